@@ -0,0 +1,165 @@
+// =============================================================================
+// Switch App Store - Host Benchmark Helpers
+// =============================================================================
+// Timing and a synthetic catalog shared by the benchmarks in bench/. The
+// catalog has the shape of the server's /api/catalog listing, so it goes
+// through the same parsers as a real refresh.
+// =============================================================================
+
+#pragma once
+
+#include "json.hpp"
+#include "store/CatalogParser.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+inline double millisSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Fastest of runs calls to body, in milliseconds
+template <typename Body>
+double bestOf(int runs, Body&& body) {
+    double best = 0.0;
+    for (int run = 0; run < runs; run++) {
+        Clock::time_point start = Clock::now();
+        body();
+        double elapsed = millisSince(start);
+        if (run == 0 || elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+// Deterministic across platforms and standard libraries (xorshift32)
+class Random {
+public:
+    explicit Random(uint32_t seed) : m_state(seed ? seed : 1) {}
+    
+    uint32_t next() {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 17;
+        m_state ^= m_state << 5;
+        return m_state;
+    }
+    
+    // In [0, bound)
+    uint32_t below(uint32_t bound) { return next() % bound; }
+
+private:
+    uint32_t m_state;
+};
+
+// -----------------------------------------------------------------------------
+// Synthetic catalog
+// -----------------------------------------------------------------------------
+
+constexpr const char* BASE_URL = "http://192.168.1.10:5090";
+
+inline const std::vector<std::string>& nameWords() {
+    static const std::vector<std::string> words = {
+        "Super", "Mario", "Zelda", "Retro", "Arch", "Kart", "Legend", "Pokemon",
+        "Tool", "Box", "Launcher", "Emu", "Star", "Fire", "Emblem", "Metroid",
+        "Kirby", "Splat", "Xeno", "Blade", "Chronicles", "Odyssey", "Party", "Tennis"
+    };
+    return words;
+}
+
+// count entries as the server's listing would send them: relative icon and
+// screenshot URLs, five categories, ten languages, some Chinese names
+inline std::string syntheticCatalog(size_t count, uint32_t seed = 1) {
+    static const char* const CATEGORIES[] = {"games", "homebrew", "emulators", "tools", "themes"};
+    static const char* const LANGUAGES[] = {"en", "zh", "ja", "ko", "fr", "de", "es", "it", "ru", "pt"};
+    static const char* const HANZI[] = {"马", "里", "奥", "塞", "尔", "达", "宝", "可", "梦", "星",
+                                        "之", "卡", "比", "动", "物", "森", "友", "会", "火", "焰"};
+    
+    const std::vector<std::string>& words = nameWords();
+    Random random(seed);
+    json::Writer writer;
+    writer.beginObject()
+        .key("success").value(true)
+        .key("data").beginObject()
+        .key("categories").beginArray();
+    for (const char* category : CATEGORIES) {
+        writer.beginObject()
+            .key("id").value(category)
+            .key("name").value(category)
+            .key("icon").value(category)
+            .endObject();
+    }
+    writer.endArray().key("games").beginArray();
+    
+    char buf[64];
+    for (size_t i = 0; i < count; i++) {
+        std::string name;
+        for (int w = 0; w < 3; w++) {
+            if (w > 0) name += ' ';
+            name += words[random.below(static_cast<uint32_t>(words.size()))];
+        }
+        if (random.below(3) == 0) {
+            name += ' ';
+            for (int c = 0; c < 3; c++) name += HANZI[random.below(20)];
+        }
+        
+        writer.beginObject();
+        snprintf(buf, sizeof(buf), "game%05zu", i);
+        writer.key("id").value(buf);
+        writer.key("name").value(name);
+        snprintf(buf, sizeof(buf), "Dev %zu", i % 300);
+        writer.key("developer").value(buf);
+        writer.key("description").value("这是一个游戏描述。 Some \"quoted\" description text\n"
+                                        "spanning a few lines, like the real ones do.\n");
+        writer.key("category").value(CATEGORIES[random.below(5)]);
+        snprintf(buf, sizeof(buf), "1.%zu.0", i % 20);
+        writer.key("version").value(buf);
+        snprintf(buf, sizeof(buf), "0100%012zX", i);
+        writer.key("titleId").value(buf);
+        snprintf(buf, sizeof(buf), "/static/icons/g%zu.png", i);
+        writer.key("iconUrl").value(buf);
+        writer.key("screenshotUrls").beginArray();
+        for (int s = 0; s < 3; s++) {
+            snprintf(buf, sizeof(buf), "/static/screenshots/g%zu_%d.png", i, s);
+            writer.value(buf);
+        }
+        writer.endArray();
+        snprintf(buf, sizeof(buf), "https://example.com/dl/g%zu.nro", i);
+        writer.key("downloadUrl").value(buf);
+        writer.key("fileSize").value((static_cast<uint64_t>(random.next()) << 1) + (1u << 20));
+        writer.key("rating").value(1.0 + random.below(41) / 10.0);
+        writer.key("downloadCount").value(random.below(200000));
+        snprintf(buf, sizeof(buf), "20%02u-%02u-%02u", 15 + random.below(11), 1 + random.below(12),
+                 1 + random.below(28));
+        writer.key("releaseDate").value(buf);
+        writer.key("languages").beginArray();
+        uint32_t first = random.below(10);
+        for (uint32_t l = 0; l < 3; l++) writer.value(LANGUAGES[(first + l * 3) % 10]);
+        writer.endArray();
+        writer.endObject();
+    }
+    
+    writer.endArray()
+        .key("total").value(count)
+        .endObject()
+        .endObject();
+    return writer.str();
+}
+
+// Parse a listing the way a refresh does (16 KB chunks, like curl's)
+inline std::vector<StoreEntry> parseEntries(const std::string& listing) {
+    CatalogParser parser(BASE_URL);
+    const size_t CHUNK = 16 * 1024;
+    for (size_t offset = 0; offset < listing.size(); offset += CHUNK) {
+        size_t size = listing.size() - offset < CHUNK ? listing.size() - offset : CHUNK;
+        if (!parser.feed(listing.data() + offset, size)) break;
+    }
+    if (!parser.finish() || !parser.isSuccess()) return std::vector<StoreEntry>();
+    return std::move(parser.getEntries());
+}
+
+} // namespace bench
@@ -0,0 +1,141 @@
+// =============================================================================
+// Switch App Store - Catalog Index Benchmark
+// =============================================================================
+// Builds a synthetic catalog (default 50000 entries) and compares the
+// lookups screens make against the scans they replaced:
+//   by id        linear scan vs std::unordered_map vs Catalog::find
+//   by titleId   linear scan vs Catalog::findByTitleId
+//   by category  scan into a new vector vs the Catalog::byCategory span
+// along with the time and memory the indexes take to build.
+//
+//   usage: index_bench [entries=50000] [runs=5]
+// =============================================================================
+
+#include "BenchCommon.hpp"
+#include "store/Catalog.hpp"
+#include <cstdlib>
+#include <unordered_map>
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 50000;
+    int runs = argc > 2 ? atoi(argv[2]) : 5;
+    
+    std::vector<StoreEntry> parsed = bench::parseEntries(bench::syntheticCatalog(count));
+    for (StoreEntry& entry : parsed) entry.sourceId = "main";
+    std::vector<StoreSource> sources(1);
+    sources[0].id = "main";
+    sources[0].url = bench::BASE_URL;
+    
+    // -------------------------------------------------------------------------
+    // Build: pack the entries and index them
+    // -------------------------------------------------------------------------
+    Catalog catalog;
+    double buildTime = bench::bestOf(runs, [&]() {
+        catalog = Catalog();
+        catalog.assign(parsed);
+        catalog.resolve(sources);
+    });
+    const EntryStore& store = catalog.entries;
+    printf("%zu entries, best of %d\n", store.size(), runs);
+    printf("  resolve (pack + indexes)   %8.2f ms\n", buildTime);
+    printf("  id / titleId index         %8zu / %zu KB\n", catalog.idIndex.memoryUsage() / 1024,
+           catalog.titleIndex.memoryUsage() / 1024);
+    printf("  category postings          %8zu KB\n", catalog.categoryPositions.size() * sizeof(uint32_t) / 1024);
+    
+    // Ids and titleIds to look up, in a scattered order
+    const size_t LOOKUPS = 20000;
+    std::vector<std::string> ids;
+    std::vector<std::string> titleIds;
+    for (size_t i = 0; i < LOOKUPS; i++) {
+        EntryView entry = store[(i * 7919) % store.size()];
+        ids.emplace_back(entry.id());
+        titleIds.emplace_back(entry.titleId());
+    }
+    
+    // -------------------------------------------------------------------------
+    // Lookups (ns per lookup; the scans only try a sample, they are slow)
+    // -------------------------------------------------------------------------
+    uint64_t checksum = 0;
+    const size_t SCANNED = 500;
+    auto perLookup = [](double millis, size_t lookups) { return millis * 1e6 / lookups; };
+    
+    double scanId = bench::bestOf(runs, [&]() {
+        for (size_t i = 0; i < SCANNED; i++) {
+            for (size_t position = 0; position < store.size(); position++) {
+                if (store[position].id() == ids[i]) {
+                    checksum += position;
+                    break;
+                }
+            }
+        }
+    });
+    
+    std::unordered_map<std::string_view, uint32_t> byId;
+    byId.reserve(store.size());
+    for (size_t position = 0; position < store.size(); position++) {
+        byId.emplace(store[position].id(), static_cast<uint32_t>(position));
+    }
+    double hashId = bench::bestOf(runs, [&]() {
+        for (const std::string& id : ids) checksum += byId.find(id)->second;
+    });
+    double indexId = bench::bestOf(runs, [&]() {
+        for (const std::string& id : ids) checksum += catalog.find(id).position();
+    });
+    
+    double scanTitle = bench::bestOf(runs, [&]() {
+        for (size_t i = 0; i < SCANNED; i++) {
+            for (size_t position = 0; position < store.size(); position++) {
+                if (store[position].titleId() == titleIds[i]) {
+                    checksum += position;
+                    break;
+                }
+            }
+        }
+    });
+    double indexTitle = bench::bestOf(runs, [&]() {
+        for (const std::string& titleId : titleIds) checksum += catalog.findByTitleId(titleId).position();
+    });
+    
+    printf("  find by id:      scan %9.1f ns  unordered_map %6.1f ns  index %6.1f ns\n",
+           perLookup(scanId, SCANNED), perLookup(hashId, LOOKUPS), perLookup(indexId, LOOKUPS));
+    printf("  find by titleId: scan %9.1f ns  index %6.1f ns\n",
+           perLookup(scanTitle, SCANNED), perLookup(indexTitle, LOOKUPS));
+    
+    // -------------------------------------------------------------------------
+    // Every category's entries, visited once
+    // -------------------------------------------------------------------------
+    const std::vector<std::string>& categories = store.categoryNames();
+    double scanCategory = bench::bestOf(runs, [&]() {
+        for (const std::string& category : categories) {
+            std::vector<EntryView> selected;
+            for (size_t position = 0; position < store.size(); position++) {
+                if (store[position].category() == category) selected.push_back(store[position]);
+            }
+            for (EntryView entry : selected) checksum += entry.downloadCount();
+        }
+    });
+    double spanCategory = bench::bestOf(runs, [&]() {
+        for (const std::string& category : categories) {
+            for (EntryView entry : catalog.byCategory(category)) checksum += entry.downloadCount();
+        }
+    });
+    printf("  all %zu categories: scan into vector %.3f ms  span %.3f ms\n",
+           categories.size(), scanCategory, spanCategory);
+    
+    // -------------------------------------------------------------------------
+    // The index must agree with the scan
+    // -------------------------------------------------------------------------
+    int bad = 0;
+    for (size_t i = 0; i < SCANNED; i++) {
+        if (catalog.find(ids[i]).id() != ids[i]) bad++;
+        if (catalog.findByTitleId(titleIds[i]).titleId() != titleIds[i]) bad++;
+    }
+    if (catalog.find("no-such-entry")) bad++;
+    size_t covered = 0;
+    for (const std::string& category : categories) covered += catalog.byCategory(category).size();
+    if (covered != store.size()) bad++;
+    
+    printf("  checksum %llu\n", static_cast<unsigned long long>(checksum));
+    if (bad) printf("%d index mismatches\n", bad);
+    return bad != 0;
+}
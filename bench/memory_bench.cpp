@@ -0,0 +1,108 @@
+// =============================================================================
+// Switch App Store - Catalog Memory Benchmark
+// =============================================================================
+// Resident memory of a synthetic catalog (default 10000 entries) held as
+// the std::vector<StoreEntry> the store used to keep, and packed into an
+// EntryStore. Each layout is built from the same parsed entries and
+// measured as the growth of the heap in use (glibc's mallinfo2) and of the
+// resident set (/proc/self/statm) after malloc_trim. Also checks that
+// unpacking the store gives the entries back.
+//
+//   usage: memory_bench [entries=10000]
+// =============================================================================
+
+#include "BenchCommon.hpp"
+#include "store/EntryStore.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <malloc.h>
+#include <unistd.h>
+
+namespace {
+
+struct Usage {
+    size_t heap = 0;
+    size_t resident = 0;
+};
+
+Usage measure() {
+    malloc_trim(0);
+    Usage usage;
+    usage.heap = mallinfo2().uordblks;
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (file) {
+        unsigned long size = 0;
+        unsigned long resident = 0;
+        if (fscanf(file, "%lu %lu", &size, &resident) == 2) {
+            usage.resident = resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+        fclose(file);
+    }
+    return usage;
+}
+
+void report(const char* label, const Usage& before, const Usage& after, size_t count) {
+    size_t heap = after.heap - before.heap;
+    long resident = static_cast<long>(after.resident) - static_cast<long>(before.resident);
+    printf("  %-22s heap %7zu KB (%4zu B/entry)  resident %+7ld KB\n", label, heap / 1024,
+           heap / count, resident / 1024);
+}
+
+// Unpacking may list an entry's languages in another order
+bool sameEntry(StoreEntry a, StoreEntry b) {
+    std::sort(a.languages.begin(), a.languages.end());
+    std::sort(b.languages.begin(), b.languages.end());
+    return a.id == b.id && a.name == b.name && a.developer == b.developer &&
+           a.description == b.description && a.category == b.category && a.version == b.version &&
+           a.titleId == b.titleId && a.iconUrl == b.iconUrl && a.screenshotUrls == b.screenshotUrls &&
+           a.downloadUrl == b.downloadUrl && a.fileSize == b.fileSize && a.rating == b.rating &&
+           a.downloadCount == b.downloadCount && a.releaseDate == b.releaseDate &&
+           a.releaseDay == b.releaseDay && a.languages == b.languages && a.sourceId == b.sourceId;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 10000;
+    
+    std::vector<StoreEntry> parsed = bench::parseEntries(bench::syntheticCatalog(count));
+    for (StoreEntry& entry : parsed) entry.sourceId = "main";
+    if (parsed.empty()) {
+        printf("no entries parsed\n");
+        return 1;
+    }
+    printf("%zu entries\n", parsed.size());
+    
+    // -------------------------------------------------------------------------
+    // Before: one StoreEntry per game
+    // -------------------------------------------------------------------------
+    Usage before = measure();
+    {
+        std::vector<StoreEntry> entries = parsed;
+        report("vector<StoreEntry>", before, measure(), parsed.size());
+    }
+    
+    // -------------------------------------------------------------------------
+    // After: packed
+    // -------------------------------------------------------------------------
+    before = measure();
+    bench::Clock::time_point start = bench::Clock::now();
+    EntryStore store(parsed);
+    double packTime = bench::millisSince(start);
+    report("EntryStore", before, measure(), parsed.size());
+    printf("  EntryStore::memoryUsage %zu KB, packed in %.2f ms\n", store.memoryUsage() / 1024, packTime);
+    
+    // -------------------------------------------------------------------------
+    // The store must give the entries back
+    // -------------------------------------------------------------------------
+    start = bench::Clock::now();
+    std::vector<StoreEntry> unpacked = store.unpack();
+    printf("  unpacked in %.2f ms\n", bench::millisSince(start));
+    
+    int bad = unpacked.size() == parsed.size() ? 0 : 1;
+    for (size_t i = 0; i < unpacked.size() && i < parsed.size(); i++) {
+        if (!sameEntry(parsed[i], unpacked[i])) bad++;
+    }
+    if (bad) printf("%d entries differ after unpacking\n", bad);
+    return bad != 0;
+}
@@ -0,0 +1,59 @@
+// =============================================================================
+// Switch App Store - Catalog Parse Benchmark
+// =============================================================================
+// Parses a synthetic catalog listing three ways and reports the best of
+// several runs:
+//   json::parse          the original byte-at-a-time Value parser
+//   json::parseDocument  structural scanner feeding the arena DOM
+//   CatalogParser        the streaming parser a refresh uses
+// parse_bench_scalar is the same program with JSON_NO_SIMD, to separate
+// what the vector scanner gives from the rest of the parser.
+//
+//   usage: parse_bench [entries=5000] [runs=10]
+// =============================================================================
+
+#include "BenchCommon.hpp"
+#include <cstdlib>
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 5000;
+    int runs = argc > 2 ? atoi(argv[2]) : 10;
+    
+    std::string listing = bench::syntheticCatalog(count);
+    double megabytes = listing.size() / (1024.0 * 1024.0);
+#if defined(JSON_SIMD_NEON)
+    const char* scanner = "NEON";
+#elif defined(JSON_SIMD_SSE2)
+    const char* scanner = "SSE2";
+#else
+    const char* scanner = "scalar";
+#endif
+    printf("%zu entries, %.2f MB, %s scanner, best of %d\n", count, megabytes, scanner, runs);
+    
+    // The three must agree before their times mean anything
+    size_t games[3] = {0, 0, 0};
+    double times[3];
+    times[0] = bench::bestOf(runs, [&]() {
+        json::Value root = json::parse(listing);
+        games[0] = root["data"]["games"].size();
+    });
+    times[1] = bench::bestOf(runs, [&]() {
+        json::Document root = json::parseDocument(listing);
+        games[1] = root["data"]["games"].size();
+    });
+    times[2] = bench::bestOf(runs, [&]() {
+        games[2] = bench::parseEntries(listing).size();
+    });
+    
+    const char* names[3] = {"json::parse", "json::parseDocument", "CatalogParser"};
+    for (int i = 0; i < 3; i++) {
+        printf("  %-20s %8.2f ms  %7.1f MB/s  %5.2fx\n", names[i], times[i], megabytes / (times[i] / 1000.0),
+               times[0] / times[i]);
+    }
+    
+    if (games[0] != count || games[1] != count || games[2] != count) {
+        printf("entry counts differ: %zu %zu %zu\n", games[0], games[1], games[2]);
+        return 1;
+    }
+    return 0;
+}
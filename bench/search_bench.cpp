@@ -0,0 +1,156 @@
+// =============================================================================
+// Switch App Store - Typo-Tolerant Search Benchmark
+// =============================================================================
+// TrigramIndex against brute force on a vocabulary of made-up words
+// (default 20000): every query is a vocabulary word with one or two
+// random edits, looked up with k = 2. The index must return exactly the
+// brute force matches: its candidate filters may only skip work, never a
+// word within k.
+// Then whole Catalog::search calls with misspelled queries, the way the
+// search screen runs them, on a synthetic catalog (default 10000 entries).
+//
+//   usage: search_bench [words=20000] [entries=10000] [runs=5]
+// =============================================================================
+
+#include "BenchCommon.hpp"
+#include "store/Catalog.hpp"
+#include "store/TrigramIndex.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+
+namespace {
+
+// Pronounceable lowercase words of 4 to 12 letters, like romanized titles
+std::string makeWord(bench::Random& random) {
+    static const char* const ONSETS[] = {"b", "ch", "d", "f", "g", "h", "k", "l", "m", "n",
+                                         "p", "r", "s", "sh", "t", "v", "z", "tr", "st", "br"};
+    static const char* const VOWELS[] = {"a", "e", "i", "o", "u", "ai", "ou", "ia"};
+    std::string word;
+    size_t syllables = 2 + random.below(3);
+    for (size_t s = 0; s < syllables; s++) {
+        word += ONSETS[random.below(20)];
+        word += VOWELS[random.below(8)];
+    }
+    if (random.below(2) == 0) word += "nrx"[random.below(3)];
+    return word;
+}
+
+// word with an insertion, deletion, substitution or adjacent swap
+std::string misspell(std::string word, bench::Random& random) {
+    size_t at = random.below(static_cast<uint32_t>(word.size()));
+    char letter = static_cast<char>('a' + random.below(26));
+    switch (random.below(4)) {
+    case 0: word.insert(word.begin() + at, letter); break;
+    case 1: if (word.size() > 3) word.erase(at, 1); break;
+    case 2: word[at] = letter; break;
+    default: if (at + 1 < word.size()) std::swap(word[at], word[at + 1]); break;
+    }
+    return word;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t wordCount = argc > 1 ? strtoul(argv[1], nullptr, 10) : 20000;
+    size_t entryCount = argc > 2 ? strtoul(argv[2], nullptr, 10) : 10000;
+    int runs = argc > 3 ? atoi(argv[3]) : 5;
+    const uint32_t MAX_DISTANCE = 2;
+    
+    // -------------------------------------------------------------------------
+    // Vocabulary and misspelled queries
+    // -------------------------------------------------------------------------
+    bench::Random random(7);
+    std::set<std::string> distinct;
+    while (distinct.size() < wordCount) distinct.insert(makeWord(random));
+    std::vector<std::string> vocabulary(distinct.begin(), distinct.end());
+    
+    std::vector<TrigramIndex::Word> words;
+    for (size_t i = 0; i < vocabulary.size(); i++) {
+        words.push_back(TrigramIndex::Word{static_cast<uint32_t>(i), vocabulary[i]});
+    }
+    
+    const size_t QUERIES = 1000;
+    std::vector<std::string> queries;
+    std::vector<uint32_t> meant;                        // Word each query misspells
+    for (size_t i = 0; i < QUERIES; i++) {
+        meant.push_back(random.below(static_cast<uint32_t>(vocabulary.size())));
+        std::string query = misspell(vocabulary[meant.back()], random);
+        if (random.below(2) == 0) query = misspell(query, random);
+        queries.push_back(query);
+    }
+    
+    TrigramIndex index;
+    double buildTime = bench::bestOf(runs, [&]() {
+        index = TrigramIndex();
+        index.build(words);
+    });
+    printf("%zu words, %zu queries, k = %u, best of %d\n", vocabulary.size(), QUERIES, MAX_DISTANCE, runs);
+    printf("  trigram index build %.2f ms, %zu KB\n", buildTime, index.memoryUsage() / 1024);
+    
+    // -------------------------------------------------------------------------
+    // Lookups: brute force verifies every word, the index only candidates
+    // -------------------------------------------------------------------------
+    std::vector<std::vector<uint32_t>> bruteMatches(QUERIES);
+    std::vector<std::vector<uint32_t>> indexMatches(QUERIES);
+    double bruteTime = bench::bestOf(runs, [&]() {
+        for (size_t q = 0; q < QUERIES; q++) {
+            bruteMatches[q].clear();
+            for (size_t i = 0; i < vocabulary.size(); i++) {
+                if (TrigramIndex::boundedDistance(queries[q], vocabulary[i], MAX_DISTANCE) <= MAX_DISTANCE) {
+                    bruteMatches[q].push_back(static_cast<uint32_t>(i));
+                }
+            }
+        }
+    });
+    size_t matched = 0;
+    double indexTime = bench::bestOf(runs, [&]() {
+        matched = 0;
+        for (size_t q = 0; q < QUERIES; q++) {
+            indexMatches[q].clear();
+            for (const TrigramIndex::Match& match : index.find(queries[q], MAX_DISTANCE)) {
+                indexMatches[q].push_back(match.id);
+            }
+            matched += indexMatches[q].size();
+        }
+    });
+    printf("  brute force   %8.1f us/query\n", bruteTime * 1000.0 / QUERIES);
+    printf("  trigram index %8.1f us/query  (%.2f matches/query)\n", indexTime * 1000.0 / QUERIES,
+           static_cast<double>(matched) / QUERIES);
+    
+    int bad = 0;
+    size_t intended = 0;
+    for (size_t q = 0; q < QUERIES; q++) {
+        std::sort(indexMatches[q].begin(), indexMatches[q].end());
+        if (indexMatches[q] != bruteMatches[q] && bad++ < 3) {
+            printf("  \"%s\": %zu index matches, %zu brute force\n", queries[q].c_str(),
+                   indexMatches[q].size(), bruteMatches[q].size());
+        }
+        intended += std::binary_search(indexMatches[q].begin(), indexMatches[q].end(), meant[q]);
+    }
+    printf("  same matches as brute force for %zu of %zu; the misspelled word found for %zu\n",
+           QUERIES - std::min<size_t>(bad, QUERIES), QUERIES, intended);
+    
+    // -------------------------------------------------------------------------
+    // Catalog::search with typos, as typed into the search screen
+    // -------------------------------------------------------------------------
+    std::vector<StoreEntry> parsed = bench::parseEntries(bench::syntheticCatalog(entryCount));
+    for (StoreEntry& entry : parsed) entry.sourceId = "main";
+    std::vector<StoreSource> sources(1);
+    sources[0].id = "main";
+    Catalog catalog;
+    catalog.assign(std::move(parsed));
+    catalog.resolve(sources);
+    
+    const char* const TYPOS[] = {"zelad", "legnd", "pokmon", "metriod", "odysey chronicels", "kriby"};
+    printf("  Catalog::search on %zu entries:\n", catalog.entries.size());
+    for (const char* typo : TYPOS) {
+        size_t hits = 0;
+        double searchTime = bench::bestOf(runs, [&]() { hits = catalog.search(typo, 50).size(); });
+        printf("    %-20s %7.1f us  %zu hits\n", typo, searchTime * 1000.0, hits);
+        if (hits == 0) bad++;
+    }
+    
+    if (bad) printf("%d failures\n", bad);
+    return bad != 0;
+}
@@ -0,0 +1,256 @@
+// =============================================================================
+// Switch App Store - TLS Connection Reuse Benchmark
+// =============================================================================
+// Runs the same request patterns against the stand-in server in TLS mode
+// twice: on bare curl easy handles, each with its own caches (how every
+// subsystem used to talk to the server), and through HttpClient and
+// HttpEngine, which share DNS and TLS sessions process-wide and multiplex
+// over HTTP/2. The stand-in counts the handshakes it saw and how many of
+// them resumed a session.
+//
+//   openssl req -x509 -newkey rsa:2048 -nodes -subj /CN=localhost -keyout key.pem -out cert.pem
+//   node server/tools/standin.js 3443 --tls cert.pem key.pem
+//   bench/build/tls_bench https://127.0.0.1:3443 [runs=3]
+//
+// Not part of `make run`, since it needs the server.
+// =============================================================================
+
+#include "BenchCommon.hpp"
+#include "network/HttpClient.hpp"
+#include "network/HttpEngine.hpp"
+#include <curl/curl.h>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+namespace {
+
+std::string s_baseUrl;
+int s_failures = 0;
+
+size_t discardBody(char* /* data */, size_t size, size_t nmemb, void* /* userp */) {
+    return size * nmemb;
+}
+
+size_t appendBody(char* data, size_t size, size_t nmemb, void* userp) {
+    static_cast<std::string*>(userp)->append(data, size * nmemb);
+    return size * nmemb;
+}
+
+// A handle with curl's defaults and nothing shared
+CURL* isolatedHandle() {
+    CURL* curl = curl_easy_init();
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, discardBody);
+    return curl;
+}
+
+void isolatedGet(CURL* curl, const std::string& path) {
+    curl_easy_setopt(curl, CURLOPT_URL, (s_baseUrl + path).c_str());
+    long status = 0;
+    if (curl_easy_perform(curl) != CURLE_OK ||
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status) != CURLE_OK || status != 200) {
+        s_failures++;
+    }
+}
+
+// count concurrent GETs of path on a new multi handle, each on an
+// isolated handle (how getStreamedAll used to run a batch)
+void isolatedBatch(int count, const std::string& path) {
+    CURLM* multi = curl_multi_init();
+    std::vector<CURL*> handles;
+    for (int i = 0; i < count; i++) {
+        CURL* curl = isolatedHandle();
+        curl_easy_setopt(curl, CURLOPT_URL, (s_baseUrl + path).c_str());
+        curl_multi_add_handle(multi, curl);
+        handles.push_back(curl);
+    }
+    int running = 1;
+    while (running > 0) {
+        curl_multi_perform(multi, &running);
+        if (running > 0) curl_multi_poll(multi, nullptr, 0, 100, nullptr);
+    }
+    for (CURL* curl : handles) {
+        long status = 0;
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status);
+        if (status != 200) s_failures++;
+        curl_multi_remove_handle(multi, curl);
+        curl_easy_cleanup(curl);
+    }
+    curl_multi_cleanup(multi);
+}
+
+// The stand-in's counters, read and reset over a connection of their own
+// (HTTP/1.1, so it adds no HTTP/2 session). That connection's handshake is
+// the one subtracted in measure().
+std::string control(const char* path, bool post) {
+    CURL* curl = isolatedHandle();
+    std::string body;
+    curl_easy_setopt(curl, CURLOPT_URL, (s_baseUrl + path).c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, appendBody);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &body);
+    if (post) curl_easy_setopt(curl, CURLOPT_POSTFIELDS, "");
+    curl_easy_perform(curl);
+    curl_easy_cleanup(curl);
+    return body;
+}
+
+struct Result {
+    int requests = 0;
+    double millis = 0.0;
+    long handshakes = 0;
+    long resumed = 0;
+    long http2Sessions = 0;
+    
+    long full() const { return handshakes - resumed; }
+    double perRequest() const { return millis / requests; }
+};
+
+template <typename Body>
+Result measure(int requests, Body&& body) {
+    control("/stats/reset", true);
+    Result result;
+    result.requests = requests;
+    bench::Clock::time_point start = bench::Clock::now();
+    body();
+    result.millis = bench::millisSince(start);
+    
+    json::Document stats = json::parseDocument(control("/stats", false));
+    result.handshakes = stats["handshakes"].asInt() - 1;
+    result.resumed = stats["resumed"].asInt();
+    result.http2Sessions = stats["http2Sessions"].asInt();
+    return result;
+}
+
+void report(const char* scenario, const Result& before, const Result& after) {
+    printf("%s, %d requests\n", scenario, before.requests);
+    const Result* results[] = {&before, &after};
+    const char* labels[] = {"isolated handles", "shared"};
+    for (int i = 0; i < 2; i++) {
+        const Result& r = *results[i];
+        printf("  %-16s %8.2f ms  %6.3f ms/request  handshakes %3ld (%3ld full, %3ld resumed)  h2 %ld\n",
+               labels[i], r.millis, r.perRequest(), r.handshakes, r.full(), r.resumed, r.http2Sessions);
+    }
+    printf("  full handshakes avoided %ld, %.3f ms saved per request\n",
+           before.full() - after.full(), before.perRequest() - after.perRequest());
+}
+
+// Each shared run starts from an empty session cache
+void resetShare() {
+    HttpClient::cleanup();
+    HttpClient::init();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printf("usage: tls_bench <https://host:port> [runs=3]\n");
+        return 1;
+    }
+    s_baseUrl = argv[1];
+    int runs = argc > 2 ? atoi(argv[2]) : 3;
+    HttpClient::init();
+    
+    for (int run = 0; run < runs; run++) {
+        printf("--- run %d\n", run + 1);
+        
+        // ---------------------------------------------------------------------
+        // One-off requests (icons, download reports): a new handle each
+        // ---------------------------------------------------------------------
+        const int ONE_OFF = 40;
+        Result before = measure(ONE_OFF, []() {
+            for (int i = 0; i < ONE_OFF; i++) {
+                CURL* curl = isolatedHandle();
+                isolatedGet(curl, "/bytes/2048");
+                curl_easy_cleanup(curl);
+            }
+        });
+        resetShare();
+        Result after = measure(ONE_OFF, []() {
+            for (int i = 0; i < ONE_OFF; i++) {
+                HttpClient client;
+                if (!client.get(s_baseUrl + "/bytes/2048").isSuccess()) s_failures++;
+            }
+        });
+        report("new handle per request", before, after);
+        
+        // ---------------------------------------------------------------------
+        // Three long-lived subsystems taking turns
+        // ---------------------------------------------------------------------
+        const int TURNS = 30;
+        before = measure(TURNS, []() {
+            CURL* handles[3];
+            for (CURL*& curl : handles) curl = isolatedHandle();
+            for (int i = 0; i < TURNS; i++) isolatedGet(handles[i % 3], "/bytes/2048");
+            for (CURL* curl : handles) curl_easy_cleanup(curl);
+        });
+        resetShare();
+        after = measure(TURNS, []() {
+            std::unique_ptr<HttpClient> clients[3];
+            for (auto& client : clients) client.reset(new HttpClient());
+            for (int i = 0; i < TURNS; i++) {
+                if (!clients[i % 3]->get(s_baseUrl + "/bytes/2048").isSuccess()) s_failures++;
+            }
+        });
+        report("3 clients taking turns", before, after);
+        
+        // ---------------------------------------------------------------------
+        // Catalog refresh: batches of streamed GETs
+        // ---------------------------------------------------------------------
+        const int BATCHES = 10;
+        const int BATCH_SIZE = 4;
+        before = measure(BATCHES * BATCH_SIZE, []() {
+            for (int b = 0; b < BATCHES; b++) isolatedBatch(BATCH_SIZE, "/bytes/16384");
+        });
+        resetShare();
+        after = measure(BATCHES * BATCH_SIZE, []() {
+            HttpClient client;
+            for (int b = 0; b < BATCHES; b++) {
+                std::vector<HttpStreamRequest> requests(BATCH_SIZE);
+                for (HttpStreamRequest& request : requests) {
+                    request.url = s_baseUrl + "/bytes/16384";
+                    request.onData = [](const char* /* data */, size_t /* size */) { return true; };
+                }
+                client.getStreamedAll(requests);
+                for (const HttpStreamRequest& request : requests) {
+                    if (!request.response.isSuccess()) s_failures++;
+                }
+            }
+        });
+        report("refresh, 10 batches of 4 streamed GETs", before, after);
+        
+        // ---------------------------------------------------------------------
+        // A burst of concurrent requests (a screen's worth of icons)
+        // ---------------------------------------------------------------------
+        const int BURST = 24;
+        before = measure(BURST, []() { isolatedBatch(BURST, "/delay/20"); });
+        resetShare();
+        after = measure(BURST, []() {
+            HttpEngine& engine = HttpEngine::getInstance();
+            engine.start();
+            int done = 0;
+            for (int i = 0; i < BURST; i++) {
+                HttpRequest request;
+                request.url = s_baseUrl + "/delay/20";
+                request.onComplete = [&done](const HttpResponse& response) {
+                    if (!response.isSuccess()) s_failures++;
+                    done++;
+                };
+                engine.submit(std::move(request));
+            }
+            while (done < BURST) {
+                engine.pump();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            engine.stop();
+        });
+        report("burst of 24 on a multi handle / HttpEngine", before, after);
+    }
+    
+    HttpClient::cleanup();
+    if (s_failures) printf("%d requests failed\n", s_failures);
+    return s_failures != 0;
+}
@@ -8,17 +8,39 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
+#include <memory>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <cctype>
+#include <cmath>
+#include <charconv>
+#include <system_error>
+#include <type_traits>
+
+// Define JSON_NO_SIMD to build the scalar structural scanner everywhere
+// (bench/ compares the two)
+#if defined(JSON_NO_SIMD)
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define JSON_SIMD_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define JSON_SIMD_SSE2 1
+#endif
 
 namespace json {
 
 // =============================================================================
 // JSON Value Types
 // =============================================================================
-enum class ValueType {
+enum class ValueType : uint8_t {
     Null,
     Bool,
     Number,
@@ -27,6 +49,582 @@ enum class ValueType {
     Object
 };
 
+// =============================================================================
+// Number - Parsed numeric value
+// =============================================================================
+// Integers that fit 64 bits are kept exact (file sizes above 2^53 are
+// plausible); everything else is stored as a double.
+// =============================================================================
+struct Number {
+    enum class Kind : uint8_t { Double, Int64, UInt64 };
+    
+    Kind kind = Kind::Double;
+    union {
+        double real = 0.0;
+        int64_t int64;
+        uint64_t uint64;
+    };
+    
+    bool isInteger() const { return kind != Kind::Double; }
+    
+    double toDouble() const {
+        switch (kind) {
+            case Kind::Int64: return static_cast<double>(int64);
+            case Kind::UInt64: return static_cast<double>(uint64);
+            default: return real;
+        }
+    }
+    
+    // Saturates instead of wrapping when the value does not fit
+    int64_t toInt64() const {
+        switch (kind) {
+            case Kind::Int64: return int64;
+            case Kind::UInt64: return uint64 > static_cast<uint64_t>(INT64_MAX) ? INT64_MAX
+                                                                               : static_cast<int64_t>(uint64);
+            default:
+                if (!(real > -9223372036854775808.0)) return real != real ? 0 : INT64_MIN;
+                if (real >= 9223372036854775808.0) return INT64_MAX;
+                return static_cast<int64_t>(real);
+        }
+    }
+    
+    uint64_t toUInt64() const {
+        switch (kind) {
+            case Kind::Int64: return int64 < 0 ? 0 : static_cast<uint64_t>(int64);
+            case Kind::UInt64: return uint64;
+            default:
+                if (!(real > 0.0)) return 0;
+                if (real >= 18446744073709551616.0) return UINT64_MAX;
+                return static_cast<uint64_t>(real);
+        }
+    }
+};
+
+// =============================================================================
+// Shared helpers
+// =============================================================================
+namespace detail {
+
+inline bool isWhitespace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+inline int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+inline void appendUtf8(std::string& out, uint32_t cp) {
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Decode the raw contents of a JSON string (without quotes) into out
+// -----------------------------------------------------------------------------
+inline void unescape(std::string_view raw, std::string& out) {
+    out.reserve(out.size() + raw.size());
+    
+    size_t i = 0;
+    while (i < raw.size()) {
+        // Copy the run up to the next escape in one go
+        size_t next = raw.find('\\', i);
+        if (next == std::string_view::npos) next = raw.size();
+        out.append(raw.data() + i, next - i);
+        i = next;
+        if (i + 1 >= raw.size()) break;
+        
+        char escaped = raw[i + 1];
+        i += 2;
+        switch (escaped) {
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                auto readHex4 = [&](size_t at, uint32_t& value) {
+                    if (at + 4 > raw.size()) return false;
+                    value = 0;
+                    for (size_t k = 0; k < 4; k++) {
+                        int h = hexValue(raw[at + k]);
+                        if (h < 0) return false;
+                        value = (value << 4) | static_cast<uint32_t>(h);
+                    }
+                    return true;
+                };
+                
+                uint32_t cp = 0;
+                if (!readHex4(i, cp)) {
+                    out += '?';
+                    break;
+                }
+                i += 4;
+                
+                // Combine UTF-16 surrogate pairs
+                if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < raw.size() &&
+                    raw[i] == '\\' && raw[i + 1] == 'u') {
+                    uint32_t low = 0;
+                    if (readHex4(i + 2, low) && low >= 0xDC00 && low <= 0xDFFF) {
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                        i += 6;
+                    }
+                }
+                if (cp >= 0xD800 && cp <= 0xDFFF) cp = 0xFFFD;  // Lone surrogate
+                appendUtf8(out, cp);
+                break;
+            }
+            default: out += escaped; break;  // '"', '\\', '/'
+        }
+    }
+}
+
+inline bool isDigit(char c) {
+    return static_cast<unsigned char>(c - '0') < 10;
+}
+
+// -----------------------------------------------------------------------------
+// Power of ten of a decimal's first significant digit (1.5e3 -> 3, 0.02 -> -2;
+// 0 for zero). Only the sign matters to callers, so huge exponents saturate.
+// -----------------------------------------------------------------------------
+inline long decimalExponent(const char* text, const char* end) {
+    const char* p = text;
+    if (p < end && *p == '-') p++;
+    
+    // Where the first nonzero digit sits relative to the decimal point
+    const char* integer = p;
+    while (p < end && isDigit(*p)) p++;
+    const char* integerEnd = p;
+    long magnitude = 0;
+    bool significant = false;
+    for (const char* q = integer; q < integerEnd && !significant; q++) {
+        if (*q != '0') {
+            magnitude = static_cast<long>(integerEnd - q) - 1;
+            significant = true;
+        }
+    }
+    if (p < end && *p == '.') {
+        const char* fraction = ++p;
+        while (p < end && isDigit(*p)) {
+            if (!significant && *p != '0') {
+                magnitude = -static_cast<long>(p - fraction) - 1;
+                significant = true;
+            }
+            p++;
+        }
+    }
+    if (!significant) return 0;
+    
+    long exponent = 0;
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negative = p < end && *p == '-';
+        if (p < end && (*p == '-' || *p == '+')) p++;
+        for (; p < end && isDigit(*p); p++) {
+            if (exponent < 1000000) exponent = exponent * 10 + (*p - '0');
+        }
+        if (negative) exponent = -exponent;
+    }
+    return magnitude + exponent;
+}
+
+// -----------------------------------------------------------------------------
+// Slow path for decimals the fast path cannot round exactly
+// -----------------------------------------------------------------------------
+inline bool convertDecimal(const char* text, const char* end, double& out) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    // Locale independent and correctly rounded (Eisel-Lemire in libstdc++)
+    auto result = std::from_chars(text, end, out);
+    if (result.ec == std::errc::result_out_of_range && result.ptr == end) {
+        // Too large is infinite, too small a zero, keeping the sign either way
+        bool negative = *text == '-';
+        if (decimalExponent(text, end) >= 0) out = negative ? -HUGE_VAL : HUGE_VAL;
+        else out = negative ? -0.0 : 0.0;
+        return true;
+    }
+    return result.ec == std::errc() && result.ptr == end;
+#else
+    size_t length = static_cast<size_t>(end - text);
+    if (length >= 128) return false;
+    
+    // Token views are not guaranteed to be NUL-terminated
+    char buffer[128];
+    std::memcpy(buffer, text, length);
+    buffer[length] = '\0';
+    out = std::strtod(buffer, nullptr);
+    return true;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Parse an RFC 8259 number starting at text.
+// Returns the end of the token, or nullptr if the grammar is violated.
+// -----------------------------------------------------------------------------
+inline const char* parseNumber(const char* text, const char* end, Number& out) {
+    // Exactly representable powers of ten
+    static const double POW10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    
+    const char* p = text;
+    bool negative = false;
+    if (p < end && *p == '-') {
+        negative = true;
+        p++;
+    }
+    
+    // int = zero / ( digit1-9 *DIGIT )
+    if (p >= end || !isDigit(*p)) return nullptr;
+    
+    uint64_t mantissa = 0;
+    int digits = 0;                 // Significant digits accumulated
+    int dropped = 0;                // Integer digits beyond the 19 that fit
+    bool truncated = false;         // A non-zero digit was dropped
+    if (*p == '0') {
+        p++;
+    } else {
+        while (p < end && isDigit(*p)) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                digits++;
+            } else {
+                dropped++;
+                truncated |= *p != '0';
+            }
+            p++;
+        }
+    }
+    
+    // frac = decimal-point 1*DIGIT
+    int fractionDigits = 0;
+    bool isDecimal = false;
+    if (p < end && *p == '.') {
+        isDecimal = true;
+        p++;
+        if (p >= end || !isDigit(*p)) return nullptr;
+        while (p < end && isDigit(*p)) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                if (mantissa != 0) digits++;
+                fractionDigits++;
+            } else {
+                truncated |= *p != '0';
+            }
+            p++;
+        }
+    }
+    
+    // exp = e [ minus / plus ] 1*DIGIT
+    int64_t exponent = 0;
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        isDecimal = true;
+        p++;
+        bool negativeExp = false;
+        if (p < end && (*p == '+' || *p == '-')) {
+            negativeExp = *p == '-';
+            p++;
+        }
+        if (p >= end || !isDigit(*p)) return nullptr;
+        while (p < end && isDigit(*p)) {
+            if (exponent < 100000) exponent = exponent * 10 + (*p - '0');
+            p++;
+        }
+        if (negativeExp) exponent = -exponent;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Integer fast path: exact 64-bit value
+    // -------------------------------------------------------------------------
+    if (!isDecimal && dropped <= 1) {
+        // Only a 20th digit can have been dropped here
+        bool fits = true;
+        if (dropped == 1) {
+            // A 20th digit still fits an unsigned 64-bit value if no overflow
+            uint64_t last = static_cast<uint64_t>(p[-1] - '0');
+            if (mantissa > (UINT64_MAX - last) / 10) {
+                fits = false;
+            } else {
+                mantissa = mantissa * 10 + last;
+            }
+        }
+        if (fits && !negative) {
+            if (mantissa <= static_cast<uint64_t>(INT64_MAX)) {
+                out.kind = Number::Kind::Int64;
+                out.int64 = static_cast<int64_t>(mantissa);
+            } else {
+                out.kind = Number::Kind::UInt64;
+                out.uint64 = mantissa;
+            }
+            return p;
+        }
+        if (fits && mantissa != 0 && mantissa <= static_cast<uint64_t>(INT64_MAX) + 1) {
+            out.kind = Number::Kind::Int64;
+            out.int64 = static_cast<int64_t>(0 - mantissa);
+            return p;
+        }
+        // "-0" and out-of-range integers continue as doubles
+    }
+    
+    // -------------------------------------------------------------------------
+    // Clinger fast path: mantissa and power of ten are both exact doubles
+    // -------------------------------------------------------------------------
+    int64_t power = exponent - fractionDigits + dropped;
+    out.kind = Number::Kind::Double;
+    if (!truncated && mantissa <= (1ULL << 53) && power >= -22 && power <= 22) {
+        double value = static_cast<double>(mantissa);
+        value = power < 0 ? value / POW10[-power] : value * POW10[power];
+        out.real = negative ? -value : value;
+        return p;
+    }
+    
+    // Pathological inputs (long mantissas, huge exponents)
+    return convertDecimal(text, p, out.real) ? p : nullptr;
+}
+
+// =============================================================================
+// SIMD structural scanning
+// =============================================================================
+// Classifies 16 bytes at a time (NEON on the Switch, SSE2 on x86 hosts,
+// scalar elsewhere) in the style of simdjson's stage 1. The resulting
+// structural index lists, in order, every unescaped quote, every
+// {}[]:, outside strings and the first byte of every number/literal, so the
+// tree builder never has to look at whitespace or string contents.
+// =============================================================================
+
+// Bit masks for one 16-byte block (bit i = byte i)
+struct BlockMasks {
+    uint32_t quote = 0;
+    uint32_t backslash = 0;
+    uint32_t op = 0;            // { } [ ] : ,
+    uint32_t whitespace = 0;
+};
+
+#if defined(JSON_SIMD_NEON)
+
+inline uint32_t movemask(uint8x16_t cmp) {
+    static const uint8_t kBits[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                      1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t masked = vandq_u8(cmp, vld1q_u8(kBits));
+    return static_cast<uint32_t>(vaddv_u8(vget_low_u8(masked))) |
+           (static_cast<uint32_t>(vaddv_u8(vget_high_u8(masked))) << 8);
+}
+
+inline BlockMasks classifyBlock(const char* p) {
+    uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+    auto eq = [](uint8x16_t x, char c) { return vceqq_u8(x, vdupq_n_u8(static_cast<uint8_t>(c))); };
+    
+    // '[' / ']' differ from '{' / '}' only in bit 0x20
+    uint8x16_t folded = vorrq_u8(v, vdupq_n_u8(0x20));
+    
+    BlockMasks m;
+    m.quote = movemask(eq(v, '"'));
+    m.backslash = movemask(eq(v, '\\'));
+    m.op = movemask(vorrq_u8(vorrq_u8(eq(folded, '{'), eq(folded, '}')),
+                             vorrq_u8(eq(v, ':'), eq(v, ','))));
+    // Everything <= 0x20 counts as whitespace (control characters are
+    // never valid outside strings)
+    m.whitespace = movemask(vcleq_u8(v, vdupq_n_u8(0x20)));
+    return m;
+}
+
+// Mask of bytes in a block that are '"' or '\\'
+inline uint32_t quoteOrBackslash(const char* p) {
+    uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+    return movemask(vorrq_u8(vceqq_u8(v, vdupq_n_u8('"')), vceqq_u8(v, vdupq_n_u8('\\'))));
+}
+
+#elif defined(JSON_SIMD_SSE2)
+
+inline BlockMasks classifyBlock(const char* p) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    auto eq = [](__m128i x, char c) { return _mm_cmpeq_epi8(x, _mm_set1_epi8(c)); };
+    
+    // '[' / ']' differ from '{' / '}' only in bit 0x20
+    __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    
+    BlockMasks m;
+    m.quote = static_cast<uint32_t>(_mm_movemask_epi8(eq(v, '"')));
+    m.backslash = static_cast<uint32_t>(_mm_movemask_epi8(eq(v, '\\')));
+    m.op = static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_or_si128(_mm_or_si128(eq(folded, '{'), eq(folded, '}')),
+                     _mm_or_si128(eq(v, ':'), eq(v, ',')))));
+    // Unsigned v <= 0x20 (SSE2 has no unsigned compare, so use min)
+    m.whitespace = static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(0x20)), v)));
+    return m;
+}
+
+inline uint32_t quoteOrBackslash(const char* p) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')))));
+}
+
+#else
+
+inline BlockMasks classifyBlock(const char* p) {
+    BlockMasks m;
+    for (int i = 0; i < 16; i++) {
+        uint32_t bit = 1u << i;
+        switch (p[i]) {
+            case '"': m.quote |= bit; break;
+            case '\\': m.backslash |= bit; break;
+            case '{': case '}': case '[': case ']': case ':': case ',': m.op |= bit; break;
+            default:
+                if (static_cast<unsigned char>(p[i]) <= 0x20) m.whitespace |= bit;
+                break;
+        }
+    }
+    return m;
+}
+
+inline uint32_t quoteOrBackslash(const char* p) {
+    uint32_t mask = 0;
+    for (int i = 0; i < 16; i++) {
+        if (p[i] == '"' || p[i] == '\\') mask |= 1u << i;
+    }
+    return mask;
+}
+
+#endif
+
+inline int countTrailingZeros(uint64_t x) { return __builtin_ctzll(x); }
+
+// -----------------------------------------------------------------------------
+// First '"' or '\\' in [p, end), or end if there is none
+// -----------------------------------------------------------------------------
+inline const char* findQuoteOrBackslash(const char* p, const char* end) {
+    while (end - p >= 16) {
+        uint32_t mask = quoteOrBackslash(p);
+        if (mask) return p + countTrailingZeros(mask);
+        p += 16;
+    }
+    while (p < end && *p != '"' && *p != '\\') p++;
+    return p;
+}
+
+// -----------------------------------------------------------------------------
+// Running xor of all lower bits: marks the bytes between quote pairs
+// -----------------------------------------------------------------------------
+inline uint64_t prefixXor(uint64_t x) {
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+// -----------------------------------------------------------------------------
+// Mask of characters escaped by a backslash run, carrying across blocks
+// -----------------------------------------------------------------------------
+inline uint64_t findEscaped(uint64_t backslash, uint64_t& prevEscaped) {
+    const uint64_t evenBits = 0x5555555555555555ULL;
+    
+    backslash &= ~prevEscaped;
+    uint64_t followsEscape = (backslash << 1) | prevEscaped;
+    
+    // Backslash runs that start on an odd bit
+    uint64_t oddStarts = backslash & ~evenBits & ~followsEscape;
+    uint64_t sequencesOnEven = oddStarts + backslash;
+    prevEscaped = sequencesOnEven < oddStarts ? 1 : 0;  // Carry out of the add
+    
+    uint64_t invert = sequencesOnEven << 1;
+    return (evenBits ^ invert) & followsEscape;
+}
+
+// =============================================================================
+// StructuralScanner - Stage 1 structural index, consumed on demand
+// =============================================================================
+// Yields, in order, every unescaped quote, every {}[]:, outside strings and
+// the first byte of every number/literal. Input is classified 64 bytes at a
+// time into a bitmask of structural positions which the parser pops with
+// ctz, so the index is never materialized as an array.
+// =============================================================================
+class StructuralScanner {
+public:
+    explicit StructuralScanner(std::string_view text)
+        : m_data(text.data()), m_size(text.size()) {}
+    
+    // Next structural character, or nullptr once the input is exhausted
+    const char* next() {
+        while (m_mask == 0) {
+            if (m_nextBase >= m_size) return nullptr;
+            loadBlock();
+        }
+        size_t offset = m_base + countTrailingZeros(m_mask);
+        m_mask &= m_mask - 1;
+        return m_data + offset;
+    }
+    
+    // True if the input ended inside a string (only meaningful at the end)
+    bool endedInString() const { return m_prevInString != 0; }
+    
+private:
+    void loadBlock() {
+        m_base = m_nextBase;
+        m_nextBase += 64;
+        
+        // The tail is padded with spaces
+        const char* block = m_data + m_base;
+        char padded[64];
+        if (m_size - m_base < 64) {
+            std::memset(padded, ' ', sizeof(padded));
+            std::memcpy(padded, block, m_size - m_base);
+            block = padded;
+        }
+        
+        uint64_t quote = 0, backslash = 0, op = 0, whitespace = 0;
+        for (int i = 0; i < 4; i++) {
+            BlockMasks m = classifyBlock(block + i * 16);
+            quote |= static_cast<uint64_t>(m.quote) << (i * 16);
+            backslash |= static_cast<uint64_t>(m.backslash) << (i * 16);
+            op |= static_cast<uint64_t>(m.op) << (i * 16);
+            whitespace |= static_cast<uint64_t>(m.whitespace) << (i * 16);
+        }
+        
+        // Strings: unescaped quotes toggle the in-string state
+        quote &= ~findEscaped(backslash, m_prevEscaped);
+        uint64_t inString = prefixXor(quote) ^ m_prevInString;
+        m_prevInString = static_cast<uint64_t>(static_cast<int64_t>(inString) >> 63);
+        
+        // Scalars: runs of anything else outside strings; keep their starts
+        uint64_t scalar = ~(op | whitespace | quote | inString);
+        uint64_t scalarStarts = scalar & ~((scalar << 1) | m_prevScalar);
+        m_prevScalar = scalar >> 63;
+        
+        m_mask = (op & ~inString) | quote | scalarStarts;
+    }
+    
+    const char* m_data;
+    size_t m_size;
+    size_t m_base = 0;              // Offset of the current block
+    size_t m_nextBase = 0;          // Offset of the next block to classify
+    uint64_t m_mask = 0;            // Remaining structurals in the current block
+    uint64_t m_prevEscaped = 0;     // Carries across block boundaries
+    uint64_t m_prevInString = 0;    // All ones while inside a string
+    uint64_t m_prevScalar = 0;
+};
+
+} // namespace detail
+
 // Forward declaration
 class Value;
 
@@ -154,7 +752,7 @@ private:
         if (c == '"') return parseString(json, pos);
         if (c == 't' || c == 'f') return parseBool(json, pos);
         if (c == 'n') return parseNull(json, pos);
-        if (c == '-' || std::isdigit(c)) return parseNumber(json, pos);
+        if (c == '-' || detail::isDigit(c)) return parseNumber(json, pos);
         
         return Value();
     }
@@ -229,6 +827,15 @@ private:
         
         std::string result;
         while (pos < json.size() && json[pos] != '"') {
+            // Copy the run of plain characters up to the next quote/escape
+            const char* run = json.data() + pos;
+            const char* stop = detail::findQuoteOrBackslash(run, json.data() + json.size());
+            if (stop != run) {
+                result.append(run, stop - run);
+                pos += stop - run;
+                continue;
+            }
+            
             if (json[pos] == '\\' && pos + 1 < json.size()) {
                 pos++;
                 char escaped = json[pos];
@@ -273,24 +880,26 @@ private:
         
         if (json[pos] == '-') pos++;
         
-        while (pos < json.size() && std::isdigit(json[pos])) pos++;
+        while (pos < json.size() && detail::isDigit(json[pos])) pos++;
         
         if (pos < json.size() && json[pos] == '.') {
             pos++;
-            while (pos < json.size() && std::isdigit(json[pos])) pos++;
+            while (pos < json.size() && detail::isDigit(json[pos])) pos++;
         }
         
         if (pos < json.size() && (json[pos] == 'e' || json[pos] == 'E')) {
             pos++;
             if (pos < json.size() && (json[pos] == '+' || json[pos] == '-')) pos++;
-            while (pos < json.size() && std::isdigit(json[pos])) pos++;
+            while (pos < json.size() && detail::isDigit(json[pos])) pos++;
         }
         
-        std::string numStr = json.substr(start, pos - start);
+        Number number;
+        const char* end = json.data() + pos;
+        if (detail::parseNumber(json.data() + start, end, number) != end) return Value();
         
         Value val;
         val.type = ValueType::Number;
-        val.numberValue = std::atof(numStr.c_str());
+        val.numberValue = number.toDouble();
         return val;
     }
     
@@ -330,4 +939,959 @@ inline Value parse(const std::string& json) {
     return Parser::parse(json);
 }
 
+// =============================================================================
+// Arena-backed DOM
+// =============================================================================
+// A second, compact DOM for large documents such as the store catalog.
+// Nodes are 16-byte tagged unions allocated from a per-document arena and
+// strings are views into the retained input buffer. Escape sequences are
+// only decoded when a string is read and actually contains one.
+// =============================================================================
+
+// =============================================================================
+// Arena - Bump allocator that frees everything at once
+// =============================================================================
+class Arena {
+public:
+    explicit Arena(size_t blockSize = 64 * 1024) : m_blockSize(blockSize) {}
+    
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena(Arena&&) = default;
+    Arena& operator=(Arena&&) = default;
+    
+    // -------------------------------------------------------------------------
+    // Allocate uninitialized storage for count objects of T
+    // -------------------------------------------------------------------------
+    template<typename T>
+    T* allocate(size_t count) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned type");
+        size_t bytes = sizeof(T) * count;
+        size_t offset = (m_used + alignof(T) - 1) & ~(alignof(T) - 1);
+        
+        if (m_blocks.empty() || offset + bytes > m_capacity) {
+            // Oversized requests get a dedicated block
+            m_capacity = bytes > m_blockSize ? bytes : m_blockSize;
+            m_blocks.emplace_back(new char[m_capacity]);
+            offset = 0;
+        }
+        
+        m_used = offset + bytes;
+        return reinterpret_cast<T*>(m_blocks.back().get() + offset);
+    }
+    
+    // -------------------------------------------------------------------------
+    // Release all blocks
+    // -------------------------------------------------------------------------
+    void clear() {
+        m_blocks.clear();
+        m_used = 0;
+        m_capacity = 0;
+    }
+    
+private:
+    size_t m_blockSize;
+    size_t m_used = 0;
+    size_t m_capacity = 0;
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+};
+
+// Forward declarations
+class Node;
+struct Member;
+
+// =============================================================================
+// Node - Compact DOM value living in a Document's arena
+// =============================================================================
+class Node {
+public:
+    Node() = default;
+    
+    // -------------------------------------------------------------------------
+    // Type checking
+    // -------------------------------------------------------------------------
+    ValueType getType() const { return m_type; }
+    bool isNull() const { return m_type == ValueType::Null; }
+    bool isBool() const { return m_type == ValueType::Bool; }
+    bool isNumber() const { return m_type == ValueType::Number; }
+    bool isString() const { return m_type == ValueType::String; }
+    bool isArray() const { return m_type == ValueType::Array; }
+    bool isObject() const { return m_type == ValueType::Object; }
+    bool isInteger() const { return m_type == ValueType::Number && m_numberKind != Number::Kind::Double; }
+    
+    // -------------------------------------------------------------------------
+    // Value access
+    // -------------------------------------------------------------------------
+    bool asBool(bool defaultVal = false) const {
+        return m_type == ValueType::Bool ? m_bool : defaultVal;
+    }
+    
+    Number number() const {
+        Number n;
+        n.kind = m_numberKind;
+        n.uint64 = m_uint64;
+        return n;
+    }
+    
+    double asNumber(double defaultVal = 0.0) const {
+        return m_type == ValueType::Number ? number().toDouble() : defaultVal;
+    }
+    
+    int asInt(int defaultVal = 0) const {
+        return m_type == ValueType::Number ? static_cast<int>(number().toInt64()) : defaultVal;
+    }
+    
+    // Exact for integers up to 64 bits
+    int64_t asInt64(int64_t defaultVal = 0) const {
+        return m_type == ValueType::Number ? number().toInt64() : defaultVal;
+    }
+    
+    uint64_t asUInt64(uint64_t defaultVal = 0) const {
+        return m_type == ValueType::Number ? number().toUInt64() : defaultVal;
+    }
+    
+    // Decoded copy of the string (escapes are resolved here, on demand)
+    std::string asString(const std::string& defaultVal = "") const {
+        if (m_type != ValueType::String) return defaultVal;
+        if (!m_escaped) return std::string(m_string, m_size);
+        std::string result;
+        detail::unescape(rawString(), result);
+        return result;
+    }
+    
+    // Zero-copy view of the string as it appears in the input.
+    // Only equal to the decoded value when hasEscapes() is false.
+    std::string_view rawString() const {
+        return m_type == ValueType::String ? std::string_view(m_string, m_size)
+                                           : std::string_view();
+    }
+    
+    bool hasEscapes() const { return m_escaped; }
+    
+    // Compare the decoded string against text without allocating when possible
+    bool equals(std::string_view text) const {
+        if (m_type != ValueType::String) return false;
+        if (!m_escaped) return rawString() == text;
+        std::string decoded;
+        detail::unescape(rawString(), decoded);
+        return decoded == text;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Array access
+    // -------------------------------------------------------------------------
+    size_t size() const {
+        return (m_type == ValueType::Array || m_type == ValueType::Object) ? m_size : 0;
+    }
+    
+    inline const Node& operator[](size_t index) const;
+    
+    // -------------------------------------------------------------------------
+    // Object access
+    // -------------------------------------------------------------------------
+    inline const Node& operator[](std::string_view key) const;
+    inline bool contains(std::string_view key) const;
+    
+    // Members in document order (valid for objects only)
+    inline const Member* begin() const;
+    inline const Member* end() const;
+    
+    static const Node& null() {
+        static const Node nullNode;
+        return nullNode;
+    }
+    
+private:
+    friend class DocumentParser;
+    
+    ValueType m_type = ValueType::Null;
+    bool m_bool = false;
+    bool m_escaped = false;
+    Number::Kind m_numberKind = Number::Kind::Double;
+    uint32_t m_size = 0;       // String length, element or member count
+    union {
+        uint64_t m_uint64 = 0; // Raw bits of the Number payload
+        const char* m_string;
+        const Node* m_items;
+        const Member* m_members;
+    };
+};
+
+// =============================================================================
+// Member - Key/value pair of an object node
+// =============================================================================
+struct Member {
+    Node key;
+    Node value;
+};
+
+inline const Node& Node::operator[](size_t index) const {
+    if (m_type != ValueType::Array || index >= m_size) return null();
+    return m_items[index];
+}
+
+inline const Node& Node::operator[](std::string_view key) const {
+    if (m_type != ValueType::Object) return null();
+    // Catalog objects have ~15 keys; a linear scan beats any map here
+    for (uint32_t i = 0; i < m_size; i++) {
+        if (m_members[i].key.equals(key)) return m_members[i].value;
+    }
+    return null();
+}
+
+inline bool Node::contains(std::string_view key) const {
+    return &(*this)[key] != &null();
+}
+
+inline const Member* Node::begin() const {
+    return m_type == ValueType::Object ? m_members : nullptr;
+}
+
+inline const Member* Node::end() const {
+    return m_type == ValueType::Object ? m_members + m_size : nullptr;
+}
+
+// =============================================================================
+// Document - Owns the arena and (optionally) the input buffer
+// =============================================================================
+class Document {
+public:
+    Document() = default;
+    Document(const Document&) = delete;
+    Document& operator=(const Document&) = delete;
+    Document(Document&&) = default;
+    Document& operator=(Document&&) = default;
+    
+    // -------------------------------------------------------------------------
+    // Parse text that outlives the document (no copy is made)
+    // -------------------------------------------------------------------------
+    inline bool parse(std::string_view text);
+    
+    // -------------------------------------------------------------------------
+    // Parse text, taking ownership of the buffer
+    // -------------------------------------------------------------------------
+    bool parse(std::string&& text) {
+        m_owned = std::make_unique<std::string>(std::move(text));
+        return parse(std::string_view(*m_owned));
+    }
+    
+    // -------------------------------------------------------------------------
+    // Access
+    // -------------------------------------------------------------------------
+    const Node& root() const { return m_root ? *m_root : Node::null(); }
+    bool isValid() const { return m_root != nullptr; }
+    
+    const Node& operator[](std::string_view key) const { return root()[key]; }
+    const Node& operator[](size_t index) const { return root()[index]; }
+    
+private:
+    std::unique_ptr<std::string> m_owned;
+    Arena m_arena;
+    const Node* m_root = nullptr;
+};
+
+// =============================================================================
+// DocumentParser - Builds arena nodes by walking the structural index
+// =============================================================================
+class DocumentParser {
+public:
+    DocumentParser(std::string_view text, Arena& arena)
+        : m_end(text.data() + text.size()), m_scanner(text), m_arena(arena) {}
+    
+    // -------------------------------------------------------------------------
+    // Parse a single value followed only by whitespace
+    // -------------------------------------------------------------------------
+    bool parse(Node& out) {
+        if (!parseValue(out, 0)) return false;
+        return !nextToken() && !m_scanner.endedInString();
+    }
+    
+private:
+    static constexpr int MAX_DEPTH = 256;
+    
+    // -------------------------------------------------------------------------
+    // Token cursor over the structural index
+    // -------------------------------------------------------------------------
+    const char* nextToken() {
+        if (m_peeked) {
+            const char* token = m_peeked;
+            m_peeked = nullptr;
+            return token;
+        }
+        return m_scanner.next();
+    }
+    
+    char peekToken() {
+        if (!m_peeked) m_peeked = m_scanner.next();
+        return m_peeked ? *m_peeked : '\0';
+    }
+    
+    bool expect(char c) {
+        const char* token = nextToken();
+        return token && *token == c;
+    }
+    
+    // A scalar must be followed by whitespace, an operator or the end
+    bool endsScalar(const char* p) const {
+        if (p >= m_end) return true;
+        char c = *p;
+        return detail::isWhitespace(c) || c == ',' || c == ':' ||
+               c == '}' || c == ']' || c == '{' || c == '[';
+    }
+    
+    // -------------------------------------------------------------------------
+    // Parse any JSON value
+    // -------------------------------------------------------------------------
+    bool parseValue(Node& out, int depth) {
+        const char* token = nextToken();
+        if (!token) return false;
+        
+        switch (*token) {
+            case '{': return depth < MAX_DEPTH && parseObject(out, depth + 1);
+            case '[': return depth < MAX_DEPTH && parseArray(out, depth + 1);
+            case '"': return parseString(token, out);
+            case 't': return parseLiteral(token, "true", out, ValueType::Bool, true);
+            case 'f': return parseLiteral(token, "false", out, ValueType::Bool, false);
+            case 'n': return parseLiteral(token, "null", out, ValueType::Null, false);
+            default: return parseNumber(token, out);
+        }
+    }
+    
+    // -------------------------------------------------------------------------
+    // Parse object - members are staged on a scratch stack, then copied
+    // into one contiguous arena block when the object closes
+    // -------------------------------------------------------------------------
+    bool parseObject(Node& out, int depth) {
+        size_t base = m_memberStack.size();
+        
+        if (peekToken() == '}') {
+            nextToken();
+        } else {
+            while (true) {
+                const char* token = nextToken();
+                if (!token || *token != '"') return false;
+                
+                Member member;
+                if (!parseString(token, member.key)) return false;
+                if (!expect(':')) return false;
+                if (!parseValue(member.value, depth)) return false;
+                m_memberStack.push_back(member);
+                
+                token = nextToken();
+                if (!token) return false;
+                if (*token == ',') continue;
+                if (*token == '}') break;
+                return false;
+            }
+        }
+        
+        size_t count = m_memberStack.size() - base;
+        Member* members = m_arena.allocate<Member>(count);
+        std::copy(m_memberStack.begin() + base, m_memberStack.end(), members);
+        m_memberStack.resize(base);
+        
+        out.m_type = ValueType::Object;
+        out.m_size = static_cast<uint32_t>(count);
+        out.m_members = members;
+        return true;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Parse array
+    // -------------------------------------------------------------------------
+    bool parseArray(Node& out, int depth) {
+        size_t base = m_nodeStack.size();
+        
+        if (peekToken() == ']') {
+            nextToken();
+        } else {
+            while (true) {
+                Node value;
+                if (!parseValue(value, depth)) return false;
+                m_nodeStack.push_back(value);
+                
+                const char* token = nextToken();
+                if (!token) return false;
+                if (*token == ',') continue;
+                if (*token == ']') break;
+                return false;
+            }
+        }
+        
+        size_t count = m_nodeStack.size() - base;
+        Node* items = m_arena.allocate<Node>(count);
+        std::copy(m_nodeStack.begin() + base, m_nodeStack.end(), items);
+        m_nodeStack.resize(base);
+        
+        out.m_type = ValueType::Array;
+        out.m_size = static_cast<uint32_t>(count);
+        out.m_items = items;
+        return true;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Parse string - the closing quote is the next index entry, so the
+    // contents are never scanned here; records a view into the input
+    // -------------------------------------------------------------------------
+    bool parseString(const char* open, Node& out) {
+        const char* close = nextToken();
+        if (!close || *close != '"') return false;
+        
+        const char* start = open + 1;
+        size_t length = static_cast<size_t>(close - start);
+        
+        out.m_type = ValueType::String;
+        out.m_escaped = std::memchr(start, '\\', length) != nullptr;
+        out.m_size = static_cast<uint32_t>(length);
+        out.m_string = start;
+        return true;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Parse number
+    // -------------------------------------------------------------------------
+    bool parseNumber(const char* start, Node& out) {
+        Number number;
+        const char* p = detail::parseNumber(start, m_end, number);
+        if (!p || !endsScalar(p)) return false;
+        
+        out.m_type = ValueType::Number;
+        out.m_numberKind = number.kind;
+        out.m_uint64 = number.uint64;
+        return true;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Parse true / false / null
+    // -------------------------------------------------------------------------
+    bool parseLiteral(const char* start, const char* literal, Node& out,
+                      ValueType type, bool value) {
+        size_t length = std::strlen(literal);
+        if (static_cast<size_t>(m_end - start) < length ||
+            std::memcmp(start, literal, length) != 0 ||
+            !endsScalar(start + length)) {
+            return false;
+        }
+        out.m_type = type;
+        out.m_bool = value;
+        return true;
+    }
+    
+    const char* m_end;
+    detail::StructuralScanner m_scanner;
+    const char* m_peeked = nullptr;     // One token of lookahead
+    Arena& m_arena;
+    std::vector<Node> m_nodeStack;
+    std::vector<Member> m_memberStack;
+};
+
+inline bool Document::parse(std::string_view text) {
+    m_arena.clear();
+    m_root = nullptr;
+    
+    Node* root = m_arena.allocate<Node>(1);
+    *root = Node();
+    
+    DocumentParser parser(text, m_arena);
+    if (!parser.parse(*root)) return false;
+    
+    m_root = root;
+    return true;
+}
+
+// =============================================================================
+// Convenience functions
+// =============================================================================
+
+// Parse into an arena DOM that borrows text (text must outlive the result)
+inline Document parseDocument(std::string_view text) {
+    Document doc;
+    doc.parse(text);
+    return doc;
+}
+
+// Parse into an arena DOM that owns its input buffer
+inline Document parseDocument(std::string&& text) {
+    Document doc;
+    doc.parse(std::move(text));
+    return doc;
+}
+
+// =============================================================================
+// StreamParser - Incremental, resumable pull parser
+// =============================================================================
+// Input is fed in chunks with arbitrary boundaries (e.g. straight from a
+// curl write callback) and tokens are pulled one at a time with next().
+// Only the unconsumed tail of the input is buffered, so memory stays at
+// roughly one chunk plus the longest token.
+//
+// Views returned by stringValue() are valid until the next call to
+// next() or feed().
+// =============================================================================
+class StreamParser {
+public:
+    enum class Event {
+        NeedMoreData,   // Feed more input (or call finish()) and retry
+        StartObject,
+        EndObject,
+        StartArray,
+        EndArray,
+        Key,            // Object key, see stringValue()
+        String,
+        Number,
+        Bool,
+        Null,
+        Done,           // Complete document consumed
+        Error
+    };
+    
+    // -------------------------------------------------------------------------
+    // Input
+    // -------------------------------------------------------------------------
+    
+    // Append a chunk of input
+    void feed(const char* data, size_t size) {
+        // Drop the consumed prefix before growing the buffer
+        if (m_pos > 0) {
+            m_buffer.erase(0, m_pos);
+            m_pos = 0;
+        }
+        m_buffer.append(data, size);
+    }
+    
+    // Signal that no more input will arrive
+    void finish() { m_finished = true; }
+    
+    // Reset to parse a new document
+    void reset() {
+        m_buffer.clear();
+        m_scratch.clear();
+        m_stack.clear();
+        m_pos = 0;
+        m_stringResume = 0;
+        m_state = State::Value;
+        m_finished = false;
+        m_error = false;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Pull the next token
+    // -------------------------------------------------------------------------
+    Event next() {
+        if (m_error) return Event::Error;
+        
+        while (true) {
+            skipWhitespace();
+            if (m_pos >= m_buffer.size()) {
+                if (!m_finished) return Event::NeedMoreData;
+                return m_state == State::Done ? Event::Done : fail();
+            }
+            
+            char c = m_buffer[m_pos];
+            
+            switch (m_state) {
+                case State::Done:
+                    return fail();  // Trailing garbage
+                
+                case State::Colon:
+                    if (c != ':') return fail();
+                    m_pos++;
+                    m_state = State::Value;
+                    continue;
+                
+                case State::CommaOrEnd:
+                    if (c == ',') {
+                        m_pos++;
+                        m_state = m_stack.back() == Container::Object ? State::Key
+                                                                      : State::Value;
+                        continue;
+                    }
+                    return closeContainer(c);
+                
+                case State::FirstKeyOrEnd:
+                    if (c == '}') return closeContainer(c);
+                    // Fall through
+                case State::Key: {
+                    if (c != '"') return fail();
+                    Event event = scanString(Event::Key);
+                    if (event == Event::Key) m_state = State::Colon;
+                    return event;
+                }
+                
+                case State::FirstValueOrEnd:
+                    if (c == ']') return closeContainer(c);
+                    // Fall through
+                case State::Value:
+                    return scanValue(c);
+            }
+        }
+    }
+    
+    // -------------------------------------------------------------------------
+    // Token values
+    // -------------------------------------------------------------------------
+    std::string_view stringValue() const { return m_string; }
+    double numberValue() const { return m_number.toDouble(); }
+    const Number& number() const { return m_number; }
+    bool boolValue() const { return m_bool; }
+    
+    // Number of open containers
+    size_t depth() const { return m_stack.size(); }
+    
+private:
+    enum class Container : uint8_t { Object, Array };
+    enum class State : uint8_t {
+        Value, FirstValueOrEnd, FirstKeyOrEnd, Key, Colon, CommaOrEnd, Done
+    };
+    
+    static constexpr size_t MAX_DEPTH = 256;
+    
+    Event fail() {
+        m_error = true;
+        return Event::Error;
+    }
+    
+    void skipWhitespace() {
+        while (m_pos < m_buffer.size() && detail::isWhitespace(m_buffer[m_pos])) m_pos++;
+    }
+    
+    void afterValue() {
+        m_state = m_stack.empty() ? State::Done : State::CommaOrEnd;
+    }
+    
+    Event closeContainer(char c) {
+        Container expected = c == '}' ? Container::Object : Container::Array;
+        if ((c != '}' && c != ']') || m_stack.empty() || m_stack.back() != expected) {
+            return fail();
+        }
+        m_pos++;
+        m_stack.pop_back();
+        afterValue();
+        return expected == Container::Object ? Event::EndObject : Event::EndArray;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Scan a value starting with c
+    // -------------------------------------------------------------------------
+    Event scanValue(char c) {
+        switch (c) {
+            case '{':
+            case '[':
+                if (m_stack.size() >= MAX_DEPTH) return fail();
+                m_pos++;
+                if (c == '{') {
+                    m_stack.push_back(Container::Object);
+                    m_state = State::FirstKeyOrEnd;
+                    return Event::StartObject;
+                }
+                m_stack.push_back(Container::Array);
+                m_state = State::FirstValueOrEnd;
+                return Event::StartArray;
+            
+            case '"': {
+                Event event = scanString(Event::String);
+                if (event == Event::String) afterValue();
+                return event;
+            }
+            
+            case 't': return scanLiteral("true", Event::Bool, true);
+            case 'f': return scanLiteral("false", Event::Bool, false);
+            case 'n': return scanLiteral("null", Event::Null, false);
+            default: return scanNumber();
+        }
+    }
+    
+    // -------------------------------------------------------------------------
+    // Scan a string; resumes where the previous attempt ran out of input
+    // -------------------------------------------------------------------------
+    Event scanString(Event kind) {
+        size_t start = m_pos + 1;
+        size_t i = start + m_stringResume;
+        bool escaped = m_stringEscaped;
+        
+        bool complete = false;
+        
+        const char* data = m_buffer.data();
+        while (i < m_buffer.size()) {
+            // Jump over plain string bytes 16 at a time
+            i = static_cast<size_t>(
+                detail::findQuoteOrBackslash(data + i, data + m_buffer.size()) - data);
+            if (i >= m_buffer.size()) break;
+            
+            char c = m_buffer[i];
+            if (c == '"') {
+                complete = true;
+                break;
+            }
+            if (c == '\\') {
+                if (i + 1 >= m_buffer.size()) break;  // Escape split across chunks
+                escaped = true;
+                i++;
+            }
+            i++;
+        }
+        
+        if (!complete) {
+            if (m_finished) return fail();
+            m_stringResume = i - start;
+            m_stringEscaped = escaped;
+            return Event::NeedMoreData;
+        }
+        
+        std::string_view raw(m_buffer.data() + start, i - start);
+        if (escaped) {
+            m_scratch.clear();
+            detail::unescape(raw, m_scratch);
+            m_string = m_scratch;
+        } else {
+            m_string = raw;
+        }
+        
+        m_pos = i + 1;
+        m_stringResume = 0;
+        m_stringEscaped = false;
+        return kind;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Scan a number; it is only complete once a delimiter has been seen
+    // -------------------------------------------------------------------------
+    Event scanNumber() {
+        size_t i = m_pos;
+        while (i < m_buffer.size()) {
+            char c = m_buffer[i];
+            if (!detail::isDigit(c) && c != '-' && c != '+' &&
+                c != '.' && c != 'e' && c != 'E') {
+                break;
+            }
+            i++;
+        }
+        
+        if (i >= m_buffer.size() && !m_finished) return Event::NeedMoreData;
+        const char* end = m_buffer.data() + i;
+        if (detail::parseNumber(m_buffer.data() + m_pos, end, m_number) != end) {
+            return fail();
+        }
+        
+        m_pos = i;
+        afterValue();
+        return Event::Number;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Scan true / false / null
+    // -------------------------------------------------------------------------
+    Event scanLiteral(const char* literal, Event kind, bool value) {
+        size_t length = std::strlen(literal);
+        size_t available = m_buffer.size() - m_pos;
+        size_t compare = available < length ? available : length;
+        
+        if (std::memcmp(m_buffer.data() + m_pos, literal, compare) != 0) return fail();
+        if (available < length) return m_finished ? fail() : Event::NeedMoreData;
+        
+        m_pos += length;
+        m_bool = value;
+        afterValue();
+        return kind;
+    }
+    
+    std::string m_buffer;               // Unconsumed input
+    std::string m_scratch;              // Decoded string with escapes
+    std::vector<Container> m_stack;
+    size_t m_pos = 0;
+    size_t m_stringResume = 0;          // Bytes of a partial string already scanned
+    bool m_stringEscaped = false;
+    State m_state = State::Value;
+    bool m_finished = false;
+    bool m_error = false;
+    
+    std::string_view m_string;
+    Number m_number;
+    bool m_bool = false;
+};
+
+// =============================================================================
+// Writer - Buffered JSON encoder
+// =============================================================================
+// Appends to an internal buffer that keeps its capacity across clear(), so
+// repeated saves do not reallocate. Commas, and indentation when requested,
+// are inserted automatically; strings are escaped per RFC 8259.
+//
+//   json::Writer writer(2);
+//   writer.beginObject().key("id").value(id).endObject();
+//   FileUtils::writeFileAtomic(path, writer.str());
+// =============================================================================
+class Writer {
+public:
+    // indent > 0 pretty-prints with that many spaces per level
+    explicit Writer(int indent = 0) : m_indent(indent) {}
+    
+    // Start over, keeping the allocated buffer
+    void clear() {
+        m_buffer.clear();
+        m_stack.clear();
+        m_afterKey = false;
+    }
+    
+    const std::string& str() const { return m_buffer; }
+    
+    // True once every container has been closed
+    bool isComplete() const { return m_stack.empty() && !m_buffer.empty(); }
+    
+    // -------------------------------------------------------------------------
+    // Containers
+    // -------------------------------------------------------------------------
+    Writer& beginObject() { return open('{'); }
+    Writer& endObject() { return close('}'); }
+    Writer& beginArray() { return open('['); }
+    Writer& endArray() { return close(']'); }
+    
+    Writer& key(std::string_view name) {
+        separate();
+        writeString(name);
+        m_buffer += m_indent > 0 ? ": " : ":";
+        m_afterKey = true;
+        return *this;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Values
+    // -------------------------------------------------------------------------
+    Writer& value(std::string_view text) {
+        separate();
+        writeString(text);
+        return *this;
+    }
+    
+    // Without this, string literals would pick the bool overload
+    Writer& value(const char* text) { return value(std::string_view(text)); }
+    
+    Writer& value(bool b) {
+        separate();
+        m_buffer += b ? "true" : "false";
+        return *this;
+    }
+    
+    template <typename T, typename std::enable_if<std::is_integral<T>::value &&
+                                                  !std::is_same<T, bool>::value, int>::type = 0>
+    Writer& value(T n) {
+        separate();
+        char digits[24];
+        char* end = digits + sizeof(digits);
+        char* p = end;
+        bool negative = std::is_signed<T>::value && n < 0;
+        // Negate in unsigned space so the minimum value does not overflow
+        uint64_t u = negative ? 0 - static_cast<uint64_t>(n) : static_cast<uint64_t>(n);
+        do {
+            *--p = static_cast<char>('0' + u % 10);
+            u /= 10;
+        } while (u != 0);
+        if (negative) *--p = '-';
+        m_buffer.append(p, static_cast<size_t>(end - p));
+        return *this;
+    }
+    
+    Writer& value(double n) {
+        separate();
+        // JSON has no NaN or infinity
+        if (n != n || n - n != 0.0) {
+            m_buffer += "null";
+            return *this;
+        }
+        char digits[32];
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        // Shortest representation that round-trips
+        auto result = std::to_chars(digits, digits + sizeof(digits), n);
+        m_buffer.append(digits, static_cast<size_t>(result.ptr - digits));
+#else
+        int length = std::snprintf(digits, sizeof(digits), "%.17g", n);
+        m_buffer.append(digits, static_cast<size_t>(length));
+#endif
+        return *this;
+    }
+    
+    Writer& null() {
+        separate();
+        m_buffer += "null";
+        return *this;
+    }
+    
+private:
+    // -------------------------------------------------------------------------
+    // Emit the comma / newline that precedes the next element
+    // -------------------------------------------------------------------------
+    void separate() {
+        if (m_afterKey) {
+            m_afterKey = false;
+            return;
+        }
+        if (m_stack.empty()) return;
+        
+        if (m_stack.back().count++ > 0) m_buffer += ',';
+        newline(m_stack.size());
+    }
+    
+    void newline(size_t depth) {
+        if (m_indent <= 0) return;
+        m_buffer += '\n';
+        m_buffer.append(depth * static_cast<size_t>(m_indent), ' ');
+    }
+    
+    Writer& open(char bracket) {
+        separate();
+        m_buffer += bracket;
+        m_stack.push_back({0});
+        return *this;
+    }
+    
+    Writer& close(char bracket) {
+        if (m_stack.empty()) return *this;
+        bool hadItems = m_stack.back().count > 0;
+        m_stack.pop_back();
+        if (hadItems) newline(m_stack.size());
+        m_buffer += bracket;
+        return *this;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Quote and escape text, copying safe runs in bulk
+    // -------------------------------------------------------------------------
+    void writeString(std::string_view text) {
+        static const char HEX[] = "0123456789abcdef";
+        
+        m_buffer += '"';
+        size_t runStart = 0;
+        for (size_t i = 0; i < text.size(); i++) {
+            unsigned char c = static_cast<unsigned char>(text[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') continue;
+            
+            m_buffer.append(text.data() + runStart, i - runStart);
+            runStart = i + 1;
+            switch (c) {
+                case '"': m_buffer += "\\\""; break;
+                case '\\': m_buffer += "\\\\"; break;
+                case '\b': m_buffer += "\\b"; break;
+                case '\f': m_buffer += "\\f"; break;
+                case '\n': m_buffer += "\\n"; break;
+                case '\r': m_buffer += "\\r"; break;
+                case '\t': m_buffer += "\\t"; break;
+                default: {
+                    char escape[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xF]};
+                    m_buffer.append(escape, sizeof(escape));
+                    break;
+                }
+            }
+        }
+        m_buffer.append(text.data() + runStart, text.size() - runStart);
+        m_buffer += '"';
+    }
+    
+    struct Level { uint32_t count; };
+    
+    std::string m_buffer;
+    std::vector<Level> m_stack;
+    int m_indent;
+    bool m_afterKey = false;
+};
+
 } // namespace json
@@ -265,6 +265,57 @@ const categories = [
     { id: "themes", name: "主题", nameEn: "Themes", icon: "palette" }
 ];
 
+// =============================================================================
+// Change tracking
+// =============================================================================
+// Every mutation bumps catalogVersion and records, per game id, the version
+// at which it last changed (or was removed). Clients sync with a cursor of
+// the form "<epoch>.<version>"; the epoch changes whenever the server
+// restarts, so a cursor from a previous process forces a full reload.
+// =============================================================================
+
+const epoch = Date.now().toString(36);
+let catalogVersion = 1;
+let lastModified = new Date();
+const changes = new Map();      // id -> { version, removed }
+
+games.forEach(g => changes.set(g.id, { version: catalogVersion, removed: false }));
+
+function markChanged(id, removed = false) {
+    catalogVersion++;
+    lastModified = new Date();
+    changes.set(id, { version: catalogVersion, removed });
+}
+
+function getCursor() {
+    return `${epoch}.${catalogVersion}`;
+}
+
+// Version encoded in a cursor, or null if it is not from this process
+function parseCursor(cursor) {
+    if (typeof cursor !== 'string') return null;
+    const [cursorEpoch, version] = cursor.split('.');
+    const parsed = Number.parseInt(version, 10);
+    if (cursorEpoch !== epoch || !Number.isInteger(parsed) || parsed > catalogVersion) return null;
+    return parsed;
+}
+
+// Games changed and ids removed after the given version
+function getChangesSince(version) {
+    const upserts = [];
+    const removed = [];
+    for (const [id, change] of changes) {
+        if (change.version <= version) continue;
+        if (change.removed) {
+            removed.push(id);
+        } else {
+            const game = games.find(g => g.id === id);
+            if (game) upserts.push(game);
+        }
+    }
+    return { upserts, removed };
+}
+
 // =============================================================================
 // Exports
 // =============================================================================
@@ -273,6 +324,14 @@ module.exports = {
     games,
     categories,
 
+    // Change tracking
+    markChanged,
+    getCursor,
+    parseCursor,
+    getChangesSince,
+    getCatalogVersion: () => catalogVersion,
+    getLastModified: () => lastModified,
+
     // Helper functions
     getGameById: (id) => games.find(g => g.id === id),
     getGamesByCategory: (category) => games.filter(g => g.category === category),
@@ -5,24 +5,110 @@
 // =============================================================================
 
 const express = require('express');
+const zlib = require('zlib');
 const router = express.Router();
-const { games, categories, getGameById, getGamesByCategory } = require('../data/games');
+const {
+    games, categories, getGameById, getGamesByCategory,
+    markChanged, getCursor, parseCursor, getChangesSince, getLastModified
+} = require('../data/games');
 
 // =============================================================================
-// GET /api/catalog
-// Returns full catalog with all games
+// GET /api/catalog[?since=<cursor>][&view=lite]
+// Returns the full catalog, or only what changed after cursor.
+//
+// The ETag names the catalog version, so a client that already has it gets
+// 304 Not Modified without a body. With a valid cursor the response is a
+// delta: { delta: true, games: [upserts], removed: [ids] }. A missing,
+// stale or foreign cursor falls back to the full catalog (delta: false).
+// Both forms carry the cursor to send next time.
+//
+// view=lite leaves out the fields only the detail page shows (see
+// DETAIL_FIELDS); clients fetch those from /game/:gameId when needed.
+//
+// Clients that accept gzip get it. The full listing is compressed once per
+// catalog version and view and served from memory until the next change;
+// deltas are small and compressed per request.
 // =============================================================================
 
+const DETAIL_FIELDS = ['description', 'screenshotUrls'];
+
+function liteGame(game) {
+    const lite = { ...game };
+    for (const field of DETAIL_FIELDS) delete lite[field];
+    return lite;
+}
+
+// Bodies smaller than this aren't worth the gzip header and trailer
+const MIN_COMPRESS_SIZE = 1024;
+
+// Gzipped full listings of the current catalog version, by view
+let precompressed = { cursor: null, bodies: new Map() };
+
+function precompressedListing(view, build) {
+    const cursor = getCursor();
+    if (precompressed.cursor !== cursor) {
+        precompressed = { cursor, bodies: new Map() };
+    }
+    let body = precompressed.bodies.get(view);
+    if (!body) {
+        body = zlib.gzipSync(JSON.stringify(build()), { level: zlib.constants.Z_BEST_COMPRESSION });
+        precompressed.bodies.set(view, body);
+    }
+    return body;
+}
+
+function sendGzip(res, body) {
+    res.set('Content-Type', 'application/json; charset=utf-8');
+    res.set('Content-Encoding', 'gzip');
+    res.send(body);
+}
+
+// res.json(), gzipped when the client accepts it and the body is big enough
+function sendJson(req, res, data) {
+    const body = JSON.stringify(data);
+    if (body.length < MIN_COMPRESS_SIZE || !req.acceptsEncodings('gzip')) {
+        res.set('Content-Type', 'application/json; charset=utf-8');
+        return res.send(body);
+    }
+    sendGzip(res, zlib.gzipSync(body));
+}
+
 router.get('/', (req, res) => {
-    res.json({
-        success: true,
-        data: {
-            games: games,
-            categories: categories,
-            total: games.length,
-            lastUpdated: new Date().toISOString()
-        }
-    });
+    const lite = req.query.view === 'lite';
+    const etag = `"catalog-${lite ? 'lite-' : ''}${getCursor()}"`;
+    res.set('ETag', etag);
+    res.set('Cache-Control', 'no-cache');
+    res.vary('Accept-Encoding');
+
+    if (req.get('If-None-Match') === etag) {
+        return res.status(304).end();
+    }
+
+    const since = parseCursor(req.query.since);
+    const data = {
+        delta: since !== null,
+        cursor: getCursor(),
+        categories: categories,
+        lastUpdated: getLastModified().toISOString()
+    };
+
+    if (since !== null) {
+        const { upserts, removed } = getChangesSince(since);
+        data.games = lite ? upserts.map(liteGame) : upserts;
+        data.removed = removed;
+        return sendJson(req, res, { success: true, data });
+    }
+
+    const listing = () => {
+        data.games = lite ? games.map(liteGame) : games;
+        data.total = games.length;
+        return { success: true, data };
+    };
+
+    if (req.acceptsEncodings('gzip')) {
+        return sendGzip(res, precompressedListing(lite ? 'lite' : 'full', listing));
+    }
+    res.json(listing());
 });
 
 // =============================================================================
@@ -79,7 +165,11 @@ router.get('/game/:gameId', (req, res) => {
         });
     }
 
-    res.json({
+    // Details change rarely; clients keep them a few minutes and then
+    // revalidate with the ETag res.send() adds
+    res.set('Cache-Control', 'max-age=300');
+    res.vary('Accept-Encoding');
+    sendJson(req, res, {
         success: true,
         data: game
     });
@@ -103,6 +193,7 @@ router.post('/download/:gameId', (req, res) => {
 
     // Increment download count
     game.downloadCount++;
+    markChanged(game.id);
 
     res.json({
         success: true,
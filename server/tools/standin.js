@@ -0,0 +1,240 @@
+// =============================================================================
+// Switch App Store - Loopback Stand-in Server
+// =============================================================================
+// Dependency-free HTTP server for exercising the client's network code on a
+// development machine: throughput, slow and stalled bodies, cancellation and
+// connection reuse. Start it with `node tools/standin.js [port]` (default
+// 3100) and point the client or a test program at http://127.0.0.1:<port>.
+//
+// With `--tls <cert.pem> <key.pem>` it serves https:// instead, speaking
+// HTTP/2 to clients that offer it and HTTP/1.1 to the rest.
+//
+// GET  /bytes/:n      n bytes of filler (?rate=<bytes/s> throttles,
+//                     ?delay=<ms> waits before the headers)
+// GET  /status/:code  empty response with that status
+// GET  /delay/:ms     small JSON body after ms milliseconds
+// ANY  /echo          the request line, headers and body as JSON
+// GET  /cache/:name   small JSON document with caching headers, answering
+//                     If-None-Match / If-Modified-Since with 304. Query:
+//                     max-age, swr, sie (stale-while-revalidate and
+//                     stale-if-error seconds), nocache=1, nostore=1, must=1
+//                     (must-revalidate), etag=0 (no ETag), lm=1
+//                     (Last-Modified), age, vary=<header>, size=<bytes>,
+//                     delay=<ms> (before answering)
+// POST /cache/:name   change the document (new ETag and Last-Modified);
+//                     with ?fail=1 its GETs answer 503 until the next POST
+// GET  /stats         counters below, as JSON
+// POST /stats/reset   zero the counters
+//
+// /stats counts connections (to check keep-alive), requests, bodies served
+// in full and responses the client abandoned (to check cancellation), and
+// /cache answers sent in full vs. as 304. In TLS mode it also counts
+// handshakes, how many of them resumed an earlier session, and HTTP/2
+// sessions.
+// =============================================================================
+
+const fs = require('fs');
+const http = require('http');
+const http2 = require('http2');
+
+const args = process.argv.slice(2);
+const tlsAt = args.indexOf('--tls');
+const TLS = tlsAt >= 0 ? { cert: args[tlsAt + 1], key: args[tlsAt + 2] } : null;
+if (tlsAt >= 0) args.splice(tlsAt, 3);
+
+const PORT = Number(args[0]) || Number(process.env.PORT) || 3100;
+const CHUNK = 64 * 1024;
+
+const FILLER = Buffer.alloc(CHUNK);
+for (let i = 0; i < CHUNK; i++) FILLER[i] = 97 + (i % 26);
+
+let stats;
+function resetStats() {
+    stats = { connections: 0, requests: 0, completed: 0, aborted: 0, bytesSent: 0,
+              cacheFull: 0, cacheNotModified: 0,
+              handshakes: 0, resumed: 0, http2Sessions: 0 };
+}
+resetStats();
+
+// =============================================================================
+// Handlers
+// =============================================================================
+
+function sendJson(res, status, data) {
+    const body = Buffer.from(JSON.stringify(data));
+    res.writeHead(status, { 'Content-Type': 'application/json', 'Content-Length': body.length });
+    res.end(body);
+}
+
+// Stream n bytes, at most rate bytes per second if given
+function sendBytes(req, res, n, rate) {
+    res.writeHead(200, { 'Content-Type': 'application/octet-stream', 'Content-Length': n });
+
+    let sent = 0;
+    let aborted = false;
+    res.on('close', () => {
+        if (sent < n && !aborted) {
+            aborted = true;
+            stats.aborted++;
+        }
+    });
+
+    // Without a rate: as fast as the socket drains. With one: a slice every
+    // 50 ms so cancellation lands mid-body.
+    const slice = rate > 0 ? Math.max(1, Math.floor(rate / 20)) : CHUNK;
+    const writeMore = () => {
+        while (sent < n && !aborted) {
+            const size = Math.min(slice, CHUNK, n - sent);
+            sent += size;
+            stats.bytesSent += size;
+            const drained = res.write(size === CHUNK ? FILLER : FILLER.subarray(0, size));
+            if (sent >= n) {
+                stats.completed++;
+                return res.end();
+            }
+            if (rate > 0) return setTimeout(writeMore, 50);
+            if (!drained) return res.once('drain', writeMore);
+        }
+    };
+    writeMore();
+}
+
+// /cache documents by name: version, when it last changed, failing or not
+const documents = new Map();
+function documentFor(name) {
+    if (!documents.has(name)) {
+        // An hour old, so Last-Modified alone gives a few minutes' freshness
+        documents.set(name, { version: 1, modified: Math.floor(Date.now() / 1000) - 3600, fail: false });
+    }
+    return documents.get(name);
+}
+
+function sendCached(req, res, name, url) {
+    const doc = documentFor(name);
+    const param = (key) => url.searchParams.get(key);
+    if (doc.fail) return sendJson(res, 503, { success: false, error: 'Unavailable' });
+
+    const directives = [];
+    if (param('nostore') === '1') directives.push('no-store');
+    if (param('nocache') === '1') directives.push('no-cache');
+    if (param('must') === '1') directives.push('must-revalidate');
+    if (param('max-age') !== null) directives.push(`max-age=${Number(param('max-age'))}`);
+    if (param('swr') !== null) directives.push(`stale-while-revalidate=${Number(param('swr'))}`);
+    if (param('sie') !== null) directives.push(`stale-if-error=${Number(param('sie'))}`);
+
+    const etag = `"${name}-${doc.version}"`;
+    const headers = {};
+    if (directives.length > 0) headers['Cache-Control'] = directives.join(', ');
+    if (param('etag') !== '0') headers['ETag'] = etag;
+    if (param('lm') === '1') headers['Last-Modified'] = new Date(doc.modified * 1000).toUTCString();
+    if (param('age') !== null) headers['Age'] = String(Number(param('age')));
+    if (param('vary') !== null) headers['Vary'] = param('vary');
+
+    const ifNoneMatch = req.headers['if-none-match'];
+    const ifModifiedSince = Date.parse(req.headers['if-modified-since'] || '') / 1000;
+    const notModified = ifNoneMatch !== undefined
+        ? headers['ETag'] !== undefined && ifNoneMatch.split(',').some((tag) => tag.trim() === etag)
+        : headers['Last-Modified'] !== undefined && ifModifiedSince >= doc.modified;
+    if (notModified) {
+        stats.cacheNotModified++;
+        res.writeHead(304, headers);
+        return res.end();
+    }
+
+    // Padded to ?size so transfers are worth measuring
+    const data = { success: true, name, version: doc.version, pad: '' };
+    const size = Number(param('size')) || 0;
+    const bare = Buffer.byteLength(JSON.stringify(data));
+    if (size > bare) data.pad = 'x'.repeat(size - bare);
+    const body = Buffer.from(JSON.stringify(data));
+
+    stats.cacheFull++;
+    stats.bytesSent += body.length;
+    headers['Content-Type'] = 'application/json';
+    headers['Content-Length'] = body.length;
+    res.writeHead(200, headers);
+    res.end(body);
+}
+
+function handle(req, res, body) {
+    const url = new URL(req.url, 'http://standin');
+    const parts = url.pathname.split('/').filter(Boolean);
+    const query = (name) => Number(url.searchParams.get(name)) || 0;
+
+    switch (parts[0]) {
+    case 'bytes': {
+        const n = Number(parts[1]) || 0;
+        const start = () => sendBytes(req, res, n, query('rate'));
+        return query('delay') > 0 ? setTimeout(start, query('delay')) : start();
+    }
+    case 'status':
+        res.writeHead(Number(parts[1]) || 200, { 'Content-Length': 0 });
+        return res.end();
+    case 'delay': {
+        const ms = Number(parts[1]) || 0;
+        return setTimeout(() => sendJson(res, 200, { success: true, delay: ms }), ms);
+    }
+    case 'cache': {
+        if (req.method !== 'POST') {
+            const send = () => sendCached(req, res, parts[1] || '', url);
+            return query('delay') > 0 ? setTimeout(send, query('delay')) : send();
+        }
+        const doc = documentFor(parts[1] || '');
+        doc.fail = url.searchParams.get('fail') === '1';
+        if (!doc.fail) {
+            doc.version++;
+            doc.modified = Math.max(doc.modified + 1, Math.floor(Date.now() / 1000));
+        }
+        return sendJson(res, 200, { success: true, version: doc.version, fail: doc.fail });
+    }
+    case 'echo':
+        return sendJson(res, 200, {
+            method: req.method,
+            url: req.url,
+            headers: req.headers,
+            body: body.toString('utf8')
+        });
+    case 'stats':
+        if (req.method === 'POST' && parts[1] === 'reset') {
+            resetStats();
+            return sendJson(res, 200, { success: true });
+        }
+        return sendJson(res, 200, stats);
+    default:
+        return sendJson(res, 404, { success: false, error: 'Not found' });
+    }
+}
+
+// =============================================================================
+// Server
+// =============================================================================
+
+function onRequest(req, res) {
+    stats.requests++;
+    const chunks = [];
+    req.on('data', (chunk) => chunks.push(chunk));
+    req.on('end', () => handle(req, res, Buffer.concat(chunks)));
+}
+
+const server = TLS
+    ? http2.createSecureServer({
+        cert: fs.readFileSync(TLS.cert),
+        key: fs.readFileSync(TLS.key),
+        allowHTTP1: true
+    }, onRequest)
+    : http.createServer(onRequest);
+
+server.on('connection', () => stats.connections++);
+if (TLS) {
+    server.on('secureConnection', (socket) => {
+        stats.handshakes++;
+        if (socket.isSessionReused()) stats.resumed++;
+    });
+    server.on('session', () => stats.http2Sessions++);
+} else {
+    server.keepAliveTimeout = 30000;
+}
+
+server.listen(PORT, '127.0.0.1', () => {
+    console.log(`Stand-in server on ${TLS ? 'https' : 'http'}://127.0.0.1:${PORT}`);
+});
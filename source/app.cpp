@@ -15,7 +15,9 @@
 #include "ui/screens/EmulatorsScreen.hpp"
 #include "ui/screens/SearchScreen.hpp"
 #include "store/StoreManager.hpp"
+#include "network/HttpCache.hpp"
 #include "network/HttpClient.hpp"
+#include "network/HttpEngine.hpp"
 
 #include <switch.h>
 
@@ -61,7 +63,15 @@ App::~App() {
         m_window = nullptr;
     }
     
-    // Cleanup global curl state
+    // Stop the store's worker threads and free their HttpClients first: a
+    // refresh may still be inside curl, and their handles hold the shared
+    // DNS / TLS cache that HttpClient::cleanup() frees
+    StoreManager::getInstance().shutdown();
+    
+    // Stop the network thread (and any cache revalidation on it), save the
+    // cache index, then cleanup global curl state
+    HttpEngine::getInstance().stop();
+    HttpCache::getInstance().flush();
     HttpClient::cleanup();
 }
 
@@ -76,10 +86,18 @@ bool App::init() {
     if (!HttpClient::init()) {
         return false;
     }
+    if (!HttpEngine::getInstance().start()) {
+        return false;
+    }
+    
+    // API responses are cached on the SD card; without it requests just
+    // go to the network every time
+    HttpCache::getInstance().init("sdmc:/switch/appstore/http-cache");
     
-    // Initialize store manager and fetch catalog
+    // Initialize store manager; this loads the cached catalog snapshot so
+    // screens have content immediately. The network refresh starts from
+    // update() after the first frame is on screen.
     StoreManager::getInstance().init("sdmc:/switch/appstore/config.json");
-    StoreManager::getInstance().refresh();  // Fetch store data
     
     // -------------------------------------------------------------------------
     // Check current display mode (docked vs handheld)
@@ -235,6 +253,14 @@ void App::handleEvents() {
 // =============================================================================
 
 void App::update(float deltaTime) {
+    // Hand finished network transfers to their owners
+    HttpEngine::getInstance().pump();
+    
+    // Refresh a stale catalog, but never before the first frame
+    if (m_framesPresented > 0) {
+        StoreManager::getInstance().update();
+    }
+    
     // Update the router (handles screen transitions, etc.)
     if (m_router) {
         m_router->update(deltaTime);
@@ -259,6 +285,7 @@ void App::render() {
     
     // Present the frame
     SDL_RenderPresent(m_sdlRenderer);
+    m_framesPresented++;
 }
 
 // =============================================================================
@@ -98,6 +98,7 @@ private:
     
     // Timing
     Uint64 m_lastFrameTime = 0;       // For delta time calculation
+    uint32_t m_framesPresented = 0;   // Frames shown since startup
     
     // Window dimensions
     int m_windowWidth = 1280;
@@ -0,0 +1,80 @@
+// =============================================================================
+// Switch App Store - Response Buffer Pool Implementation
+// =============================================================================
+
+#include "BufferPool.hpp"
+
+// =============================================================================
+// Singleton
+// =============================================================================
+
+BufferPool& BufferPool::getInstance() {
+    static BufferPool instance;
+    return instance;
+}
+
+// =============================================================================
+// Acquire / Release
+// =============================================================================
+
+std::string BufferPool::acquire(size_t expectedSize) {
+    std::string buffer;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_acquires++;
+        
+        // Smallest buffer that fits; failing that, the largest (it grows
+        // from the most room we have)
+        size_t best = m_free.size();
+        for (size_t i = 0; i < m_free.size(); i++) {
+            if (best == m_free.size()) {
+                best = i;
+                continue;
+            }
+            size_t capacity = m_free[i].capacity();
+            size_t bestCapacity = m_free[best].capacity();
+            if (bestCapacity >= expectedSize) {
+                if (capacity >= expectedSize && capacity < bestCapacity) best = i;
+            } else if (capacity > bestCapacity) {
+                best = i;
+            }
+        }
+        
+        if (best < m_free.size()) {
+            buffer = std::move(m_free[best]);
+            m_free[best] = std::move(m_free.back());
+            m_free.pop_back();
+            m_pooledBytes -= buffer.capacity();
+            if (buffer.capacity() >= expectedSize) m_hits++;
+        }
+    }
+    
+    buffer.clear();
+    if (expectedSize > buffer.capacity()) buffer.reserve(expectedSize);
+    return buffer;
+}
+
+void BufferPool::release(std::string&& buffer) {
+    size_t capacity = buffer.capacity();
+    if (capacity < MIN_POOLED_CAPACITY || capacity > MAX_POOLED_CAPACITY) return;
+    
+    std::string kept = std::move(buffer);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_pooledBytes + capacity > MAX_POOLED_BYTES) return;
+    m_pooledBytes += capacity;
+    m_free.push_back(std::move(kept));
+}
+
+// =============================================================================
+// Stats
+// =============================================================================
+
+uint64_t BufferPool::getHits() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_hits;
+}
+
+uint64_t BufferPool::getAcquires() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_acquires;
+}
@@ -0,0 +1,59 @@
+// =============================================================================
+// Switch App Store - Response Buffer Pool
+// =============================================================================
+// Buffered response bodies are built in strings taken from here and moved,
+// not copied, into HttpResponse::body. Whoever is done with a body hands it
+// back (HttpEngine does so after each completion callback), so the next
+// icon or API response fills memory that is already allocated instead of
+// growing a fresh string one reallocation at a time.
+// =============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// =============================================================================
+// BufferPool - thread-safe free list of body buffers
+// =============================================================================
+class BufferPool {
+public:
+    // -------------------------------------------------------------------------
+    // Singleton access
+    // -------------------------------------------------------------------------
+    static BufferPool& getInstance();
+    
+    // An empty buffer with room for at least expectedSize bytes (0: unknown).
+    // Prefers the smallest pooled buffer that fits.
+    std::string acquire(size_t expectedSize);
+    
+    // Return a buffer for reuse. Small and oversized buffers are freed, as
+    // is anything beyond the pool's byte budget.
+    void release(std::string&& buffer);
+    
+    // Acquires served from the pool without allocating, and total acquires
+    uint64_t getHits() const;
+    uint64_t getAcquires() const;
+    
+    // Buffers below this aren't worth keeping; above it they'd pin memory
+    static constexpr size_t MIN_POOLED_CAPACITY = 4 * 1024;
+    static constexpr size_t MAX_POOLED_CAPACITY = 2 * 1024 * 1024;
+    
+    // Capacity the pool holds on to at most, across all buffers
+    static constexpr size_t MAX_POOLED_BYTES = 4 * 1024 * 1024;
+
+private:
+    BufferPool() = default;
+    
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+    
+    mutable std::mutex m_mutex;
+    std::vector<std::string> m_free;
+    size_t m_pooledBytes = 0;
+    uint64_t m_hits = 0;
+    uint64_t m_acquires = 0;
+};
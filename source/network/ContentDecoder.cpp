@@ -0,0 +1,158 @@
+// =============================================================================
+// Switch App Store - Content Decoder Implementation
+// =============================================================================
+
+#include "ContentDecoder.hpp"
+#include <zlib.h>
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+// Output window per inflate call; decoded data is handed on in pieces this big
+constexpr size_t OUT_CHUNK = 32 * 1024;
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        char ca = a[i], cb = b[i];
+        if (ca >= 'A' && ca <= 'Z') ca = static_cast<char>(ca - 'A' + 'a');
+        if (cb >= 'A' && cb <= 'Z') cb = static_cast<char>(cb - 'A' + 'a');
+        if (ca != cb) return false;
+    }
+    return true;
+}
+
+std::string_view trim(std::string_view value) {
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) value.remove_suffix(1);
+    return value;
+}
+
+} // namespace
+
+struct ContentDecoder::Stream {
+    z_stream z;
+    bool initialized = false;
+};
+
+// =============================================================================
+// Constructor & Destructor
+// =============================================================================
+
+ContentDecoder::ContentDecoder() = default;
+
+ContentDecoder::~ContentDecoder() {
+    reset();
+}
+
+void ContentDecoder::reset() {
+    if (m_stream && m_stream->initialized) {
+        inflateEnd(&m_stream->z);
+        m_stream->initialized = false;
+    }
+    m_mode = Mode::Identity;
+    m_started = false;
+    m_ended = false;
+    m_inputBytes = 0;
+    m_outputBytes = 0;
+    m_decodeMicros = 0;
+}
+
+bool ContentDecoder::init(int windowBits) {
+    if (!m_stream) m_stream = std::make_unique<Stream>();
+    if (!m_out) m_out.reset(new char[OUT_CHUNK]);
+    
+    memset(&m_stream->z, 0, sizeof(m_stream->z));
+    if (inflateInit2(&m_stream->z, windowBits) != Z_OK) return false;
+    m_stream->initialized = true;
+    return true;
+}
+
+// =============================================================================
+// Decoding
+// =============================================================================
+
+bool ContentDecoder::begin(std::string_view contentEncoding) {
+    reset();
+    
+    contentEncoding = trim(contentEncoding);
+    if (contentEncoding.empty() || equalsIgnoreCase(contentEncoding, "identity")) {
+        return true;
+    }
+    if (equalsIgnoreCase(contentEncoding, "gzip") || equalsIgnoreCase(contentEncoding, "x-gzip")) {
+        m_mode = Mode::Gzip;
+        return true;
+    }
+    if (equalsIgnoreCase(contentEncoding, "deflate")) {
+        // zlib or raw deflate; decided by the first byte (see write)
+        m_mode = Mode::Deflate;
+        return true;
+    }
+    // Stacked encodings ("gzip, br") or ones we never asked for
+    return false;
+}
+
+bool ContentDecoder::write(const char* data, size_t size, const DecodedSink& sink) {
+    m_inputBytes += size;
+    
+    if (m_mode == Mode::Identity) {
+        m_outputBytes += size;
+        return sink(data, size);
+    }
+    if (size == 0) return true;
+    if (m_ended) return true;           // Trailing bytes after the stream
+    
+    if (!m_started) {
+        int windowBits = 16 + MAX_WBITS;
+        if (m_mode == Mode::Deflate) {
+            // "deflate" should be zlib-wrapped, but some servers send it
+            // raw. A zlib header starts with CM = 8 and CINFO <= 7.
+            unsigned char first = static_cast<unsigned char>(data[0]);
+            bool zlibHeader = (first & 0x0f) == 8 && (first >> 4) <= 7;
+            windowBits = zlibHeader ? MAX_WBITS : -MAX_WBITS;
+        }
+        if (!init(windowBits)) return false;
+        m_started = true;
+    }
+    
+    z_stream& z = m_stream->z;
+    z.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    z.avail_in = static_cast<uInt>(size);
+    
+    // -------------------------------------------------------------------------
+    // Inflate until this chunk is used up, passing on each full window
+    // -------------------------------------------------------------------------
+    while (z.avail_in > 0 || z.avail_out == 0) {
+        z.next_out = reinterpret_cast<Bytef*>(m_out.get());
+        z.avail_out = static_cast<uInt>(OUT_CHUNK);
+        
+        auto start = std::chrono::steady_clock::now();
+        int status = inflate(&z, Z_NO_FLUSH);
+        m_decodeMicros += std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        
+        if (status != Z_OK && status != Z_STREAM_END && status != Z_BUF_ERROR) {
+            return false;
+        }
+        
+        size_t produced = OUT_CHUNK - z.avail_out;
+        if (produced > 0) {
+            m_outputBytes += produced;
+            if (!sink(m_out.get(), produced)) return false;
+        }
+        
+        if (status == Z_STREAM_END) {
+            m_ended = true;
+            break;
+        }
+        if (status == Z_BUF_ERROR) break;   // Needs more input
+    }
+    return true;
+}
+
+bool ContentDecoder::finish() {
+    if (m_mode == Mode::Identity) return true;
+    // An empty body is fine; a compressed one must have reached its end
+    return !m_started || m_ended;
+}
@@ -0,0 +1,74 @@
+// =============================================================================
+// Switch App Store - Content Decoder
+// =============================================================================
+// Streaming decoder for HTTP Content-Encoding. HttpClient asks for gzip and
+// deflate bodies and runs them through zlib itself, chunk by chunk, so the
+// sink (a buffer or a streaming parser) only ever sees the decoded bytes and
+// nothing waits for the whole compressed body.
+// =============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+
+// Receives decoded output; return false to abort
+using DecodedSink = std::function<bool(const char* data, size_t size)>;
+
+// =============================================================================
+// ContentDecoder - gzip / deflate / identity
+// =============================================================================
+class ContentDecoder {
+public:
+    // Value for the Accept-Encoding request header
+    static constexpr const char* ACCEPT_ENCODING = "gzip, deflate";
+    
+    ContentDecoder();
+    ~ContentDecoder();
+    
+    ContentDecoder(const ContentDecoder&) = delete;
+    ContentDecoder& operator=(const ContentDecoder&) = delete;
+    
+    // Set up for a body with the given Content-Encoding header value ("" or
+    // "identity" pass through). Returns false for an encoding we can't read.
+    bool begin(std::string_view contentEncoding);
+    
+    // Decode the next chunk of the body into sink.
+    // Returns false if the data is corrupt or the sink aborted.
+    bool write(const char* data, size_t size, const DecodedSink& sink);
+    
+    // Returns true if the body ended cleanly (always true for identity)
+    bool finish();
+    
+    // True if begin() selected gzip or deflate
+    bool isCompressed() const { return m_mode != Mode::Identity; }
+    
+    // Body bytes in, decoded bytes out, and time spent inflating
+    uint64_t inputBytes() const { return m_inputBytes; }
+    uint64_t outputBytes() const { return m_outputBytes; }
+    uint64_t decodeMicros() const { return m_decodeMicros; }
+
+private:
+    enum class Mode : uint8_t {
+        Identity,
+        Gzip,
+        Deflate
+    };
+    
+    bool init(int windowBits);
+    void reset();
+    
+    struct Stream;                          // z_stream, kept out of this header
+    std::unique_ptr<Stream> m_stream;
+    std::unique_ptr<char[]> m_out;          // Inflate output window
+    
+    Mode m_mode = Mode::Identity;
+    bool m_started = false;                 // Any deflate input seen yet
+    bool m_ended = false;                   // Z_STREAM_END reached
+    uint64_t m_inputBytes = 0;
+    uint64_t m_outputBytes = 0;
+    uint64_t m_decodeMicros = 0;
+};
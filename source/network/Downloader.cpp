@@ -43,7 +43,6 @@ Downloader& Downloader::getInstance() {
 
 void Downloader::init(const std::string& downloadDir) {
     m_downloadDir = downloadDir;
-    m_httpClient = std::make_unique<HttpClient>();
     
     // Create download directory
     mkdir(downloadDir.c_str(), 0755);
@@ -51,8 +50,10 @@ void Downloader::init(const std::string& downloadDir) {
 
 void Downloader::shutdown() {
     // Cancel any active download
-    m_cancelRequested = true;
-    m_httpClient.reset();
+    for (const auto& transfer : m_transfers) {
+        HttpEngine::getInstance().cancel(transfer.second);
+    }
+    m_transfers.clear();
     m_downloads.clear();
 }
 
@@ -83,9 +84,9 @@ std::string Downloader::addDownload(const std::string& name, const std::string&
 void Downloader::removeDownload(const std::string& id) {
     for (auto it = m_downloads.begin(); it != m_downloads.end(); ++it) {
         if (it->id == id) {
-            // If this is the active download, request cancel
+            // If this is an active download, stop its transfer
             if (it->status == DownloadStatus::Downloading) {
-                m_cancelRequested = true;
+                cancelTransfer(id);
             }
             
             // Mark as cancelled but don't remove yet
@@ -124,7 +125,7 @@ DownloadItem* Downloader::getDownload(const std::string& id) {
 void Downloader::pause(const std::string& id) {
     DownloadItem* item = getDownload(id);
     if (item && item->status == DownloadStatus::Downloading) {
-        m_cancelRequested = true;
+        cancelTransfer(id);
         item->status = DownloadStatus::Paused;
     }
 }
@@ -138,12 +139,14 @@ void Downloader::resume(const std::string& id) {
 
 void Downloader::pauseAll() {
     for (auto& item : m_downloads) {
+        if (item.status == DownloadStatus::Downloading) {
+            cancelTransfer(item.id);
+        }
         if (item.status == DownloadStatus::Downloading ||
             item.status == DownloadStatus::Queued) {
             item.status = DownloadStatus::Paused;
         }
     }
-    m_cancelRequested = true;
 }
 
 void Downloader::resumeAll() {
@@ -171,69 +174,98 @@ void Downloader::update() {
         }
     }
     
-    // Start next download if none active
-    if (m_currentDownloads < m_maxConcurrent) {
-        startNextDownload();
+    // Start queued downloads up to the concurrency limit
+    while (static_cast<int>(m_transfers.size()) < m_maxConcurrent) {
+        if (!startNextDownload()) break;
     }
 }
 
-void Downloader::startNextDownload() {
+bool Downloader::startNextDownload() {
     // Find next queued download
-    int index = -1;
-    for (size_t i = 0; i < m_downloads.size(); i++) {
-        if (m_downloads[i].status == DownloadStatus::Queued) {
-            index = static_cast<int>(i);
+    DownloadItem* next = nullptr;
+    for (auto& item : m_downloads) {
+        if (item.status == DownloadStatus::Queued) {
+            next = &item;
             break;
         }
     }
     
-    if (index < 0) return;
+    if (!next) return false;
     
-    DownloadItem& item = m_downloads[index];
+    DownloadItem& item = *next;
     item.status = DownloadStatus::Downloading;
-    m_activeIndex = index;
-    m_currentDownloads++;
-    m_cancelRequested = false;
+    item.error.clear();
     
-    // Download with progress callback
-    bool success = m_httpClient->downloadFile(
-        item.url,
-        item.outputPath,
-        [this, index](size_t downloaded, size_t total) {
-            if (index < static_cast<int>(m_downloads.size())) {
-                m_downloads[index].downloadedBytes = downloaded;
-                m_downloads[index].totalBytes = total;
-                
-                if (m_onProgress) {
-                    m_onProgress(m_downloads[index]);
-                }
-            }
+    // -------------------------------------------------------------------------
+    // Stream to disk on the engine thread. Callbacks look the item up by id:
+    // the list may have changed by the time they run.
+    // -------------------------------------------------------------------------
+    HttpRequest request;
+    request.url = item.url;
+    request.outputPath = item.outputPath;
+    request.options.timeoutSeconds = 0;             // Large files take a while
+    request.options.acceptCompressed = false;       // Packages are compressed already
+
+    std::string id = item.id;
+    request.onProgress = [this, id](size_t downloaded, size_t total) {
+        DownloadItem* progressed = getDownload(id);
+        if (!progressed) return;
+        progressed->downloadedBytes = downloaded;
+        progressed->totalBytes = total;
+
+        if (m_onProgress) {
+            m_onProgress(*progressed);
         }
-    );
+    };
+    request.onComplete = [this, id](const HttpResponse& response) {
+        onTransferDone(id, response);
+    };
     
-    // Update status
-    if (m_cancelRequested) {
-        // Was cancelled during download
-        if (item.status != DownloadStatus::Paused) {
-            item.status = DownloadStatus::Cancelled;
-        }
-    } else if (success) {
-        item.status = DownloadStatus::Completed;
-        item.downloadedBytes = item.totalBytes;
-    } else {
+    HttpHandle handle = HttpEngine::getInstance().submit(std::move(request));
+    if (handle == 0) {
         item.status = DownloadStatus::Failed;
         item.error = "Download failed";
+        if (m_onComplete) {
+            m_onComplete(item, false);
+        }
+        return true;
     }
+    m_transfers[id] = handle;
+    return true;
+}
+
+void Downloader::onTransferDone(const std::string& id, const HttpResponse& response) {
+    m_transfers.erase(id);
     
-    m_currentDownloads--;
-    m_activeIndex = -1;
+    DownloadItem* item = getDownload(id);
+    if (!item) return;
+
+    // Paused or removed downloads cancel their transfer, so this is the
+    // outcome of one still marked Downloading
+    bool success = response.isSuccess();
+    if (success) {
+        item->status = DownloadStatus::Completed;
+        item->downloadedBytes = item->totalBytes;
+    } else {
+        item->status = DownloadStatus::Failed;
+        item->error = "Download failed";
+    }
     
     // Fire completion callback
     if (m_onComplete) {
-        m_onComplete(item, success);
+        m_onComplete(*item, success);
     }
 }
 
+void Downloader::cancelTransfer(const std::string& id) {
+    auto it = m_transfers.find(id);
+    if (it == m_transfers.end()) return;
+
+    // The engine removes the partial file
+    HttpEngine::getInstance().cancel(it->second);
+    m_transfers.erase(it);
+}
+
 bool Downloader::hasActiveDownload() const {
     for (const auto& item : m_downloads) {
         if (item.status == DownloadStatus::Downloading) {
@@ -6,9 +6,10 @@
 
 #pragma once
 
-#include "HttpClient.hpp"
+#include "HttpEngine.hpp"
 #include <string>
 #include <vector>
+#include <map>
 #include <queue>
 #include <functional>
 #include <memory>
@@ -111,7 +112,8 @@ public:
     // Processing
     // -------------------------------------------------------------------------
     
-    // Process downloads (call each frame)
+    // Process downloads (call each frame). Transfers run on the HttpEngine;
+    // progress and completion arrive through its pump().
     void update();
     
     // Check if any download is active
@@ -143,8 +145,11 @@ private:
     Downloader& operator=(const Downloader&) = delete;
     
     // Internal download processing
-    void startNextDownload();
-    void processActiveDownload();
+    bool startNextDownload();
+    void onTransferDone(const std::string& id, const HttpResponse& response);
+    
+    // Abort the running transfer of a download, if any
+    void cancelTransfer(const std::string& id);
     
     // Generate unique ID
     std::string generateId();
@@ -155,19 +160,14 @@ private:
     
     std::string m_downloadDir;
     std::vector<DownloadItem> m_downloads;
-    std::unique_ptr<HttpClient> m_httpClient;
     
     int m_maxConcurrent = 1;
-    int m_currentDownloads = 0;
     int m_nextId = 1;
     
-    // Currently active download index
-    int m_activeIndex = -1;
+    // Download id -> engine transfer, for every download in Downloading
+    std::map<std::string, HttpHandle> m_transfers;
     
     // Callbacks
     DownloadProgressCallback m_onProgress;
     DownloadCompleteCallback m_onComplete;
-    
-    // Request to cancel current download
-    bool m_cancelRequested = false;
 };
@@ -0,0 +1,728 @@
+// =============================================================================
+// Switch App Store - HTTP Cache Implementation
+// =============================================================================
+
+#include "HttpCache.hpp"
+#include "HttpEngine.hpp"
+#include "HttpSink.hpp"
+#include "utils/FileUtils.hpp"
+#include <curl/curl.h>
+#include <json.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+constexpr const char* INDEX_FILE = "index.json";
+constexpr int INDEX_VERSION = 1;
+
+// Response headers that describe the transfer rather than the content: the
+// body is stored decoded, and the age is worked out again on every use
+bool isTransferHeader(std::string_view name) {
+    return name == "content-encoding" || name == "content-length" ||
+           name == "transfer-encoding" || name == "connection" ||
+           name == "keep-alive" || name == "age" || name == "set-cookie";
+}
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        char x = (a[i] >= 'A' && a[i] <= 'Z') ? static_cast<char>(a[i] - 'A' + 'a') : a[i];
+        char y = (b[i] >= 'A' && b[i] <= 'Z') ? static_cast<char>(b[i] - 'A' + 'a') : b[i];
+        if (x != y) return false;
+    }
+    return true;
+}
+
+std::string_view trim(std::string_view value) {
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) value.remove_suffix(1);
+    return value;
+}
+
+// Calls fn(token) for each comma-separated, trimmed token of value
+template <typename Fn>
+void forEachToken(std::string_view value, Fn fn) {
+    while (!value.empty()) {
+        size_t comma = value.find(',');
+        std::string_view token = trim(value.substr(0, comma));
+        if (!token.empty()) fn(token);
+        if (comma == std::string_view::npos) break;
+        value.remove_prefix(comma + 1);
+    }
+}
+
+// delta-seconds; -1 if malformed. Overlong values saturate.
+int64_t parseSeconds(std::string_view value) {
+    if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+        value = value.substr(1, value.size() - 2);
+    }
+    if (value.empty()) return -1;
+    int64_t seconds = 0;
+    for (char c : value) {
+        if (c < '0' || c > '9') return -1;
+        if (seconds < (int64_t(1) << 40)) seconds = seconds * 10 + (c - '0');
+    }
+    return seconds;
+}
+
+// An HTTP date as seconds since the epoch; -1 if absent or unreadable
+int64_t parseDate(std::string_view value) {
+    if (value.empty()) return -1;
+    return static_cast<int64_t>(curl_getdate(std::string(value).c_str(), nullptr));
+}
+
+// -----------------------------------------------------------------------------
+// What a response allows a private cache to do with it (RFC 7234 sections 3
+// and 4.2, RFC 5861)
+// -----------------------------------------------------------------------------
+struct Policy {
+    bool storable = false;
+    int64_t initialAge = 0;
+    int64_t freshFor = 0;
+    int64_t staleWhileRevalidate = 0;
+    int64_t staleIfError = 0;
+    bool noCache = false;
+    bool mustRevalidate = false;
+};
+
+Policy policyFor(const HttpResponse& response, int64_t requestTime, int64_t responseTime) {
+    Policy policy;
+    
+    // Only complete 200s; the API has nothing else worth keeping
+    if (!response.error.empty() || response.statusCode != 200) return policy;
+    
+    const HttpHeaders& headers = response.headers;
+    bool noStore = false;
+    bool hasCacheControl = false;
+    int64_t maxAge = -1;
+    for (size_t i = 0; i < headers.size(); i++) {
+        if (headers.name(i) != "cache-control") continue;
+        hasCacheControl = true;
+        forEachToken(headers.value(i), [&](std::string_view directive) {
+            size_t eq = directive.find('=');
+            std::string_view name = trim(directive.substr(0, eq));
+            std::string_view arg = eq == std::string_view::npos
+                ? std::string_view() : trim(directive.substr(eq + 1));
+            
+            // no-cache="field" only restricts those fields; treating it
+            // like plain no-cache is stricter, never wrong
+            if (equalsIgnoreCase(name, "no-store")) noStore = true;
+            else if (equalsIgnoreCase(name, "no-cache")) policy.noCache = true;
+            else if (equalsIgnoreCase(name, "must-revalidate")) policy.mustRevalidate = true;
+            else if (equalsIgnoreCase(name, "max-age")) maxAge = parseSeconds(arg);
+            else if (equalsIgnoreCase(name, "stale-while-revalidate")) {
+                policy.staleWhileRevalidate = std::max<int64_t>(0, parseSeconds(arg));
+            } else if (equalsIgnoreCase(name, "stale-if-error")) {
+                policy.staleIfError = std::max<int64_t>(0, parseSeconds(arg));
+            }
+        });
+    }
+    if (noStore) return policy;
+    
+    // HTTP/1.0 servers say it this way
+    if (!hasCacheControl && headers.find("pragma").find("no-cache") != std::string_view::npos) {
+        policy.noCache = true;
+    }
+    
+    // The key is the URL alone, so only answers that don't vary with the
+    // request can be kept. Encodings don't matter: bodies are stored decoded.
+    bool variesOnRequest = false;
+    forEachToken(headers.find("vary"), [&](std::string_view field) {
+        if (!equalsIgnoreCase(field, "accept-encoding")) variesOnRequest = true;
+    });
+    if (variesOnRequest) return policy;
+    
+    // Age it had on arrival: the server's Age plus the time the request took.
+    // Date vs. our own clock would count console clock skew as age.
+    int64_t age = std::max<int64_t>(0, parseSeconds(headers.find("age")));
+    policy.initialAge = age + std::max<int64_t>(0, responseTime - requestTime);
+    
+    // Freshness lifetime: max-age, else Expires - Date, else a tenth of the
+    // time since Last-Modified (both ends on the server's clock)
+    int64_t date = parseDate(headers.find("date"));
+    if (date < 0) date = responseTime;
+    std::string_view expires = headers.find("expires");
+    int64_t lastModified = parseDate(headers.find("last-modified"));
+    if (maxAge >= 0) {
+        policy.freshFor = maxAge;
+    } else if (!expires.empty()) {
+        int64_t expiresAt = parseDate(expires);
+        policy.freshFor = expiresAt > date ? expiresAt - date : 0;   // Invalid: expired
+    } else if (lastModified >= 0 && lastModified < date) {
+        policy.freshFor = std::min((date - lastModified) / 10, HttpCache::MAX_HEURISTIC_SECONDS);
+    }
+    
+    // Worth keeping if it can be served as is, or revalidated cheaply
+    bool hasValidator = headers.has("etag") || headers.has("last-modified");
+    bool usable = !policy.noCache &&
+        (policy.freshFor > 0 || policy.staleWhileRevalidate > 0 || policy.staleIfError > 0);
+    policy.storable = usable || hasValidator;
+    return policy;
+}
+
+} // namespace
+
+// =============================================================================
+// Background revalidation
+// =============================================================================
+// Buffers the refreshed body on the engine thread and hands the result to
+// the cache from end(), so no pump() is needed for the entry to update.
+class HttpCache::RevalidateSink : public BufferSink {
+public:
+    RevalidateSink(std::string url, int64_t requestTime)
+        : m_url(std::move(url)), m_requestTime(requestTime) {}
+    
+    void end(HttpResponse& response) override {
+        BufferSink::end(response);
+        HttpCache::getInstance().finishRevalidation(m_url, response, m_requestTime);
+    }
+
+private:
+    std::string m_url;
+    int64_t m_requestTime;
+};
+
+// =============================================================================
+// Singleton
+// =============================================================================
+
+HttpCache& HttpCache::getInstance() {
+    static HttpCache instance;
+    return instance;
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+bool HttpCache::init(const std::string& directory, size_t maxBytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_directory = directory;
+    m_maxBytes = maxBytes;
+    m_entries.clear();
+    m_index.clear();
+    m_bytes = 0;
+    
+    mkdir(directory.c_str(), 0755);
+    struct stat st;
+    if (stat(directory.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) {
+        m_enabled = false;
+        return false;
+    }
+    
+    loadIndex();
+    removeOrphans();
+    evictOverBudget();
+    m_enabled = true;
+    if (m_dirty) saveIndex();
+    return true;
+}
+
+void HttpCache::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_enabled && m_dirty) saveIndex();
+}
+
+void HttpCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_enabled) return;
+    while (!m_entries.empty()) {
+        erase(m_entries.begin());
+    }
+    saveIndex();
+}
+
+bool HttpCache::isEnabled() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_enabled;
+}
+
+bool HttpCache::canUse(const HttpOptions& options) {
+    for (const auto& header : options.headers) {
+        const std::string& name = header.first;
+        if (equalsIgnoreCase(name, "if-none-match") || equalsIgnoreCase(name, "if-modified-since") ||
+            equalsIgnoreCase(name, "if-match") || equalsIgnoreCase(name, "if-unmodified-since") ||
+            equalsIgnoreCase(name, "if-range") || equalsIgnoreCase(name, "range") ||
+            equalsIgnoreCase(name, "authorization")) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int64_t HttpCache::now() {
+    return static_cast<int64_t>(time(nullptr));
+}
+
+// =============================================================================
+// Lookup
+// =============================================================================
+
+HttpCacheLookup HttpCache::lookup(const std::string& url, const HttpOptions& options) {
+    HttpCacheLookup result;
+    bool stale = false;
+    bool revalidate = false;
+    std::string etag, lastModified;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_enabled) return result;
+        
+        auto found = m_index.find(url);
+        if (found == m_index.end()) {
+            m_stats.misses++;
+            return result;
+        }
+        
+        Entry& entry = *found->second;
+        touch(found->second);
+        int64_t age = currentAge(entry, now());
+        
+        if (!entry.noCache && age < entry.freshFor) {
+            // Fresh: served as is
+        } else if (!entry.noCache && !entry.mustRevalidate &&
+                   age < entry.freshFor + entry.staleWhileRevalidate) {
+            // Served now, refreshed for next time (one refresh at a time)
+            stale = true;
+            if (!entry.revalidating) {
+                entry.revalidating = true;
+                revalidate = true;
+                etag = entry.etag;
+                lastModified = entry.lastModified;
+            }
+        } else if (!entry.etag.empty() || !entry.lastModified.empty()) {
+            m_stats.misses++;
+            result.state = HttpCacheState::Revalidate;
+            result.etag = entry.etag;
+            result.lastModified = entry.lastModified;
+            return result;
+        } else {
+            // Stale with nothing to revalidate against: fetch it again
+            m_stats.misses++;
+            return result;
+        }
+    }
+    
+    int64_t bodySize = loadEntry(url, result.response);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (bodySize < 0) {
+            // The entry went with its file; fetch it like any other miss
+            m_stats.misses++;
+            result.response = HttpResponse();
+            return result;
+        }
+        if (stale) m_stats.staleHits++;
+        else m_stats.hits++;
+        m_stats.bytesSaved += static_cast<uint64_t>(bodySize);
+    }
+    
+    result.state = stale ? HttpCacheState::Stale : HttpCacheState::Fresh;
+    if (revalidate) revalidateAsync(url, options, etag, lastModified);
+    return result;
+}
+
+bool HttpCache::notModified(const std::string& url, HttpResponse& response, int64_t requestTime) {
+    int64_t bodySize = refresh(url, response, requestTime);
+    if (bodySize < 0) return false;
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.revalidated++;
+    m_stats.bytesSaved += static_cast<uint64_t>(bodySize);
+    return true;
+}
+
+bool HttpCache::serveStale(const std::string& url, HttpResponse& response) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_enabled) return false;
+        auto found = m_index.find(url);
+        if (found == m_index.end()) return false;
+        
+        const Entry& entry = *found->second;
+        if (entry.mustRevalidate) return false;
+        if (currentAge(entry, now()) >= entry.freshFor + entry.staleIfError) return false;
+    }
+    
+    HttpResponse cached;
+    int64_t bodySize = loadEntry(url, cached);
+    if (bodySize < 0) return false;
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.staleHits++;
+    m_stats.bytesSaved += static_cast<uint64_t>(bodySize);
+    response = std::move(cached);
+    return true;
+}
+
+// =============================================================================
+// Storing
+// =============================================================================
+
+void HttpCache::store(const std::string& url, const HttpResponse& response, int64_t requestTime) {
+    int64_t responseTime = now();
+    Policy policy = policyFor(response, requestTime, responseTime);
+    
+    // Headers, a blank line, then the decoded body
+    std::string data;
+    if (policy.storable) {
+        const HttpHeaders& headers = response.headers;
+        size_t headerBytes = 0;
+        for (size_t i = 0; i < headers.size(); i++) {
+            headerBytes += headers.name(i).size() + headers.value(i).size() + 3;
+        }
+        data.reserve(headerBytes + 1 + response.body.size());
+        for (size_t i = 0; i < headers.size(); i++) {
+            if (isTransferHeader(headers.name(i))) continue;
+            data.append(headers.name(i)).append(": ").append(headers.value(i)).push_back('\n');
+        }
+        data.push_back('\n');
+        data.append(response.body);
+    }
+    
+    std::string file;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_enabled) return;
+        
+        // Not storable replaces (and so removes) what was cached
+        if (!policy.storable || data.size() > m_maxBytes / MAX_ENTRY_FRACTION) {
+            auto found = m_index.find(url);
+            if (found != m_index.end()) erase(found->second);
+            saveIndexIfDue();
+            return;
+        }
+        
+        char name[24];
+        snprintf(name, sizeof(name), "%08llx.res", static_cast<unsigned long long>(m_nextFile++));
+        file = name;
+    }
+    
+    // Written outside the lock to a new file, so readers of the old one
+    // are never looking at a half-written replacement
+    std::string path = pathOf(file);
+    FILE* out = fopen(path.c_str(), "wb");
+    if (!out) return;
+    bool ok = fwrite(data.data(), 1, data.size(), out) == data.size();
+    ok = fclose(out) == 0 && ok;
+    if (!ok) {
+        remove(path.c_str());
+        return;
+    }
+    
+    Entry entry;
+    entry.url = url;
+    entry.file = file;
+    entry.size = data.size();
+    entry.bodySize = response.body.size();
+    entry.storedAt = responseTime;
+    entry.initialAge = policy.initialAge;
+    entry.freshFor = policy.freshFor;
+    entry.staleWhileRevalidate = policy.staleWhileRevalidate;
+    entry.staleIfError = policy.staleIfError;
+    entry.noCache = policy.noCache;
+    entry.mustRevalidate = policy.mustRevalidate;
+    entry.etag = std::string(response.headers.find("etag"));
+    entry.lastModified = std::string(response.headers.find("last-modified"));
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_enabled) {
+        remove(path.c_str());
+        return;
+    }
+    auto found = m_index.find(url);
+    if (found != m_index.end()) erase(found->second);
+    
+    m_entries.push_back(std::move(entry));
+    m_index[url] = std::prev(m_entries.end());
+    m_bytes += data.size();
+    m_dirty = true;
+    
+    evictOverBudget();
+    saveIndexIfDue();
+}
+
+void HttpCache::invalidate(const std::string& url) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_enabled) return;
+    auto found = m_index.find(url);
+    if (found == m_index.end()) return;
+    erase(found->second);
+    saveIndexIfDue();
+}
+
+int64_t HttpCache::refresh(const std::string& url, HttpResponse& response, int64_t requestTime) {
+    HttpResponse cached;
+    int64_t bodySize = loadEntry(url, cached);
+    if (bodySize < 0) return -1;
+    
+    // The 304's headers replace the stored ones of the same name (RFC 7234
+    // section 4.3.4); the body stays
+    HttpHeaders merged;
+    for (size_t i = 0; i < cached.headers.size(); i++) {
+        std::string_view name = cached.headers.name(i);
+        if (name != "age" && !response.headers.has(name)) merged.add(name, cached.headers.value(i));
+    }
+    for (size_t i = 0; i < response.headers.size(); i++) {
+        merged.add(response.headers.name(i), response.headers.value(i));
+    }
+    cached.headers = std::move(merged);
+    
+    store(url, cached, requestTime);
+    response = std::move(cached);
+    return bodySize;
+}
+
+// =============================================================================
+// Background revalidation
+// =============================================================================
+
+void HttpCache::revalidateAsync(const std::string& url, const HttpOptions& options,
+                                const std::string& etag, const std::string& lastModified) {
+    HttpRequest request;
+    request.url = url;
+    request.options = options;
+    if (!etag.empty()) request.options.headers["If-None-Match"] = etag;
+    if (!lastModified.empty()) request.options.headers["If-Modified-Since"] = lastModified;
+    request.sink = std::make_shared<RevalidateSink>(url, now());
+    
+    if (HttpEngine::getInstance().submit(std::move(request)) != 0) return;
+    
+    // Engine not running: try again on a later lookup
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_index.find(url);
+    if (found != m_index.end()) found->second->revalidating = false;
+}
+
+void HttpCache::finishRevalidation(const std::string& url, HttpResponse& response,
+                                   int64_t requestTime) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_index.find(url);
+        if (found != m_index.end()) found->second->revalidating = false;
+    }
+    
+    // Counted already, as the stale hit that started it
+    if (response.isNotModified()) {
+        refresh(url, response, requestTime);
+        return;
+    }
+    
+    // A failed refresh keeps the stale copy for the next lookup
+    if (!response.error.empty() || response.statusCode >= 500) return;
+    store(url, response, requestTime);
+}
+
+// =============================================================================
+// Entries
+// =============================================================================
+
+int64_t HttpCache::loadEntry(const std::string& url, HttpResponse& response) {
+    std::string file;
+    uint64_t size = 0, bodySize = 0;
+    int64_t age = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto found = m_index.find(url);
+        if (found == m_index.end()) return -1;
+        const Entry& entry = *found->second;
+        file = entry.file;
+        size = entry.size;
+        bodySize = entry.bodySize;
+        age = currentAge(entry, now());
+    }
+    
+    if (readEntry(pathOf(file), size, bodySize, response)) {
+        response.headers.add("age", std::to_string(age));
+        return static_cast<int64_t>(bodySize);
+    }
+    
+    // Damaged or removed behind our back; unless it was replaced meanwhile,
+    // the entry is useless
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_index.find(url);
+    if (found != m_index.end() && found->second->file == file) erase(found->second);
+    return -1;
+}
+
+bool HttpCache::readEntry(const std::string& path, uint64_t size, uint64_t bodySize,
+                          HttpResponse& response) const {
+    std::string data;
+    if (!FileUtils::readFile(path, data) || data.size() != size) return false;
+    
+    response.headers.clear();
+    size_t pos = 0;
+    for (;;) {
+        size_t end = data.find('\n', pos);
+        if (end == std::string::npos) return false;
+        if (end == pos) {
+            pos++;
+            break;
+        }
+        response.headers.addLine(std::string_view(data).substr(pos, end - pos));
+        pos = end + 1;
+    }
+    if (data.size() - pos != bodySize) return false;
+    
+    // The body is the tail of what was read; drop the headers in front
+    data.erase(0, pos);
+    response.body = std::move(data);
+    response.statusCode = 200;
+    response.error.clear();
+    return true;
+}
+
+int64_t HttpCache::currentAge(const Entry& entry, int64_t time) const {
+    // A clock set back since then makes it no younger than on arrival
+    return entry.initialAge + std::max<int64_t>(0, time - entry.storedAt);
+}
+
+void HttpCache::touch(EntryList::iterator it) {
+    if (std::next(it) == m_entries.end()) return;
+    m_entries.splice(m_entries.end(), m_entries, it);
+    m_dirty = true;
+}
+
+void HttpCache::erase(EntryList::iterator it) {
+    remove(pathOf(it->file).c_str());
+    m_bytes -= it->size;
+    m_index.erase(it->url);
+    m_entries.erase(it);
+    m_dirty = true;
+}
+
+void HttpCache::evictOverBudget() {
+    while (m_bytes > m_maxBytes && !m_entries.empty()) {
+        erase(m_entries.begin());
+        m_stats.evictions++;
+    }
+}
+
+std::string HttpCache::pathOf(const std::string& file) const {
+    return m_directory + "/" + file;
+}
+
+HttpCacheStats HttpCache::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    HttpCacheStats stats = m_stats;
+    stats.entries = m_entries.size();
+    stats.bytes = m_bytes;
+    return stats;
+}
+
+// =============================================================================
+// Index
+// =============================================================================
+
+void HttpCache::loadIndex() {
+    m_dirty = false;
+    
+    std::string content;
+    if (!FileUtils::readFile(pathOf(INDEX_FILE), content)) return;
+    
+    json::Document doc = json::parseDocument(std::move(content));
+    if (doc["version"].asInt(0) != INDEX_VERSION) {
+        m_dirty = true;
+        return;
+    }
+    m_nextFile = std::max<uint64_t>(m_nextFile, doc["nextFile"].asUInt64(1));
+    
+    // Least recently used first, as saved
+    const json::Node& entries = doc["entries"];
+    for (size_t i = 0; i < entries.size(); i++) {
+        const json::Node& item = entries[i];
+        
+        Entry entry;
+        entry.url = item["url"].asString();
+        entry.file = item["file"].asString();
+        entry.size = item["size"].asUInt64();
+        entry.bodySize = item["body"].asUInt64();
+        entry.storedAt = item["stored"].asInt64();
+        entry.initialAge = item["age"].asInt64();
+        entry.freshFor = item["fresh"].asInt64();
+        entry.staleWhileRevalidate = item["swr"].asInt64();
+        entry.staleIfError = item["sie"].asInt64();
+        entry.noCache = item["noCache"].asBool();
+        entry.mustRevalidate = item["mustRevalidate"].asBool();
+        entry.etag = item["etag"].asString();
+        entry.lastModified = item["lastModified"].asString();
+        
+        // Files lost since the index was written are dropped with their
+        // entry; the orphan sweep removes any that are left half-written
+        struct stat st;
+        if (entry.url.empty() || entry.file.empty() || m_index.count(entry.url) ||
+            stat(pathOf(entry.file).c_str(), &st) != 0 ||
+            static_cast<uint64_t>(st.st_size) != entry.size) {
+            m_dirty = true;
+            continue;
+        }
+        
+        m_bytes += entry.size;
+        m_entries.push_back(std::move(entry));
+        m_index[m_entries.back().url] = std::prev(m_entries.end());
+    }
+}
+
+void HttpCache::removeOrphans() {
+    // Stored since the index was last saved, or replaced before a crash
+    std::unordered_set<std::string> known;
+    for (const Entry& entry : m_entries) {
+        known.insert(entry.file);
+    }
+    
+    DIR* dir = opendir(m_directory.c_str());
+    if (!dir) return;
+    
+    std::vector<std::string> orphans;
+    struct dirent* item;
+    while ((item = readdir(dir)) != nullptr) {
+        std::string name = item->d_name;
+        if (name.size() < 4 || name.compare(name.size() - 4, 4, ".res") != 0) continue;
+        if (!known.count(name)) orphans.push_back(name);
+    }
+    closedir(dir);
+    
+    for (const std::string& name : orphans) {
+        remove(pathOf(name).c_str());
+    }
+}
+
+void HttpCache::saveIndex() {
+    json::Writer writer;
+    writer.beginObject()
+        .key("version").value(INDEX_VERSION)
+        .key("nextFile").value(m_nextFile)
+        .key("entries").beginArray();
+    for (const Entry& entry : m_entries) {
+        writer.beginObject()
+            .key("url").value(entry.url)
+            .key("file").value(entry.file)
+            .key("size").value(entry.size)
+            .key("body").value(entry.bodySize)
+            .key("stored").value(entry.storedAt)
+            .key("age").value(entry.initialAge)
+            .key("fresh").value(entry.freshFor)
+            .key("swr").value(entry.staleWhileRevalidate)
+            .key("sie").value(entry.staleIfError)
+            .key("noCache").value(entry.noCache)
+            .key("mustRevalidate").value(entry.mustRevalidate)
+            .key("etag").value(entry.etag)
+            .key("lastModified").value(entry.lastModified)
+            .endObject();
+    }
+    writer.endArray().endObject();
+    
+    if (FileUtils::writeFileAtomic(pathOf(INDEX_FILE), writer.str())) {
+        m_dirty = false;
+        m_savedAt = now();
+    }
+}
+
+void HttpCache::saveIndexIfDue() {
+    if (m_dirty && now() - m_savedAt >= INDEX_SAVE_SECONDS) saveIndex();
+}
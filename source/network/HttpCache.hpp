@@ -0,0 +1,205 @@
+// =============================================================================
+// Switch App Store - HTTP Cache
+// =============================================================================
+// Private on-disk cache for API GETs, following RFC 7234: responses are kept
+// as long as their Cache-Control / Expires say they are fresh, revalidated
+// with If-None-Match / If-Modified-Since once they are not, and served stale
+// within stale-while-revalidate (refreshing in the background) or
+// stale-if-error (when the network fails). HttpClient::get and HttpEngine's
+// buffered GETs go through it on their own; callers see an ordinary 200
+// either way.
+//
+// Each response is one file (headers, blank line, body) in the cache
+// directory; an index.json next to them keeps the metadata in LRU order.
+// The total size of the files is held to a byte budget by evicting the
+// least recently used entries.
+// =============================================================================
+
+#pragma once
+
+#include "HttpClient.hpp"
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// =============================================================================
+// Lookup result for one GET
+// =============================================================================
+enum class HttpCacheState {
+    Miss,           // Nothing usable; fetch normally
+    Fresh,          // response is the cached answer
+    Stale,          // response is the cached answer, a refresh is under way
+    Revalidate      // Send the validators; on 304 ask notModified()
+};
+
+struct HttpCacheLookup {
+    HttpCacheState state = HttpCacheState::Miss;
+    HttpResponse response;              // Fresh / Stale
+    std::string etag;                   // Revalidate: If-None-Match
+    std::string lastModified;           // Revalidate: If-Modified-Since
+};
+
+// =============================================================================
+// Counters since startup
+// =============================================================================
+struct HttpCacheStats {
+    uint64_t hits = 0;                  // Answered fresh from disk
+    uint64_t staleHits = 0;             // Answered stale (while-revalidate / if-error)
+    uint64_t misses = 0;                // Needed the network, revalidations included
+    uint64_t revalidated = 0;           // ...of which came back 304
+    uint64_t bytesSaved = 0;            // Body bytes served from disk instead
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t bytes = 0;                   // On disk, against the budget
+};
+
+// =============================================================================
+// HttpCache - RFC 7234 response cache with an LRU byte budget
+// =============================================================================
+class HttpCache {
+public:
+    // -------------------------------------------------------------------------
+    // Singleton access
+    // -------------------------------------------------------------------------
+    static HttpCache& getInstance();
+    
+    // -------------------------------------------------------------------------
+    // Lifecycle
+    // -------------------------------------------------------------------------
+    
+    // Load the index from directory (created if missing) and drop files it
+    // doesn't know. Until this is called the cache stays out of the way.
+    bool init(const std::string& directory, size_t maxBytes = DEFAULT_MAX_BYTES);
+    
+    // Write the index if it changed (call at shutdown, after HttpEngine::stop)
+    void flush();
+    
+    // Remove every entry and its file
+    void clear();
+    
+    bool isEnabled() const;
+    
+    // Requests the cache keeps out of: conditional, ranged or authorized
+    // ones, whose answers depend on more than the URL
+    static bool canUse(const HttpOptions& options);
+    
+    // -------------------------------------------------------------------------
+    // Used by HttpClient::get and HttpEngine (any thread)
+    // -------------------------------------------------------------------------
+    
+    // What the cache holds for a GET of url. A Stale answer has already
+    // started its background revalidation on the HttpEngine, with options.
+    HttpCacheLookup lookup(const std::string& url, const HttpOptions& options);
+    
+    // A 304 for url: store its updated headers with the cached body and
+    // turn response into that 200. False if the entry went away meanwhile.
+    bool notModified(const std::string& url, HttpResponse& response, int64_t requestTime);
+    
+    // The network failed (error or 5xx): replace response with the cached
+    // copy if stale-if-error still allows it
+    bool serveStale(const std::string& url, HttpResponse& response);
+    
+    // Keep a response fetched from the network, if it may be stored;
+    // otherwise forget what was cached for url. requestTime is when the
+    // request went out (now()).
+    void store(const std::string& url, const HttpResponse& response, int64_t requestTime);
+    
+    // Forget url (after a successful unsafe request to it)
+    void invalidate(const std::string& url);
+    
+    HttpCacheStats getStats() const;
+    
+    // Seconds since the epoch; the clock freshness is measured with
+    static int64_t now();
+    
+    // Budget for all cached files
+    static constexpr size_t DEFAULT_MAX_BYTES = 4 * 1024 * 1024;
+    
+    // Bodies above budget / this aren't stored, so one can't flush the rest
+    static constexpr size_t MAX_ENTRY_FRACTION = 8;
+    
+    // Longest freshness guessed from Last-Modified alone
+    static constexpr int64_t MAX_HEURISTIC_SECONDS = 24 * 60 * 60;
+    
+    // Unsaved index changes are written out at most this often
+    static constexpr int64_t INDEX_SAVE_SECONDS = 30;
+
+private:
+    HttpCache() = default;
+    
+    HttpCache(const HttpCache&) = delete;
+    HttpCache& operator=(const HttpCache&) = delete;
+    
+    struct Entry {
+        std::string url;
+        std::string file;               // Name in m_directory
+        uint64_t size = 0;              // File bytes
+        uint64_t bodySize = 0;
+        int64_t storedAt = 0;           // now() when the response arrived
+        int64_t initialAge = 0;         // Age it already had then
+        int64_t freshFor = 0;           // Freshness lifetime
+        int64_t staleWhileRevalidate = 0;
+        int64_t staleIfError = 0;
+        bool noCache = false;           // Revalidate before every use
+        bool mustRevalidate = false;    // Never serve it stale
+        std::string etag;
+        std::string lastModified;
+        bool revalidating = false;      // Background refresh running (not saved)
+    };
+    
+    using EntryList = std::list<Entry>;
+    
+    // Background revalidation for a Stale answer; its sink reports back
+    // from the engine thread
+    class RevalidateSink;
+    void revalidateAsync(const std::string& url, const HttpOptions& options,
+                         const std::string& etag, const std::string& lastModified);
+    void finishRevalidation(const std::string& url, HttpResponse& response,
+                            int64_t requestTime);
+    
+    // -------------------------------------------------------------------------
+    // m_mutex held
+    // -------------------------------------------------------------------------
+    int64_t currentAge(const Entry& entry, int64_t time) const;
+    void touch(EntryList::iterator it);
+    void erase(EntryList::iterator it);
+    void evictOverBudget();
+    void saveIndex();
+    void saveIndexIfDue();
+    std::string pathOf(const std::string& file) const;
+    
+    // Read an entry's file into response (no lock; false if it's gone)
+    bool readEntry(const std::string& path, uint64_t size, uint64_t bodySize,
+                   HttpResponse& response) const;
+    
+    // Load url's cached response; a missing or damaged file drops the
+    // entry. Returns the body size, or -1.
+    int64_t loadEntry(const std::string& url, HttpResponse& response);
+    
+    // Merge a 304 into the cached response and store that again; returns
+    // the body size, or -1 if there is nothing cached
+    int64_t refresh(const std::string& url, HttpResponse& response, int64_t requestTime);
+    
+    void loadIndex();
+    void removeOrphans();
+    
+    mutable std::mutex m_mutex;
+    std::string m_directory;
+    size_t m_maxBytes = DEFAULT_MAX_BYTES;
+    bool m_enabled = false;
+    
+    // Least recently used first; m_index points into it by URL
+    EntryList m_entries;
+    std::unordered_map<std::string, EntryList::iterator> m_index;
+    size_t m_bytes = 0;
+    
+    // Entries are never rewritten in place: each store gets a new file
+    uint64_t m_nextFile = 1;
+    
+    bool m_dirty = false;
+    int64_t m_savedAt = 0;
+    
+    HttpCacheStats m_stats;
+};
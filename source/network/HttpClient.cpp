@@ -3,9 +3,120 @@
 // =============================================================================
 
 #include "HttpClient.hpp"
+#include "HttpCache.hpp"
+#include "HttpSink.hpp"
 #include <curl/curl.h>
 #include <cstdio>
 #include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace {
+
+// Backing for HttpClient::getStats(); clients run on several threads
+struct StatCounters {
+    std::atomic<uint64_t> requests{0};
+    std::atomic<uint64_t> compressedResponses{0};
+    std::atomic<uint64_t> wireBytes{0};
+    std::atomic<uint64_t> bodyBytes{0};
+    std::atomic<uint64_t> decodeMicros{0};
+    std::atomic<uint64_t> connectionsOpened{0};
+    std::atomic<uint64_t> connectionsReused{0};
+    std::atomic<uint64_t> connectMicros{0};
+};
+
+StatCounters s_stats;
+
+void countTransfer(uint64_t wireBytes, uint64_t bodyBytes, uint64_t decodeMicros, bool compressed) {
+    s_stats.requests.fetch_add(1, std::memory_order_relaxed);
+    if (compressed) s_stats.compressedResponses.fetch_add(1, std::memory_order_relaxed);
+    s_stats.wireBytes.fetch_add(wireBytes, std::memory_order_relaxed);
+    s_stats.bodyBytes.fetch_add(bodyBytes, std::memory_order_relaxed);
+    s_stats.decodeMicros.fetch_add(decodeMicros, std::memory_order_relaxed);
+}
+
+// New connection (and the time its TCP + TLS setup took) or a reused one.
+// Transfers that never got a response are left out.
+void countConnection(CURL* curl) {
+    long httpCode = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+    if (httpCode <= 0) return;
+    
+    long connects = 0;
+    curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &connects);
+    if (connects == 0) {
+        s_stats.connectionsReused.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    // APPCONNECT is 0 for plain HTTP; both are measured from the start
+    curl_off_t connect = 0, appConnect = 0;
+    curl_easy_getinfo(curl, CURLINFO_CONNECT_TIME_T, &connect);
+    curl_easy_getinfo(curl, CURLINFO_APPCONNECT_TIME_T, &appConnect);
+    s_stats.connectionsOpened.fetch_add(static_cast<uint64_t>(connects), std::memory_order_relaxed);
+    s_stats.connectMicros.fetch_add(static_cast<uint64_t>(std::max(connect, appConnect)),
+                                    std::memory_order_relaxed);
+}
+
+// Content-Length as a number, -1 if missing or malformed
+int64_t parseContentLength(std::string_view value) {
+    if (value.empty() || value.size() > 18) return -1;
+    int64_t length = 0;
+    for (char c : value) {
+        if (c < '0' || c > '9') return -1;
+        length = length * 10 + (c - '0');
+    }
+    return length;
+}
+
+// The body into a byte vector (downloadData), presized like BufferSink
+class VectorSink : public HttpSink {
+public:
+    explicit VectorSink(std::vector<uint8_t>* data) : m_data(data) {}
+    
+    bool begin(const HttpResponse& /* response */, int64_t expectedSize) override {
+        if (expectedSize > 0) {
+            m_data->reserve(std::min(static_cast<size_t>(expectedSize), BufferSink::MAX_PRESIZE));
+        }
+        return true;
+    }
+    
+    bool write(const char* data, size_t size) override {
+        m_data->insert(m_data->end(), data, data + size);
+        return true;
+    }
+
+private:
+    std::vector<uint8_t>* m_data;
+};
+
+// -----------------------------------------------------------------------------
+// Process-wide share: resolved addresses and TLS sessions are reused by every
+// handle, so a new connection to a known host skips the lookup and resumes
+// the session instead of a full handshake. Connections themselves stay in
+// each handle's (or multi handle's) own cache: curl can't share those between
+// handles running on different threads at once.
+// -----------------------------------------------------------------------------
+CURLSH* s_share = nullptr;
+std::mutex s_shareLocks[CURL_LOCK_DATA_LAST];
+
+void lockShare(CURL* /* handle */, curl_lock_data data, curl_lock_access /* access */, void* /* userptr */) {
+    s_shareLocks[data].lock();
+}
+
+void unlockShare(CURL* /* handle */, curl_lock_data data, void* /* userptr */) {
+    s_shareLocks[data].unlock();
+}
+
+// How long a resolved address stays in the shared DNS cache
+constexpr long DNS_CACHE_SECONDS = 300;
+
+// Idle time before TCP keep-alive probes, and the interval between them
+constexpr long KEEPALIVE_IDLE_SECONDS = 30;
+constexpr long KEEPALIVE_INTERVAL_SECONDS = 15;
+
+} // namespace
 
 // =============================================================================
 // Static initialization
@@ -13,13 +124,56 @@
 
 bool HttpClient::init() {
     CURLcode result = curl_global_init(CURL_GLOBAL_ALL);
-    return result == CURLE_OK;
+    if (result != CURLE_OK) return false;
+    
+    // Without the share every handle still works, just with its own caches
+    s_share = curl_share_init();
+    if (s_share) {
+        curl_share_setopt(s_share, CURLSHOPT_LOCKFUNC, lockShare);
+        curl_share_setopt(s_share, CURLSHOPT_UNLOCKFUNC, unlockShare);
+        curl_share_setopt(s_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(s_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+    return true;
 }
 
 void HttpClient::cleanup() {
+    // Refused while a handle still uses it; it then lives until exit
+    if (s_share && curl_share_cleanup(s_share) == CURLSHE_OK) {
+        s_share = nullptr;
+    }
     curl_global_cleanup();
 }
 
+void HttpClient::configureConnection(void* handle) {
+    CURL* curl = static_cast<CURL*>(handle);
+    if (s_share) curl_easy_setopt(curl, CURLOPT_SHARE, s_share);
+    curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, DNS_CACHE_SECONDS);
+    
+    // Keep idle pooled connections alive through NAT and Wi-Fi power saving
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPIDLE, KEEPALIVE_IDLE_SECONDS);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPINTVL, KEEPALIVE_INTERVAL_SECONDS);
+    
+    // HTTP/2 over TLS when the server offers it (plain HTTP stays 1.1). On
+    // a multi handle, wait for a connection being set up to the same host
+    // rather than opening another, in case it turns out to multiplex.
+    curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+    curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+}
+
+void HttpClient::configureMulti(void* handle) {
+    CURLM* multi = static_cast<CURLM*>(handle);
+    
+    // Transfers beyond the per-host limit wait inside curl for a free
+    // connection instead of opening more; finished connections are kept
+    // open for the next transfer to the same host. HTTP/2 connections
+    // carry several transfers at once.
+    curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, MAX_HOST_CONNECTIONS);
+    curl_multi_setopt(multi, CURLMOPT_MAXCONNECTS, MAX_IDLE_CONNECTIONS);
+    curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+}
+
 // =============================================================================
 // Constructor & Destructor
 // =============================================================================
@@ -29,6 +183,10 @@ HttpClient::HttpClient() {
 }
 
 HttpClient::~HttpClient() {
+    if (m_multi) {
+        curl_multi_cleanup(static_cast<CURLM*>(m_multi));
+        m_multi = nullptr;
+    }
     if (m_curl) {
         curl_easy_cleanup(static_cast<CURL*>(m_curl));
         m_curl = nullptr;
@@ -39,16 +197,57 @@ HttpClient::~HttpClient() {
 // Write Callbacks
 // =============================================================================
 
-size_t HttpClient::writeCallback(void* contents, size_t size, size_t nmemb, void* userp) {
+size_t HttpClient::writeBodyCallback(void* contents, size_t size, size_t nmemb, void* userp) {
     size_t realsize = size * nmemb;
-    std::string* buffer = static_cast<std::string*>(userp);
-    buffer->append(static_cast<char*>(contents), realsize);
+    Transfer* transfer = static_cast<Transfer*>(userp);
+    
+    // All headers are in by the first body byte (headerCallback starts
+    // over for each response, so this is the final one's encoding)
+    if (!transfer->started) {
+        transfer->started = true;
+        const HttpHeaders& headers = transfer->response->headers;
+        if (!transfer->decoder.begin(headers.find("content-encoding"))) {
+            transfer->decodeFailed = true;
+            return 0;
+        }
+        
+        // Content-Length counts encoded bytes; only a plain body's is its size
+        int64_t expectedSize = transfer->decoder.isCompressed()
+            ? -1 : parseContentLength(headers.find("content-length"));
+        if (!transfer->sink->begin(*transfer->response, expectedSize)) {
+            transfer->aborted = true;
+            return 0;
+        }
+    }
+    
+    // Returning less than realsize makes curl abort with CURLE_WRITE_ERROR
+    if (!transfer->decoder.write(static_cast<const char*>(contents), realsize, transfer->decoded)) {
+        if (!transfer->aborted) transfer->decodeFailed = true;
+        return 0;
+    }
     return realsize;
 }
 
-size_t HttpClient::writeFileCallback(void* contents, size_t size, size_t nmemb, void* userp) {
-    FILE* file = static_cast<FILE*>(userp);
-    return fwrite(contents, size, nmemb, file);
+size_t HttpClient::headerCallback(char* buffer, size_t size, size_t nitems, void* userp) {
+    size_t realsize = size * nitems;
+    HttpResponse* response = static_cast<HttpResponse*>(userp);
+    std::string_view line(buffer, realsize);
+    
+    // A new status line starts over (redirects, 100 Continue). Its code
+    // is set here so sinks see it; curl's final answer replaces it later.
+    if (line.compare(0, 5, "HTTP/") == 0) {
+        size_t space = line.find(' ');
+        int status = 0;
+        for (size_t i = space + 1; space != std::string_view::npos && i < line.size() &&
+                                   line[i] >= '0' && line[i] <= '9'; i++) {
+            status = status * 10 + (line[i] - '0');
+        }
+        response->statusCode = status;
+    }
+    
+    // Names are case-insensitive; stored lowercased
+    response->headers.addLine(line);
+    return realsize;
 }
 
 int HttpClient::progressCallback(void* clientp, double dltotal, double dlnow,
@@ -60,11 +259,133 @@ int HttpClient::progressCallback(void* clientp, double dltotal, double dlnow,
     return 0;  // Return 0 to continue, non-zero to abort
 }
 
+// =============================================================================
+// Transfers
+// =============================================================================
+
+void HttpClient::sendTo(Transfer& transfer, HttpResponse* response, HttpSink* sink) {
+    Transfer* self = &transfer;
+    transfer.response = response;
+    transfer.sink = sink;
+    transfer.decoded = [self, sink](const char* data, size_t size) {
+        if (sink->write(data, size)) return true;
+        self->aborted = true;
+        return false;
+    };
+}
+
+void HttpClient::prepareBody(void* handle, Transfer* transfer) {
+    CURL* curl = static_cast<CURL*>(handle);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, headerCallback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, transfer->response);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeBodyCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, transfer);
+    
+    // ContentDecoder does the inflating (and the timing); a curl built
+    // with zlib must hand over the body untouched
+    curl_easy_setopt(curl, CURLOPT_HTTP_CONTENT_DECODING, 0L);
+}
+
+struct curl_slist* HttpClient::appendHeaders(struct curl_slist* list, const HttpOptions& options) {
+    bool hasAcceptEncoding = false;
+    for (const auto& header : options.headers) {
+        std::string name = header.first;
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        if (name == "accept-encoding") hasAcceptEncoding = true;
+        
+        std::string headerStr = header.first + ": " + header.second;
+        list = curl_slist_append(list, headerStr.c_str());
+    }
+    if (options.acceptCompressed && !hasAcceptEncoding) {
+        list = curl_slist_append(list, (std::string("Accept-Encoding: ") +
+                                        ContentDecoder::ACCEPT_ENCODING).c_str());
+    }
+    return list;
+}
+
+void HttpClient::finishTransfer(void* curl, Transfer* transfer, int result) {
+    HttpResponse* response = transfer->response;
+    const ContentDecoder& decoder = transfer->decoder;
+    
+    if (transfer->decodeFailed) {
+        response->error = "Unreadable Content-Encoding";
+    } else if (result != CURLE_OK) {
+        response->error = curl_easy_strerror(static_cast<CURLcode>(result));
+    } else if (!transfer->decoder.finish()) {
+        response->error = "Truncated compressed body";
+    }
+    transfer->sink->end(*response);
+    
+    countTransfer(decoder.inputBytes(), decoder.outputBytes(), decoder.decodeMicros(),
+                  decoder.isCompressed());
+    countConnection(static_cast<CURL*>(curl));
+}
+
+NetworkStats HttpClient::getStats() {
+    NetworkStats stats;
+    stats.requests = s_stats.requests.load(std::memory_order_relaxed);
+    stats.compressedResponses = s_stats.compressedResponses.load(std::memory_order_relaxed);
+    stats.wireBytes = s_stats.wireBytes.load(std::memory_order_relaxed);
+    stats.bodyBytes = s_stats.bodyBytes.load(std::memory_order_relaxed);
+    stats.decodeMicros = s_stats.decodeMicros.load(std::memory_order_relaxed);
+    stats.connectionsOpened = s_stats.connectionsOpened.load(std::memory_order_relaxed);
+    stats.connectionsReused = s_stats.connectionsReused.load(std::memory_order_relaxed);
+    stats.connectMicros = s_stats.connectMicros.load(std::memory_order_relaxed);
+    return stats;
+}
+
 // =============================================================================
 // GET Request
 // =============================================================================
 
-HttpResponse HttpClient::get(const std::string& url, const HttpOptions& options) {
+HttpResponse HttpClient::get(const std::string& url, const HttpOptions& options,
+                              CancelCheck isCancelled) {
+    HttpCache& cache = HttpCache::getInstance();
+    if (!options.useCache || !HttpCache::canUse(options) || !cache.isEnabled()) {
+        return fetch(url, options, isCancelled);
+    }
+    
+    HttpCacheLookup cached = cache.lookup(url, options);
+    if (cached.state == HttpCacheState::Fresh || cached.state == HttpCacheState::Stale) {
+        return std::move(cached.response);
+    }
+    
+    // -------------------------------------------------------------------------
+    // Stale: ask whether the cached copy still holds, and answer a 304 with
+    // it. Anything else goes out (and into the cache) as usual.
+    // -------------------------------------------------------------------------
+    int64_t requestTime = HttpCache::now();
+    HttpResponse response;
+    if (cached.state == HttpCacheState::Revalidate) {
+        HttpOptions conditional = options;
+        if (!cached.etag.empty()) conditional.headers["If-None-Match"] = cached.etag;
+        if (!cached.lastModified.empty()) conditional.headers["If-Modified-Since"] = cached.lastModified;
+        response = fetch(url, conditional, isCancelled);
+        if (response.isNotModified()) {
+            if (cache.notModified(url, response, requestTime)) return response;
+            
+            // Evicted in the meantime: the 304 has no body to give
+            requestTime = HttpCache::now();
+            response = fetch(url, options, isCancelled);
+        }
+    } else {
+        response = fetch(url, options, isCancelled);
+    }
+    
+    // Abandoned: nothing learned about the cached copy either way
+    if (isCancelled && response.error == "Cancelled") return response;
+    
+    // An unreachable or failing server may be covered by stale-if-error
+    if ((!response.error.empty() || response.statusCode >= 500) && cache.serveStale(url, response)) {
+        return response;
+    }
+    
+    cache.store(url, response, requestTime);
+    return response;
+}
+
+HttpResponse HttpClient::fetch(const std::string& url, const HttpOptions& options,
+                               const CancelCheck& isCancelled) {
     HttpResponse response;
     
     if (!m_curl) {
@@ -74,16 +395,19 @@ HttpResponse HttpClient::get(const std::string& url, const HttpOptions& options)
     
     CURL* curl = static_cast<CURL*>(m_curl);
     
-    // Reset handle for reuse
+    // Reset handle for reuse (its open connections survive the reset)
     curl_easy_reset(curl);
+    configureConnection(curl);
     
     // Set URL
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     
-    // Set write callback
-    std::string responseData;
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &responseData);
+    // Set write callback (decoding any Content-Encoding into a pooled
+    // buffer that then moves into response.body)
+    BufferSink body;
+    Transfer transfer;
+    sendTo(transfer, &response, &body);
+    prepareBody(curl, &transfer);
     
     // Set options
     curl_easy_setopt(curl, CURLOPT_TIMEOUT, options.timeoutSeconds);
@@ -95,28 +419,23 @@ HttpResponse HttpClient::get(const std::string& url, const HttpOptions& options)
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
     
     // Set custom headers
-    struct curl_slist* headerList = nullptr;
-    for (const auto& header : options.headers) {
-        std::string headerStr = header.first + ": " + header.second;
-        headerList = curl_slist_append(headerList, headerStr.c_str());
-    }
+    struct curl_slist* headerList = appendHeaders(nullptr, options);
     if (headerList) {
         curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headerList);
     }
     
     // Perform request
-    CURLcode res = curl_easy_perform(curl);
+    bool cancelled = false;
+    CURLcode res = isCancelled ? static_cast<CURLcode>(performCancellable(isCancelled, cancelled))
+                               : curl_easy_perform(curl);
     
     // Get response code
     long httpCode = 0;
     curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
     response.statusCode = static_cast<int>(httpCode);
     
-    if (res != CURLE_OK) {
-        response.error = curl_easy_strerror(res);
-    } else {
-        response.body = responseData;
-    }
+    finishTransfer(curl, &transfer, res);
+    if (cancelled) response.error = "Cancelled";
     
     // Cleanup headers
     if (headerList) {
@@ -126,6 +445,199 @@ HttpResponse HttpClient::get(const std::string& url, const HttpOptions& options)
     return response;
 }
 
+int HttpClient::performCancellable(const CancelCheck& isCancelled, bool& cancelled) {
+    CURLM* handle = static_cast<CURLM*>(multi());
+    CURL* curl = static_cast<CURL*>(m_curl);
+    if (!handle || curl_multi_add_handle(handle, curl) != CURLM_OK) return CURLE_FAILED_INIT;
+    
+    // Like curl_easy_perform, but waking every 100 ms to ask isCancelled
+    CURLcode result = CURLE_OK;
+    bool done = false;
+    int running = 0;
+    while (!done) {
+        curl_multi_perform(handle, &running);
+        
+        CURLMsg* msg;
+        int queued = 0;
+        while ((msg = curl_multi_info_read(handle, &queued)) != nullptr) {
+            if (msg->msg == CURLMSG_DONE && msg->easy_handle == curl) {
+                result = msg->data.result;
+                done = true;
+            }
+        }
+        if (done) break;
+        if (isCancelled()) {
+            cancelled = true;
+            result = CURLE_ABORTED_BY_CALLBACK;
+            break;
+        }
+        curl_multi_wait(handle, nullptr, 0, 100, nullptr);
+    }
+    
+    curl_multi_remove_handle(handle, curl);
+    return result;
+}
+
+// =============================================================================
+// Streaming GET Request
+// =============================================================================
+
+HttpResponse HttpClient::getStreamed(const std::string& url, DataCallback onData,
+                                      const HttpOptions& options) {
+    CallbackSink sink(std::move(onData));
+    return getStreamed(url, sink, options);
+}
+
+HttpResponse HttpClient::getStreamed(const std::string& url, HttpSink& sink,
+                                      const HttpOptions& options) {
+    HttpResponse response;
+    
+    if (!m_curl) {
+        response.error = "CURL not initialized";
+        return response;
+    }
+    
+    CURL* curl = static_cast<CURL*>(m_curl);
+    curl_easy_reset(curl);
+    Transfer transfer;
+    sendTo(transfer, &response, &sink);
+    struct curl_slist* headerList = prepareStreamed(curl, url, &transfer, options);
+    
+    CURLcode res = curl_easy_perform(curl);
+    
+    long httpCode = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+    response.statusCode = static_cast<int>(httpCode);
+    
+    finishTransfer(curl, &transfer, res);
+    
+    if (headerList) {
+        curl_slist_free_all(headerList);
+    }
+    
+    return response;
+}
+
+struct curl_slist* HttpClient::prepareStreamed(void* handle, const std::string& url,
+                                               Transfer* transfer, const HttpOptions& options) {
+    CURL* curl = static_cast<CURL*>(handle);
+    configureConnection(curl);
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    
+    // Hand each chunk to the sink as soon as curl delivers (and the
+    // decoder inflates) it
+    prepareBody(curl, transfer);
+    
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, options.timeoutSeconds);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, options.followRedirects ? 1L : 0L);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, options.userAgent.c_str());
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
+    
+    struct curl_slist* headerList = appendHeaders(nullptr, options);
+    if (headerList) {
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headerList);
+    }
+    return headerList;
+}
+
+// =============================================================================
+// Concurrent Streaming GET Requests
+// =============================================================================
+
+void* HttpClient::multi() {
+    // Kept between batches: its connection cache is what lets the next
+    // refresh skip the TCP and TLS setup
+    if (!m_multi) {
+        m_multi = curl_multi_init();
+        if (m_multi) configureMulti(m_multi);
+    }
+    return m_multi;
+}
+
+void HttpClient::getStreamedAll(std::vector<HttpStreamRequest>& requests,
+                                CancelCheck isCancelled) {
+    CURLM* multi = static_cast<CURLM*>(this->multi());
+    if (!multi) {
+        for (auto& request : requests) {
+            request.response.error = "CURL not initialized";
+        }
+        return;
+    }
+    
+    // -------------------------------------------------------------------------
+    // One easy handle per request, all driven by the same multi handle so
+    // the total time is that of the slowest transfer, not the sum
+    // -------------------------------------------------------------------------
+    std::vector<CURL*> handles(requests.size(), nullptr);
+    std::vector<struct curl_slist*> headerLists(requests.size(), nullptr);
+    std::unique_ptr<Transfer[]> transfers(new Transfer[requests.size()]);
+    std::vector<std::unique_ptr<CallbackSink>> sinks(requests.size());
+    
+    for (size_t i = 0; i < requests.size(); i++) {
+        HttpStreamRequest& request = requests[i];
+        CURL* curl = curl_easy_init();
+        if (!curl) {
+            request.response.error = "CURL not initialized";
+            continue;
+        }
+        sinks[i].reset(new CallbackSink(request.onData));
+        sendTo(transfers[i], &request.response, sinks[i].get());
+        headerLists[i] = prepareStreamed(curl, request.url, &transfers[i], request.options);
+        curl_multi_add_handle(multi, curl);
+        handles[i] = curl;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Drive all transfers; write callbacks run in here as data arrives
+    // -------------------------------------------------------------------------
+    bool cancelled = false;
+    int running = 0;
+    for (;;) {
+        curl_multi_perform(multi, &running);
+        
+        CURLMsg* msg;
+        int queued = 0;
+        while ((msg = curl_multi_info_read(multi, &queued)) != nullptr) {
+            if (msg->msg != CURLMSG_DONE) continue;
+            
+            for (size_t i = 0; i < handles.size(); i++) {
+                if (handles[i] != msg->easy_handle) continue;
+                
+                HttpResponse& response = requests[i].response;
+                long httpCode = 0;
+                curl_easy_getinfo(handles[i], CURLINFO_RESPONSE_CODE, &httpCode);
+                response.statusCode = static_cast<int>(httpCode);
+                finishTransfer(handles[i], &transfers[i], msg->data.result);
+                break;
+            }
+        }
+        
+        if (running == 0) break;
+        if (isCancelled && isCancelled()) {
+            cancelled = true;
+            break;
+        }
+        
+        // Sleep until a socket is ready, waking regularly for isCancelled
+        curl_multi_wait(multi, nullptr, 0, 100, nullptr);
+    }
+    
+    for (size_t i = 0; i < handles.size(); i++) {
+        if (!handles[i]) continue;
+        
+        HttpResponse& response = requests[i].response;
+        if (cancelled && response.statusCode == 0 && response.error.empty()) {
+            response.error = "Cancelled";
+        }
+        curl_multi_remove_handle(multi, handles[i]);
+        curl_easy_cleanup(handles[i]);
+        if (headerLists[i]) {
+            curl_slist_free_all(headerLists[i]);
+        }
+    }
+}
+
 // =============================================================================
 // POST Request
 // =============================================================================
@@ -143,6 +655,7 @@ HttpResponse HttpClient::post(const std::string& url, const std::string& body,
     
     // Reset handle
     curl_easy_reset(curl);
+    configureConnection(curl);
     
     // Set URL and POST
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
@@ -151,9 +664,10 @@ HttpResponse HttpClient::post(const std::string& url, const std::string& body,
     curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, body.length());
     
     // Set write callback
-    std::string responseData;
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &responseData);
+    BufferSink responseBody;
+    Transfer transfer;
+    sendTo(transfer, &response, &responseBody);
+    prepareBody(curl, &transfer);
     
     // Set options
     curl_easy_setopt(curl, CURLOPT_TIMEOUT, options.timeoutSeconds);
@@ -166,10 +680,7 @@ HttpResponse HttpClient::post(const std::string& url, const std::string& body,
     struct curl_slist* headerList = nullptr;
     headerList = curl_slist_append(headerList, 
                                     ("Content-Type: " + options.contentType).c_str());
-    for (const auto& header : options.headers) {
-        std::string headerStr = header.first + ": " + header.second;
-        headerList = curl_slist_append(headerList, headerStr.c_str());
-    }
+    headerList = appendHeaders(headerList, options);
     curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headerList);
     
     // Perform request
@@ -179,14 +690,13 @@ HttpResponse HttpClient::post(const std::string& url, const std::string& body,
     curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
     response.statusCode = static_cast<int>(httpCode);
     
-    if (res != CURLE_OK) {
-        response.error = curl_easy_strerror(res);
-    } else {
-        response.body = responseData;
-    }
+    finishTransfer(curl, &transfer, res);
     
     curl_slist_free_all(headerList);
     
+    // A cached GET of the same URL may no longer be what the server holds
+    if (response.isSuccess()) HttpCache::getInstance().invalidate(url);
+    
     return response;
 }
 
@@ -200,17 +710,20 @@ bool HttpClient::downloadFile(const std::string& url, const std::string& outputP
     
     CURL* curl = static_cast<CURL*>(m_curl);
     curl_easy_reset(curl);
+    configureConnection(curl);
     
     // Open output file
-    FILE* file = fopen(outputPath.c_str(), "wb");
-    if (!file) return false;
+    FileSink file(outputPath);
+    if (!file.open()) return false;
     
     // Set URL
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     
     // Set write callback
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeFileCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, file);
+    HttpResponse response;
+    Transfer transfer;
+    sendTo(transfer, &response, &file);
+    prepareBody(curl, &transfer);
     
     // Set progress callback
     ProgressContext ctx;
@@ -226,18 +739,15 @@ bool HttpClient::downloadFile(const std::string& url, const std::string& outputP
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
     
-    // Perform download
+    // Perform download; the sink deletes a partial file or error page
     CURLcode res = curl_easy_perform(curl);
     
-    fclose(file);
-    
-    if (res != CURLE_OK) {
-        // Delete partial file on error
-        remove(outputPath.c_str());
-        return false;
-    }
+    long httpCode = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+    response.statusCode = static_cast<int>(httpCode);
+    finishTransfer(curl, &transfer, res);
     
-    return true;
+    return response.error.empty() && response.isSuccess();
 }
 
 // =============================================================================
@@ -252,14 +762,17 @@ std::vector<uint8_t> HttpClient::downloadData(const std::string& url,
     
     CURL* curl = static_cast<CURL*>(m_curl);
     curl_easy_reset(curl);
+    configureConnection(curl);
     
     // Set URL
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     
-    // Use string buffer for simplicity
-    std::string buffer;
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &buffer);
+    // Straight into the result, presized from Content-Length
+    HttpResponse response;
+    VectorSink sink(&result);
+    Transfer transfer;
+    sendTo(transfer, &response, &sink);
+    prepareBody(curl, &transfer);
     
     // Progress callback
     ProgressContext ctx;
@@ -275,9 +788,10 @@ std::vector<uint8_t> HttpClient::downloadData(const std::string& url,
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
     
     CURLcode res = curl_easy_perform(curl);
+    finishTransfer(curl, &transfer, res);
     
-    if (res == CURLE_OK) {
-        result.assign(buffer.begin(), buffer.end());
+    if (!response.error.empty()) {
+        result.clear();
     }
     
     return result;
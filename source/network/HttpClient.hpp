@@ -7,11 +7,17 @@
 
 #pragma once
 
+#include "ContentDecoder.hpp"
+#include "HttpHeaders.hpp"
 #include <string>
 #include <vector>
 #include <functional>
 #include <map>
 #include <memory>
+#include <cstdint>
+
+struct curl_slist;
+class HttpSink;
 
 // =============================================================================
 // HTTP Response structure
@@ -19,11 +25,18 @@
 struct HttpResponse {
     int statusCode = 0;
     std::string body;
-    std::map<std::string, std::string> headers;
+    HttpHeaders headers;                            // Lowercased names
     std::string error;
     
     bool isSuccess() const { return statusCode >= 200 && statusCode < 300; }
     bool isError() const { return statusCode >= 400 || !error.empty(); }
+    
+    // 304 in answer to If-None-Match: the cached copy is still current
+    bool isNotModified() const { return statusCode == 304 && error.empty(); }
+    
+    std::string getHeader(std::string_view lowercaseName) const {
+        return std::string(headers.find(lowercaseName));
+    }
 };
 
 // =============================================================================
@@ -35,16 +48,56 @@ struct HttpOptions {
     bool followRedirects = true;
     std::string userAgent = "SwitchAppStore/1.0";
     
+    // Send Accept-Encoding: gzip, deflate. A compressed body is inflated
+    // as it arrives, so callers always see the plain bytes.
+    bool acceptCompressed = true;
+    
+    // get() and buffered HttpEngine GETs answer from and fill the on-disk
+    // HttpCache (once it is initialized) as the response's Cache-Control
+    // allows
+    bool useCache = true;
+    
     // For POST requests
     std::string contentType = "application/json";
 };
 
+// =============================================================================
+// Traffic counters, summed over every HttpClient since startup
+// =============================================================================
+struct NetworkStats {
+    uint64_t requests = 0;
+    uint64_t compressedResponses = 0;   // Bodies that came gzip/deflate encoded
+    uint64_t wireBytes = 0;             // Response bodies as received
+    uint64_t bodyBytes = 0;             // Response bodies after decoding
+    uint64_t decodeMicros = 0;          // Time spent inflating
+    uint64_t connectionsOpened = 0;     // TCP (+ TLS) connections set up
+    uint64_t connectionsReused = 0;     // Requests sent on an open connection
+    uint64_t connectMicros = 0;         // Time spent setting connections up
+};
+
 // =============================================================================
 // Progress callback for downloads
 // =============================================================================
 using ProgressCallback = std::function<void(size_t downloaded, size_t total)>;
 using CompletionCallback = std::function<void(const HttpResponse&)>;
 
+// Receives the response body chunk by chunk; return false to abort
+using DataCallback = std::function<bool(const char* data, size_t size)>;
+
+// Polled while a batch (or a cancellable get) runs; return true to abort
+// the remaining transfers
+using CancelCheck = std::function<bool()>;
+
+// =============================================================================
+// One streamed GET in a batch (see HttpClient::getStreamedAll)
+// =============================================================================
+struct HttpStreamRequest {
+    std::string url;
+    HttpOptions options;
+    DataCallback onData;
+    HttpResponse response;      // Filled in when the transfer completes
+};
+
 // =============================================================================
 // HttpClient - Main HTTP client class
 // =============================================================================
@@ -63,8 +116,28 @@ public:
     // Synchronous requests
     // -------------------------------------------------------------------------
     
-    // Perform a GET request
-    HttpResponse get(const std::string& url, const HttpOptions& options = {});
+    // Perform a GET request, through the HttpCache (see HttpCache.hpp): a
+    // cached or revalidated answer comes back as a plain 200. isCancelled
+    // is polled at least every 100 ms while a transfer runs; once it
+    // returns true the transfer is aborted with the error "Cancelled".
+    HttpResponse get(const std::string& url, const HttpOptions& options = {},
+                     CancelCheck isCancelled = nullptr);
+    
+    // Perform a GET request, streaming the body to onData as it arrives
+    // instead of buffering it (HttpResponse::body is left empty)
+    HttpResponse getStreamed(const std::string& url, DataCallback onData,
+                             const HttpOptions& options = {});
+    
+    // Same, into a sink (see HttpSink.hpp): a parser, a file, or anything
+    // else that consumes the body as it arrives
+    HttpResponse getStreamed(const std::string& url, HttpSink& sink,
+                             const HttpOptions& options = {});
+    
+    // Perform all streamed GETs concurrently over one multi handle and
+    // return once every transfer has finished. onData callbacks run on the
+    // calling thread, interleaved as data arrives for each request.
+    void getStreamedAll(std::vector<HttpStreamRequest>& requests,
+                        CancelCheck isCancelled = nullptr);
     
     // Perform a POST request
     HttpResponse post(const std::string& url, const std::string& body,
@@ -96,13 +169,76 @@ public:
     // Build query string from parameters
     static std::string buildQueryString(const std::map<std::string, std::string>& params);
     
+    // Snapshot of the traffic counters
+    static NetworkStats getStats();
+    
+    // Connections kept to one host by a multi handle; further transfers to
+    // it wait their turn (or share an HTTP/2 connection)
+    static constexpr long MAX_HOST_CONNECTIONS = 6;
+    
+    // Idle connections a multi handle keeps open across all hosts
+    static constexpr long MAX_IDLE_CONNECTIONS = 16;
+
 private:
+    // Sets up its transfers with the helpers below
+    friend class HttpEngine;
+    
     // CURL handle (reused for connection pooling)
     void* m_curl = nullptr;
     
+    // Multi handle for getStreamedAll and cancellable gets, created on
+    // first use and kept so its connections carry over to the next batch
+    void* m_multi = nullptr;
+    void* multi();
+    
+    // The GET itself, buffered, without the cache
+    HttpResponse fetch(const std::string& url, const HttpOptions& options,
+                       const CancelCheck& isCancelled);
+    
+    // Run m_curl's transfer on the multi handle, checking isCancelled
+    // between waits; returns the CURLcode, and sets cancelled
+    int performCancellable(const CancelCheck& isCancelled, bool& cancelled);
+    
+    // Body of one transfer on its way through the decoder into a sink
+    struct Transfer {
+        HttpResponse* response = nullptr;
+        HttpSink* sink = nullptr;
+        DecodedSink decoded;            // sink->write, noting an abort
+        ContentDecoder decoder;
+        bool started = false;           // First body byte seen
+        bool aborted = false;           // The sink returned false
+        bool decodeFailed = false;
+    };
+    
+    // Point the transfer's headers at response and its body at sink
+    static void sendTo(Transfer& transfer, HttpResponse* response, HttpSink* sink);
+    
+    // Set up curl for a streamed GET; returns the header list to free
+    // once the transfer is done (may be null)
+    static curl_slist* prepareStreamed(void* curl, const std::string& url,
+                                       Transfer* transfer, const HttpOptions& options);
+    
+    // Route the headers into the response and the body through the
+    // transfer's decoder
+    static void prepareBody(void* curl, Transfer* transfer);
+    
+    // options.headers plus Accept-Encoding, appended to list
+    static curl_slist* appendHeaders(curl_slist* list, const HttpOptions& options);
+    
+    // Shared DNS / TLS session cache, keep-alive and HTTP/2 for an easy
+    // handle (again after every curl_easy_reset)
+    static void configureConnection(void* curl);
+    
+    // Per-host connection limit, idle pool size and multiplexing
+    static void configureMulti(void* multi);
+    
+    // Check the decoder's end state, set response->error, end the sink,
+    // count the traffic and whether curl's connection was new or reused
+    static void finishTransfer(void* curl, Transfer* transfer, int result);
+    
     // For write callbacks
-    static size_t writeCallback(void* contents, size_t size, size_t nmemb, void* userp);
-    static size_t writeFileCallback(void* contents, size_t size, size_t nmemb, void* userp);
+    static size_t writeBodyCallback(void* contents, size_t size, size_t nmemb, void* userp);
+    static size_t headerCallback(char* buffer, size_t size, size_t nitems, void* userp);
     static int progressCallback(void* clientp, double dltotal, double dlnow,
                                 double ultotal, double ulnow);
     
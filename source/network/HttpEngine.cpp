@@ -0,0 +1,578 @@
+// =============================================================================
+// Switch App Store - HTTP Engine Implementation
+// =============================================================================
+
+#include "HttpEngine.hpp"
+#include "BufferPool.hpp"
+#include "HttpCache.hpp"
+#include <curl/curl.h>
+
+namespace {
+
+// Written by curl on the engine thread, read by pump() on the main thread
+struct TransferProgress {
+    std::atomic<int64_t> downloaded{0};
+    std::atomic<int64_t> total{0};
+};
+
+int onTransferProgress(void* clientp, curl_off_t dltotal, curl_off_t dlnow,
+                       curl_off_t /* ultotal */, curl_off_t /* ulnow */) {
+    auto* progress = static_cast<TransferProgress*>(clientp);
+    progress->downloaded.store(dlnow, std::memory_order_relaxed);
+    progress->total.store(dltotal, std::memory_order_relaxed);
+    return 0;
+}
+
+// Identifies GETs whose responses are interchangeable: same URL and same
+// request headers. Empty for anything that can't share a transfer.
+std::string coalesceKey(const HttpRequest& request) {
+    if (request.method != HttpMethod::Get || request.sink || !request.outputPath.empty() ||
+        request.onData) {
+        return std::string();
+    }
+    
+    const HttpOptions& options = request.options;
+    std::string key = request.url;
+    key += '\n';
+    for (const auto& header : options.headers) {
+        key += header.first;
+        key += ": ";
+        key += header.second;
+        key += '\n';
+    }
+    key += options.userAgent;
+    key += options.acceptCompressed ? "\ncompressed" : "\nidentity";
+    key += options.followRedirects ? "\nfollow" : "\nnofollow";
+    return key;
+}
+
+} // namespace
+
+// =============================================================================
+// Job - one submitted transfer
+// =============================================================================
+struct HttpEngine::Job {
+    HttpHandle handle = 0;
+    HttpRequest request;
+    HttpResponse response;
+    
+    // Engine thread while running
+    CURL* curl = nullptr;
+    curl_slist* headers = nullptr;
+    HttpClient::Transfer transfer;
+    std::shared_ptr<HttpSink> sink;
+    
+    TransferProgress progress;
+    int64_t reportedBytes = -1;         // Main thread: last progress passed on
+    
+    std::atomic<bool> cancelled{false};
+    bool waited = false;                // perform(): no onComplete, wake the waiter
+    bool finished = false;              // Guarded by m_mutex (perform only)
+    
+    // Coalescing, guarded by m_mutex. A leader runs the transfer and is
+    // registered in m_inflight under key; followers never start and get
+    // the leader's response. followers is emptied when the leader ends.
+    std::string key;
+    std::shared_ptr<Job> leader;
+    std::vector<std::shared_ptr<Job>> followers;
+    bool shared = false;                // response is delivered to followers too
+    
+    // Engine thread: a buffered GET that missed HttpCache (or is asking it
+    // with the cached validators) and goes into it when it finishes
+    bool cached = false;
+    bool revalidating = false;
+    int64_t requestTime = 0;
+    
+    const HttpResponse& result() const { return leader ? leader->response : response; }
+};
+
+// =============================================================================
+// Singleton
+// =============================================================================
+
+HttpEngine& HttpEngine::getInstance() {
+    static HttpEngine instance;
+    return instance;
+}
+
+HttpEngine::~HttpEngine() {
+    stop();
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+bool HttpEngine::start() {
+    if (m_thread.joinable()) return true;
+    
+    CURLM* multi = curl_multi_init();
+    if (!multi) return false;
+    
+    HttpClient::configureMulti(multi);
+    
+    m_multi = multi;
+    m_stop = false;
+    m_thread = std::thread(&HttpEngine::run, this);
+    return true;
+}
+
+void HttpEngine::stop() {
+    if (!m_thread.joinable()) return;
+    
+    m_stop = true;
+    curl_multi_wakeup(static_cast<CURLM*>(m_multi));
+    m_thread.join();
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    // Never started: fail any perform() still waiting
+    for (auto& job : m_pending) {
+        failWaiters(*job);
+    }
+    m_done.notify_all();
+    
+    m_pending.clear();
+    m_cancelled.clear();
+    m_completed.clear();
+    m_jobs.clear();
+    m_inflight.clear();
+    
+    curl_multi_cleanup(static_cast<CURLM*>(m_multi));
+    m_multi = nullptr;
+}
+
+// =============================================================================
+// Submitting
+// =============================================================================
+
+HttpHandle HttpEngine::submit(HttpRequest request) {
+    if (!m_multi) return 0;
+    
+    auto job = std::make_shared<Job>();
+    job->request = std::move(request);
+    job->key = coalesceKey(job->request);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        job->handle = m_nextHandle++;
+        m_jobs[job->handle] = job;
+        m_submitted++;
+        
+        // The same GET is already on its way: wait for that one's answer
+        if (joinInflight(job)) return job->handle;
+        
+        if (!job->key.empty()) m_inflight[job->key] = job;
+        m_pending.push_back(job);
+    }
+    curl_multi_wakeup(static_cast<CURLM*>(m_multi));
+    return job->handle;
+}
+
+bool HttpEngine::joinInflight(const std::shared_ptr<Job>& job) {
+    if (job->key.empty()) return false;
+    auto it = m_inflight.find(job->key);
+    if (it == m_inflight.end()) return false;
+    
+    job->leader = it->second;
+    it->second->followers.push_back(job);
+    m_coalesced++;
+    return true;
+}
+
+void HttpEngine::cancel(HttpHandle handle) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_jobs.find(handle);
+        if (it == m_jobs.end()) return;
+        
+        // pump() skips it from here on, wherever it is
+        std::shared_ptr<Job> job = it->second;
+        job->cancelled = true;
+        m_jobs.erase(it);
+        
+        // A shared transfer runs on while anyone still wants its answer
+        std::shared_ptr<Job> owner = job->leader ? job->leader : job;
+        if (!owner->cancelled) return;
+        for (const auto& follower : owner->followers) {
+            if (!follower->cancelled) return;
+        }
+        auto inflight = m_inflight.find(owner->key);
+        if (inflight != m_inflight.end() && inflight->second == owner) {
+            m_inflight.erase(inflight);
+        }
+        handle = owner->handle;
+        
+        // Not picked up by the engine thread yet: nothing to abort
+        for (auto pending = m_pending.begin(); pending != m_pending.end(); ++pending) {
+            if ((*pending)->handle == handle) {
+                m_pending.erase(pending);
+                return;
+            }
+        }
+        m_cancelled.push_back(handle);
+    }
+    curl_multi_wakeup(static_cast<CURLM*>(m_multi));
+}
+
+HttpResponse HttpEngine::perform(HttpRequest request) {
+    if (!m_multi) {
+        HttpResponse response;
+        response.error = "HTTP engine not running";
+        return response;
+    }
+    
+    auto job = std::make_shared<Job>();
+    job->request = std::move(request);
+    job->key = coalesceKey(job->request);
+    job->waited = true;
+    
+    // May wait on a submitted transfer, but never leads one: its response
+    // is moved out to the caller, so there'd be nothing left to share
+    std::unique_lock<std::mutex> lock(m_mutex);
+    job->handle = m_nextHandle++;
+    m_submitted++;
+    if (!joinInflight(job)) {
+        m_pending.push_back(job);
+        curl_multi_wakeup(static_cast<CURLM*>(m_multi));
+    }
+    
+    m_done.wait(lock, [&job]() { return job->finished; });
+    return std::move(job->response);
+}
+
+// =============================================================================
+// Main Thread Delivery
+// =============================================================================
+
+size_t HttpEngine::pump() {
+    std::deque<std::shared_ptr<Job>> completed;
+    std::vector<std::shared_ptr<Job>> reporting;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        completed.swap(m_completed);
+        for (const auto& entry : m_jobs) {
+            if (entry.second->request.onProgress) reporting.push_back(entry.second);
+        }
+    }
+    
+    // -------------------------------------------------------------------------
+    // Callbacks run without the lock, so they may submit or cancel. A
+    // callback that cancels another transfer stops its delivery too.
+    // -------------------------------------------------------------------------
+    for (const auto& job : reporting) {
+        if (job->cancelled) continue;
+        const TransferProgress& progress = job->leader ? job->leader->progress : job->progress;
+        int64_t downloaded = progress.downloaded.load(std::memory_order_relaxed);
+        if (downloaded == job->reportedBytes) continue;
+        job->reportedBytes = downloaded;
+        job->request.onProgress(static_cast<size_t>(downloaded),
+                                static_cast<size_t>(progress.total.load(std::memory_order_relaxed)));
+    }
+    
+    size_t delivered = 0;
+    for (const auto& job : completed) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (job->cancelled) continue;
+            m_jobs.erase(job->handle);
+        }
+        if (job->request.onComplete) job->request.onComplete(job->result());
+        delivered++;
+        
+        // Nobody can hold on to the body past the callback, unless it is
+        // shared with followers still to be called
+        if (!job->shared) BufferPool::getInstance().release(std::move(job->response.body));
+    }
+    return delivered;
+}
+
+size_t HttpEngine::getActiveCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_jobs.size();
+}
+
+uint64_t HttpEngine::getSubmittedCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_submitted;
+}
+
+uint64_t HttpEngine::getCoalescedCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_coalesced;
+}
+
+// =============================================================================
+// Engine Thread
+// =============================================================================
+
+void HttpEngine::run() {
+    CURLM* multi = static_cast<CURLM*>(m_multi);
+    std::vector<std::shared_ptr<Job>> submitted;
+    std::vector<HttpHandle> cancelled;
+    
+    while (!m_stop.load()) {
+        // ---------------------------------------------------------------------
+        // Take new work and cancellations
+        // ---------------------------------------------------------------------
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            submitted.swap(m_pending);
+            cancelled.swap(m_cancelled);
+        }
+        
+        for (HttpHandle handle : cancelled) {
+            auto it = m_running.find(handle);
+            if (it == m_running.end()) continue;     // Finished in the meantime
+            abortJob(*it->second);
+            m_running.erase(it);
+        }
+        cancelled.clear();
+        
+        for (auto& job : submitted) {
+            if (lookupCache(*job)) {
+                finishJob(*job, CURLE_OK);
+            } else if (startJob(*job)) {
+                m_running[job->handle] = job;
+            } else {
+                finishJob(*job, CURLE_FAILED_INIT);
+            }
+        }
+        submitted.clear();
+        
+        // ---------------------------------------------------------------------
+        // Drive the transfers; write callbacks run in here
+        // ---------------------------------------------------------------------
+        int runningCount = 0;
+        curl_multi_perform(multi, &runningCount);
+        
+        CURLMsg* msg;
+        int queued = 0;
+        while ((msg = curl_multi_info_read(multi, &queued)) != nullptr) {
+            if (msg->msg != CURLMSG_DONE) continue;
+            
+            Job* done = nullptr;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &done);
+            CURLcode result = msg->data.result;
+            curl_multi_remove_handle(multi, msg->easy_handle);
+            
+            auto it = m_running.find(done->handle);
+            std::shared_ptr<Job> job = it->second;
+            m_running.erase(it);
+            if (!finishJob(*job, result)) {
+                m_running[job->handle] = job;   // Started over, see updateCache
+            }
+        }
+        
+        // Sleep until a socket is ready or submit()/cancel()/stop() wakes us
+        curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+    }
+    
+    for (auto& entry : m_running) {
+        abortJob(*entry.second);
+    }
+    m_running.clear();
+}
+
+bool HttpEngine::startJob(Job& job) {
+    HttpRequest& request = job.request;
+    
+    job.curl = curl_easy_init();
+    if (!job.curl) {
+        job.response.error = "CURL not initialized";
+        return false;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Body destination
+    // -------------------------------------------------------------------------
+    if (request.sink) {
+        job.sink = request.sink;
+    } else if (!request.outputPath.empty()) {
+        auto file = std::make_shared<FileSink>(request.outputPath);
+        if (!file->open()) {
+            job.response.error = "Cannot open " + request.outputPath;
+            releaseJob(job);
+            return false;
+        }
+        job.sink = std::move(file);
+    } else if (request.onData) {
+        job.sink = std::make_shared<CallbackSink>(std::move(request.onData));
+    } else {
+        job.sink = std::make_shared<BufferSink>();
+    }
+    HttpClient::sendTo(job.transfer, &job.response, job.sink.get());
+    
+    job.headers = HttpClient::prepareStreamed(job.curl, request.url, &job.transfer, request.options);
+    
+    if (request.method == HttpMethod::Post) {
+        curl_easy_setopt(job.curl, CURLOPT_POST, 1L);
+        curl_easy_setopt(job.curl, CURLOPT_POSTFIELDS, request.body.c_str());
+        curl_easy_setopt(job.curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(request.body.size()));
+        job.headers = curl_slist_append(job.headers, ("Content-Type: " + request.options.contentType).c_str());
+        curl_easy_setopt(job.curl, CURLOPT_HTTPHEADER, job.headers);
+    }
+    
+    if (request.onProgress) {
+        curl_easy_setopt(job.curl, CURLOPT_NOPROGRESS, 0L);
+        curl_easy_setopt(job.curl, CURLOPT_XFERINFOFUNCTION, onTransferProgress);
+        curl_easy_setopt(job.curl, CURLOPT_XFERINFODATA, &job.progress);
+    }
+    
+    curl_easy_setopt(job.curl, CURLOPT_PRIVATE, &job);
+    curl_multi_add_handle(static_cast<CURLM*>(m_multi), job.curl);
+    return true;
+}
+
+bool HttpEngine::finishJob(Job& job, int result) {
+    if (job.curl) {
+        long httpCode = 0;
+        curl_easy_getinfo(job.curl, CURLINFO_RESPONSE_CODE, &httpCode);
+        job.response.statusCode = static_cast<int>(httpCode);
+        HttpClient::finishTransfer(job.curl, &job.transfer, result);
+    } else if (result != CURLE_OK && job.response.error.empty()) {
+        job.response.error = curl_easy_strerror(static_cast<CURLcode>(result));
+    }
+    releaseJob(job);
+    
+    if (job.cached && !updateCache(job)) {
+        if (startJob(job)) return false;
+    }
+    
+    // Like HttpClient::post, a successful POST makes the cached GET stale
+    if (job.request.method == HttpMethod::Post && job.response.isSuccess()) {
+        HttpCache::getInstance().invalidate(job.request.url);
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    endInflight(job);
+    
+    if (job.waited) {
+        job.finished = true;
+        m_done.notify_all();
+    } else if (!job.cancelled) {
+        // Take the shared_ptr from m_jobs; a cancelled job isn't there
+        auto it = m_jobs.find(job.handle);
+        if (it != m_jobs.end()) m_completed.push_back(it->second);
+    }
+    
+    // Followers joined until just now and are delivered after the leader,
+    // in the order they came. perform() waiters get a copy, the rest are
+    // handed the leader's response in pump().
+    for (const auto& follower : job.followers) {
+        if (follower->waited) {
+            follower->response = job.response;
+            follower->finished = true;
+            m_done.notify_all();
+        } else if (!follower->cancelled) {
+            job.shared = true;
+            m_completed.push_back(follower);
+        }
+    }
+    job.followers.clear();
+    return true;
+}
+
+// =============================================================================
+// HttpCache (engine thread)
+// =============================================================================
+
+bool HttpEngine::lookupCache(Job& job) {
+    // Only buffered GETs (the coalescable ones) have a whole body to keep
+    HttpRequest& request = job.request;
+    HttpCache& cache = HttpCache::getInstance();
+    if (job.key.empty() || !request.options.useCache || !HttpCache::canUse(request.options) ||
+        !cache.isEnabled()) {
+        return false;
+    }
+    
+    HttpCacheLookup cached = cache.lookup(request.url, request.options);
+    if (cached.state == HttpCacheState::Fresh || cached.state == HttpCacheState::Stale) {
+        job.response = std::move(cached.response);
+        return true;
+    }
+    
+    job.cached = true;
+    job.requestTime = HttpCache::now();
+    if (cached.state == HttpCacheState::Revalidate) {
+        if (!cached.etag.empty()) request.options.headers["If-None-Match"] = cached.etag;
+        if (!cached.lastModified.empty()) request.options.headers["If-Modified-Since"] = cached.lastModified;
+        job.revalidating = true;
+    }
+    return false;
+}
+
+bool HttpEngine::updateCache(Job& job) {
+    HttpCache& cache = HttpCache::getInstance();
+    const std::string& url = job.request.url;
+    HttpResponse& response = job.response;
+    
+    if (job.revalidating && response.isNotModified()) {
+        if (cache.notModified(url, response, job.requestTime)) return true;
+        
+        // Evicted in the meantime: the 304 has no body to give, so the
+        // request goes out again without the validators
+        job.request.options.headers.erase("If-None-Match");
+        job.request.options.headers.erase("If-Modified-Since");
+        job.revalidating = false;
+        job.requestTime = HttpCache::now();
+        job.response = HttpResponse();
+        job.transfer.started = false;
+        job.transfer.aborted = false;
+        job.transfer.decodeFailed = false;
+        return false;
+    }
+    
+    // An unreachable or failing server may be covered by stale-if-error
+    if ((!response.error.empty() || response.statusCode >= 500) && cache.serveStale(url, response)) {
+        return true;
+    }
+    
+    cache.store(url, response, job.requestTime);
+    return true;
+}
+
+void HttpEngine::endInflight(Job& job) {
+    if (job.key.empty()) return;
+    auto it = m_inflight.find(job.key);
+    if (it != m_inflight.end() && it->second.get() == &job) m_inflight.erase(it);
+}
+
+void HttpEngine::failWaiters(Job& job) {
+    for (const auto& follower : job.followers) {
+        if (!follower->waited) continue;
+        follower->response.error = "Cancelled";
+        follower->finished = true;
+    }
+    job.followers.clear();
+    if (job.waited) {
+        job.response.error = "Cancelled";
+        job.finished = true;
+    }
+}
+
+void HttpEngine::abortJob(Job& job) {
+    curl_multi_remove_handle(static_cast<CURLM*>(m_multi), job.curl);
+    
+    // Lets a FileSink remove what it wrote so far
+    job.response.error = "Cancelled";
+    job.sink->end(job.response);
+    releaseJob(job);
+    
+    // Everyone else has cancelled too, but perform() waiters (and stop())
+    // still need an answer
+    std::lock_guard<std::mutex> lock(m_mutex);
+    endInflight(job);
+    failWaiters(job);
+    m_done.notify_all();
+}
+
+void HttpEngine::releaseJob(Job& job) {
+    if (job.curl) {
+        curl_easy_cleanup(job.curl);
+        job.curl = nullptr;
+    }
+    if (job.headers) {
+        curl_slist_free_all(job.headers);
+        job.headers = nullptr;
+    }
+}
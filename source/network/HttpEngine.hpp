@@ -0,0 +1,184 @@
+// =============================================================================
+// Switch App Store - HTTP Engine
+// =============================================================================
+// Asynchronous HTTP on one event-loop thread. Every transfer submitted here
+// runs on a single curl multi handle, so connections are shared and the UI
+// thread never blocks on the network. Completions are queued and handed back
+// on the main thread by pump(), once per frame.
+//
+// HttpClient stays for code that already runs on its own worker thread and
+// wants a blocking call; main-thread code should submit here instead. Like
+// HttpClient::get, buffered GETs are answered from and kept in HttpCache as
+// options.useCache allows.
+// =============================================================================
+
+#pragma once
+
+#include "HttpClient.hpp"
+#include "HttpSink.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Identifies a submitted transfer; 0 is never a valid handle
+using HttpHandle = uint64_t;
+
+enum class HttpMethod {
+    Get,
+    Post
+};
+
+// =============================================================================
+// One transfer for HttpEngine::submit
+// =============================================================================
+struct HttpRequest {
+    std::string url;
+    HttpMethod method = HttpMethod::Get;
+    std::string body;                   // POST body (options.contentType)
+    HttpOptions options;
+    
+    // Where the response body goes, in order of preference:
+    //   sink        any HttpSink; its calls run on the engine thread
+    //   outputPath  written to this file (removed again on failure)
+    //   onData      streamed; runs on the engine thread, return false to abort
+    //   otherwise   buffered into HttpResponse::body
+    std::shared_ptr<HttpSink> sink;
+    std::string outputPath;
+    DataCallback onData;
+    
+    // Main thread, from pump(): progress at most once per frame while the
+    // transfer runs, then the completion exactly once unless cancelled. A
+    // buffered body goes back to the BufferPool once onComplete returns,
+    // so copy out anything kept beyond the callback.
+    ProgressCallback onProgress;
+    CompletionCallback onComplete;
+};
+
+// =============================================================================
+// HttpEngine - curl multi event loop with main-thread completion delivery
+// =============================================================================
+class HttpEngine {
+public:
+    // -------------------------------------------------------------------------
+    // Singleton access
+    // -------------------------------------------------------------------------
+    static HttpEngine& getInstance();
+    
+    // -------------------------------------------------------------------------
+    // Lifecycle (after HttpClient::init / before HttpClient::cleanup)
+    // -------------------------------------------------------------------------
+    bool start();
+    
+    // Aborts whatever is still running; no further callbacks are made
+    void stop();
+    
+    // -------------------------------------------------------------------------
+    // Transfers (any thread)
+    // -------------------------------------------------------------------------
+    
+    // Queue a transfer; it starts on the engine thread right away
+    HttpHandle submit(HttpRequest request);
+    
+    // Abort a transfer. Its onProgress/onComplete are not called after this
+    // returns (onData may still be running on the engine thread until the
+    // abort is picked up). Unknown or finished handles are ignored.
+    void cancel(HttpHandle handle);
+    
+    // Run a transfer and wait for it on the calling thread. The response is
+    // returned instead of passed to onComplete. Not for use from inside a
+    // pump() callback on a transfer the caller is waiting for.
+    HttpResponse perform(HttpRequest request);
+    
+    // -------------------------------------------------------------------------
+    // Main thread
+    // -------------------------------------------------------------------------
+    
+    // Deliver queued progress and completions; returns completions delivered
+    size_t pump();
+    
+    // Transfers submitted and not yet delivered or cancelled
+    size_t getActiveCount() const;
+    
+    // -------------------------------------------------------------------------
+    // Coalescing: a buffered GET submitted (or performed) while an identical
+    // one - same URL and request headers - is in flight doesn't start a
+    // transfer of its own. It gets the same response when that one
+    // finishes; cancelling it leaves the shared transfer running for the
+    // others. Streaming, file and POST requests always run on their own.
+    // -------------------------------------------------------------------------
+    
+    // Requests submitted or performed since startup, and how many of them
+    // were answered by another's transfer
+    uint64_t getSubmittedCount() const;
+    uint64_t getCoalescedCount() const;
+
+private:
+    HttpEngine() = default;
+    ~HttpEngine();
+    
+    HttpEngine(const HttpEngine&) = delete;
+    HttpEngine& operator=(const HttpEngine&) = delete;
+    
+    struct Job;
+    
+    // -------------------------------------------------------------------------
+    // Engine thread
+    // -------------------------------------------------------------------------
+    void run();
+    bool startJob(Job& job);
+    
+    // Deliver a finished job; false if it had to start over instead
+    bool finishJob(Job& job, int result);
+    void abortJob(Job& job);
+    void releaseJob(Job& job);
+    
+    // Buffered GETs through HttpCache: lookupCache answers the job from
+    // it (true) or adds the validators to ask with; updateCache stores
+    // the result, and returns false if the job must run again
+    bool lookupCache(Job& job);
+    bool updateCache(Job& job);
+    
+    // -------------------------------------------------------------------------
+    // Coalescing (m_mutex held)
+    // -------------------------------------------------------------------------
+    bool joinInflight(const std::shared_ptr<Job>& job);
+    void endInflight(Job& job);
+    void failWaiters(Job& job);
+    
+    // -------------------------------------------------------------------------
+    // Members
+    // -------------------------------------------------------------------------
+    
+    void* m_multi = nullptr;
+    std::thread m_thread;
+    std::atomic<bool> m_stop{false};
+    
+    mutable std::mutex m_mutex;
+    std::condition_variable m_done;             // perform() waiters
+    HttpHandle m_nextHandle = 1;
+    
+    // Everything submitted and not yet delivered or cancelled
+    std::unordered_map<HttpHandle, std::shared_ptr<Job>> m_jobs;
+    
+    // Handed from submit()/cancel() to the engine thread
+    std::vector<std::shared_ptr<Job>> m_pending;
+    std::vector<HttpHandle> m_cancelled;
+    
+    // Coalescable transfers not finished yet, by request key
+    std::unordered_map<std::string, std::shared_ptr<Job>> m_inflight;
+    uint64_t m_submitted = 0;
+    uint64_t m_coalesced = 0;
+    
+    // Finished on the engine thread, waiting for pump()
+    std::deque<std::shared_ptr<Job>> m_completed;
+    
+    // Engine thread only: jobs attached to the multi handle
+    std::unordered_map<HttpHandle, std::shared_ptr<Job>> m_running;
+};
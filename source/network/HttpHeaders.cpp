@@ -0,0 +1,89 @@
+// =============================================================================
+// Switch App Store - HTTP Headers Implementation
+// =============================================================================
+
+#include "HttpHeaders.hpp"
+
+namespace {
+
+// Room for a typical response's headers without growing
+constexpr size_t INITIAL_BYTES = 512;
+constexpr size_t INITIAL_FIELDS = 16;
+
+char toLower(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+std::string_view trim(std::string_view value) {
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\t' ||
+                              value.back() == '\r' || value.back() == '\n')) {
+        value.remove_suffix(1);
+    }
+    return value;
+}
+
+} // namespace
+
+// =============================================================================
+// Filling
+// =============================================================================
+
+void HttpHeaders::addLine(std::string_view line) {
+    if (line.compare(0, 5, "HTTP/") == 0) {
+        clear();
+        return;
+    }
+    
+    size_t colon = line.find(':');
+    if (colon == std::string_view::npos) return;
+    add(trim(line.substr(0, colon)), trim(line.substr(colon + 1)));
+}
+
+void HttpHeaders::add(std::string_view name, std::string_view value) {
+    if (m_data.capacity() == 0) m_data.reserve(INITIAL_BYTES);
+    if (m_fields.capacity() == 0) m_fields.reserve(INITIAL_FIELDS);
+    
+    Field field;
+    field.offset = static_cast<uint32_t>(m_data.size());
+    field.nameSize = static_cast<uint32_t>(name.size());
+    field.valueSize = static_cast<uint32_t>(value.size());
+    
+    for (char c : name) m_data.push_back(toLower(c));
+    m_data.append(value.data(), value.size());
+    m_fields.push_back(field);
+}
+
+void HttpHeaders::clear() {
+    m_data.clear();
+    m_fields.clear();
+}
+
+// =============================================================================
+// Lookup
+// =============================================================================
+
+std::string_view HttpHeaders::find(std::string_view lowercaseName) const {
+    // Last one wins, as it did when repeated headers overwrote each other
+    for (size_t i = m_fields.size(); i-- > 0;) {
+        if (name(i) == lowercaseName) return value(i);
+    }
+    return std::string_view();
+}
+
+bool HttpHeaders::has(std::string_view lowercaseName) const {
+    for (size_t i = 0; i < m_fields.size(); i++) {
+        if (name(i) == lowercaseName) return true;
+    }
+    return false;
+}
+
+std::string_view HttpHeaders::name(size_t index) const {
+    const Field& field = m_fields[index];
+    return std::string_view(m_data.data() + field.offset, field.nameSize);
+}
+
+std::string_view HttpHeaders::value(size_t index) const {
+    const Field& field = m_fields[index];
+    return std::string_view(m_data.data() + field.offset + field.nameSize, field.valueSize);
+}
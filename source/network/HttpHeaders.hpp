@@ -0,0 +1,53 @@
+// =============================================================================
+// Switch App Store - HTTP Headers
+// =============================================================================
+// Response headers as curl hands them over, one line at a time. Names and
+// values are packed back to back into a single string with a small index
+// next to it, so a response's headers cost two allocations (usually zero
+// once a handle has been used) instead of two strings and a tree node each.
+// =============================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// =============================================================================
+// HttpHeaders - flat, case-insensitive header list
+// =============================================================================
+class HttpHeaders {
+public:
+    // Parse one raw header line ("Name: value\r\n"). A status line starts
+    // over (redirects, 100 Continue); anything without a colon is ignored.
+    void addLine(std::string_view line);
+    
+    // Append a field; the name is stored lowercased
+    void add(std::string_view name, std::string_view value);
+    
+    // Value of the last field with this (lowercase) name, or "" if absent.
+    // Valid until the headers are changed.
+    std::string_view find(std::string_view lowercaseName) const;
+    bool has(std::string_view lowercaseName) const;
+    
+    // Keeps the storage for the next response
+    void clear();
+    
+    size_t size() const { return m_fields.size(); }
+    bool empty() const { return m_fields.empty(); }
+    
+    // Fields in arrival order
+    std::string_view name(size_t index) const;
+    std::string_view value(size_t index) const;
+
+private:
+    struct Field {
+        uint32_t offset;                // Name starts here in m_data...
+        uint32_t nameSize;
+        uint32_t valueSize;             // ...and the value right after it
+    };
+    
+    std::string m_data;
+    std::vector<Field> m_fields;
+};
@@ -0,0 +1,95 @@
+// =============================================================================
+// Switch App Store - HTTP Response Sinks Implementation
+// =============================================================================
+
+#include "HttpSink.hpp"
+#include "BufferPool.hpp"
+#include <algorithm>
+
+// =============================================================================
+// HttpSink
+// =============================================================================
+
+bool HttpSink::begin(const HttpResponse& /* response */, int64_t /* expectedSize */) {
+    return true;
+}
+
+void HttpSink::end(HttpResponse& /* response */) {
+}
+
+// =============================================================================
+// BufferSink
+// =============================================================================
+
+BufferSink::~BufferSink() {
+    BufferPool::getInstance().release(std::move(m_buffer));
+}
+
+bool BufferSink::begin(const HttpResponse& /* response */, int64_t expectedSize) {
+    size_t presize = expectedSize > 0
+        ? std::min(static_cast<size_t>(expectedSize), MAX_PRESIZE) : 0;
+    m_buffer = BufferPool::getInstance().acquire(presize);
+    return true;
+}
+
+bool BufferSink::write(const char* data, size_t size) {
+    m_buffer.append(data, size);
+    return true;
+}
+
+void BufferSink::end(HttpResponse& response) {
+    // Error bodies (404 pages, API errors) are kept; broken transfers aren't
+    if (response.error.empty()) {
+        response.body = std::move(m_buffer);
+    }
+}
+
+// =============================================================================
+// CallbackSink
+// =============================================================================
+
+CallbackSink::CallbackSink(DataCallback onData)
+    : m_onData(std::move(onData)) {
+}
+
+bool CallbackSink::write(const char* data, size_t size) {
+    return m_onData(data, size);
+}
+
+// =============================================================================
+// FileSink
+// =============================================================================
+
+FileSink::FileSink(std::string path)
+    : m_path(std::move(path)) {
+}
+
+FileSink::~FileSink() {
+    close(false);
+}
+
+bool FileSink::open() {
+    close(false);
+    m_file = fopen(m_path.c_str(), "wb");
+    return m_file != nullptr;
+}
+
+bool FileSink::write(const char* data, size_t size) {
+    return m_file && fwrite(data, 1, size, m_file) == size;
+}
+
+void FileSink::end(HttpResponse& response) {
+    // Keep neither a partial file nor an error page
+    bool keep = response.error.empty() && response.isSuccess();
+    if (!close(keep) && keep) {
+        response.error = "Cannot write " + m_path;
+    }
+}
+
+bool FileSink::close(bool keep) {
+    if (!m_file) return true;
+    bool written = fclose(m_file) == 0;
+    m_file = nullptr;
+    if (!keep || !written) remove(m_path.c_str());
+    return written;
+}
@@ -0,0 +1,91 @@
+// =============================================================================
+// Switch App Store - HTTP Response Sinks
+// =============================================================================
+// Where a response body goes as it arrives. HttpClient and HttpEngine run
+// the body through ContentDecoder and hand the plain bytes to a sink: the
+// ones here buffer it, pass it to a callback or write it to a file. A
+// parser can implement HttpSink itself and consume a large body without it
+// ever being held in memory whole.
+// =============================================================================
+
+#pragma once
+
+#include "HttpClient.hpp"
+#include <cstdio>
+
+// =============================================================================
+// HttpSink - receives one response body
+// =============================================================================
+class HttpSink {
+public:
+    virtual ~HttpSink() = default;
+    
+    // Status and headers are in and the body is about to start. expectedSize
+    // is the decoded size if the server gave it (an uncompressed body's
+    // Content-Length), -1 otherwise. Return false to abort.
+    virtual bool begin(const HttpResponse& response, int64_t expectedSize);
+    
+    // Next piece of the decoded body; return false to abort
+    virtual bool write(const char* data, size_t size) = 0;
+    
+    // The transfer is over, also when it failed or had no body; response
+    // has its final status and error. A sink may fill in response.body.
+    virtual void end(HttpResponse& response);
+};
+
+// =============================================================================
+// BufferSink - the body into HttpResponse::body
+// =============================================================================
+// Built in a BufferPool buffer presized from Content-Length, then moved into
+// the response unless the transfer failed (the buffer goes back instead).
+class BufferSink : public HttpSink {
+public:
+    ~BufferSink() override;
+    
+    bool begin(const HttpResponse& response, int64_t expectedSize) override;
+    bool write(const char* data, size_t size) override;
+    void end(HttpResponse& response) override;
+    
+    // A Content-Length above this is trusted only as far as this
+    static constexpr size_t MAX_PRESIZE = 32 * 1024 * 1024;
+
+private:
+    std::string m_buffer;
+};
+
+// =============================================================================
+// CallbackSink - the body to a DataCallback, chunk by chunk
+// =============================================================================
+class CallbackSink : public HttpSink {
+public:
+    explicit CallbackSink(DataCallback onData);
+    
+    bool write(const char* data, size_t size) override;
+
+private:
+    DataCallback m_onData;
+};
+
+// =============================================================================
+// FileSink - the body into a file, removed again unless the response is a 2xx
+// =============================================================================
+class FileSink : public HttpSink {
+public:
+    explicit FileSink(std::string path);
+    ~FileSink() override;
+    
+    // Create (truncate) the file; call before the transfer starts
+    bool open();
+    
+    bool write(const char* data, size_t size) override;
+    void end(HttpResponse& response) override;
+    
+    const std::string& getPath() const { return m_path; }
+
+private:
+    // Returns false if buffered data couldn't be flushed (file removed)
+    bool close(bool keep);
+    
+    std::string m_path;
+    FILE* m_file = nullptr;
+};
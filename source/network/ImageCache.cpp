@@ -9,7 +9,9 @@
 #include <SDL2/SDL_image.h>
 #include <cstdio>
 #include <cstdlib>
+#include <dirent.h>
 #include <sys/stat.h>
+#include <vector>
 
 // =============================================================================
 // Singleton
@@ -31,13 +33,18 @@ ImageCache::~ImageCache() {
 void ImageCache::init(SDL_Renderer* renderer, const std::string& cacheDir) {
     m_renderer = renderer;
     m_cacheDir = cacheDir;
-    m_httpClient = std::make_unique<HttpClient>();
     
     // Create cache directory if it doesn't exist
     mkdir(cacheDir.c_str(), 0755);
 }
 
 void ImageCache::shutdown() {
+    // Their completions would create textures after this point
+    for (const auto& download : m_downloads) {
+        HttpEngine::getInstance().cancel(download.second);
+    }
+    m_downloads.clear();
+    
     // Free all cached textures from the new CacheEntry structure
     for (auto& pair : m_cacheEntries) {
         if (pair.second.texture) {
@@ -46,7 +53,6 @@ void ImageCache::shutdown() {
     }
     m_cacheEntries.clear();
     m_currentCacheSize = 0;
-    m_httpClient.reset();
 }
 
 // =============================================================================
@@ -142,19 +148,15 @@ SDL_Texture* ImageCache::loadSync(const std::string& url) {
         }
     }
     
-    // Download from network
-    if (!m_httpClient) {
-        // Mark as failed if we can't download
-        if (m_cacheEntries.find(url) != m_cacheEntries.end()) {
-            m_cacheEntries[url].state = ImageLoadState::Failed;
-        }
-        if (m_stateCallback) {
-            m_stateCallback(url, ImageLoadState::Failed);
-        }
-        return nullptr;
-    }
-    
-    std::vector<uint8_t> data = m_httpClient->downloadData(url);
+    // Download from network, waiting for the engine
+    HttpRequest request;
+    request.url = url;
+    request.options.acceptCompressed = false;   // Image formats are compressed already
+    HttpResponse response = HttpEngine::getInstance().perform(std::move(request));
+    return addDownloaded(url, response.isSuccess() ? std::string_view(response.body) : std::string_view());
+}
+
+SDL_Texture* ImageCache::addDownloaded(const std::string& url, std::string_view data) {
     if (data.empty()) {
         // Mark as failed
         if (m_cacheEntries.find(url) != m_cacheEntries.end()) {
@@ -167,6 +169,7 @@ SDL_Texture* ImageCache::loadSync(const std::string& url) {
     }
     
     // Save to disk cache
+    std::string cachePath = getCachePath(url);
     FILE* file = fopen(cachePath.c_str(), "wb");
     if (file) {
         fwrite(data.data(), 1, data.size(), file);
@@ -174,7 +177,7 @@ SDL_Texture* ImageCache::loadSync(const std::string& url) {
     }
     
     // Load into texture
-    SDL_Texture* tex = loadFromMemory(data.data(), data.size());
+    SDL_Texture* tex = loadFromMemory(reinterpret_cast<const uint8_t*>(data.data()), data.size());
     if (tex) {
         // -------------------------------------------------------------------------
         // Create cache entry with full LRU metadata
@@ -250,10 +253,35 @@ void ImageCache::processOne() {
     
     std::string url = m_loadQueue.front();
     m_loadQueue.pop();
-    m_loadingUrls.erase(url);
     
-    // Load synchronously (in real app, would use background thread)
-    loadSync(url);
+    // -------------------------------------------------------------------------
+    // Disk cache hits load right away. Anything else is downloaded on the
+    // HttpEngine and turned into a texture when it completes, still on the
+    // main thread; the URL stays in m_loadingUrls until then.
+    // -------------------------------------------------------------------------
+    struct stat st;
+    if (stat(getCachePath(url).c_str(), &st) == 0) {
+        m_loadingUrls.erase(url);
+        loadSync(url);
+        return;
+    }
+    
+    HttpRequest request;
+    request.url = url;
+    request.options.acceptCompressed = false;
+    request.onComplete = [this, url](const HttpResponse& response) {
+        m_downloads.erase(url);
+        m_loadingUrls.erase(url);
+        addDownloaded(url, response.isSuccess() ? std::string_view(response.body) : std::string_view());
+    };
+    
+    HttpHandle handle = HttpEngine::getInstance().submit(std::move(request));
+    if (handle == 0) {
+        m_loadingUrls.erase(url);
+        addDownloaded(url, std::string_view());
+        return;
+    }
+    m_downloads[url] = handle;
 }
 
 // =============================================================================
@@ -271,8 +299,22 @@ void ImageCache::clearMemoryCache() {
 }
 
 void ImageCache::clearDiskCache() {
-    // Simple implementation: just clear our tracking
-    // Real implementation would scan and delete files in m_cacheDir
+    // Every file in m_cacheDir is a downloaded image (see getCachePath);
+    // textures already in memory stay until they are evicted
+    DIR* dir = opendir(m_cacheDir.c_str());
+    if (!dir) return;
+    
+    std::vector<std::string> files;
+    struct dirent* item;
+    while ((item = readdir(dir)) != nullptr) {
+        if (item->d_name[0] == '.') continue;
+        files.push_back(m_cacheDir + "/" + item->d_name);
+    }
+    closedir(dir);
+    
+    for (const std::string& path : files) {
+        remove(path.c_str());
+    }
 }
 
 size_t ImageCache::getMemoryCacheSize() const {
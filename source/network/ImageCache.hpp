@@ -8,9 +8,10 @@
 
 #pragma once
 
-#include "HttpClient.hpp"
+#include "HttpEngine.hpp"
 #include <SDL2/SDL.h>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <queue>
 #include <mutex>
@@ -68,6 +69,7 @@ public:
     
     // Request an image to be loaded (async)
     // Returns immediately - texture will be available later via getCached
+    // (downloads run on the HttpEngine and finish in its pump())
     void requestImage(const std::string& url);
     
     // Load an image synchronously (blocks until loaded)
@@ -115,11 +117,12 @@ public:
     // Processing pending loads
     // -------------------------------------------------------------------------
     
-    // Process one pending load (call from main thread each frame)
+    // Process one pending load (call from main thread each frame): loads
+    // it from disk, or starts its download
     void processOne();
     
     // Check if any images are loading
-    bool hasQueuedLoads() const { return !m_loadQueue.empty(); }
+    bool hasQueuedLoads() const { return !m_loadQueue.empty() || !m_downloads.empty(); }
     
 private:
     ImageCache() = default;
@@ -135,6 +138,9 @@ private:
     // Generate hash for URL
     std::string hashUrl(const std::string& url) const;
     
+    // Cache a downloaded image on disk and in memory (empty data: failed)
+    SDL_Texture* addDownloaded(const std::string& url, std::string_view data);
+    
     // Evict old entries if over size limit (LRU strategy)
     void evictIfNeeded();
     
@@ -158,8 +164,8 @@ private:
     // Load queue for async loading
     std::queue<std::string> m_loadQueue;
     
-    // HTTP client for downloads
-    std::unique_ptr<HttpClient> m_httpClient;
+    // Downloads in flight on the HttpEngine: URL -> transfer
+    std::unordered_map<std::string, HttpHandle> m_downloads;
     
     // Set of URLs currently being loaded (to avoid duplicate requests)
     std::unordered_map<std::string, bool> m_loadingUrls;
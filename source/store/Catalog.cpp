@@ -0,0 +1,411 @@
+// =============================================================================
+// Switch App Store - Catalog Implementation
+// =============================================================================
+
+#include "Catalog.hpp"
+#include "CatalogParser.hpp"
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+// Where an entry goes in a sort order: smaller keys first. Only reads the
+// hot arrays, so sorting never touches the entries' text.
+double sortKey(const EntryStore& entries, size_t position, EntrySort sort) {
+    switch (sort) {
+        case EntrySort::Popularity:
+            return -StoreEntry::popularity(entries.rating(position), entries.downloadCount(position));
+        case EntrySort::Rating:     return -entries.rating(position);
+        case EntrySort::Downloads:  return -double(entries.downloadCount(position));
+        case EntrySort::Newest:     return -double(entries.releaseDay(position));
+        case EntrySort::Size:       return double(entries.fileSize(position));
+        default:                    return 0.0;
+    }
+}
+
+// Strict order on positions: by key, then catalog order
+struct SortsBefore {
+    const EntryStore& entries;
+    EntrySort sort;
+    
+    bool operator()(uint32_t a, uint32_t b) const {
+        double ka = sortKey(entries, a, sort);
+        double kb = sortKey(entries, b, sort);
+        return ka != kb ? ka < kb : a < b;
+    }
+};
+
+} // namespace
+
+// =============================================================================
+// Lookup
+// =============================================================================
+
+EntryView Catalog::find(const std::string& id) const {
+    uint32_t position = idIndex.find(id);
+    return position != EntryIndex::NOT_FOUND ? entries[position] : EntryView();
+}
+
+EntryView Catalog::findByTitleId(const std::string& titleId) const {
+    uint32_t position = titleIndex.find(titleId);
+    return position != EntryIndex::NOT_FOUND ? entries[position] : EntryView();
+}
+
+EntrySpan Catalog::byCategory(const std::string& category) const {
+    auto it = std::lower_bound(categoryPostings.begin(), categoryPostings.end(), category,
+        [](const CategoryPostings& p, const std::string& c) { return p.category < c; });
+    if (it == categoryPostings.end() || it->category != category) return EntrySpan();
+    return EntrySpan(&entries, categoryPositions.data() + it->first, it->count);
+}
+
+std::vector<EntryView> Catalog::search(std::string_view query, size_t limit) const {
+    std::vector<EntryView> result;
+    if (!searchIndex) return result;
+    
+    for (const auto& hit : searchIndex->search(query, limit)) {
+        result.push_back(entries[hit.position]);
+    }
+    return result;
+}
+
+EntrySpan Catalog::sorted(EntrySort sort, size_t first, size_t count) const {
+    const auto& order = sortOrders[size_t(sort)];
+    if (!order || first >= order->size()) return EntrySpan();
+    
+    count = std::min(count, order->size() - first);
+    return EntrySpan(&entries, order->data() + first, count);
+}
+
+std::vector<uint32_t> Catalog::filter(const EntryFilter& filter, EntrySort sort, size_t limit) const {
+    std::vector<uint32_t> positions;
+    if (!facets || limit == 0) return positions;
+    FacetIndex::Bitmap matches = facets->match(filter);
+    
+    // -------------------------------------------------------------------------
+    // A broad filter finds its first matches early along the precomputed
+    // order; a narrow one is cheaper to sort than to look for
+    // -------------------------------------------------------------------------
+    const auto& order = sortOrders[size_t(sort)];
+    if (sort != EntrySort::Catalog && order && FacetIndex::count(matches) * 16 >= entries.size()) {
+        for (uint32_t position : *order) {
+            if ((matches[position / 64] >> (position % 64)) & 1) {
+                positions.push_back(position);
+                if (positions.size() == limit) break;
+            }
+        }
+        return positions;
+    }
+    
+    FacetIndex::positions(matches, positions);
+    if (sort != EntrySort::Catalog) {
+        SortsBefore before{entries, sort};
+        if (positions.size() > limit) {
+            std::partial_sort(positions.begin(), positions.begin() + limit, positions.end(), before);
+        } else {
+            std::sort(positions.begin(), positions.end(), before);
+        }
+    }
+    if (positions.size() > limit) positions.resize(limit);
+    return positions;
+}
+
+// =============================================================================
+// Building
+// =============================================================================
+
+void Catalog::merge(const std::string& sourceId, CatalogParser& parser) {
+    stage();
+    
+    std::vector<StoreEntry>& parsed = parser.getEntries();
+    for (auto& entry : parsed) {
+        entry.sourceId = sourceId;
+    }
+    
+    if (parser.hasCategories()) {
+        categories = std::move(parser.getCategories());
+    }
+    
+    // -------------------------------------------------------------------------
+    // Full listing: replaces everything this source contributed
+    // -------------------------------------------------------------------------
+    if (!parser.isDelta()) {
+        staged.erase(std::remove_if(staged.begin(), staged.end(),
+            [&sourceId](const StoreEntry& e) { return e.sourceId == sourceId; }),
+            staged.end());
+        staged.insert(staged.end(),
+                      std::make_move_iterator(parsed.begin()),
+                      std::make_move_iterator(parsed.end()));
+        parsed.clear();
+        return;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Delta: upserts replace in place or append, tombstones remove. Ids are
+    // only unique within a source, so lookups go through a source-local map.
+    // -------------------------------------------------------------------------
+    std::unordered_map<std::string, size_t> local;
+    for (size_t i = 0; i < staged.size(); i++) {
+        if (staged[i].sourceId == sourceId) {
+            local.emplace(staged[i].id, i);
+        }
+    }
+    
+    for (auto& entry : parsed) {
+        auto it = local.find(entry.id);
+        if (it != local.end()) {
+            staged[it->second] = std::move(entry);
+        } else {
+            local.emplace(entry.id, staged.size());
+            staged.push_back(std::move(entry));
+        }
+    }
+    parsed.clear();
+    
+    std::vector<std::string>& removed = parser.getRemovedIds();
+    if (!removed.empty()) {
+        for (const auto& id : removed) {
+            auto it = local.find(id);
+            if (it != local.end()) {
+                staged[it->second].id.clear();      // Marked for compaction
+            }
+        }
+        staged.erase(std::remove_if(staged.begin(), staged.end(),
+            [](const StoreEntry& e) { return e.id.empty(); }),
+            staged.end());
+    }
+}
+
+bool Catalog::retainSources(const std::vector<StoreSource>& sources) {
+    auto isActive = [&sources](std::string_view sourceId) {
+        for (const auto& source : sources) {
+            if (source.id == sourceId) return source.enabled;
+        }
+        return false;
+    };
+    
+    // Usually nothing goes, and then the packed entries can stay packed
+    bool removes = false;
+    for (size_t i = 0; i < entries.size() && !removes; i++) {
+        removes = !isActive(entries[i].sourceId());
+    }
+    for (const auto* list : {&staged, &shadowed}) {
+        for (const auto& e : *list) removes = removes || !isActive(e.sourceId);
+    }
+    if (!removes) return false;
+    
+    stage();
+    size_t before = staged.size();
+    staged.erase(std::remove_if(staged.begin(), staged.end(),
+        [&isActive](const StoreEntry& e) { return !isActive(e.sourceId); }),
+        staged.end());
+    return staged.size() != before;
+}
+
+void Catalog::resolve(const std::vector<StoreSource>& sources) {
+    stage();
+    
+    // -------------------------------------------------------------------------
+    // Rank sources: higher priority first, equal priorities in config order
+    // -------------------------------------------------------------------------
+    std::vector<size_t> sourceOrder(sources.size());
+    for (size_t i = 0; i < sourceOrder.size(); i++) sourceOrder[i] = i;
+    std::stable_sort(sourceOrder.begin(), sourceOrder.end(), [&sources](size_t a, size_t b) {
+        return sources[a].priority > sources[b].priority;
+    });
+    
+    std::unordered_map<std::string, size_t> rankOf;
+    for (size_t rank = 0; rank < sourceOrder.size(); rank++) {
+        rankOf.emplace(sources[sourceOrder[rank]].id, rank);
+    }
+    
+    std::vector<uint32_t> rank(staged.size());
+    for (size_t i = 0; i < staged.size(); i++) {
+        auto it = rankOf.find(staged[i].sourceId);
+        rank[i] = static_cast<uint32_t>(it != rankOf.end() ? it->second : sourceOrder.size());
+    }
+    
+    // Entry order within one source is kept as the source sent it
+    std::vector<uint32_t> order(staged.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = static_cast<uint32_t>(i);
+    std::stable_sort(order.begin(), order.end(), [&rank](uint32_t a, uint32_t b) {
+        return rank[a] < rank[b];
+    });
+    
+    // -------------------------------------------------------------------------
+    // Hash join on titleId and id: the first (highest-ranked) entry with a
+    // given key wins. Views point into the staged entries, which are not
+    // touched until every decision has been made.
+    // -------------------------------------------------------------------------
+    std::unordered_set<std::string_view> seenTitle;
+    std::unordered_set<std::string_view> seenId;
+    seenTitle.reserve(staged.size());
+    seenId.reserve(staged.size());
+    
+    std::vector<bool> visible(staged.size(), false);
+    for (uint32_t i : order) {
+        const StoreEntry& e = staged[i];
+        bool duplicate = seenId.count(e.id) != 0 ||
+                         (!e.titleId.empty() && seenTitle.count(e.titleId) != 0);
+        if (duplicate) continue;
+        
+        visible[i] = true;
+        seenId.insert(e.id);
+        if (!e.titleId.empty()) seenTitle.insert(e.titleId);
+    }
+    
+    std::vector<StoreEntry> resolved;
+    resolved.reserve(staged.size());
+    for (uint32_t i : order) {
+        if (visible[i]) {
+            resolved.push_back(std::move(staged[i]));
+        } else {
+            shadowed.push_back(std::move(staged[i]));
+        }
+    }
+    staged.clear();
+    entries = EntryStore(resolved);
+    rebuildIndexes();
+}
+
+void Catalog::assign(std::vector<StoreEntry> all) {
+    entries = EntryStore();
+    shadowed.clear();
+    staged = std::move(all);
+}
+
+void Catalog::stage() {
+    if (!entries.empty()) {
+        staged = entries.unpack();
+        entries = EntryStore();
+    }
+    staged.insert(staged.end(),
+                  std::make_move_iterator(shadowed.begin()),
+                  std::make_move_iterator(shadowed.end()));
+    shadowed.clear();
+}
+
+void Catalog::rebuildIndexes() {
+    idIndex.build(entries);
+    titleIndex.build(entries);
+    
+    auto text = std::make_shared<SearchIndex>();
+    text->build(entries);
+    searchIndex = std::move(text);
+    
+    auto facetIndex = std::make_shared<FacetIndex>();
+    facetIndex->build(entries);
+    facets = std::move(facetIndex);
+    
+    rebuildSortOrders();
+    
+    // -------------------------------------------------------------------------
+    // Category posting lists: count, lay out ranges in name order, then
+    // fill each range in entry order (a counting sort by category id)
+    // -------------------------------------------------------------------------
+    categoryPostings.clear();
+    for (const auto& name : entries.categoryNames()) {
+        categoryPostings.push_back({name, 0, 0});
+    }
+    for (size_t i = 0; i < entries.size(); i++) {
+        categoryPostings[entries.categoryOf(i)].count++;
+    }
+    
+    std::vector<uint32_t> order(categoryPostings.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = static_cast<uint32_t>(i);
+    std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        return categoryPostings[a].category < categoryPostings[b].category;
+    });
+    
+    std::vector<uint32_t> cursor(categoryPostings.size());
+    uint32_t first = 0;
+    for (uint32_t slot : order) {
+        categoryPostings[slot].first = first;
+        cursor[slot] = first;
+        first += categoryPostings[slot].count;
+    }
+    
+    categoryPositions.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        categoryPositions[cursor[entries.categoryOf(i)]++] = static_cast<uint32_t>(i);
+    }
+    
+    std::vector<CategoryPostings> sorted;
+    sorted.reserve(order.size());
+    for (uint32_t slot : order) {
+        sorted.push_back(std::move(categoryPostings[slot]));
+    }
+    categoryPostings = std::move(sorted);
+}
+
+// =============================================================================
+// Sort orders
+// =============================================================================
+
+void Catalog::rebuildSortOrders() {
+    // Keys are computed once per entry rather than per comparison
+    std::vector<std::pair<double, uint32_t>> keyed(entries.size());
+    for (size_t s = 0; s < ENTRY_SORT_COUNT; s++) {
+        EntrySort sort = static_cast<EntrySort>(s);
+        for (size_t i = 0; i < entries.size(); i++) {
+            keyed[i] = {sortKey(entries, i, sort), static_cast<uint32_t>(i)};
+        }
+        if (sort != EntrySort::Catalog) std::sort(keyed.begin(), keyed.end());
+        
+        auto order = std::make_shared<std::vector<uint32_t>>(entries.size());
+        for (size_t i = 0; i < keyed.size(); i++) {
+            (*order)[i] = keyed[i].second;
+        }
+        sortOrders[s] = std::move(order);
+    }
+}
+
+void Catalog::setDownloadCount(size_t position, int count) {
+    if (entries.downloadCount(position) == count) return;
+    
+    // -------------------------------------------------------------------------
+    // Find the entry in each affected order under its old key, then move
+    // it to where its new key belongs. The orders are copied (the old
+    // version may still be read), but nothing is sorted again.
+    // -------------------------------------------------------------------------
+    const EntrySort affected[] = {EntrySort::Popularity, EntrySort::Downloads};
+    std::shared_ptr<std::vector<uint32_t>> orders[2];
+    size_t at[2];
+    const uint32_t p = static_cast<uint32_t>(position);
+    bool stale = false;
+    
+    for (size_t i = 0; i < 2; i++) {
+        const auto& shared = sortOrders[size_t(affected[i])];
+        if (!shared) continue;
+        
+        orders[i] = std::make_shared<std::vector<uint32_t>>(*shared);
+        auto it = std::lower_bound(orders[i]->begin(), orders[i]->end(), p, SortsBefore{entries, affected[i]});
+        at[i] = it - orders[i]->begin();
+        stale |= it == orders[i]->end() || *it != p;
+    }
+    
+    entries.setDownloadCount(position, count);
+    if (stale) {
+        rebuildSortOrders();
+        return;
+    }
+    
+    for (size_t i = 0; i < 2; i++) {
+        if (!orders[i]) continue;
+        
+        std::vector<uint32_t>& order = *orders[i];
+        SortsBefore before{entries, affected[i]};
+        auto it = order.begin() + at[i];
+        if (it != order.begin() && before(p, *(it - 1))) {
+            // Moves up: shift the entries it overtakes down by one
+            auto to = std::lower_bound(order.begin(), it, p, before);
+            std::rotate(to, it, it + 1);
+        } else {
+            auto to = std::lower_bound(it + 1, order.end(), p, before);
+            std::rotate(it, it + 1, to);
+        }
+        sortOrders[size_t(affected[i])] = std::move(orders[i]);
+    }
+}
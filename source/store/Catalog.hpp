@@ -0,0 +1,108 @@
+// =============================================================================
+// Switch App Store - Catalog
+// =============================================================================
+// One immutable, self-contained version of the store catalog. A refresh
+// builds a new Catalog off the main thread and publishes it with an atomic
+// pointer swap; readers pin the version they are using through a
+// CatalogHandle, so entries never change or move underneath them.
+// =============================================================================
+
+#pragma once
+
+#include "StoreManager.hpp"
+#include "EntryStore.hpp"
+#include "EntryIndex.hpp"
+#include "SearchIndex.hpp"
+#include "FacetIndex.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+class CatalogParser;
+
+// =============================================================================
+// Catalog - Entries, categories and indexes of one catalog version
+// =============================================================================
+struct Catalog {
+    EntryStore entries;                             // Visible, highest-priority source first
+    std::vector<StoreEntry> shadowed;               // Hidden duplicates from lower-priority sources
+    std::vector<StoreCategory> categories;
+    uint32_t version = 0;                           // Unique per published catalog
+    
+    // -------------------------------------------------------------------------
+    // Indexes over entries, rebuilt by resolve() and shared by every reader
+    // -------------------------------------------------------------------------
+    struct CategoryPostings {
+        std::string category;
+        uint32_t first;                             // Into categoryPositions
+        uint32_t count;
+    };
+    
+    EntryIndex idIndex{&EntryView::id};
+    EntryIndex titleIndex{&EntryView::titleId};
+    std::vector<uint32_t> categoryPositions;        // Entry positions grouped by category
+    std::vector<CategoryPostings> categoryPostings; // Sorted by category
+    
+    // Shared by copies that only change counters (see updateLocalDownloadCount)
+    std::shared_ptr<const SearchIndex> searchIndex;
+    std::shared_ptr<const FacetIndex> facets;
+    
+    // Entry positions in every EntrySort order (ties in catalog order).
+    // A copy shares them until it changes a sort key.
+    std::shared_ptr<const std::vector<uint32_t>> sortOrders[ENTRY_SORT_COUNT];
+    
+    // Entry by id / title id, or an empty view
+    EntryView find(const std::string& id) const;
+    EntryView findByTitleId(const std::string& titleId) const;
+    
+    // Entries of one category in catalog order
+    EntrySpan byCategory(const std::string& category) const;
+    
+    // Full-text search, best match first
+    std::vector<EntryView> search(std::string_view query, size_t limit) const;
+    
+    // Entries first .. first + count in the given order
+    EntrySpan sorted(EntrySort sort, size_t first, size_t count) const;
+    
+    // Positions of the entries matching filter in the given order, at most
+    // limit of them
+    std::vector<uint32_t> filter(const EntryFilter& filter, EntrySort sort, size_t limit) const;
+    
+    // -------------------------------------------------------------------------
+    // Building (only on a Catalog that has not been published yet).
+    // merge() and retainSources() see every source's entries, shadowed ones
+    // included; resolve() must run before the catalog is published.
+    // -------------------------------------------------------------------------
+    
+    // Replace every entry (e.g. with a loaded snapshot); resolve() follows
+    void assign(std::vector<StoreEntry> all);
+    
+    // Apply a finished parse for one source: a full listing replaces that
+    // source's entries, a delta is merged into them
+    void merge(const std::string& sourceId, CatalogParser& parser);
+    
+    // Drop entries whose source is missing or disabled.
+    // Returns true if anything was removed.
+    bool retainSources(const std::vector<StoreSource>& sources);
+    
+    // Order entries by source priority (ties keep the order of sources),
+    // shadow every entry whose titleId or id a higher-priority source
+    // already provides, pack the rest and rebuild the indexes
+    void resolve(const std::vector<StoreSource>& sources);
+    
+    // Change one entry's download count and move it within the sort
+    // orders that depend on it, without sorting them again
+    void setDownloadCount(size_t position, int count);
+
+private:
+    // Unpack entries and fold shadowed ones back in before they are edited
+    void stage();
+    
+    std::vector<StoreEntry> staged;                 // Every entry, while building
+    
+    void rebuildIndexes();
+    void rebuildSortOrders();
+};
+
+// Shared, read-only reference that keeps one catalog version alive
+using CatalogHandle = std::shared_ptr<const Catalog>;
@@ -0,0 +1,298 @@
+// =============================================================================
+// Switch App Store - Catalog Parser Implementation
+// =============================================================================
+
+#include "CatalogParser.hpp"
+
+// =============================================================================
+// Schemas
+// =============================================================================
+
+namespace {
+
+constexpr schema::FieldBinding<StoreEntry> kEntryFields[] = {
+    schema::field("id", &StoreEntry::id),
+    schema::field("name", &StoreEntry::name),
+    schema::field("developer", &StoreEntry::developer),
+    schema::field("description", &StoreEntry::description),
+    schema::field("category", &StoreEntry::category),
+    schema::field("version", &StoreEntry::version),
+    schema::field("titleId", &StoreEntry::titleId),
+    schema::urlField("iconUrl", &StoreEntry::iconUrl),
+    schema::urlField("screenshotUrls", &StoreEntry::screenshotUrls),
+    schema::urlField("downloadUrl", &StoreEntry::downloadUrl),
+    schema::field("fileSize", &StoreEntry::fileSize),
+    schema::field("rating", &StoreEntry::rating),
+    schema::field("downloadCount", &StoreEntry::downloadCount),
+    schema::field("releaseDate", &StoreEntry::releaseDate),
+    schema::field("languages", &StoreEntry::languages),
+};
+
+constexpr schema::FieldBinding<StoreCategory> kCategoryFields[] = {
+    schema::field("id", &StoreCategory::id),
+    schema::field("name", &StoreCategory::name),
+    schema::field("icon", &StoreCategory::iconName),
+};
+
+constexpr auto kEntrySchema = schema::makeSchema(kEntryFields);
+constexpr auto kCategorySchema = schema::makeSchema(kCategoryFields);
+
+static_assert(kEntrySchema.isValid(), "no perfect hash for StoreEntry keys");
+static_assert(kCategorySchema.isValid(), "no perfect hash for StoreCategory keys");
+
+} // namespace
+
+// =============================================================================
+// Constructor
+// =============================================================================
+
+CatalogParser::CatalogParser(const std::string& baseUrl)
+    : m_baseUrl(baseUrl)
+{
+}
+
+// =============================================================================
+// Input
+// =============================================================================
+
+bool CatalogParser::feed(const char* data, size_t size) {
+    if (m_failed) return false;
+    m_parser.feed(data, size);
+    return pump();
+}
+
+bool CatalogParser::finish() {
+    if (m_failed) return false;
+    m_parser.finish();
+    return pump() && m_done;
+}
+
+bool CatalogParser::pump() {
+    using Event = json::StreamParser::Event;
+
+    while (true) {
+        Event event = m_parser.next();
+        switch (event) {
+            case Event::NeedMoreData:
+                return true;
+            case Event::Done:
+                m_done = true;
+                return true;
+            case Event::Error:
+                m_failed = true;
+                return false;
+            case Event::StartObject:
+                onStartContainer(true);
+                break;
+            case Event::StartArray:
+                onStartContainer(false);
+                break;
+            case Event::EndObject:
+            case Event::EndArray:
+                onEndContainer();
+                break;
+            case Event::Key:
+                onKey(m_parser.stringValue());
+                break;
+            case Event::String:
+                onString(m_parser.stringValue());
+                break;
+            case Event::Number:
+                onNumber(m_parser.number());
+                break;
+            case Event::Bool:
+                onBool(m_parser.boolValue());
+                break;
+            case Event::Null:
+                break;
+        }
+    }
+}
+
+// =============================================================================
+// Key lookup
+// =============================================================================
+
+CatalogParser::Key CatalogParser::lookupKey(std::string_view key) {
+    if (key == "success") return Key::Success;
+    if (key == "data") return Key::Data;
+    if (key == "games") return Key::Games;
+    if (key == "categories") return Key::Categories;
+    if (key == "delta") return Key::Delta;
+    if (key == "cursor") return Key::Cursor;
+    if (key == "removed") return Key::Removed;
+    return Key::Other;
+}
+
+void CatalogParser::onKey(std::string_view key) {
+    // Only the innermost context's table is consulted; anything it does
+    // not map resolves to nullptr and its value is dropped
+    Context context = m_stack.empty() ? Context::Skip : m_stack.back();
+    switch (context) {
+        case Context::Game:
+            m_entryField = kEntrySchema.find(key);
+            break;
+        case Context::Category:
+            m_categoryField = kCategorySchema.find(key);
+            break;
+        case Context::Root:
+        case Context::Data:
+            m_key = lookupKey(key);
+            break;
+        default:
+            break;
+    }
+}
+
+// =============================================================================
+// Structure events
+// =============================================================================
+
+void CatalogParser::onStartContainer(bool isObject) {
+    // -------------------------------------------------------------------------
+    // Decide what the new container is from its parent and the key it sits
+    // under. Anything we do not recognize is skipped wholesale.
+    // -------------------------------------------------------------------------
+    Context parent = m_stack.empty() ? Context::Skip : m_stack.back();
+    Context next = Context::Skip;
+
+    if (m_stack.empty()) {
+        next = isObject ? Context::Root : Context::Skip;
+    } else if (isObject) {
+        if (parent == Context::Root && m_key == Key::Data) {
+            next = Context::Data;
+        } else if (parent == Context::Games) {
+            next = Context::Game;
+            m_entry = StoreEntry();
+        } else if (parent == Context::Categories) {
+            next = Context::Category;
+            m_category = StoreCategory();
+        }
+    } else {
+        if (parent == Context::Data && m_key == Key::Games) {
+            next = Context::Games;
+        } else if (parent == Context::Data && m_key == Key::Categories) {
+            next = Context::Categories;
+            m_hasCategories = true;
+        } else if (parent == Context::Data && m_key == Key::Removed) {
+            next = Context::Removed;
+        } else if (parent == Context::Game && m_entryField && m_entryField->isList()) {
+            next = Context::List;
+            m_listField = m_entryField;
+        }
+    }
+
+    m_stack.push_back(next);
+    m_key = Key::Other;
+    m_entryField = nullptr;
+    m_categoryField = nullptr;
+}
+
+void CatalogParser::onEndContainer() {
+    if (m_stack.empty()) return;
+
+    Context closed = m_stack.back();
+    m_stack.pop_back();
+
+    if (closed == Context::Game) {
+        m_entry.releaseDay = StoreEntry::parseReleaseDate(m_entry.releaseDate);
+        m_entries.push_back(std::move(m_entry));
+        m_entry = StoreEntry();
+    } else if (closed == Context::Category) {
+        m_categories.push_back(std::move(m_category));
+        m_category = StoreCategory();
+    } else if (closed == Context::List) {
+        m_listField = nullptr;
+    }
+    m_key = Key::Other;
+    m_entryField = nullptr;
+    m_categoryField = nullptr;
+}
+
+// =============================================================================
+// Scalar events
+// =============================================================================
+
+void CatalogParser::onString(std::string_view value) {
+    if (m_stack.empty()) return;
+
+    switch (m_stack.back()) {
+        case Context::Game:
+            if (m_entryField) assignString(m_entry, *m_entryField, value);
+            break;
+
+        case Context::Category:
+            if (m_categoryField) assignString(m_category, *m_categoryField, value);
+            break;
+
+        case Context::Removed:
+            m_removedIds.emplace_back(value);
+            break;
+
+        case Context::Data:
+            if (m_key == Key::Cursor) m_cursor.assign(value.data(), value.size());
+            break;
+
+        case Context::List:
+            if (m_listField->isUrl()) {
+                (m_entry.*(m_listField->list)).push_back(resolveUrl(value));
+            } else {
+                (m_entry.*(m_listField->list)).emplace_back(value);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+template <typename T>
+void CatalogParser::assignString(T& record, const schema::FieldBinding<T>& field, std::string_view value) {
+    switch (field.kind) {
+        case schema::FieldKind::String:
+            (record.*(field.text)).assign(value.data(), value.size());
+            break;
+        case schema::FieldKind::Url:
+            record.*(field.text) = resolveUrl(value);
+            break;
+        default:
+            break;
+    }
+}
+
+void CatalogParser::onNumber(const json::Number& value) {
+    if (m_stack.empty() || m_stack.back() != Context::Game || !m_entryField) return;
+
+    switch (m_entryField->kind) {
+        case schema::FieldKind::Size: m_entry.*(m_entryField->size) = static_cast<size_t>(value.toUInt64()); break;
+        case schema::FieldKind::Int: m_entry.*(m_entryField->integer) = static_cast<int>(value.toInt64()); break;
+        case schema::FieldKind::Float: m_entry.*(m_entryField->real) = static_cast<float>(value.toDouble()); break;
+        default: break;
+    }
+}
+
+void CatalogParser::onBool(bool value) {
+    if (m_stack.empty()) return;
+
+    if (m_stack.back() == Context::Root && m_key == Key::Success) {
+        m_success = value;
+    } else if (m_stack.back() == Context::Data && m_key == Key::Delta) {
+        m_delta = value;
+    }
+}
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+std::string CatalogParser::resolveUrl(const std::string& baseUrl, std::string_view url) {
+    // Relative URLs are served by the source itself
+    if (!url.empty() && url.front() == '/') {
+        std::string resolved;
+        resolved.reserve(baseUrl.size() + url.size());
+        resolved += baseUrl;
+        resolved += url;
+        return resolved;
+    }
+    return std::string(url);
+}
@@ -0,0 +1,132 @@
+// =============================================================================
+// Switch App Store - Catalog Parser
+// =============================================================================
+// Streaming builder for /api/catalog responses. Fed straight from the
+// network write callback, it emits a StoreEntry as soon as each games[i]
+// object closes, so the whole document is never held in memory.
+// =============================================================================
+
+#pragma once
+
+#include "StoreManager.hpp"
+#include "SchemaBinding.hpp"
+#include "json.hpp"
+#include <string>
+#include <vector>
+
+// =============================================================================
+// CatalogParser - Builds StoreEntry / StoreCategory lists from a JSON stream
+// =============================================================================
+class CatalogParser {
+public:
+    // baseUrl is prepended to relative ("/static/...") URLs
+    explicit CatalogParser(const std::string& baseUrl);
+
+    // -------------------------------------------------------------------------
+    // Input
+    // -------------------------------------------------------------------------
+
+    // Feed the next chunk of the response body.
+    // Returns false once the stream is known to be malformed.
+    bool feed(const char* data, size_t size);
+
+    // Signal end of input. Returns true if a complete document was parsed.
+    bool finish();
+
+    // -------------------------------------------------------------------------
+    // Results
+    // -------------------------------------------------------------------------
+
+    // True if the document carried "success": true
+    bool isSuccess() const { return m_success; }
+
+    // Parsed entries, in document order (move out when done)
+    std::vector<StoreEntry>& getEntries() { return m_entries; }
+
+    // Parsed categories (empty if the response had none)
+    std::vector<StoreCategory>& getCategories() { return m_categories; }
+
+    // True if the response contained a "categories" array
+    bool hasCategories() const { return m_hasCategories; }
+
+    // True for a delta response: entries are upserts, see getRemovedIds()
+    bool isDelta() const { return m_delta; }
+
+    // Ids deleted since the cursor the request was made with (delta only)
+    std::vector<std::string>& getRemovedIds() { return m_removedIds; }
+
+    // Cursor to send with the next request ("" if the server sent none)
+    const std::string& getCursor() const { return m_cursor; }
+
+    // url, with a relative ("/static/...") one resolved against baseUrl
+    static std::string resolveUrl(const std::string& baseUrl, std::string_view url);
+
+private:
+    // Where we are in the document
+    enum class Context : uint8_t {
+        Root,
+        Data,
+        Games,
+        Game,
+        List,           // String array bound to an entry field
+        Removed,        // Tombstone ids of a delta response
+        Categories,
+        Category,
+        Skip
+    };
+
+    // Envelope keys; entry and category keys go through their schemas
+    enum class Key : uint8_t {
+        Other,
+        Success,
+        Data,
+        Games,
+        Categories,
+        Delta,
+        Cursor,
+        Removed
+    };
+
+    static Key lookupKey(std::string_view key);
+
+    void onKey(std::string_view key);
+
+    // Drain all tokens available from the stream parser
+    bool pump();
+
+    void onStartContainer(bool isObject);
+    void onEndContainer();
+    void onString(std::string_view value);
+    template <typename T>
+    void assignString(T& record, const schema::FieldBinding<T>& field, std::string_view value);
+    void onNumber(const json::Number& value);
+    void onBool(bool value);
+
+    std::string resolveUrl(std::string_view url) const { return resolveUrl(m_baseUrl, url); }
+
+    // -------------------------------------------------------------------------
+    // Members
+    // -------------------------------------------------------------------------
+
+    json::StreamParser m_parser;
+    std::string m_baseUrl;
+
+    std::vector<Context> m_stack;
+    Key m_key = Key::Other;
+    const schema::FieldBinding<StoreEntry>* m_entryField = nullptr;
+    const schema::FieldBinding<StoreCategory>* m_categoryField = nullptr;
+    const schema::FieldBinding<StoreEntry>* m_listField = nullptr;
+
+    StoreEntry m_entry;                 // Entry currently being built
+    StoreCategory m_category;           // Category currently being built
+
+    std::vector<StoreEntry> m_entries;
+    std::vector<StoreCategory> m_categories;
+    std::vector<std::string> m_removedIds;
+    std::string m_cursor;
+    bool m_hasCategories = false;
+    bool m_delta = false;
+    bool m_success = false;
+    bool m_done = false;
+    bool m_failed = false;
+};
@@ -0,0 +1,307 @@
+// =============================================================================
+// Switch App Store - Catalog Snapshot Implementation
+// =============================================================================
+
+#include "CatalogSnapshot.hpp"
+#include "utils/FileUtils.hpp"
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+// =============================================================================
+// Save
+// =============================================================================
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// Deduplicating string table (category names, languages and developers
+// repeat across thousands of entries)
+// -----------------------------------------------------------------------------
+class StringTableBuilder {
+public:
+    template <typename Ref>
+    Ref add(std::string_view text) {
+        auto it = m_offsets.find(text);
+        uint32_t offset;
+        if (it != m_offsets.end()) {
+            offset = it->second;
+        } else {
+            offset = static_cast<uint32_t>(m_data.size());
+            m_data.append(text.data(), text.size());
+            m_offsets.emplace(text, offset);
+        }
+        return Ref{offset, static_cast<uint32_t>(text.size())};
+    }
+
+    const std::string& data() const { return m_data; }
+
+private:
+    std::string m_data;
+    std::unordered_map<std::string_view, uint32_t> m_offsets;   // Views into the caller's strings
+};
+
+template <typename T>
+void appendRaw(std::string& out, const T* items, size_t count) {
+    out.append(reinterpret_cast<const char*>(items), sizeof(T) * count);
+}
+
+} // namespace
+
+bool CatalogSnapshot::save(const std::string& path,
+                           const std::vector<StoreEntry>& entries,
+                           const std::vector<StoreEntry>& shadowed,
+                           const std::vector<StoreCategory>& categories,
+                           const std::vector<StoreSource>& sources,
+                           uint64_t savedAt) {
+    StringTableBuilder strings;
+    std::vector<uint32_t> lists;        // Pairs of (offset, length) per list item
+
+    // -------------------------------------------------------------------------
+    // Flatten records
+    // -------------------------------------------------------------------------
+    auto addList = [&](const std::vector<std::string>& items) {
+        ListRef ref{static_cast<uint32_t>(lists.size() / 2), static_cast<uint32_t>(items.size())};
+        for (const auto& item : items) {
+            StringRef s = strings.add<StringRef>(item);
+            lists.push_back(s.offset);
+            lists.push_back(s.length);
+        }
+        return ref;
+    };
+
+    std::vector<EntryRecord> entryRecords;
+    entryRecords.reserve(entries.size() + shadowed.size());
+    auto addEntry = [&](const StoreEntry& e) {
+        EntryRecord r;
+        std::memset(&r, 0, sizeof(r));
+        r.id = strings.add<StringRef>(e.id);
+        r.name = strings.add<StringRef>(e.name);
+        r.developer = strings.add<StringRef>(e.developer);
+        r.description = strings.add<StringRef>(e.description);
+        r.category = strings.add<StringRef>(e.category);
+        r.version = strings.add<StringRef>(e.version);
+        r.titleId = strings.add<StringRef>(e.titleId);
+        r.iconUrl = strings.add<StringRef>(e.iconUrl);
+        r.downloadUrl = strings.add<StringRef>(e.downloadUrl);
+        r.releaseDate = strings.add<StringRef>(e.releaseDate);
+        r.sourceId = strings.add<StringRef>(e.sourceId);
+        r.screenshotUrls = addList(e.screenshotUrls);
+        r.languages = addList(e.languages);
+        r.fileSize = e.fileSize;
+        r.rating = e.rating;
+        r.downloadCount = e.downloadCount;
+        entryRecords.push_back(r);
+    };
+    for (const auto& e : entries) addEntry(e);
+    for (const auto& e : shadowed) addEntry(e);
+
+    std::vector<CategoryRecord> categoryRecords;
+    categoryRecords.reserve(categories.size());
+    for (const auto& c : categories) {
+        CategoryRecord r;
+        r.id = strings.add<StringRef>(c.id);
+        r.name = strings.add<StringRef>(c.name);
+        r.iconName = strings.add<StringRef>(c.iconName);
+        categoryRecords.push_back(r);
+    }
+
+    std::vector<SourceRecord> sourceRecords;
+    sourceRecords.reserve(sources.size());
+    for (const auto& s : sources) {
+        SourceRecord r;
+        r.id = strings.add<StringRef>(s.id);
+        r.etag = strings.add<StringRef>(s.etag);
+        r.cursor = strings.add<StringRef>(s.cursor);
+        sourceRecords.push_back(r);
+    }
+
+    // -------------------------------------------------------------------------
+    // Lay out sections back to back
+    // -------------------------------------------------------------------------
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.savedAt = savedAt;
+    header.entryCount = static_cast<uint32_t>(entryRecords.size());
+    header.categoryCount = static_cast<uint32_t>(categoryRecords.size());
+    header.entriesOffset = sizeof(Header);
+    header.categoriesOffset = header.entriesOffset + header.entryCount * sizeof(EntryRecord);
+    header.sourceCount = static_cast<uint32_t>(sourceRecords.size());
+    header.sourcesOffset = header.categoriesOffset + header.categoryCount * sizeof(CategoryRecord);
+    header.listsOffset = header.sourcesOffset + header.sourceCount * sizeof(SourceRecord);
+    header.listCount = static_cast<uint32_t>(lists.size() / 2);
+    header.stringsOffset = header.listsOffset + static_cast<uint32_t>(lists.size() * sizeof(uint32_t));
+    header.stringsSize = static_cast<uint32_t>(strings.data().size());
+
+    std::string out;
+    out.reserve(header.stringsOffset + header.stringsSize);
+    appendRaw(out, &header, 1);
+    appendRaw(out, entryRecords.data(), entryRecords.size());
+    appendRaw(out, categoryRecords.data(), categoryRecords.size());
+    appendRaw(out, sourceRecords.data(), sourceRecords.size());
+    appendRaw(out, lists.data(), lists.size());
+    out += strings.data();
+
+    // Checksum is written last, over the finished payload
+    header.checksum = checksum(out.data() + sizeof(Header), out.size() - sizeof(Header));
+    std::memcpy(&out[0], &header, sizeof(header));
+
+    return FileUtils::writeFileAtomic(path, out);
+}
+
+// =============================================================================
+// Load
+// =============================================================================
+
+bool CatalogSnapshot::load(const std::string& path,
+                           std::vector<StoreEntry>& entries,
+                           std::vector<StoreCategory>& categories,
+                           std::vector<StoreSource>& sources,
+                           uint64_t& savedAt) {
+    std::string data;
+    if (!FileUtils::readFile(path, data)) return false;
+    if (data.size() < sizeof(Header)) return false;
+
+    Header header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.magic != MAGIC || header.version != VERSION) return false;
+
+    // -------------------------------------------------------------------------
+    // Validate section bounds (64-bit math so counts cannot overflow)
+    // -------------------------------------------------------------------------
+    uint64_t size = data.size();
+    if (header.entriesOffset + uint64_t(header.entryCount) * sizeof(EntryRecord) > size ||
+        header.categoriesOffset + uint64_t(header.categoryCount) * sizeof(CategoryRecord) > size ||
+        header.sourcesOffset + uint64_t(header.sourceCount) * sizeof(SourceRecord) > size ||
+        header.listsOffset + uint64_t(header.listCount) * 2 * sizeof(uint32_t) > size ||
+        header.stringsOffset + uint64_t(header.stringsSize) > size) {
+        return false;
+    }
+    if (header.checksum != checksum(data.data() + sizeof(Header), data.size() - sizeof(Header))) {
+        return false;
+    }
+
+    const char* base = data.data();
+    const char* stringTable = base + header.stringsOffset;
+    bool ok = true;
+
+    auto text = [&](const StringRef& ref) {
+        if (uint64_t(ref.offset) + ref.length > header.stringsSize) {
+            ok = false;
+            return std::string();
+        }
+        return std::string(stringTable + ref.offset, ref.length);
+    };
+
+    auto list = [&](const ListRef& ref) {
+        std::vector<std::string> items;
+        if (uint64_t(ref.first) + ref.count > header.listCount) {
+            ok = false;
+            return items;
+        }
+        items.reserve(ref.count);
+        for (uint32_t i = 0; i < ref.count; i++) {
+            StringRef item;
+            std::memcpy(&item, base + header.listsOffset + (uint64_t(ref.first) + i) * sizeof(StringRef),
+                        sizeof(item));
+            items.push_back(text(item));
+        }
+        return items;
+    };
+
+    // -------------------------------------------------------------------------
+    // Materialize
+    // -------------------------------------------------------------------------
+    std::vector<StoreEntry> loadedEntries(header.entryCount);
+    for (uint32_t i = 0; i < header.entryCount && ok; i++) {
+        EntryRecord r;
+        std::memcpy(&r, base + header.entriesOffset + uint64_t(i) * sizeof(EntryRecord), sizeof(r));
+
+        StoreEntry& e = loadedEntries[i];
+        e.id = text(r.id);
+        e.name = text(r.name);
+        e.developer = text(r.developer);
+        e.description = text(r.description);
+        e.category = text(r.category);
+        e.version = text(r.version);
+        e.titleId = text(r.titleId);
+        e.iconUrl = text(r.iconUrl);
+        e.downloadUrl = text(r.downloadUrl);
+        e.releaseDate = text(r.releaseDate);
+        e.releaseDay = StoreEntry::parseReleaseDate(e.releaseDate);
+        e.sourceId = text(r.sourceId);
+        e.screenshotUrls = list(r.screenshotUrls);
+        e.languages = list(r.languages);
+        e.fileSize = static_cast<size_t>(r.fileSize);
+        e.rating = r.rating;
+        e.downloadCount = r.downloadCount;
+    }
+
+    std::vector<StoreCategory> loadedCategories(header.categoryCount);
+    for (uint32_t i = 0; i < header.categoryCount && ok; i++) {
+        CategoryRecord r;
+        std::memcpy(&r, base + header.categoriesOffset + uint64_t(i) * sizeof(CategoryRecord), sizeof(r));
+
+        StoreCategory& c = loadedCategories[i];
+        c.id = text(r.id);
+        c.name = text(r.name);
+        c.iconName = text(r.iconName);
+    }
+
+    std::vector<StoreSource> loadedSources(header.sourceCount);
+    for (uint32_t i = 0; i < header.sourceCount && ok; i++) {
+        SourceRecord r;
+        std::memcpy(&r, base + header.sourcesOffset + uint64_t(i) * sizeof(SourceRecord), sizeof(r));
+
+        StoreSource& s = loadedSources[i];
+        s.id = text(r.id);
+        s.etag = text(r.etag);
+        s.cursor = text(r.cursor);
+    }
+
+    if (!ok) return false;
+
+    entries = std::move(loadedEntries);
+    categories = std::move(loadedCategories);
+    sources = std::move(loadedSources);
+    savedAt = header.savedAt;
+    return true;
+}
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+uint32_t CatalogSnapshot::checksum(const char* data, size_t size) {
+    // -------------------------------------------------------------------------
+    // Four independent multiply/rotate lanes over 8-byte words (the xxHash64
+    // round). A byte-serial FNV loop over a multi-megabyte snapshot cost
+    // more than the rest of the load combined.
+    // -------------------------------------------------------------------------
+    const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+    const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+    auto round = [&](uint64_t acc, uint64_t word) {
+        acc += word * PRIME2;
+        acc = (acc << 31) | (acc >> 33);
+        return acc * PRIME1;
+    };
+    
+    uint64_t lanes[4] = {PRIME1 + PRIME2, PRIME2, 0, 0 - PRIME1};
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        for (int k = 0; k < 4; k++) {
+            uint64_t word;
+            std::memcpy(&word, data + i + k * 8, sizeof(word));
+            lanes[k] = round(lanes[k], word);
+        }
+    }
+    
+    uint64_t hash = size;
+    for (int k = 0; k < 4; k++) hash = round(hash, lanes[k]);
+    for (; i < size; i++) hash = round(hash, static_cast<uint8_t>(data[i]));
+    
+    hash ^= hash >> 29;
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+}
@@ -0,0 +1,117 @@
+// =============================================================================
+// Switch App Store - Catalog Snapshot
+// =============================================================================
+// Flat binary copy of the last good catalog, kept on the SD card so the
+// store can show content at startup before any network request finishes.
+//
+// Layout (little endian, all offsets from the start of the file):
+//
+//   Header           fixed size, magic + version + section offsets
+//   EntryRecord[]    fixed-size records, strings as (offset, length)
+//   CategoryRecord[]
+//   SourceRecord[]   per-source sync state (ETag, delta cursor)
+//   uint32_t[]       list table: string refs for screenshotUrls/languages
+//   char[]           string table, deduplicated, not NUL-terminated
+//
+// Any mismatch (magic, version, bounds, checksum) rejects the whole file.
+// =============================================================================
+
+#pragma once
+
+#include "StoreManager.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// =============================================================================
+// CatalogSnapshot - Save/load the catalog as a binary snapshot
+// =============================================================================
+class CatalogSnapshot {
+public:
+    static constexpr uint32_t MAGIC = 0x53435341;   // "ASCS"
+    static constexpr uint32_t VERSION = 2;
+
+    // Write entries, categories and the sync state (id, etag, cursor) of
+    // sources to path (atomically). shadowed is stored in the same table
+    // as entries, so deltas can still update entries hidden by another
+    // source. savedAt is stored so the caller can tell how stale the copy is.
+    static bool save(const std::string& path,
+                     const std::vector<StoreEntry>& entries,
+                     const std::vector<StoreEntry>& shadowed,
+                     const std::vector<StoreCategory>& categories,
+                     const std::vector<StoreSource>& sources,
+                     uint64_t savedAt);
+
+    // Read a snapshot with one bulk read. entries receives the shadowed
+    // entries too; sources receives only id, etag and cursor. On failure
+    // the outputs are untouched.
+    static bool load(const std::string& path,
+                     std::vector<StoreEntry>& entries,
+                     std::vector<StoreCategory>& categories,
+                     std::vector<StoreSource>& sources,
+                     uint64_t& savedAt);
+
+private:
+    // -------------------------------------------------------------------------
+    // On-disk structures
+    // -------------------------------------------------------------------------
+    struct StringRef {
+        uint32_t offset;        // Into the string table
+        uint32_t length;
+    };
+
+    struct ListRef {
+        uint32_t first;         // Index into the list table
+        uint32_t count;
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t savedAt;
+        uint32_t entryCount;
+        uint32_t categoryCount;
+        uint32_t entriesOffset;
+        uint32_t categoriesOffset;
+        uint32_t sourceCount;
+        uint32_t sourcesOffset;
+        uint32_t listsOffset;
+        uint32_t listCount;
+        uint32_t stringsOffset;
+        uint32_t stringsSize;
+        uint32_t checksum;      // Over everything after the header
+    };
+
+    struct EntryRecord {
+        StringRef id;
+        StringRef name;
+        StringRef developer;
+        StringRef description;
+        StringRef category;
+        StringRef version;
+        StringRef titleId;
+        StringRef iconUrl;
+        StringRef downloadUrl;
+        StringRef releaseDate;
+        StringRef sourceId;
+        ListRef screenshotUrls;
+        ListRef languages;
+        uint64_t fileSize;
+        float rating;
+        int32_t downloadCount;
+    };
+
+    struct CategoryRecord {
+        StringRef id;
+        StringRef name;
+        StringRef iconName;
+    };
+
+    struct SourceRecord {
+        StringRef id;
+        StringRef etag;
+        StringRef cursor;
+    };
+
+    static uint32_t checksum(const char* data, size_t size);
+};
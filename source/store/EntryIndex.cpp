@@ -0,0 +1,122 @@
+// =============================================================================
+// Switch App Store - Entry Index Implementation
+// =============================================================================
+
+#include "EntryIndex.hpp"
+#include <cstring>
+
+// =============================================================================
+// Build
+// =============================================================================
+
+void EntryIndex::build(const EntryStore& entries) {
+    // -------------------------------------------------------------------------
+    // Power-of-two table at most half full, so linear probes stay short
+    // -------------------------------------------------------------------------
+    size_t capacity = 16;
+    while (capacity < entries.size() * 2) capacity <<= 1;
+    
+    m_slots.assign(capacity, 0);
+    m_mask = static_cast<uint32_t>(capacity - 1);
+    m_records.clear();
+    m_records.reserve(entries.size() * (RECORD_HEADER + 16));
+    
+    for (size_t i = 0; i < entries.size(); i++) {
+        std::string_view key = (entries[i].*m_key)();
+        if (key.empty() || key.size() > UINT16_MAX) continue;
+        
+        uint32_t h = hash(key);
+        uint32_t slot = h & m_mask;
+        bool repeated = false;
+        while (m_slots[slot] != 0) {
+            if (uint32_t(m_slots[slot] >> 32) == h && keyAt(uint32_t(m_slots[slot]) - 1) == key) {
+                repeated = true;    // Keep the first entry
+                break;
+            }
+            slot = (slot + 1) & m_mask;
+        }
+        if (repeated) continue;
+        
+        uint32_t offset = static_cast<uint32_t>(m_records.size());
+        uint32_t position = static_cast<uint32_t>(i);
+        uint16_t length = static_cast<uint16_t>(key.size());
+        m_records.append(reinterpret_cast<const char*>(&position), sizeof(position));
+        m_records.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        m_records.append(key);
+        m_slots[slot] = (uint64_t(h) << 32) | uint64_t(offset + 1);
+    }
+}
+
+// =============================================================================
+// Lookup
+// =============================================================================
+
+uint32_t EntryIndex::find(std::string_view key) const {
+    if (m_slots.empty() || key.empty()) return NOT_FOUND;
+    
+    uint32_t h = hash(key);
+    uint32_t slot = h & m_mask;
+    for (;;) {
+        uint64_t current = m_slots[slot];
+        if (current == 0) return NOT_FOUND;
+        
+        // Compare the stored hash first; keys are only read on a match
+        if (uint32_t(current >> 32) == h) {
+            uint32_t offset = uint32_t(current) - 1;
+            if (keyAt(offset) == key) {
+                uint32_t position;
+                std::memcpy(&position, m_records.data() + offset, sizeof(position));
+                return position;
+            }
+        }
+        slot = (slot + 1) & m_mask;
+    }
+}
+
+std::string_view EntryIndex::keyAt(uint32_t offset) const {
+    uint16_t length;
+    std::memcpy(&length, m_records.data() + offset + sizeof(uint32_t), sizeof(length));
+    return std::string_view(m_records.data() + offset + RECORD_HEADER, length);
+}
+
+// =============================================================================
+// Hashing
+// =============================================================================
+
+uint32_t EntryIndex::hash(std::string_view key) {
+    // -------------------------------------------------------------------------
+    // Eight bytes per multiply-rotate step (ids and title ids are 8-20
+    // characters), then a final avalanche so the low bits used for the
+    // slot depend on every input byte
+    // -------------------------------------------------------------------------
+    const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+    const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+    
+    uint64_t h = key.size() * PRIME1;
+    size_t i = 0;
+    for (; i + 8 <= key.size(); i += 8) {
+        uint64_t word;
+        std::memcpy(&word, key.data() + i, sizeof(word));
+        h ^= word * PRIME2;
+        h = ((h << 31) | (h >> 33)) * PRIME1;
+    }
+    if (i < key.size()) {
+        // Tail: re-read the last eight bytes (overlapping the previous
+        // word) instead of a variable-length copy, which costs a libc call
+        uint64_t word = 0;
+        if (key.size() >= 8) {
+            std::memcpy(&word, key.data() + key.size() - 8, sizeof(word));
+        } else {
+            for (size_t k = i; k < key.size(); k++) {
+                word |= uint64_t(static_cast<uint8_t>(key[k])) << (8 * (k - i));
+            }
+        }
+        h ^= word * PRIME2;
+        h = ((h << 31) | (h >> 33)) * PRIME1;
+    }
+    
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    return static_cast<uint32_t>(h);
+}
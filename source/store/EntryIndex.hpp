@@ -0,0 +1,52 @@
+// =============================================================================
+// Switch App Store - Entry Index
+// =============================================================================
+// Open-addressing hash index from one string field of an entry (id,
+// titleId, ...) to the entry's position. Slots are one 64-bit word (hash +
+// record offset); keys are copied into a packed arena next to the
+// position, so a lookup never touches the (large, scattered) entries and
+// the index stays valid when the Catalog that owns it is copied.
+// =============================================================================
+
+#pragma once
+
+#include "EntryStore.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// =============================================================================
+// EntryIndex - key field -> position in an EntryStore
+// =============================================================================
+class EntryIndex {
+public:
+    static constexpr uint32_t NOT_FOUND = UINT32_MAX;
+    
+    using KeyField = std::string_view (EntryView::*)() const;
+    
+    explicit EntryIndex(KeyField key) : m_key(key) {}
+    
+    // Index entries. Empty keys are skipped; for repeated keys the first
+    // entry wins.
+    void build(const EntryStore& entries);
+    
+    // Position of the entry whose key field equals key, or NOT_FOUND
+    uint32_t find(std::string_view key) const;
+    
+    size_t memoryUsage() const { return m_slots.size() * sizeof(uint64_t) + m_records.size(); }
+    
+    // String hash used for the slots (also by SearchIndex's term table)
+    static uint32_t hash(std::string_view key);
+
+private:
+    std::string_view keyAt(uint32_t offset) const;
+    
+    // Record layout in m_records: uint32 position, uint16 length, key bytes
+    static constexpr size_t RECORD_HEADER = 6;
+    
+    KeyField m_key;
+    std::vector<uint64_t> m_slots;      // (hash << 32) | (record offset + 1); 0 = empty
+    std::string m_records;
+    uint32_t m_mask = 0;
+};
@@ -0,0 +1,294 @@
+// =============================================================================
+// Switch App Store - Entry Store Implementation
+// =============================================================================
+
+#include "EntryStore.hpp"
+#include <algorithm>
+#include <unordered_map>
+
+// =============================================================================
+// Packing
+// =============================================================================
+
+EntryStore::EntryStore(const std::vector<StoreEntry>& entries) {
+    auto cold = std::make_shared<Cold>();
+    const size_t count = entries.size();
+    
+    // -------------------------------------------------------------------------
+    // Interning tables only live for the build; views point into entries
+    // -------------------------------------------------------------------------
+    std::unordered_map<std::string_view, uint32_t> poolIds;
+    std::unordered_map<std::string_view, uint16_t> categoryIds;
+    std::unordered_map<std::string_view, uint32_t> languageBits;
+    
+    auto intern = [&](std::string_view value) {
+        auto inserted = poolIds.emplace(value, static_cast<uint32_t>(cold->poolOffsets.size()));
+        if (inserted.second) {
+            cold->poolOffsets.push_back(static_cast<uint32_t>(cold->pool.size()));
+            cold->pool.append(value.data(), value.size());
+        }
+        return inserted.first->second;
+    };
+    intern(std::string_view());         // Id 0 is the empty string
+    
+    auto append = [&](std::string_view value) {
+        cold->text.append(value.data(), value.size());
+        return static_cast<uint32_t>(value.size());
+    };
+    
+    // Absolute URLs share their scheme://authority part (one per mirror or
+    // CDN); the path is what differs between entries
+    auto splitUrl = [&](std::string_view url) {
+        UrlRef ref{0, static_cast<uint32_t>(cold->text.size()), 0};
+        size_t scheme = url.find("://");
+        if (scheme != std::string_view::npos) {
+            size_t path = url.find('/', scheme + 3);
+            if (path == std::string_view::npos) path = url.size();
+            ref.base = intern(url.substr(0, path));
+            url.remove_prefix(path);
+        }
+        ref.length = append(url);
+        return ref;
+    };
+    
+    size_t textSize = 0;
+    size_t screenshotCount = 0;
+    for (const auto& e : entries) {
+        textSize += e.id.size() + e.name.size() + e.description.size() + e.titleId.size() +
+                    e.releaseDate.size() + e.iconUrl.size() + e.downloadUrl.size();
+        for (const auto& url : e.screenshotUrls) textSize += url.size();
+        screenshotCount += e.screenshotUrls.size();
+    }
+    cold->text.reserve(textSize);
+    cold->records.reserve(count);
+    cold->screenshots.reserve(screenshotCount);
+    
+    m_rating.resize(count);
+    m_downloadCount.resize(count);
+    m_fileSize.resize(count);
+    m_releaseDay.resize(count);
+    m_category.resize(count);
+    m_languages.resize(count);
+    
+    for (size_t i = 0; i < count; i++) {
+        const StoreEntry& e = entries[i];
+        
+        Record record;
+        record.text = static_cast<uint32_t>(cold->text.size());
+        record.length[ID] = append(e.id);
+        record.length[NAME] = append(e.name);
+        record.length[DESCRIPTION] = append(e.description);
+        record.length[TITLE_ID] = append(e.titleId);
+        record.length[RELEASE_DATE] = append(e.releaseDate);
+        record.developer = intern(e.developer);
+        record.version = intern(e.version);
+        record.sourceId = intern(e.sourceId);
+        record.icon = splitUrl(e.iconUrl);
+        record.download = splitUrl(e.downloadUrl);
+        record.firstScreenshot = static_cast<uint32_t>(cold->screenshots.size());
+        record.screenshotCount = static_cast<uint32_t>(e.screenshotUrls.size());
+        for (const auto& url : e.screenshotUrls) {
+            cold->screenshots.push_back(splitUrl(url));
+        }
+        cold->records.push_back(record);
+        
+        auto category = categoryIds.emplace(e.category, static_cast<uint16_t>(cold->categoryNames.size()));
+        if (category.second) {
+            if (cold->categoryNames.size() == UINT16_MAX) {
+                // Out of ids: share the last one rather than wrap around
+                category.first->second = UINT16_MAX - 1;
+            } else {
+                cold->categoryNames.push_back(e.category);
+            }
+        }
+        
+        uint64_t languages = 0;
+        for (const auto& code : e.languages) {
+            auto bit = languageBits.find(code);
+            if (bit == languageBits.end()) {
+                if (cold->languageNames.size() == MAX_LANGUAGES) continue;
+                bit = languageBits.emplace(code, static_cast<uint32_t>(cold->languageNames.size())).first;
+                cold->languageNames.push_back(code);
+            }
+            languages |= 1ULL << bit->second;
+        }
+        
+        m_rating[i] = e.rating;
+        m_downloadCount[i] = e.downloadCount;
+        m_fileSize[i] = e.fileSize;
+        m_releaseDay[i] = e.releaseDay;
+        m_category[i] = category.first->second;
+        m_languages[i] = languages;
+    }
+    cold->poolOffsets.push_back(static_cast<uint32_t>(cold->pool.size()));
+    
+    m_cold = std::move(cold);
+}
+
+std::vector<StoreEntry> EntryStore::unpack() const {
+    std::vector<StoreEntry> entries;
+    entries.reserve(size());
+    for (size_t i = 0; i < size(); i++) {
+        entries.push_back((*this)[i].toEntry());
+    }
+    return entries;
+}
+
+// =============================================================================
+// Cold data
+// =============================================================================
+
+const std::vector<std::string>& EntryStore::categoryNames() const {
+    static const std::vector<std::string> none;
+    return m_cold ? m_cold->categoryNames : none;
+}
+
+const std::vector<std::string>& EntryStore::languageNames() const {
+    static const std::vector<std::string> none;
+    return m_cold ? m_cold->languageNames : none;
+}
+
+std::string_view EntryStore::pooled(uint32_t id) const {
+    const auto& offsets = m_cold->poolOffsets;
+    return std::string_view(m_cold->pool.data() + offsets[id], offsets[id + 1] - offsets[id]);
+}
+
+std::string_view EntryStore::text(const Record& record, TextField field) const {
+    uint32_t offset = record.text;
+    for (int f = 0; f < field; f++) offset += record.length[f];
+    return std::string_view(m_cold->text.data() + offset, record.length[field]);
+}
+
+std::string EntryStore::url(const UrlRef& ref) const {
+    std::string_view base = pooled(ref.base);
+    std::string result;
+    result.reserve(base.size() + ref.length);
+    result.append(base.data(), base.size());
+    result.append(m_cold->text.data() + ref.offset, ref.length);
+    return result;
+}
+
+size_t EntryStore::memoryUsage() const {
+    size_t hot = m_rating.capacity() * sizeof(float) +
+                 m_downloadCount.capacity() * sizeof(int32_t) +
+                 m_fileSize.capacity() * sizeof(uint64_t) +
+                 m_releaseDay.capacity() * sizeof(int32_t) +
+                 m_category.capacity() * sizeof(uint16_t) +
+                 m_languages.capacity() * sizeof(uint64_t);
+    if (!m_cold) return hot;
+    
+    size_t names = 0;
+    for (const auto* values : {&m_cold->categoryNames, &m_cold->languageNames}) {
+        for (const auto& value : *values) names += sizeof(std::string) + value.capacity();
+    }
+    return hot + names +
+           m_cold->text.capacity() + m_cold->pool.capacity() +
+           m_cold->poolOffsets.capacity() * sizeof(uint32_t) +
+           m_cold->records.capacity() * sizeof(Record) +
+           m_cold->screenshots.capacity() * sizeof(UrlRef);
+}
+
+// =============================================================================
+// EntryView
+// =============================================================================
+
+std::string_view EntryView::id() const {
+    return m_store->text(m_store->record(m_position), EntryStore::ID);
+}
+
+std::string_view EntryView::name() const {
+    return m_store->text(m_store->record(m_position), EntryStore::NAME);
+}
+
+std::string_view EntryView::developer() const {
+    return m_store->pooled(m_store->record(m_position).developer);
+}
+
+std::string_view EntryView::description() const {
+    return m_store->text(m_store->record(m_position), EntryStore::DESCRIPTION);
+}
+
+std::string_view EntryView::category() const {
+    return m_store->categoryNames()[m_store->categoryOf(m_position)];
+}
+
+std::string_view EntryView::version() const {
+    return m_store->pooled(m_store->record(m_position).version);
+}
+
+std::string_view EntryView::titleId() const {
+    return m_store->text(m_store->record(m_position), EntryStore::TITLE_ID);
+}
+
+std::string_view EntryView::releaseDate() const {
+    return m_store->text(m_store->record(m_position), EntryStore::RELEASE_DATE);
+}
+
+std::string_view EntryView::sourceId() const {
+    return m_store->pooled(m_store->record(m_position).sourceId);
+}
+
+std::string EntryView::iconUrl() const {
+    return m_store->url(m_store->record(m_position).icon);
+}
+
+std::string EntryView::downloadUrl() const {
+    return m_store->url(m_store->record(m_position).download);
+}
+
+std::vector<std::string> EntryView::screenshotUrls() const {
+    const auto& record = m_store->record(m_position);
+    std::vector<std::string> urls;
+    urls.reserve(record.screenshotCount);
+    for (uint32_t i = 0; i < record.screenshotCount; i++) {
+        urls.push_back(m_store->url(m_store->m_cold->screenshots[record.firstScreenshot + i]));
+    }
+    return urls;
+}
+
+std::vector<std::string_view> EntryView::languages() const {
+    std::vector<std::string_view> codes;
+    const auto& names = m_store->languageNames();
+    for (uint64_t bits = m_store->languagesOf(m_position); bits != 0; bits &= bits - 1) {
+        codes.push_back(names[__builtin_ctzll(bits)]);
+    }
+    return codes;
+}
+
+size_t EntryView::fileSize() const {
+    return static_cast<size_t>(m_store->fileSize(m_position));
+}
+
+float EntryView::rating() const {
+    return m_store->rating(m_position);
+}
+
+int EntryView::downloadCount() const {
+    return m_store->downloadCount(m_position);
+}
+
+int32_t EntryView::releaseDay() const {
+    return m_store->releaseDay(m_position);
+}
+
+StoreEntry EntryView::toEntry() const {
+    StoreEntry e;
+    e.id = std::string(id());
+    e.name = std::string(name());
+    e.developer = std::string(developer());
+    e.description = std::string(description());
+    e.category = std::string(category());
+    e.version = std::string(version());
+    e.titleId = std::string(titleId());
+    e.iconUrl = iconUrl();
+    e.screenshotUrls = screenshotUrls();
+    e.downloadUrl = downloadUrl();
+    e.fileSize = fileSize();
+    e.rating = rating();
+    e.downloadCount = downloadCount();
+    e.releaseDate = std::string(releaseDate());
+    e.releaseDay = releaseDay();
+    for (std::string_view code : languages()) e.languages.emplace_back(code);
+    e.sourceId = std::string(sourceId());
+    return e;
+}
@@ -0,0 +1,136 @@
+// =============================================================================
+// Switch App Store - Entry Store
+// =============================================================================
+// Packed, read-only storage for the entries of a published catalog. A
+// StoreEntry spends most of its size on per-entry std::string and vector
+// overhead and on copies of the same few strings, so a resolved catalog is
+// packed into:
+//
+//   Hot arrays     rating, downloadCount, fileSize, releaseDay, category
+//                  and language set, one contiguous array per field for the
+//                  sort and filter passes
+//   Text           every entry's own strings back to back in one arena
+//   String pool    values that repeat across entries (category, developer,
+//                  version, source, URL bases) stored once, by id
+//   Languages      a bitmask over the catalog's language codes
+//   URLs           (pooled scheme://host base, suffix in the arena)
+//
+// Callers read entries through EntryView. Everything but the hot arrays is
+// shared between copies, so a copy that only changes a download count
+// stays cheap.
+// =============================================================================
+
+#pragma once
+
+#include "StoreManager.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// =============================================================================
+// EntryStore - entries packed for reading
+// =============================================================================
+class EntryStore {
+public:
+    // Language codes per catalog that fit the per-entry mask; codes past
+    // this many distinct ones are not kept
+    static constexpr size_t MAX_LANGUAGES = 64;
+    
+    EntryStore() = default;
+    
+    // Pack entries (their order becomes the positions)
+    explicit EntryStore(const std::vector<StoreEntry>& entries);
+    
+    // Mutable copies of every entry, in position order
+    std::vector<StoreEntry> unpack() const;
+    
+    size_t size() const { return m_rating.size(); }
+    bool empty() const { return m_rating.empty(); }
+    EntryView operator[](size_t position) const { return EntryView(this, static_cast<uint32_t>(position)); }
+    
+    // -------------------------------------------------------------------------
+    // Hot fields by position
+    // -------------------------------------------------------------------------
+    float rating(size_t position) const { return m_rating[position]; }
+    int32_t downloadCount(size_t position) const { return m_downloadCount[position]; }
+    uint64_t fileSize(size_t position) const { return m_fileSize[position]; }
+    int32_t releaseDay(size_t position) const { return m_releaseDay[position]; }
+    
+    // Index into categoryNames()
+    uint16_t categoryOf(size_t position) const { return m_category[position]; }
+    
+    // Bit i set: the entry lists languageNames()[i]
+    uint64_t languagesOf(size_t position) const { return m_languages[position]; }
+    
+    const std::vector<std::string>& categoryNames() const;
+    const std::vector<std::string>& languageNames() const;
+    
+    // The only field that changes after packing (see
+    // StoreManager::updateLocalDownloadCount)
+    void setDownloadCount(size_t position, int32_t count) { m_downloadCount[position] = count; }
+    
+    size_t memoryUsage() const;
+
+private:
+    friend class EntryView;
+    
+    // -------------------------------------------------------------------------
+    // Cold data, shared by copies
+    // -------------------------------------------------------------------------
+    
+    // Suffix in Cold::text after a pooled base
+    struct UrlRef {
+        uint32_t base;              // Pool id; the empty string for relative URLs
+        uint32_t offset;            // Into Cold::text
+        uint32_t length;
+    };
+    
+    // Per-entry strings stored in Cold::text, in this order
+    enum TextField {
+        ID,
+        NAME,
+        DESCRIPTION,
+        TITLE_ID,
+        RELEASE_DATE,
+        TEXT_FIELDS
+    };
+    
+    struct Record {
+        uint32_t text;                      // First field in Cold::text
+        uint32_t length[TEXT_FIELDS];       // The fields follow each other
+        uint32_t developer;                 // Pool ids
+        uint32_t version;
+        uint32_t sourceId;
+        UrlRef icon;
+        UrlRef download;
+        uint32_t firstScreenshot;           // Into Cold::screenshots
+        uint32_t screenshotCount;
+    };
+    
+    struct Cold {
+        std::string text;
+        std::string pool;                   // Pooled strings back to back
+        std::vector<uint32_t> poolOffsets;  // Id -> start in pool, plus the end
+        std::vector<Record> records;
+        std::vector<UrlRef> screenshots;
+        std::vector<std::string> categoryNames;
+        std::vector<std::string> languageNames;
+    };
+    
+    std::string_view pooled(uint32_t id) const;
+    std::string_view text(const Record& record, TextField field) const;
+    std::string url(const UrlRef& ref) const;
+    const Record& record(size_t position) const { return m_cold->records[position]; }
+    
+    std::shared_ptr<const Cold> m_cold;
+    
+    // Hot arrays, copied with the store
+    std::vector<float> m_rating;
+    std::vector<int32_t> m_downloadCount;
+    std::vector<uint64_t> m_fileSize;
+    std::vector<int32_t> m_releaseDay;
+    std::vector<uint16_t> m_category;
+    std::vector<uint64_t> m_languages;
+};
@@ -0,0 +1,260 @@
+// =============================================================================
+// Switch App Store - Facet Index Implementation
+// =============================================================================
+
+#include "FacetIndex.hpp"
+#include <algorithm>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+const size_t FacetIndex::SIZE_BOUNDS[FacetCounts::SIZE_LIMITS - 1] = {
+    100ULL * 1024 * 1024,
+    500ULL * 1024 * 1024,
+    1024ULL * 1024 * 1024,
+    4096ULL * 1024 * 1024
+};
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// Bitset kernels, two words per vector. Bitmaps are small enough to stay
+// in cache, so these are bound by instruction count rather than memory.
+// -----------------------------------------------------------------------------
+
+void andWords(uint64_t* dst, const uint64_t* src, size_t count) {
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    for (; i + 2 <= count; i += 2) {
+        vst1q_u64(dst + i, vandq_u64(vld1q_u64(dst + i), vld1q_u64(src + i)));
+    }
+#elif defined(__SSE2__)
+    for (; i + 2 <= count; i += 2) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_and_si128(a, b));
+    }
+#endif
+    for (; i < count; i++) dst[i] &= src[i];
+}
+
+void orWords(uint64_t* dst, const uint64_t* src, size_t count) {
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    for (; i + 2 <= count; i += 2) {
+        vst1q_u64(dst + i, vorrq_u64(vld1q_u64(dst + i), vld1q_u64(src + i)));
+    }
+#elif defined(__SSE2__)
+    for (; i + 2 <= count; i += 2) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_or_si128(a, b));
+    }
+#endif
+    for (; i < count; i++) dst[i] |= src[i];
+}
+
+// Set bits of a & b, without storing the AND
+uint32_t andCount(const uint64_t* a, const uint64_t* b, size_t count) {
+    size_t i = 0;
+    uint64_t total = 0;
+#if defined(__ARM_NEON)
+    // Byte counts are widened pairwise into two 64-bit lanes
+    uint64x2_t lanes = vdupq_n_u64(0);
+    for (; i + 2 <= count; i += 2) {
+        uint8x16_t bytes = vreinterpretq_u8_u64(vandq_u64(vld1q_u64(a + i), vld1q_u64(b + i)));
+        lanes = vpadalq_u32(lanes, vpaddlq_u16(vpaddlq_u8(vcntq_u8(bytes))));
+    }
+    total = vgetq_lane_u64(lanes, 0) + vgetq_lane_u64(lanes, 1);
+#endif
+    for (; i < count; i++) total += __builtin_popcountll(a[i] & b[i]);
+    return static_cast<uint32_t>(total);
+}
+
+uint32_t countWords(const uint64_t* bits, size_t count) {
+    return andCount(bits, bits, count);
+}
+
+} // namespace
+
+// =============================================================================
+// Build
+// =============================================================================
+
+void FacetIndex::build(const EntryStore& entries) {
+    m_entryCount = static_cast<uint32_t>(entries.size());
+    m_words = (entries.size() + 63) / 64;
+    
+    // The store already numbers its distinct categories and languages;
+    // the chips list them sorted
+    m_categories = entries.categoryNames();
+    m_languages = entries.languageNames();
+    for (auto* values : {&m_categories, &m_languages}) {
+        std::sort(values->begin(), values->end());
+    }
+    
+    m_sizeBase = m_categories.size() + m_languages.size();
+    m_starsBase = m_sizeBase + FacetCounts::SIZE_LIMITS - 1;
+    size_t bitmapCount = m_starsBase + FacetCounts::STAR_LEVELS - 1;
+    m_bits.assign(bitmapCount * m_words, 0);
+    
+    // Store id -> bitmap
+    auto bitmapsOf = [](const std::vector<std::string>& names, const std::vector<std::string>& sorted,
+                        size_t base) {
+        std::vector<size_t> index(names.size());
+        for (size_t id = 0; id < names.size(); id++) {
+            index[id] = base + (std::lower_bound(sorted.begin(), sorted.end(), names[id]) - sorted.begin());
+        }
+        return index;
+    };
+    const std::vector<size_t> categoryBitmap = bitmapsOf(entries.categoryNames(), m_categories, 0);
+    const std::vector<size_t> languageBitmap = bitmapsOf(entries.languageNames(), m_languages,
+                                                         m_categories.size());
+    
+    for (size_t i = 0; i < entries.size(); i++) {
+        const size_t word = i / 64;
+        const uint64_t bit = 1ULL << (i % 64);
+        
+        bitmap(categoryBitmap[entries.categoryOf(i)])[word] |= bit;
+        for (uint64_t languages = entries.languagesOf(i); languages != 0; languages &= languages - 1) {
+            bitmap(languageBitmap[__builtin_ctzll(languages)])[word] |= bit;
+        }
+        for (size_t limit = 0; limit < FacetCounts::SIZE_LIMITS - 1; limit++) {
+            if (entries.fileSize(i) <= SIZE_BOUNDS[limit]) bitmap(m_sizeBase + limit)[word] |= bit;
+        }
+        for (size_t stars = 1; stars < FacetCounts::STAR_LEVELS; stars++) {
+            if (entries.rating(i) >= float(stars)) bitmap(m_starsBase + stars - 1)[word] |= bit;
+        }
+    }
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+bool FacetIndex::select(Facet facet, const EntryFilter& filter, uint64_t* out) const {
+    // Listed values: OR of the ones that exist
+    auto selectValues = [&](const std::vector<std::string>& values, const std::vector<std::string>& wanted,
+                            size_t base) {
+        if (wanted.empty()) return false;
+        std::fill(out, out + m_words, 0);
+        for (const auto& value : wanted) {
+            auto it = std::lower_bound(values.begin(), values.end(), value);
+            if (it != values.end() && *it == value) {
+                orWords(out, bitmap(base + (it - values.begin())), m_words);
+            }
+        }
+        return true;
+    };
+    
+    switch (facet) {
+        case CATEGORY:
+            return selectValues(m_categories, filter.categories, 0);
+        case LANGUAGE:
+            return selectValues(m_languages, filter.languages, m_categories.size());
+        case SIZE:
+            if (filter.size == SizeLimit::Any) return false;
+            std::copy_n(bitmap(m_sizeBase + size_t(filter.size) - 1), m_words, out);
+            return true;
+        case STARS:
+            if (filter.minStars <= 0) return false;
+            if (filter.minStars >= int(FacetCounts::STAR_LEVELS)) {
+                std::fill(out, out + m_words, 0);
+            } else {
+                std::copy_n(bitmap(m_starsBase + size_t(filter.minStars) - 1), m_words, out);
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
+FacetIndex::Bitmap FacetIndex::match(const EntryFilter& filter) const {
+    // Start from every entry; bits past the last entry stay clear
+    Bitmap result(m_words, ~0ULL);
+    if (m_entryCount % 64 != 0) result.back() = (1ULL << (m_entryCount % 64)) - 1;
+    
+    Bitmap selection(m_words);
+    for (int facet = 0; facet < FACET_COUNT; facet++) {
+        if (select(Facet(facet), filter, selection.data())) {
+            andWords(result.data(), selection.data(), m_words);
+        }
+    }
+    return result;
+}
+
+FacetCounts FacetIndex::counts(const EntryFilter& filter) const {
+    FacetCounts counts;
+    
+    // -------------------------------------------------------------------------
+    // Each facet is counted against the AND of the other facets, so a
+    // chip shows what picking it (instead of its siblings) would match
+    // -------------------------------------------------------------------------
+    std::vector<Bitmap> selections(FACET_COUNT);
+    bool selected[FACET_COUNT];
+    for (int facet = 0; facet < FACET_COUNT; facet++) {
+        selections[facet].resize(m_words);
+        selected[facet] = select(Facet(facet), filter, selections[facet].data());
+    }
+    
+    auto othersThan = [&](int skipped) {
+        Bitmap base(m_words, ~0ULL);
+        if (m_entryCount % 64 != 0) base.back() = (1ULL << (m_entryCount % 64)) - 1;
+        for (int facet = 0; facet < FACET_COUNT; facet++) {
+            if (facet != skipped && selected[facet]) {
+                andWords(base.data(), selections[facet].data(), m_words);
+            }
+        }
+        return base;
+    };
+    
+    Bitmap base = othersThan(CATEGORY);
+    counts.matches = selected[CATEGORY] ? andCount(base.data(), selections[CATEGORY].data(), m_words)
+                                        : countWords(base.data(), m_words);
+    for (size_t i = 0; i < m_categories.size(); i++) {
+        counts.categories.emplace_back(m_categories[i], andCount(base.data(), bitmap(i), m_words));
+    }
+    
+    base = othersThan(LANGUAGE);
+    for (size_t i = 0; i < m_languages.size(); i++) {
+        counts.languages.emplace_back(m_languages[i],
+                                      andCount(base.data(), bitmap(m_categories.size() + i), m_words));
+    }
+    
+    base = othersThan(SIZE);
+    counts.sizes[0] = countWords(base.data(), m_words);
+    for (size_t limit = 1; limit < FacetCounts::SIZE_LIMITS; limit++) {
+        counts.sizes[limit] = andCount(base.data(), bitmap(m_sizeBase + limit - 1), m_words);
+    }
+    
+    base = othersThan(STARS);
+    counts.stars[0] = countWords(base.data(), m_words);
+    for (size_t stars = 1; stars < FacetCounts::STAR_LEVELS; stars++) {
+        counts.stars[stars] = andCount(base.data(), bitmap(m_starsBase + stars - 1), m_words);
+    }
+    return counts;
+}
+
+void FacetIndex::positions(const Bitmap& bitmap, std::vector<uint32_t>& out) {
+    out.clear();
+    for (size_t word = 0; word < bitmap.size(); word++) {
+        for (uint64_t bits = bitmap[word]; bits != 0; bits &= bits - 1) {
+            out.push_back(static_cast<uint32_t>(word * 64 + __builtin_ctzll(bits)));
+        }
+    }
+}
+
+uint32_t FacetIndex::count(const Bitmap& bitmap) {
+    return countWords(bitmap.data(), bitmap.size());
+}
+
+size_t FacetIndex::memoryUsage() const {
+    size_t names = 0;
+    for (const auto* values : {&m_categories, &m_languages}) {
+        for (const auto& value : *values) names += sizeof(std::string) + value.capacity();
+    }
+    return m_bits.capacity() * sizeof(uint64_t) + names;
+}
@@ -0,0 +1,79 @@
+// =============================================================================
+// Switch App Store - Facet Index
+// =============================================================================
+// Bitmap index behind the store's filter chips. Every chip value owns one
+// bitset with a bit per entry position:
+//
+//   Category, language   One bitmap per distinct value; chips of one
+//                        facet are ORed together.
+//   Size, rating         Range encoded: "under 500 MB" and "4 stars and
+//                        up" are one bitmap each, so a chip is never an OR.
+//
+// A filter is the AND of its facets and a chip count is a popcount of that
+// AND, both a few vector instructions per 128 entries (NEON on the Switch).
+// Plain bitsets rather than compressed ones: even 50k entries only take
+// 6 KB per bitmap, and every chip is dense enough that compression would
+// mostly add branches.
+// =============================================================================
+
+#pragma once
+
+#include "EntryStore.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// =============================================================================
+// FacetIndex - chip value -> bitmap of entry positions
+// =============================================================================
+class FacetIndex {
+public:
+    using Bitmap = std::vector<uint64_t>;
+    
+    // Index entries (positions refer to this store)
+    void build(const EntryStore& entries);
+    
+    // Entries matching filter
+    Bitmap match(const EntryFilter& filter) const;
+    
+    // Chip counts for filter (see FacetCounts)
+    FacetCounts counts(const EntryFilter& filter) const;
+    
+    // Positions whose bit is set, ascending
+    static void positions(const Bitmap& bitmap, std::vector<uint32_t>& out);
+    
+    // Number of bits set
+    static uint32_t count(const Bitmap& bitmap);
+    
+    size_t memoryUsage() const;
+
+private:
+    enum Facet {
+        CATEGORY,
+        LANGUAGE,
+        SIZE,
+        STARS,
+        FACET_COUNT
+    };
+    
+    // Upper size bound of SizeLimit::Under100MB onwards
+    static const size_t SIZE_BOUNDS[FacetCounts::SIZE_LIMITS - 1];
+    
+    // Write the entries that facet's selection in filter allows to out; false
+    // (and out untouched) if the facet is not constrained
+    bool select(Facet facet, const EntryFilter& filter, uint64_t* out) const;
+    
+    const uint64_t* bitmap(size_t index) const { return m_bits.data() + index * m_words; }
+    uint64_t* bitmap(size_t index) { return m_bits.data() + index * m_words; }
+    
+    uint32_t m_entryCount = 0;
+    size_t m_words = 0;                         // Per bitmap
+    
+    // Bitmaps in m_bits: categories, languages, then one per SizeLimit past
+    // Any and one per minStars from 1 to 5
+    std::vector<std::string> m_categories;      // Sorted
+    std::vector<std::string> m_languages;       // Sorted
+    size_t m_sizeBase = 0;
+    size_t m_starsBase = 0;
+    std::vector<uint64_t> m_bits;
+};
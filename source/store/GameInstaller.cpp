@@ -3,6 +3,7 @@
 // =============================================================================
 
 #include "GameInstaller.hpp"
+#include "utils/FileUtils.hpp"
 #include <cstdio>
 #include <cstring>
 #include <ctime>
@@ -153,6 +154,7 @@ void GameInstaller::scanInstalledGames() {
     DIR* dir = opendir(m_installDir.c_str());
     if (!dir) return;
     
+    bool added = false;
     struct dirent* entry;
     while ((entry = readdir(dir)) != nullptr) {
         std::string name = entry->d_name;
@@ -183,11 +185,12 @@ void GameInstaller::scanInstalledGames() {
             }
             
             m_installedGames.push_back(game);
+            added = true;
         }
     }
     
     closedir(dir);
-    saveDatabase();
+    if (added) saveDatabase();
 }
 
 // =============================================================================
@@ -315,24 +318,47 @@ std::string GameInstaller::generateGameId(const std::string& name) {
 // =============================================================================
 
 void GameInstaller::loadDatabase() {
-    FILE* file = fopen(m_databasePath.c_str(), "r");
-    if (!file) return;
+    std::string content;
+    if (!FileUtils::readFile(m_databasePath, content)) return;
     
-    // Read file (simplified JSON parsing would go here)
-    fclose(file);
+    json::Document doc = json::parseDocument(std::move(content));
+    const json::Node& games = doc["games"];
+    if (!games.isArray()) return;
+    
+    m_installedGames.clear();
+    for (size_t i = 0; i < games.size(); i++) {
+        const json::Node& item = games[i];
+        
+        InstalledGame game;
+        game.id = item["id"].asString();
+        game.name = item["name"].asString();
+        game.path = item["path"].asString();
+        game.version = item["version"].asString();
+        game.iconPath = item["iconPath"].asString();
+        game.fileSize = static_cast<size_t>(item["fileSize"].asUInt64());
+        game.installDate = item["installDate"].asUInt64();
+        
+        if (!game.id.empty()) {
+            m_installedGames.push_back(std::move(game));
+        }
+    }
 }
 
 void GameInstaller::saveDatabase() {
-    FILE* file = fopen(m_databasePath.c_str(), "w");
-    if (!file) return;
-    
-    fprintf(file, "{\n  \"games\": [\n");
-    for (size_t i = 0; i < m_installedGames.size(); i++) {
-        const auto& g = m_installedGames[i];
-        fprintf(file, "    {\"id\":\"%s\",\"name\":\"%s\",\"path\":\"%s\",\"version\":\"%s\"}%s\n",
-                g.id.c_str(), g.name.c_str(), g.path.c_str(), g.version.c_str(),
-                i < m_installedGames.size() - 1 ? "," : "");
+    m_databaseWriter.clear();
+    m_databaseWriter.beginObject().key("games").beginArray();
+    for (const auto& g : m_installedGames) {
+        m_databaseWriter.beginObject()
+            .key("id").value(g.id)
+            .key("name").value(g.name)
+            .key("path").value(g.path)
+            .key("version").value(g.version)
+            .key("iconPath").value(g.iconPath)
+            .key("fileSize").value(g.fileSize)
+            .key("installDate").value(g.installDate)
+            .endObject();
     }
-    fprintf(file, "  ]\n}\n");
-    fclose(file);
+    m_databaseWriter.endArray().endObject();
+    
+    FileUtils::writeFileAtomic(m_databasePath, m_databaseWriter.str());
 }
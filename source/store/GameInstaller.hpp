@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "json.hpp"
 #include <string>
 #include <vector>
 #include <functional>
@@ -142,6 +143,7 @@ private:
     
     std::string m_installDir;
     std::string m_databasePath;
+    json::Writer m_databaseWriter{2};   // Reused across saves
     std::vector<InstalledGame> m_installedGames;
     InstallProgress m_progress;
 };
@@ -0,0 +1,1544 @@
+// =============================================================================
+// Switch App Store - Pinyin Table
+// =============================================================================
+// Generated from ICU's Han-Latin transliterator (most common reading, tone
+// marks and umlauts folded to ASCII) for the characters of GB2312 and Big5
+// level 1: 8836 simplified and traditional characters, 400 syllables.
+// =============================================================================
+
+#include "Pinyin.hpp"
+#include <algorithm>
+
+namespace {
+
+// Toneless syllables, sorted
+constexpr char SYLLABLES[][7] = {
+    "a", "ai", "an", "ang", "ao", "ba", "bai", "ban", "bang", "bao", "bei", "ben", "beng", "bi",
+    "bian", "biao", "bie", "bin", "bing", "bo", "bu", "ca", "cai", "can", "cang", "cao", "ce",
+    "cen", "ceng", "cha", "chai", "chan", "chang", "chao", "che", "chen", "cheng", "chi", "chong",
+    "chou", "chu", "chuai", "chuan", "chuang", "chui", "chun", "chuo", "ci", "cong", "cou", "cu",
+    "cuan", "cui", "cun", "cuo", "da", "dai", "dan", "dang", "dao", "de", "deng", "di", "dian",
+    "diao", "die", "ding", "diu", "dong", "dou", "du", "duan", "dui", "dun", "duo", "e", "ei", "en",
+    "er", "fa", "fan", "fang", "fei", "fen", "feng", "fou", "fu", "ga", "gai", "gan", "gang", "gao",
+    "ge", "gei", "gen", "geng", "gong", "gou", "gu", "gua", "guai", "guan", "guang", "gui", "gun",
+    "guo", "ha", "hai", "han", "hang", "hao", "he", "hei", "hen", "heng", "hong", "hou", "hu",
+    "hua", "huai", "huan", "huang", "hui", "hun", "huo", "ji", "jia", "jian", "jiang", "jiao",
+    "jie", "jin", "jing", "jiong", "jiu", "ju", "juan", "jue", "jun", "ka", "kai", "kan", "kang",
+    "kao", "ke", "kei", "ken", "keng", "kong", "kou", "ku", "kua", "kuai", "kuan", "kuang", "kui",
+    "kun", "kuo", "la", "lai", "lan", "lang", "lao", "le", "lei", "leng", "li", "lia", "lian",
+    "liang", "liao", "lie", "lin", "ling", "liu", "long", "lou", "lu", "luan", "lue", "lun", "luo",
+    "ma", "mai", "man", "mang", "mao", "me", "mei", "men", "meng", "mi", "mian", "miao", "mie",
+    "min", "ming", "miu", "mo", "mou", "mu", "n", "na", "nai", "nan", "nang", "nao", "ne", "nei",
+    "nen", "neng", "ni", "nian", "niang", "niao", "nie", "nin", "ning", "niu", "nong", "nou", "nu",
+    "nuan", "nue", "nuo", "o", "ou", "pa", "pai", "pan", "pang", "pao", "pei", "pen", "peng", "pi",
+    "pian", "piao", "pie", "pin", "ping", "po", "pou", "pu", "qi", "qia", "qian", "qiang", "qiao",
+    "qie", "qin", "qing", "qiong", "qiu", "qu", "quan", "que", "qun", "ran", "rang", "rao", "re",
+    "ren", "reng", "ri", "rong", "rou", "ru", "ruan", "rui", "run", "ruo", "sa", "sai", "san",
+    "sang", "sao", "se", "sen", "seng", "sha", "shai", "shan", "shang", "shao", "she", "shei",
+    "shen", "sheng", "shi", "shou", "shu", "shua", "shuai", "shuan", "shuang", "shui", "shun",
+    "shuo", "si", "song", "sou", "su", "suan", "sui", "sun", "suo", "ta", "tai", "tan", "tang",
+    "tao", "te", "teng", "ti", "tian", "tiao", "tie", "ting", "tong", "tou", "tu", "tuan", "tui",
+    "tun", "tuo", "wa", "wai", "wan", "wang", "wei", "wen", "weng", "wo", "wu", "xi", "xia", "xian",
+    "xiang", "xiao", "xie", "xin", "xing", "xiong", "xiu", "xu", "xuan", "xue", "xun", "ya", "yan",
+    "yang", "yao", "ye", "yi", "yin", "ying", "yo", "yong", "you", "yu", "yuan", "yue", "yun", "za",
+    "zai", "zan", "zang", "zao", "ze", "zei", "zen", "zeng", "zha", "zhai", "zhan", "zhang", "zhao",
+    "zhe", "zhen", "zheng", "zhi", "zhong", "zhou", "zhu", "zhua", "zhuai", "zhuan", "zhuang",
+    "zhui", "zhun", "zhuo", "zi", "zong", "zou", "zu", "zuan", "zui", "zun", "zuo",
+};
+
+struct Reading {
+    uint16_t codepoint;         // All characters are in U+4E00..U+9FFF
+    uint16_t syllable;          // Into SYLLABLES
+};
+
+// Sorted by codepoint
+constexpr Reading READINGS[] = {
+    {0x4E00, 354}, {0x4E01, 66}, {0x4E03, 244}, {0x4E07, 328}, {0x4E08, 376}, {0x4E09, 274},
+    {0x4E0A, 283}, {0x4E0B, 336}, {0x4E0C, 125}, {0x4E0D, 20}, {0x4E0E, 360}, {0x4E10, 88},
+    {0x4E11, 39}, {0x4E13, 387}, {0x4E14, 249}, {0x4E15, 235}, {0x4E16, 289}, {0x4E18, 253},
+    {0x4E19, 18}, {0x4E1A, 353}, {0x4E1B, 48}, {0x4E1C, 68}, {0x4E1D, 299}, {0x4E1E, 36},
+    {0x4E1F, 67}, {0x4E22, 67}, {0x4E24, 169}, {0x4E25, 350}, {0x4E26, 18}, {0x4E27, 275},
+    {0x4E28, 104}, {0x4E2A, 92}, {0x4E2B, 349}, {0x4E2C, 247}, {0x4E2D, 382}, {0x4E30, 84},
+    {0x4E32, 42}, {0x4E34, 172}, {0x4E36, 384}, {0x4E38, 328}, {0x4E39, 57}, {0x4E3A, 330},
+    {0x4E3B, 384}, {0x4E3D, 166}, {0x4E3E, 135}, {0x4E3F, 238}, {0x4E43, 203}, {0x4E45, 134},
+    {0x4E47, 325}, {0x4E48, 187}, {0x4E49, 354}, {0x4E4B, 381}, {0x4E4C, 334}, {0x4E4D, 373},
+    {0x4E4E, 117}, {0x4E4F, 79}, {0x4E50, 163}, {0x4E52, 240}, {0x4E53, 230}, {0x4E54, 248},
+    {0x4E56, 100}, {0x4E58, 36}, {0x4E59, 354}, {0x4E5C, 194}, {0x4E5D, 134}, {0x4E5E, 244},
+    {0x4E5F, 353}, {0x4E60, 335}, {0x4E61, 338}, {0x4E66, 291}, {0x4E69, 125}, {0x4E70, 183},
+    {0x4E71, 178}, {0x4E73, 267}, {0x4E7E, 246}, {0x4E82, 178}, {0x4E86, 163}, {0x4E88, 360},
+    {0x4E89, 380}, {0x4E8B, 289}, {0x4E8C, 78}, {0x4E8D, 40}, {0x4E8E, 360}, {0x4E8F, 155},
+    {0x4E91, 363}, {0x4E92, 117}, {0x4E93, 244}, {0x4E94, 334}, {0x4E95, 132}, {0x4E98, 94},
+    {0x4E99, 94}, {0x4E9A, 349}, {0x4E9B, 340}, {0x4E9E, 349}, {0x4E9F, 125}, {0x4EA0, 320},
+    {0x4EA1, 329}, {0x4EA2, 142}, {0x4EA4, 129}, {0x4EA5, 107}, {0x4EA6, 354}, {0x4EA7, 31},
+    {0x4EA8, 114}, {0x4EA9, 200}, {0x4EAB, 338}, {0x4EAC, 132}, {0x4EAD, 318}, {0x4EAE, 169},
+    {0x4EB2, 250}, {0x4EB3, 19}, {0x4EB5, 340}, {0x4EBA, 262}, {0x4EBB, 262}, {0x4EBF, 354},
+    {0x4EC0, 287}, {0x4EC1, 262}, {0x4EC2, 163}, {0x4EC3, 66}, {0x4EC4, 369}, {0x4EC5, 131},
+    {0x4EC6, 243}, {0x4EC7, 39}, {0x4EC9, 376}, {0x4ECA, 131}, {0x4ECB, 130}, {0x4ECD, 263},
+    {0x4ECE, 48}, {0x4ED1, 180}, {0x4ED3, 24}, {0x4ED4, 392}, {0x4ED5, 289}, {0x4ED6, 307},
+    {0x4ED7, 376}, {0x4ED8, 86}, {0x4ED9, 337}, {0x4EDD, 319}, {0x4EDE, 262}, {0x4EDF, 246},
+    {0x4EE1, 92}, {0x4EE3, 56}, {0x4EE4, 173}, {0x4EE5, 354}, {0x4EE8, 272}, {0x4EEA, 354},
+    {0x4EEB, 200}, {0x4EEC, 189}, {0x4EF0, 351}, {0x4EF2, 382}, {0x4EF3, 235}, {0x4EF5, 334},
+    {0x4EF6, 127}, {0x4EF7, 126}, {0x4EFB, 262}, {0x4EFD, 83}, {0x4EFF, 81}, {0x4F01, 244},
+    {0x4F09, 142}, {0x4F0A, 354}, {0x4F0B, 125}, {0x4F0D, 334}, {0x4F0E, 125}, {0x4F0F, 86},
+    {0x4F10, 79}, {0x4F11, 344}, {0x4F15, 86}, {0x4F17, 382}, {0x4F18, 359}, {0x4F19, 124},
+    {0x4F1A, 122}, {0x4F1B, 360}, {0x4F1E, 274}, {0x4F1F, 330}, {0x4F20, 42}, {0x4F22, 349},
+    {0x4F24, 283}, {0x4F25, 32}, {0x4F26, 180}, {0x4F27, 24}, {0x4F2A, 330}, {0x4F2B, 384},
+    {0x4F2F, 19}, {0x4F30, 98}, {0x4F32, 211}, {0x4F34, 7}, {0x4F36, 173}, {0x4F38, 287},
+    {0x4F3A, 47}, {0x4F3C, 289}, {0x4F3D, 126}, {0x4F43, 63}, {0x4F46, 57}, {0x4F47, 384},
+    {0x4F48, 20}, {0x4F4D, 330}, {0x4F4E, 62}, {0x4F4F, 384}, {0x4F50, 399}, {0x4F51, 359},
+    {0x4F53, 314}, {0x4F54, 375}, {0x4F55, 111}, {0x4F57, 325}, {0x4F58, 285}, {0x4F59, 360},
+    {0x4F5A, 354}, {0x4F5B, 86}, {0x4F5C, 399}, {0x4F5D, 97}, {0x4F5E, 217}, {0x4F5F, 319},
+    {0x4F60, 211}, {0x4F63, 358}, {0x4F64, 326}, {0x4F65, 246}, {0x4F67, 139}, {0x4F69, 232},
+    {0x4F6C, 162}, {0x4F6F, 351}, {0x4F70, 6}, {0x4F73, 126}, {0x4F74, 78}, {0x4F75, 18},
+    {0x4F76, 125}, {0x4F7A, 255}, {0x4F7B, 316}, {0x4F7C, 129}, {0x4F7E, 354}, {0x4F7F, 289},
+    {0x4F83, 141}, {0x4F84, 381}, {0x4F86, 159}, {0x4F88, 37}, {0x4F89, 151}, {0x4F8B, 166},
+    {0x4F8D, 289}, {0x4F8F, 384}, {0x4F91, 359}, {0x4F94, 199}, {0x4F96, 180}, {0x4F97, 68},
+    {0x4F9B, 96}, {0x4F9D, 354}, {0x4FA0, 336}, {0x4FA3, 177}, {0x4FA5, 129}, {0x4FA6, 379},
+    {0x4FA7, 26}, {0x4FA8, 248}, {0x4FA9, 152}, {0x4FAA, 30}, {0x4FAC, 219}, {0x4FAE, 334},
+    {0x4FAF, 116}, {0x4FB5, 250}, {0x4FB6, 177}, {0x4FB7, 135}, {0x4FBF, 14}, {0x4FC2, 335},
+    {0x4FC3, 50}, {0x4FC4, 75}, {0x4FC5, 253}, {0x4FCA, 138}, {0x4FCE, 395}, {0x4FCF, 248},
+    {0x4FD0, 166}, {0x4FD1, 358}, {0x4FD7, 302}, {0x4FD8, 86}, {0x4FDA, 166}, {0x4FDC, 240},
+    {0x4FDD, 9}, {0x4FDE, 360}, {0x4FDF, 244}, {0x4FE0, 336}, {0x4FE1, 341}, {0x4FE3, 360},
+    {0x4FE6, 39}, {0x4FE8, 350}, {0x4FE9, 167}, {0x4FEA, 166}, {0x4FED, 127}, {0x4FEE, 344},
+    {0x4FEF, 86}, {0x4FF1, 135}, {0x4FF3, 228}, {0x4FF8, 84}, {0x4FFA, 2}, {0x4FFE, 13},
+    {0x5000, 32}, {0x5006, 167}, {0x5009, 24}, {0x500B, 92}, {0x500C, 101}, {0x500D, 10},
+    {0x500F, 291}, {0x5011, 189}, {0x5012, 59}, {0x5014, 137}, {0x5016, 342}, {0x5018, 310},
+    {0x5019, 116}, {0x501A, 354}, {0x501C, 314}, {0x501F, 130}, {0x5021, 32}, {0x5023, 81},
+    {0x5025, 148}, {0x5026, 136}, {0x5028, 135}, {0x5029, 246}, {0x502A, 211}, {0x502B, 180},
+    {0x502C, 391}, {0x502D, 333}, {0x502E, 181}, {0x503A, 374}, {0x503C, 381}, {0x503E, 251},
+    {0x5043, 350}, {0x5047, 126}, {0x5048, 125}, {0x5049, 330}, {0x504C, 271}, {0x504E, 330},
+    {0x504F, 236}, {0x5055, 340}, {0x505A, 399}, {0x505C, 318}, {0x5065, 127}, {0x506C, 393},
+    {0x506D, 192}, {0x506F, 354}, {0x5074, 26}, {0x5075, 379}, {0x5076, 226}, {0x5077, 320},
+    {0x507A, 364}, {0x507B, 176}, {0x507D, 330}, {0x507E, 83}, {0x507F, 32}, {0x5080, 103},
+    {0x5085, 86}, {0x5088, 166}, {0x508D, 8}, {0x5091, 130}, {0x5096, 24}, {0x5098, 274},
+    {0x5099, 10}, {0x509A, 339}, {0x50A2, 126}, {0x50A3, 56}, {0x50A5, 310}, {0x50A7, 17},
+    {0x50A8, 40}, {0x50A9, 224}, {0x50AC, 52}, {0x50AD, 358}, {0x50AF, 393}, {0x50B2, 4},
+    {0x50B3, 42}, {0x50B5, 374}, {0x50B7, 283}, {0x50BA, 37}, {0x50BB, 280}, {0x50BE, 251},
+    {0x50C5, 131}, {0x50C7, 177}, {0x50CE, 387}, {0x50CF, 338}, {0x50D1, 248}, {0x50D5, 243},
+    {0x50D6, 335}, {0x50DA, 170}, {0x50E5, 129}, {0x50E6, 134}, {0x50E7, 279}, {0x50E9, 337},
+    {0x50EC, 129}, {0x50ED, 127}, {0x50EE, 319}, {0x50F1, 98}, {0x50F3, 302}, {0x50F5, 128},
+    {0x50F9, 126}, {0x50FB, 235}, {0x5100, 354}, {0x5102, 219}, {0x5104, 354}, {0x5105, 58},
+    {0x5106, 132}, {0x5107, 346}, {0x5108, 152}, {0x5109, 127}, {0x510B, 57}, {0x5110, 17},
+    {0x5112, 267}, {0x5114, 39}, {0x5115, 30}, {0x5118, 131}, {0x511F, 32}, {0x5121, 164},
+    {0x512A, 359}, {0x5132, 40}, {0x5133, 31}, {0x5137, 166}, {0x5138, 181}, {0x513B, 310},
+    {0x513C, 350}, {0x513F, 78}, {0x5140, 334}, {0x5141, 363}, {0x5143, 361}, {0x5144, 343},
+    {0x5145, 38}, {0x5146, 377}, {0x5147, 343}, {0x5148, 337}, {0x5149, 102}, {0x514B, 144},
+    {0x514C, 72}, {0x514D, 192}, {0x5151, 72}, {0x5152, 78}, {0x5154, 321}, {0x5155, 299},
+    {0x5156, 350}, {0x5157, 350}, {0x515A, 58}, {0x515C, 69}, {0x5162, 132}, {0x5165, 267},
+    {0x5167, 208}, {0x5168, 255}, {0x5169, 169}, {0x516B, 5}, {0x516C, 96}, {0x516D, 174},
+    {0x516E, 335}, {0x5170, 160}, {0x5171, 96}, {0x5173, 101}, {0x5174, 342}, {0x5175, 18},
+    {0x5176, 244}, {0x5177, 135}, {0x5178, 63}, {0x5179, 392}, {0x517B, 351}, {0x517C, 127},
+    {0x517D, 290}, {0x5180, 125}, {0x5181, 31}, {0x5182, 133}, {0x5185, 208}, {0x5188, 90},
+    {0x5189, 258}, {0x518A, 26}, {0x518C, 26}, {0x518D, 365}, {0x5191, 383}, {0x5192, 186},
+    {0x5195, 192}, {0x5196, 191}, {0x5197, 265}, {0x5199, 340}, {0x519B, 138}, {0x519C, 219},
+    {0x51A0, 101}, {0x51A2, 382}, {0x51A4, 361}, {0x51A5, 196}, {0x51AA, 191}, {0x51AB, 18},
+    {0x51AC, 68}, {0x51AF, 84}, {0x51B0, 18}, {0x51B1, 117}, {0x51B2, 38}, {0x51B3, 137},
+    {0x51B5, 154}, {0x51B6, 353}, {0x51B7, 165}, {0x51BB, 68}, {0x51BC, 337}, {0x51BD, 171},
+    {0x51C0, 132}, {0x51C4, 244}, {0x51C6, 390}, {0x51C7, 300}, {0x51C9, 169}, {0x51CB, 64},
+    {0x51CC, 173}, {0x51CD, 68}, {0x51CF, 127}, {0x51D1, 49}, {0x51DB, 172}, {0x51DC, 172},
+    {0x51DD, 217}, {0x51E0, 125}, {0x51E1, 80}, {0x51E4, 84}, {0x51EB, 86}, {0x51ED, 240},
+    {0x51EF, 140}, {0x51F0, 121}, {0x51F1, 140}, {0x51F3, 61}, {0x51F5, 246}, {0x51F6, 343},
+    {0x51F8, 321}, {0x51F9, 4}, {0x51FA, 40}, {0x51FB, 125}, {0x51FC, 58}, {0x51FD, 108},
+    {0x51FF, 368}, {0x5200, 59}, {0x5201, 64}, {0x5202, 59}, {0x5203, 262}, {0x5206, 83},
+    {0x5207, 249}, {0x5208, 354}, {0x520A, 141}, {0x520D, 40}, {0x520E, 331}, {0x5211, 342},
+    {0x5212, 118}, {0x5216, 362}, {0x5217, 171}, {0x5218, 174}, {0x5219, 369}, {0x521A, 90},
+    {0x521B, 43}, {0x521D, 40}, {0x5220, 282}, {0x5224, 229}, {0x5225, 16}, {0x5228, 231},
+    {0x5229, 166}, {0x522A, 282}, {0x522B, 16}, {0x522D, 132}, {0x522E, 99}, {0x5230, 59},
+    {0x5233, 150}, {0x5236, 381}, {0x5237, 292}, {0x5238, 255}, {0x5239, 280}, {0x523A, 47},
+    {0x523B, 144}, {0x523D, 103}, {0x523F, 103}, {0x5240, 140}, {0x5241, 74}, {0x5242, 125},
+    {0x5243, 314}, {0x5247, 369}, {0x524A, 347}, {0x524B, 145}, {0x524C, 158}, {0x524D, 246},
+    {0x524E, 280}, {0x5250, 99}, {0x5251, 127}, {0x5254, 314}, {0x5256, 242}, {0x525B, 90},
+    {0x525C, 328}, {0x525D, 19}, {0x525E, 125}, {0x5261, 282}, {0x5265, 19}, {0x5267, 135},
+    {0x5269, 288}, {0x526A, 127}, {0x526F, 86}, {0x5272, 92}, {0x5274, 140}, {0x5275, 43},
+    {0x5277, 31}, {0x527D, 237}, {0x527F, 129}, {0x5281, 248}, {0x5282, 137}, {0x5283, 118},
+    {0x5287, 135}, {0x5288, 235}, {0x5289, 174}, {0x528A, 103}, {0x528D, 127}, {0x5290, 124},
+    {0x5291, 125}, {0x5293, 354}, {0x529B, 166}, {0x529D, 255}, {0x529E, 7}, {0x529F, 96},
+    {0x52A0, 126}, {0x52A1, 334}, {0x52A2, 183}, {0x52A3, 171}, {0x52A8, 68}, {0x52A9, 384},
+    {0x52AA, 221}, {0x52AB, 130}, {0x52AC, 254}, {0x52AD, 284}, {0x52B1, 166}, {0x52B2, 131},
+    {0x52B3, 162}, {0x52BB, 154}, {0x52BE, 111}, {0x52BF, 289}, {0x52C1, 131}, {0x52C3, 19},
+    {0x52C7, 358}, {0x52C9, 192}, {0x52CB, 348}, {0x52D0, 190}, {0x52D2, 164}, {0x52D5, 68},
+    {0x52D6, 345}, {0x52D7, 345}, {0x52D8, 141}, {0x52D9, 334}, {0x52DB, 348}, {0x52DD, 288},
+    {0x52DE, 162}, {0x52DF, 200}, {0x52E2, 289}, {0x52E3, 125}, {0x52E4, 250}, {0x52E6, 33},
+    {0x52F0, 340}, {0x52F3, 348}, {0x52F5, 166}, {0x52F8, 255}, {0x52F9, 9}, {0x52FA, 284},
+    {0x52FB, 363}, {0x52FE, 97}, {0x52FF, 334}, {0x5300, 363}, {0x5305, 9}, {0x5306, 48},
+    {0x5308, 343}, {0x530D, 243}, {0x530F, 231}, {0x5310, 86}, {0x5315, 13}, {0x5316, 118},
+    {0x5317, 10}, {0x5319, 289}, {0x531A, 81}, {0x531D, 364}, {0x5320, 128}, {0x5321, 154},
+    {0x5323, 336}, {0x5326, 103}, {0x532A, 82}, {0x532E, 155}, {0x532F, 122}, {0x5331, 103},
+    {0x5339, 235}, {0x533A, 254}, {0x533B, 354}, {0x533E, 14}, {0x533F, 211}, {0x5340, 254},
+    {0x5341, 289}, {0x5343, 246}, {0x5345, 272}, {0x5347, 288}, {0x5348, 334}, {0x5349, 122},
+    {0x534A, 7}, {0x534E, 118}, {0x534F, 340}, {0x5351, 10}, {0x5352, 395}, {0x5353, 391},
+    {0x5354, 340}, {0x5355, 57}, {0x5356, 183}, {0x5357, 204}, {0x535A, 19}, {0x535C, 19},
+    {0x535E, 14}, {0x535F, 20}, {0x5360, 375}, {0x5361, 139}, {0x5362, 177}, {0x5363, 359},
+    {0x5364, 177}, {0x5366, 99}, {0x5367, 333}, {0x5369, 130}, {0x536B, 330}, {0x536E, 381},
+    {0x536F, 186}, {0x5370, 355}, {0x5371, 330}, {0x5373, 125}, {0x5374, 256}, {0x5375, 178},
+    {0x5377, 136}, {0x5378, 340}, {0x5379, 345}, {0x537A, 131}, {0x537B, 256}, {0x537F, 251},
+    {0x5382, 32}, {0x5384, 75}, {0x5385, 318}, {0x5386, 166}, {0x5389, 166}, {0x538B, 349},
+    {0x538C, 350}, {0x538D, 285}, {0x5395, 26}, {0x5398, 166}, {0x539A, 116}, {0x539D, 54},
+    {0x539F, 361}, {0x53A2, 338}, {0x53A3, 350}, {0x53A5, 137}, {0x53A6, 280}, {0x53A8, 40},
+    {0x53A9, 134}, {0x53AD, 350}, {0x53AE, 299}, {0x53B2, 166}, {0x53B6, 299}, {0x53BB, 254},
+    {0x53BF, 337}, {0x53C1, 274}, {0x53C2, 23}, {0x53C3, 23}, {0x53C8, 359}, {0x53C9, 29},
+    {0x53CA, 125}, {0x53CB, 359}, {0x53CC, 295}, {0x53CD, 80}, {0x53D1, 79}, {0x53D4, 291},
+    {0x53D6, 254}, {0x53D7, 290}, {0x53D8, 14}, {0x53D9, 345}, {0x53DB, 229}, {0x53DF, 301},
+    {0x53E0, 65}, {0x53E2, 48}, {0x53E3, 149}, {0x53E4, 98}, {0x53E5, 135}, {0x53E6, 173},
+    {0x53E8, 59}, {0x53E9, 149}, {0x53EA, 381}, {0x53EB, 129}, {0x53EC, 377}, {0x53ED, 5},
+    {0x53EE, 66}, {0x53EF, 144}, {0x53F0, 308}, {0x53F1, 37}, {0x53F2, 289}, {0x53F3, 359},
+    {0x53F5, 241}, {0x53F6, 353}, {0x53F7, 110}, {0x53F8, 299}, {0x53F9, 309}, {0x53FB, 163},
+    {0x53FC, 64}, {0x53FD, 125}, {0x5401, 345}, {0x5403, 37}, {0x5404, 92}, {0x5406, 352},
+    {0x5408, 111}, {0x5409, 125}, {0x540A, 64}, {0x540B, 53}, {0x540C, 319}, {0x540D, 196},
+    {0x540E, 116}, {0x540F, 166}, {0x5410, 321}, {0x5411, 338}, {0x5412, 373}, {0x5413, 336},
+    {0x5415, 177}, {0x5416, 349}, {0x5417, 182}, {0x541B, 138}, {0x541D, 172}, {0x541E, 324},
+    {0x541F, 355}, {0x5420, 82}, {0x5421, 13}, {0x5423, 250}, {0x5426, 85}, {0x5427, 5},
+    {0x5428, 73}, {0x5429, 83}, {0x542B, 108}, {0x542C, 318}, {0x542D, 147}, {0x542E, 297},
+    {0x542F, 244}, {0x5431, 381}, {0x5432, 355}, {0x5433, 334}, {0x5434, 334}, {0x5435, 33},
+    {0x5436, 202}, {0x5438, 335}, {0x5439, 44}, {0x543B, 331}, {0x543C, 116}, {0x543E, 334},
+    {0x5440, 349}, {0x5442, 177}, {0x5443, 75}, {0x5446, 56}, {0x5448, 36}, {0x544A, 91},
+    {0x544B, 86}, {0x544E, 37}, {0x5450, 202}, {0x5452, 86}, {0x5453, 354}, {0x5454, 56},
+    {0x5455, 226}, {0x5456, 166}, {0x5457, 10}, {0x5458, 361}, {0x5459, 105}, {0x545B, 247},
+    {0x545C, 334}, {0x5462, 207}, {0x5464, 173}, {0x5466, 359}, {0x5468, 383}, {0x5471, 98},
+    {0x5472, 47}, {0x5473, 330}, {0x5475, 111}, {0x5476, 206}, {0x5477, 87}, {0x5478, 232},
+    {0x547B, 287}, {0x547C, 117}, {0x547D, 196}, {0x5480, 135}, {0x5482, 364}, {0x5484, 74},
+    {0x5486, 231}, {0x548B, 364}, {0x548C, 111}, {0x548E, 134}, {0x548F, 358}, {0x5490, 86},
+    {0x5492, 383}, {0x5494, 139}, {0x5495, 98}, {0x5496, 139}, {0x5499, 175}, {0x549A, 68},
+    {0x549B, 217}, {0x549D, 299}, {0x54A3, 102}, {0x54A4, 373}, {0x54A6, 354}, {0x54A7, 171},
+    {0x54A8, 392}, {0x54A9, 194}, {0x54AA, 191}, {0x54AB, 381}, {0x54AC, 352}, {0x54AD, 125},
+    {0x54AF, 92}, {0x54B1, 366}, {0x54B3, 107}, {0x54B4, 122}, {0x54B8, 337}, {0x54BB, 344},
+    {0x54BD, 350}, {0x54BF, 354}, {0x54C0, 1}, {0x54C1, 239}, {0x54C2, 287}, {0x54C4, 115},
+    {0x54C6, 74}, {0x54C7, 326}, {0x54C8, 106}, {0x54C9, 365}, {0x54CC, 228}, {0x54CD, 338},
+    {0x54CE, 1}, {0x54CF, 94}, {0x54D0, 154}, {0x54D1, 349}, {0x54D2, 55}, {0x54D3, 339},
+    {0x54D4, 13}, {0x54D5, 122}, {0x54D7, 118}, {0x54D9, 152}, {0x54DA, 74}, {0x54DC, 125},
+    {0x54DD, 219}, {0x54DE, 199}, {0x54DF, 357}, {0x54E1, 361}, {0x54E5, 92}, {0x54E6, 225},
+    {0x54E7, 37}, {0x54E8, 284}, {0x54E9, 166}, {0x54EA, 202}, {0x54ED, 150}, {0x54EE, 339},
+    {0x54F2, 378}, {0x54F3, 373}, {0x54FA, 20}, {0x54FC, 114}, {0x54FD, 95}, {0x54FF, 92},
+    {0x5501, 350}, {0x5506, 306}, {0x5507, 45}, {0x5509, 1}, {0x550F, 335}, {0x5510, 310},
+    {0x5511, 399}, {0x5514, 334}, {0x551B, 182}, {0x5520, 162}, {0x5522, 306}, {0x5523, 368},
+    {0x5524, 120}, {0x5527, 125}, {0x552A, 84}, {0x552C, 117}, {0x552E, 290}, {0x552F, 330},
+    {0x5530, 292}, {0x5531, 32}, {0x5533, 166}, {0x5537, 357}, {0x5538, 212}, {0x553C, 280},
+    {0x553E, 325}, {0x553F, 117}, {0x5541, 377}, {0x5543, 146}, {0x5544, 391}, {0x5546, 283},
+    {0x5549, 172}, {0x554A, 0}, {0x554F, 331}, {0x5550, 52}, {0x5555, 311}, {0x5556, 57},
+    {0x5557, 57}, {0x555C, 41}, {0x555E, 349}, {0x555F, 244}, {0x5561, 82}, {0x5563, 337},
+    {0x5564, 235}, {0x5565, 280}, {0x5566, 158}, {0x5567, 369}, {0x556A, 227}, {0x556C, 277},
+    {0x556D, 387}, {0x556E, 215}, {0x5575, 19}, {0x5576, 66}, {0x5577, 161}, {0x5578, 339},
+    {0x557B, 37}, {0x557C, 314}, {0x557E, 134}, {0x5580, 139}, {0x5581, 358}, {0x5582, 330},
+    {0x5583, 204}, {0x5584, 282}, {0x5587, 158}, {0x5588, 130}, {0x5589, 116}, {0x558A, 108},
+    {0x558B, 65}, {0x558F, 224}, {0x5591, 355}, {0x5594, 225}, {0x5598, 42}, {0x5599, 122},
+    {0x559A, 120}, {0x559C, 335}, {0x559D, 111}, {0x559F, 155}, {0x55A7, 346}, {0x55AA, 275},
+    {0x55AB, 37}, {0x55AC, 248}, {0x55AE, 57}, {0x55B1, 166}, {0x55B2, 357}, {0x55B3, 373},
+    {0x55B5, 193}, {0x55B7, 233}, {0x55B9, 155}, {0x55BB, 360}, {0x55BD, 176}, {0x55BE, 150},
+    {0x55C4, 0}, {0x55C5, 344}, {0x55C6, 247}, {0x55C7, 277}, {0x55C9, 302}, {0x55CC, 1},
+    {0x55CD, 306}, {0x55CE, 182}, {0x55D1, 144}, {0x55D2, 55}, {0x55D3, 275}, {0x55D4, 35},
+    {0x55D6, 301}, {0x55DA, 334}, {0x55DC, 289}, {0x55DD, 92}, {0x55DF, 130}, {0x55E1, 332},
+    {0x55E3, 299}, {0x55E4, 37}, {0x55E5, 110}, {0x55E6, 306}, {0x55E8, 107}, {0x55EA, 250},
+    {0x55EB, 215}, {0x55EC, 111}, {0x55EF, 201}, {0x55F2, 65}, {0x55F3, 1}, {0x55F5, 319},
+    {0x55F6, 13}, {0x55F7, 4}, {0x55FD, 301}, {0x55FE, 301}, {0x5600, 62}, {0x5601, 244},
+    {0x5606, 309}, {0x5608, 25}, {0x5609, 126}, {0x560C, 237}, {0x560D, 176}, {0x560E, 87},
+    {0x560F, 98}, {0x5610, 339}, {0x5614, 226}, {0x5616, 369}, {0x5617, 32}, {0x5618, 345},
+    {0x561B, 182}, {0x561E, 164}, {0x561F, 70}, {0x5623, 12}, {0x5624, 356}, {0x5627, 191},
+    {0x5629, 118}, {0x562C, 41}, {0x562D, 234}, {0x562E, 162}, {0x562F, 339}, {0x5630, 125},
+    {0x5631, 384}, {0x5632, 33}, {0x5634, 397}, {0x5636, 299}, {0x5639, 170}, {0x563B, 335},
+    {0x563F, 112}, {0x564C, 28}, {0x564D, 129}, {0x564E, 353}, {0x5653, 345}, {0x5654, 61},
+    {0x5657, 243}, {0x5658, 137}, {0x5659, 250}, {0x565C, 177}, {0x5662, 225}, {0x5664, 131},
+    {0x5665, 219}, {0x5668, 244}, {0x5669, 75}, {0x566A, 368}, {0x566B, 354}, {0x566C, 289},
+    {0x566F, 1}, {0x5671, 137}, {0x5674, 233}, {0x5676, 87}, {0x5678, 73}, {0x5679, 58},
+    {0x567B, 273}, {0x567C, 235}, {0x5680, 217}, {0x5685, 267}, {0x5686, 110}, {0x5687, 336},
+    {0x568E, 110}, {0x568F, 314}, {0x5690, 32}, {0x5693, 21}, {0x5695, 177}, {0x56A3, 339},
+    {0x56A5, 350}, {0x56A8, 175}, {0x56AE, 338}, {0x56AF, 124}, {0x56B4, 350}, {0x56B6, 356},
+    {0x56B7, 259}, {0x56BC, 137}, {0x56C0, 387}, {0x56C1, 215}, {0x56C2, 339}, {0x56C8, 354},
+    {0x56C9, 181}, {0x56CA, 205}, {0x56CC, 302}, {0x56D1, 384}, {0x56D4, 205}, {0x56D7, 330},
+    {0x56DA, 253}, {0x56DB, 299}, {0x56DD, 127}, {0x56DE, 122}, {0x56DF, 341}, {0x56E0, 355},
+    {0x56E1, 204}, {0x56E2, 322}, {0x56E4, 73}, {0x56EA, 48}, {0x56EB, 117}, {0x56ED, 361},
+    {0x56F0, 156}, {0x56F1, 48}, {0x56F4, 330}, {0x56F5, 180}, {0x56F9, 173}, {0x56FA, 98},
+    {0x56FD, 105}, {0x56FE, 321}, {0x56FF, 359}, {0x5703, 243}, {0x5704, 360}, {0x5706, 361},
+    {0x5708, 255}, {0x5709, 360}, {0x570A, 251}, {0x570B, 105}, {0x570D, 330}, {0x5712, 361},
+    {0x5713, 361}, {0x5716, 321}, {0x5718, 322}, {0x571C, 120}, {0x571F, 321}, {0x5723, 288},
+    {0x5728, 365}, {0x5729, 330}, {0x572A, 92}, {0x572C, 334}, {0x572D, 103}, {0x572E, 235},
+    {0x572F, 354}, {0x5730, 60}, {0x5733, 379}, {0x5739, 154}, {0x573A, 32}, {0x573B, 244},
+    {0x573E, 125}, {0x5740, 381}, {0x5742, 7}, {0x5747, 138}, {0x574A, 81}, {0x574C, 11},
+    {0x574D, 309}, {0x574E, 141}, {0x574F, 119}, {0x5750, 399}, {0x5751, 147}, {0x5757, 152},
+    {0x575A, 127}, {0x575B, 309}, {0x575C, 166}, {0x575D, 5}, {0x575E, 334}, {0x575F, 83},
+    {0x5760, 389}, {0x5761, 241}, {0x5764, 156}, {0x5766, 309}, {0x5768, 325}, {0x5769, 89},
+    {0x576A, 240}, {0x576B, 63}, {0x576D, 211}, {0x576F, 235}, {0x5773, 4}, {0x5776, 200},
+    {0x5777, 144}, {0x577B, 37}, {0x577C, 34}, {0x5782, 44}, {0x5783, 158}, {0x5784, 175},
+    {0x5785, 175}, {0x5786, 177}, {0x578B, 342}, {0x578C, 68}, {0x5792, 164}, {0x5793, 88},
+    {0x579B, 74}, {0x57A0, 355}, {0x57A1, 79}, {0x57A2, 97}, {0x57A3, 361}, {0x57A4, 65},
+    {0x57A6, 146}, {0x57A7, 283}, {0x57A9, 75}, {0x57AB, 63}, {0x57AD, 349}, {0x57AE, 151},
+    {0x57B2, 140}, {0x57B4, 206}, {0x57B8, 361}, {0x57C2, 95}, {0x57C3, 1}, {0x57CB, 183},
+    {0x57CE, 36}, {0x57CF, 282}, {0x57D2, 171}, {0x57D4, 20}, {0x57D5, 36}, {0x57D8, 289},
+    {0x57D9, 348}, {0x57DA, 105}, {0x57DD, 212}, {0x57DF, 360}, {0x57E0, 20}, {0x57E4, 235},
+    {0x57ED, 56}, {0x57EF, 2}, {0x57F4, 381}, {0x57F7, 381}, {0x57F8, 354}, {0x57F9, 232},
+    {0x57FA, 125}, {0x57FD, 276}, {0x5800, 150}, {0x5802, 310}, {0x5805, 127}, {0x5806, 72},
+    {0x5807, 131}, {0x5809, 360}, {0x580A, 75}, {0x580B, 234}, {0x580D, 321}, {0x5811, 246},
+    {0x5815, 74}, {0x5819, 355}, {0x581D, 105}, {0x581E, 65}, {0x5820, 116}, {0x5821, 9},
+    {0x5824, 62}, {0x582A, 141}, {0x582F, 352}, {0x5830, 350}, {0x5831, 9}, {0x5834, 32},
+    {0x5835, 70}, {0x5844, 165}, {0x584A, 152}, {0x584B, 356}, {0x584C, 307}, {0x584D, 36},
+    {0x5851, 302}, {0x5852, 289}, {0x5854, 307}, {0x5857, 321}, {0x5858, 310}, {0x585A, 382},
+    {0x585E, 273}, {0x5862, 334}, {0x5865, 92}, {0x586B, 315}, {0x586C, 361}, {0x586D, 331},
+    {0x5875, 35}, {0x5879, 246}, {0x587D, 295}, {0x587E, 291}, {0x5880, 37}, {0x5881, 184},
+    {0x5883, 132}, {0x5885, 291}, {0x5889, 358}, {0x588A, 63}, {0x5892, 283}, {0x5893, 200},
+    {0x5899, 247}, {0x589A, 169}, {0x589C, 389}, {0x589E, 372}, {0x589F, 345}, {0x58A6, 80},
+    {0x58A8, 198}, {0x58A9, 73}, {0x58AE, 74}, {0x58B3, 83}, {0x58BC, 125}, {0x58BE, 146},
+    {0x58C1, 13}, {0x58C5, 358}, {0x58C7, 309}, {0x58CE, 348}, {0x58D1, 111}, {0x58D3, 349},
+    {0x58D5, 110}, {0x58D8, 164}, {0x58D9, 154}, {0x58DE, 119}, {0x58DF, 175}, {0x58E2, 166},
+    {0x58E4, 259}, {0x58E9, 5}, {0x58EB, 289}, {0x58EC, 262}, {0x58EE, 388}, {0x58EF, 388},
+    {0x58F0, 288}, {0x58F3, 144}, {0x58F6, 117}, {0x58F9, 354}, {0x58FA, 117}, {0x58FD, 290},
+    {0x5902, 381}, {0x5904, 40}, {0x5907, 10}, {0x590D, 86}, {0x590F, 336}, {0x5914, 155},
+    {0x5915, 335}, {0x5916, 327}, {0x5919, 302}, {0x591A, 74}, {0x591C, 353}, {0x591F, 97},
+    {0x5920, 97}, {0x5922, 190}, {0x5924, 355}, {0x5925, 124}, {0x5927, 55}, {0x5929, 315},
+    {0x592A, 308}, {0x592B, 86}, {0x592D, 352}, {0x592E, 351}, {0x592F, 109}, {0x5931, 289},
+    {0x5934, 320}, {0x5937, 354}, {0x5938, 151}, {0x5939, 126}, {0x593A, 74}, {0x593C, 154},
+    {0x593E, 126}, {0x5941, 168}, {0x5942, 120}, {0x5944, 350}, {0x5947, 244}, {0x5948, 203},
+    {0x5949, 84}, {0x594B, 83}, {0x594E, 155}, {0x594F, 394}, {0x5950, 120}, {0x5951, 244},
+    {0x5954, 11}, {0x5955, 354}, {0x5956, 128}, {0x5957, 311}, {0x5958, 367}, {0x595A, 335},
+    {0x5960, 63}, {0x5962, 285}, {0x5965, 4}, {0x5967, 4}, {0x5969, 168}, {0x596A, 74},
+    {0x596D, 289}, {0x596E, 83}, {0x5973, 221}, {0x5974, 221}, {0x5976, 203}, {0x5978, 127},
+    {0x5979, 307}, {0x597D, 110}, {0x5981, 298}, {0x5982, 267}, {0x5983, 82}, {0x5984, 329},
+    {0x5986, 388}, {0x5987, 86}, {0x5988, 182}, {0x598A, 262}, {0x598D, 350}, {0x5992, 70},
+    {0x5993, 125}, {0x5996, 352}, {0x5997, 131}, {0x5999, 193}, {0x599D, 388}, {0x599E, 218},
+    {0x59A3, 13}, {0x59A4, 360}, {0x59A5, 325}, {0x59A8, 81}, {0x59A9, 334}, {0x59AA, 360},
+    {0x59AB, 103}, {0x59AE, 211}, {0x59AF, 383}, {0x59B2, 55}, {0x59B3, 203}, {0x59B9, 188},
+    {0x59BB, 244}, {0x59BE, 249}, {0x59C5, 7}, {0x59C6, 200}, {0x59CA, 392}, {0x59CB, 289},
+    {0x59CD, 282}, {0x59D0, 130}, {0x59D1, 98}, {0x59D2, 299}, {0x59D3, 342}, {0x59D4, 330},
+    {0x59D7, 282}, {0x59D8, 239}, {0x59DA, 352}, {0x59DC, 128}, {0x59DD, 291}, {0x59E3, 129},
+    {0x59E5, 162}, {0x59E6, 127}, {0x59E8, 354}, {0x59EA, 381}, {0x59EC, 125}, {0x59F9, 29},
+    {0x59FB, 355}, {0x59FF, 392}, {0x5A01, 330}, {0x5A03, 326}, {0x5A04, 176}, {0x5A05, 349},
+    {0x5A06, 260}, {0x5A07, 129}, {0x5A08, 178}, {0x5A09, 240}, {0x5A0C, 166}, {0x5A11, 306},
+    {0x5A13, 330}, {0x5A18, 213}, {0x5A1B, 360}, {0x5A1C, 202}, {0x5A1F, 136}, {0x5A20, 287},
+    {0x5A23, 62}, {0x5A25, 75}, {0x5A29, 192}, {0x5A31, 360}, {0x5A32, 326}, {0x5A34, 337},
+    {0x5A36, 254}, {0x5A3C, 32}, {0x5A40, 75}, {0x5A41, 176}, {0x5A46, 241}, {0x5A49, 328},
+    {0x5A4A, 15}, {0x5A55, 130}, {0x5A5A, 123}, {0x5A62, 13}, {0x5A66, 86}, {0x5A67, 132},
+    {0x5A6A, 160}, {0x5A74, 356}, {0x5A75, 31}, {0x5A76, 287}, {0x5A77, 318}, {0x5A7A, 334},
+    {0x5A7F, 345}, {0x5A92, 188}, {0x5A9A, 188}, {0x5A9B, 361}, {0x5AA7, 326}, {0x5AAA, 4},
+    {0x5AB2, 235}, {0x5AB3, 335}, {0x5AB5, 356}, {0x5AB8, 37}, {0x5ABC, 4}, {0x5ABD, 182},
+    {0x5ABE, 97}, {0x5AC1, 126}, {0x5AC2, 276}, {0x5AC9, 125}, {0x5ACC, 337}, {0x5AD2, 1},
+    {0x5AD4, 239}, {0x5AD6, 237}, {0x5AD7, 360}, {0x5AD8, 164}, {0x5ADC, 376}, {0x5AE0, 166},
+    {0x5AE1, 62}, {0x5AE3, 350}, {0x5AE6, 32}, {0x5AE9, 209}, {0x5AEB, 198}, {0x5AF1, 247},
+    {0x5AF5, 334}, {0x5AFB, 337}, {0x5B08, 260}, {0x5B09, 335}, {0x5B0B, 31}, {0x5B0C, 129},
+    {0x5B16, 13}, {0x5B17, 282}, {0x5B1D, 214}, {0x5B24, 182}, {0x5B2A, 239}, {0x5B30, 356},
+    {0x5B32, 214}, {0x5B34, 356}, {0x5B37, 182}, {0x5B38, 287}, {0x5B40, 295}, {0x5B43, 213},
+    {0x5B50, 392}, {0x5B51, 130}, {0x5B53, 137}, {0x5B54, 148}, {0x5B55, 363}, {0x5B57, 392},
+    {0x5B58, 53}, {0x5B59, 305}, {0x5B5A, 86}, {0x5B5B, 10}, {0x5B5C, 392}, {0x5B5D, 339},
+    {0x5B5F, 190}, {0x5B62, 9}, {0x5B63, 125}, {0x5B64, 98}, {0x5B65, 221}, {0x5B66, 347},
+    {0x5B69, 107}, {0x5B6A, 178}, {0x5B6B, 305}, {0x5B6C, 206}, {0x5B70, 291}, {0x5B71, 23},
+    {0x5B73, 392}, {0x5B75, 86}, {0x5B78, 347}, {0x5B7A, 267}, {0x5B7D, 215}, {0x5B7F, 178},
+    {0x5B80, 192}, {0x5B81, 217}, {0x5B83, 307}, {0x5B84, 103}, {0x5B85, 374}, {0x5B87, 360},
+    {0x5B88, 290}, {0x5B89, 2}, {0x5B8B, 300}, {0x5B8C, 328}, {0x5B8F, 115}, {0x5B93, 191},
+    {0x5B95, 58}, {0x5B97, 393}, {0x5B98, 101}, {0x5B99, 383}, {0x5B9A, 66}, {0x5B9B, 328},
+    {0x5B9C, 354}, {0x5B9D, 9}, {0x5B9E, 289}, {0x5BA0, 38}, {0x5BA1, 287}, {0x5BA2, 144},
+    {0x5BA3, 346}, {0x5BA4, 289}, {0x5BA5, 359}, {0x5BA6, 120}, {0x5BAA, 337}, {0x5BAB, 96},
+    {0x5BAE, 96}, {0x5BB0, 365}, {0x5BB3, 107}, {0x5BB4, 350}, {0x5BB5, 339}, {0x5BB6, 126},
+    {0x5BB8, 35}, {0x5BB9, 265}, {0x5BBD, 153}, {0x5BBE, 17}, {0x5BBF, 302}, {0x5BC2, 125},
+    {0x5BC4, 125}, {0x5BC5, 355}, {0x5BC6, 191}, {0x5BC7, 149}, {0x5BCC, 86}, {0x5BD0, 188},
+    {0x5BD2, 108}, {0x5BD3, 360}, {0x5BDD, 250}, {0x5BDE, 198}, {0x5BDF, 29}, {0x5BE1, 99},
+    {0x5BE2, 250}, {0x5BE4, 334}, {0x5BE5, 170}, {0x5BE6, 289}, {0x5BE7, 217}, {0x5BE8, 374},
+    {0x5BE9, 287}, {0x5BEB, 340}, {0x5BEC, 153}, {0x5BEE, 170}, {0x5BF0, 120}, {0x5BF5, 38},
+    {0x5BF6, 9}, {0x5BF8, 53}, {0x5BF9, 72}, {0x5BFA, 299}, {0x5BFB, 348}, {0x5BFC, 59},
+    {0x5BFF, 290}, {0x5C01, 84}, {0x5C04, 285}, {0x5C06, 128}, {0x5C07, 128}, {0x5C08, 387},
+    {0x5C09, 330}, {0x5C0A, 398}, {0x5C0B, 348}, {0x5C0D, 72}, {0x5C0E, 59}, {0x5C0F, 339},
+    {0x5C11, 284}, {0x5C14, 78}, {0x5C15, 87}, {0x5C16, 127}, {0x5C18, 35}, {0x5C1A, 283},
+    {0x5C1C, 87}, {0x5C1D, 32}, {0x5C22, 359}, {0x5C24, 359}, {0x5C25, 170}, {0x5C27, 352},
+    {0x5C2C, 87}, {0x5C31, 134}, {0x5C34, 89}, {0x5C37, 89}, {0x5C38, 289}, {0x5C39, 355},
+    {0x5C3A, 37}, {0x5C3B, 143}, {0x5C3C, 211}, {0x5C3D, 131}, {0x5C3E, 330}, {0x5C3F, 214},
+    {0x5C40, 135}, {0x5C41, 235}, {0x5C42, 28}, {0x5C45, 135}, {0x5C46, 130}, {0x5C48, 254},
+    {0x5C49, 314}, {0x5C4A, 130}, {0x5C4B, 334}, {0x5C4D, 289}, {0x5C4E, 289}, {0x5C4F, 240},
+    {0x5C50, 125}, {0x5C51, 340}, {0x5C55, 375}, {0x5C58, 184}, {0x5C59, 75}, {0x5C5C, 314},
+    {0x5C5D, 82}, {0x5C5E, 291}, {0x5C60, 321}, {0x5C61, 177}, {0x5C62, 177}, {0x5C63, 335},
+    {0x5C64, 28}, {0x5C65, 177}, {0x5C66, 135}, {0x5C68, 135}, {0x5C6C, 291}, {0x5C6E, 34},
+    {0x5C6F, 324}, {0x5C71, 282}, {0x5C79, 354}, {0x5C7A, 244}, {0x5C7F, 360}, {0x5C81, 304},
+    {0x5C82, 244}, {0x5C88, 349}, {0x5C8C, 125}, {0x5C8D, 246}, {0x5C90, 244}, {0x5C91, 27},
+    {0x5C94, 29}, {0x5C96, 254}, {0x5C97, 90}, {0x5C98, 337}, {0x5C99, 4}, {0x5C9A, 160},
+    {0x5C9B, 59}, {0x5C9C, 5}, {0x5CA1, 90}, {0x5CA2, 144}, {0x5CA3, 97}, {0x5CA9, 350},
+    {0x5CAB, 344}, {0x5CAC, 126}, {0x5CAD, 173}, {0x5CB1, 56}, {0x5CB3, 362}, {0x5CB5, 117},
+    {0x5CB7, 195}, {0x5CB8, 2}, {0x5CBD, 68}, {0x5CBF, 155}, {0x5CC1, 186}, {0x5CC4, 354},
+    {0x5CCB, 348}, {0x5CD2, 68}, {0x5CD9, 381}, {0x5CE1, 336}, {0x5CE4, 129}, {0x5CE5, 380},
+    {0x5CE6, 178}, {0x5CE8, 75}, {0x5CEA, 360}, {0x5CED, 248}, {0x5CF0, 84}, {0x5CF4, 337},
+    {0x5CF6, 59}, {0x5CFB, 138}, {0x5CFD, 336}, {0x5D01, 141}, {0x5D02, 162}, {0x5D03, 159},
+    {0x5D06, 148}, {0x5D07, 38}, {0x5D0E, 244}, {0x5D11, 156}, {0x5D14, 52}, {0x5D16, 349},
+    {0x5D17, 90}, {0x5D19, 180}, {0x5D1B, 137}, {0x5D1E, 105}, {0x5D22, 380}, {0x5D24, 339},
+    {0x5D26, 350}, {0x5D27, 300}, {0x5D29, 12}, {0x5D2D, 375}, {0x5D2E, 98}, {0x5D34, 327},
+    {0x5D3D, 365}, {0x5D3E, 352}, {0x5D47, 125}, {0x5D4A, 288}, {0x5D4B, 188}, {0x5D4C, 246},
+    {0x5D50, 160}, {0x5D58, 265}, {0x5D5B, 360}, {0x5D5D, 176}, {0x5D69, 300}, {0x5D6B, 392},
+    {0x5D6C, 330}, {0x5D6F, 54}, {0x5D74, 125}, {0x5D82, 376}, {0x5D84, 375}, {0x5D87, 254},
+    {0x5D94, 250}, {0x5D99, 172}, {0x5D9D, 61}, {0x5DB7, 354}, {0x5DB8, 265}, {0x5DBA, 173},
+    {0x5DBC, 360}, {0x5DBD, 362}, {0x5DC5, 63}, {0x5DC9, 31}, {0x5DCD, 330}, {0x5DD2, 178},
+    {0x5DD4, 63}, {0x5DD6, 350}, {0x5DDB, 42}, {0x5DDD, 42}, {0x5DDE, 383}, {0x5DE1, 348},
+    {0x5DE2, 33}, {0x5DE5, 96}, {0x5DE6, 399}, {0x5DE7, 248}, {0x5DE8, 135}, {0x5DE9, 96},
+    {0x5DEB, 334}, {0x5DEE, 29}, {0x5DEF, 253}, {0x5DF1, 125}, {0x5DF2, 354}, {0x5DF3, 299},
+    {0x5DF4, 5}, {0x5DF7, 338}, {0x5DFD, 348}, {0x5DFE, 131}, {0x5E01, 13}, {0x5E02, 289},
+    {0x5E03, 20}, {0x5E05, 293}, {0x5E06, 80}, {0x5E08, 289}, {0x5E0C, 335}, {0x5E0F, 330},
+    {0x5E10, 376}, {0x5E11, 310}, {0x5E14, 232}, {0x5E15, 227}, {0x5E16, 317}, {0x5E18, 168},
+    {0x5E19, 381}, {0x5E1A, 383}, {0x5E1B, 19}, {0x5E1C, 381}, {0x5E1D, 62}, {0x5E1F, 354},
+    {0x5E25, 293}, {0x5E26, 56}, {0x5E27, 380}, {0x5E2B, 289}, {0x5E2D, 335}, {0x5E2E, 8},
+    {0x5E31, 39}, {0x5E33, 376}, {0x5E36, 56}, {0x5E37, 330}, {0x5E38, 32}, {0x5E3B, 369},
+    {0x5E3C, 105}, {0x5E3D, 186}, {0x5E40, 380}, {0x5E42, 191}, {0x5E43, 330}, {0x5E44, 333},
+    {0x5E45, 86}, {0x5E4C, 121}, {0x5E54, 184}, {0x5E55, 200}, {0x5E57, 105}, {0x5E5B, 376},
+    {0x5E5E, 86}, {0x5E5F, 381}, {0x5E61, 80}, {0x5E62, 43}, {0x5E63, 13}, {0x5E6B, 8},
+    {0x5E72, 89}, {0x5E73, 240}, {0x5E74, 212}, {0x5E76, 18}, {0x5E78, 342}, {0x5E79, 89},
+    {0x5E7A, 352}, {0x5E7B, 120}, {0x5E7C, 359}, {0x5E7D, 359}, {0x5E7E, 125}, {0x5E7F, 102},
+    {0x5E80, 235}, {0x5E84, 388}, {0x5E86, 251}, {0x5E87, 13}, {0x5E8A, 43}, {0x5E8B, 103},
+    {0x5E8F, 345}, {0x5E90, 177}, {0x5E91, 334}, {0x5E93, 150}, {0x5E94, 356}, {0x5E95, 62},
+    {0x5E96, 231}, {0x5E97, 63}, {0x5E99, 193}, {0x5E9A, 95}, {0x5E9C, 86}, {0x5E9E, 230},
+    {0x5E9F, 82}, {0x5EA0, 338}, {0x5EA5, 344}, {0x5EA6, 70}, {0x5EA7, 399}, {0x5EAB, 150},
+    {0x5EAD, 318}, {0x5EB3, 13}, {0x5EB5, 2}, {0x5EB6, 291}, {0x5EB7, 142}, {0x5EB8, 358},
+    {0x5EB9, 325}, {0x5EBE, 360}, {0x5EC1, 26}, {0x5EC2, 338}, {0x5EC4, 134}, {0x5EC8, 280},
+    {0x5EC9, 168}, {0x5ECA, 161}, {0x5ED1, 131}, {0x5ED2, 4}, {0x5ED3, 157}, {0x5ED6, 170},
+    {0x5EDA, 40}, {0x5EDB, 31}, {0x5EDD, 299}, {0x5EDF, 193}, {0x5EE0, 32}, {0x5EE2, 82},
+    {0x5EE3, 102}, {0x5EE8, 340}, {0x5EEA, 172}, {0x5EEC, 177}, {0x5EF3, 318}, {0x5EF4, 355},
+    {0x5EF6, 350}, {0x5EF7, 318}, {0x5EFA, 127}, {0x5EFE, 96}, {0x5EFF, 212}, {0x5F00, 140},
+    {0x5F01, 14}, {0x5F02, 354}, {0x5F03, 244}, {0x5F04, 219}, {0x5F08, 354}, {0x5F0A, 13},
+    {0x5F0B, 354}, {0x5F0F, 289}, {0x5F11, 289}, {0x5F12, 289}, {0x5F13, 96}, {0x5F14, 64},
+    {0x5F15, 355}, {0x5F17, 86}, {0x5F18, 115}, {0x5F1B, 37}, {0x5F1F, 62}, {0x5F20, 376},
+    {0x5F25, 191}, {0x5F26, 337}, {0x5F27, 117}, {0x5F29, 221}, {0x5F2A, 132}, {0x5F2D, 191},
+    {0x5F2F, 328}, {0x5F31, 271}, {0x5F35, 376}, {0x5F37, 247}, {0x5F39, 57}, {0x5F3A, 247},
+    {0x5F3C, 13}, {0x5F40, 97}, {0x5F46, 16}, {0x5F48, 57}, {0x5F4A, 128}, {0x5F4C, 191},
+    {0x5F4E, 328}, {0x5F50, 125}, {0x5F52, 103}, {0x5F53, 58}, {0x5F55, 177}, {0x5F56, 322},
+    {0x5F57, 122}, {0x5F58, 381}, {0x5F59, 122}, {0x5F5D, 354}, {0x5F61, 282}, {0x5F62, 342},
+    {0x5F64, 319}, {0x5F65, 350}, {0x5F66, 350}, {0x5F69, 22}, {0x5F6A, 15}, {0x5F6B, 64},
+    {0x5F6C, 17}, {0x5F6D, 234}, {0x5F70, 376}, {0x5F71, 356}, {0x5F73, 37}, {0x5F77, 81},
+    {0x5F79, 354}, {0x5F7B, 34}, {0x5F7C, 13}, {0x5F7F, 86}, {0x5F80, 329}, {0x5F81, 380},
+    {0x5F82, 50}, {0x5F84, 132}, {0x5F85, 56}, {0x5F87, 348}, {0x5F88, 113}, {0x5F89, 351},
+    {0x5F8A, 119}, {0x5F8B, 177}, {0x5F8C, 116}, {0x5F90, 345}, {0x5F91, 132}, {0x5F92, 321},
+    {0x5F95, 159}, {0x5F97, 60}, {0x5F98, 228}, {0x5F99, 335}, {0x5F9C, 32}, {0x5F9E, 48},
+    {0x5FA0, 159}, {0x5FA1, 360}, {0x5FA8, 121}, {0x5FA9, 86}, {0x5FAA, 348}, {0x5FAC, 230},
+    {0x5FAD, 352}, {0x5FAE, 330}, {0x5FB5, 381}, {0x5FB7, 60}, {0x5FB9, 34}, {0x5FBC, 129},
+    {0x5FBD, 122}, {0x5FC3, 341}, {0x5FC4, 341}, {0x5FC5, 13}, {0x5FC6, 354}, {0x5FC9, 59},
+    {0x5FCC, 125}, {0x5FCD, 262}, {0x5FCF, 31}, {0x5FD0, 309}, {0x5FD1, 312}, {0x5FD2, 312},
+    {0x5FD6, 53}, {0x5FD7, 381}, {0x5FD8, 329}, {0x5FD9, 185}, {0x5FDD, 315}, {0x5FE0, 382},
+    {0x5FE1, 38}, {0x5FE4, 334}, {0x5FE7, 359}, {0x5FEA, 300}, {0x5FEB, 152}, {0x5FED, 14},
+    {0x5FEE, 381}, {0x5FF1, 35}, {0x5FF5, 212}, {0x5FF8, 218}, {0x5FFB, 341}, {0x5FFD, 117},
+    {0x5FFE, 140}, {0x5FFF, 83}, {0x6000, 119}, {0x6001, 308}, {0x6002, 300}, {0x6003, 334},
+    {0x6004, 226}, {0x6005, 32}, {0x6006, 43}, {0x600A, 33}, {0x600D, 399}, {0x600E, 371},
+    {0x600F, 351}, {0x6012, 221}, {0x6014, 380}, {0x6015, 227}, {0x6016, 20}, {0x6019, 117},
+    {0x601B, 55}, {0x601C, 168}, {0x601D, 299}, {0x6020, 56}, {0x6021, 354}, {0x6025, 125},
+    {0x6026, 234}, {0x6027, 342}, {0x6028, 361}, {0x6029, 211}, {0x602A, 100}, {0x602B, 86},
+    {0x602F, 249}, {0x6035, 40}, {0x603B, 393}, {0x603C, 72}, {0x603F, 354}, {0x6041, 209},
+    {0x6042, 348}, {0x6043, 289}, {0x6046, 114}, {0x604B, 168}, {0x604D, 121}, {0x6050, 148},
+    {0x6052, 114}, {0x6055, 291}, {0x6059, 351}, {0x605A, 122}, {0x605D, 126}, {0x6062, 122},
+    {0x6063, 392}, {0x6064, 345}, {0x6065, 37}, {0x6067, 221}, {0x6068, 113}, {0x6069, 77},
+    {0x606A, 144}, {0x606B, 68}, {0x606C, 315}, {0x606D, 96}, {0x606F, 335}, {0x6070, 245},
+    {0x6073, 146}, {0x6076, 75}, {0x6078, 319}, {0x6079, 350}, {0x607A, 140}, {0x607B, 26},
+    {0x607C, 206}, {0x607D, 363}, {0x607F, 358}, {0x6083, 156}, {0x6084, 248}, {0x6085, 362},
+    {0x6089, 335}, {0x608C, 314}, {0x608D, 108}, {0x6092, 354}, {0x6094, 122}, {0x6096, 10},
+    {0x609A, 300}, {0x609B, 255}, {0x609D, 155}, {0x609F, 334}, {0x60A0, 359}, {0x60A3, 120},
+    {0x60A6, 362}, {0x60A8, 216}, {0x60AB, 256}, {0x60AC, 346}, {0x60AD, 246}, {0x60AF, 195},
+    {0x60B1, 82}, {0x60B2, 10}, {0x60B4, 52}, {0x60B5, 32}, {0x60B6, 189}, {0x60B8, 125},
+    {0x60BB, 342}, {0x60BC, 59}, {0x60BD, 244}, {0x60C5, 251}, {0x60C6, 39}, {0x60C7, 73},
+    {0x60CA, 132}, {0x60CB, 328}, {0x60D1, 124}, {0x60D5, 314}, {0x60D8, 329}, {0x60DA, 117},
+    {0x60DC, 335}, {0x60DD, 32}, {0x60DF, 330}, {0x60E0, 122}, {0x60E1, 75}, {0x60E6, 63},
+    {0x60E7, 135}, {0x60E8, 23}, {0x60E9, 36}, {0x60EB, 10}, {0x60EC, 249}, {0x60ED, 23},
+    {0x60EE, 57}, {0x60EF, 101}, {0x60F0, 74}, {0x60F1, 206}, {0x60F3, 338}, {0x60F4, 389},
+    {0x60F6, 121}, {0x60F9, 261}, {0x60FA, 342}, {0x60FB, 26}, {0x6100, 248}, {0x6101, 39},
+    {0x6106, 246}, {0x6108, 360}, {0x6109, 360}, {0x610D, 195}, {0x610E, 13}, {0x610F, 354},
+    {0x6112, 140}, {0x6115, 75}, {0x611A, 360}, {0x611B, 1}, {0x611C, 249}, {0x611F, 89},
+    {0x6120, 363}, {0x6123, 165}, {0x6124, 83}, {0x6126, 155}, {0x6127, 155}, {0x612B, 302},
+    {0x6134, 43}, {0x6137, 140}, {0x613E, 140}, {0x613F, 361}, {0x6144, 166}, {0x6147, 355},
+    {0x6148, 47}, {0x614A, 246}, {0x614B, 308}, {0x614C, 121}, {0x614D, 363}, {0x614E, 287},
+    {0x6151, 285}, {0x6155, 200}, {0x6158, 23}, {0x615A, 23}, {0x615D, 312}, {0x615F, 319},
+    {0x6162, 184}, {0x6163, 101}, {0x6167, 122}, {0x6168, 140}, {0x616B, 300}, {0x616E, 177},
+    {0x6170, 330}, {0x6175, 358}, {0x6176, 251}, {0x6177, 142}, {0x617C, 244}, {0x617E, 360},
+    {0x6182, 359}, {0x618A, 10}, {0x618B, 16}, {0x618E, 372}, {0x6190, 168}, {0x6191, 240},
+    {0x6194, 248}, {0x619A, 57}, {0x619D, 72}, {0x61A4, 83}, {0x61A7, 38}, {0x61A8, 108},
+    {0x61A9, 244}, {0x61AB, 195}, {0x61AC, 132}, {0x61AE, 334}, {0x61B2, 337}, {0x61B6, 354},
+    {0x61B7, 40}, {0x61BE, 108}, {0x61C2, 68}, {0x61C7, 146}, {0x61C8, 340}, {0x61C9, 356},
+    {0x61CA, 4}, {0x61CB, 186}, {0x61CD, 172}, {0x61D1, 189}, {0x61D2, 160}, {0x61D4, 172},
+    {0x61E3, 189}, {0x61E6, 224}, {0x61F2, 36}, {0x61F5, 190}, {0x61F6, 160}, {0x61F7, 119},
+    {0x61F8, 346}, {0x61FA, 31}, {0x61FC, 135}, {0x61FE, 285}, {0x61FF, 354}, {0x6200, 168},
+    {0x6206, 90}, {0x6208, 92}, {0x620A, 334}, {0x620B, 127}, {0x620C, 345}, {0x620D, 291},
+    {0x620E, 265}, {0x620F, 335}, {0x6210, 36}, {0x6211, 333}, {0x6212, 130}, {0x6215, 247},
+    {0x6216, 124}, {0x6217, 247}, {0x6218, 375}, {0x621A, 244}, {0x621B, 126}, {0x621F, 125},
+    {0x6221, 141}, {0x6222, 125}, {0x6224, 88}, {0x6225, 61}, {0x622A, 130}, {0x622C, 127},
+    {0x622E, 177}, {0x6230, 375}, {0x6232, 335}, {0x6233, 46}, {0x6234, 56}, {0x6236, 117},
+    {0x6237, 117}, {0x623D, 117}, {0x623E, 166}, {0x623F, 81}, {0x6240, 306}, {0x6241, 14},
+    {0x6243, 133}, {0x6247, 282}, {0x6248, 117}, {0x6249, 82}, {0x624B, 290}, {0x624C, 290},
+    {0x624D, 22}, {0x624E, 373}, {0x6251, 243}, {0x6252, 5}, {0x6253, 55}, {0x6254, 263},
+    {0x6258, 325}, {0x625B, 142}, {0x6263, 149}, {0x6266, 246}, {0x6267, 381}, {0x6269, 157},
+    {0x626A, 189}, {0x626B, 276}, {0x626C, 351}, {0x626D, 218}, {0x626E, 7}, {0x626F, 34},
+    {0x6270, 260}, {0x6273, 7}, {0x6276, 86}, {0x6279, 235}, {0x627C, 75}, {0x627E, 377},
+    {0x627F, 36}, {0x6280, 125}, {0x6284, 33}, {0x6286, 331}, {0x6289, 137}, {0x628A, 5},
+    {0x6291, 354}, {0x6292, 291}, {0x6293, 385}, {0x6295, 320}, {0x6296, 69}, {0x6297, 142},
+    {0x6298, 378}, {0x629A, 86}, {0x629B, 231}, {0x629F, 322}, {0x62A0, 149}, {0x62A1, 180},
+    {0x62A2, 247}, {0x62A4, 117}, {0x62A5, 9}, {0x62A8, 234}, {0x62AB, 235}, {0x62AC, 308},
+    {0x62B1, 9}, {0x62B5, 62}, {0x62B9, 198}, {0x62BB, 35}, {0x62BC, 349}, {0x62BD, 39},
+    {0x62BF, 195}, {0x62C2, 86}, {0x62C4, 384}, {0x62C5, 57}, {0x62C6, 30}, {0x62C7, 200},
+    {0x62C8, 212}, {0x62C9, 158}, {0x62CA, 86}, {0x62CB, 231}, {0x62CC, 7}, {0x62CD, 228},
+    {0x62CE, 172}, {0x62D0, 100}, {0x62D2, 135}, {0x62D3, 307}, {0x62D4, 5}, {0x62D6, 325},
+    {0x62D7, 4}, {0x62D8, 135}, {0x62D9, 391}, {0x62DA, 229}, {0x62DB, 377}, {0x62DC, 6},
+    {0x62DF, 211}, {0x62E2, 175}, {0x62E3, 127}, {0x62E5, 358}, {0x62E6, 160}, {0x62E7, 217},
+    {0x62E8, 19}, {0x62E9, 369}, {0x62EC, 157}, {0x62ED, 289}, {0x62EE, 130}, {0x62EF, 380},
+    {0x62F1, 96}, {0x62F3, 255}, {0x62F4, 294}, {0x62F6, 364}, {0x62F7, 143}, {0x62FC, 239},
+    {0x62FD, 386}, {0x62FE, 289}, {0x62FF, 202}, {0x6301, 37}, {0x6302, 99}, {0x6307, 381},
+    {0x6308, 249}, {0x6309, 2}, {0x630E, 151}, {0x6311, 316}, {0x6316, 326}, {0x631A, 381},
+    {0x631B, 178}, {0x631D, 333}, {0x631E, 307}, {0x631F, 340}, {0x6320, 206}, {0x6321, 58},
+    {0x6322, 129}, {0x6323, 380}, {0x6324, 125}, {0x6325, 122}, {0x6328, 1}, {0x632A, 224},
+    {0x632B, 54}, {0x632F, 379}, {0x6332, 272}, {0x6339, 354}, {0x633A, 318}, {0x633D, 328},
+    {0x633E, 340}, {0x6342, 334}, {0x6343, 138}, {0x6345, 319}, {0x6346, 156}, {0x6349, 391},
+    {0x634B, 177}, {0x634C, 5}, {0x634D, 108}, {0x634E, 284}, {0x634F, 215}, {0x6350, 136},
+    {0x6355, 20}, {0x635E, 162}, {0x635F, 305}, {0x6361, 127}, {0x6362, 120}, {0x6363, 59},
+    {0x6367, 234}, {0x6368, 285}, {0x6369, 171}, {0x636B, 189}, {0x636D, 6}, {0x636E, 135},
+    {0x6371, 1}, {0x6372, 136}, {0x6376, 44}, {0x6377, 130}, {0x637A, 202}, {0x637B, 212},
+    {0x6380, 337}, {0x6382, 63}, {0x6383, 276}, {0x6384, 180}, {0x6387, 74}, {0x6388, 290},
+    {0x6389, 64}, {0x638A, 242}, {0x638C, 376}, {0x638E, 125}, {0x638F, 311}, {0x6390, 245},
+    {0x6392, 228}, {0x6396, 353}, {0x6398, 137}, {0x6399, 380}, {0x639B, 99}, {0x63A0, 179},
+    {0x63A1, 22}, {0x63A2, 309}, {0x63A3, 34}, {0x63A5, 130}, {0x63A7, 148}, {0x63A8, 323},
+    {0x63A9, 350}, {0x63AA, 54}, {0x63AC, 135}, {0x63AD, 315}, {0x63AE, 246}, {0x63B0, 6},
+    {0x63B3, 177}, {0x63B4, 100}, {0x63B7, 381}, {0x63B8, 57}, {0x63BA, 23}, {0x63BC, 101},
+    {0x63BE, 361}, {0x63C0, 127}, {0x63C4, 360}, {0x63C6, 155}, {0x63C9, 266}, {0x63CD, 394},
+    {0x63CE, 346}, {0x63CF, 193}, {0x63D0, 314}, {0x63D2, 29}, {0x63D6, 354}, {0x63DA, 351},
+    {0x63DB, 120}, {0x63DE, 2}, {0x63E0, 349}, {0x63E1, 333}, {0x63E3, 41}, {0x63E9, 140},
+    {0x63EA, 134}, {0x63ED, 130}, {0x63EE, 122}, {0x63F2, 65}, {0x63F4, 361}, {0x63F6, 353},
+    {0x63F8, 373}, {0x63F9, 10}, {0x63FD, 160}, {0x63FF, 250}, {0x6400, 31}, {0x6401, 92},
+    {0x6402, 176}, {0x6405, 129}, {0x6406, 97}, {0x640B, 41}, {0x640C, 375}, {0x640D, 305},
+    {0x640F, 19}, {0x6410, 40}, {0x6413, 54}, {0x6414, 276}, {0x6416, 352}, {0x6417, 59},
+    {0x641B, 127}, {0x641C, 301}, {0x641E, 91}, {0x6420, 298}, {0x6421, 275}, {0x6426, 224},
+    {0x642A, 310}, {0x642C, 7}, {0x642D, 55}, {0x6434, 246}, {0x6436, 247}, {0x643A, 340},
+    {0x643D, 29}, {0x643E, 373}, {0x643F, 92}, {0x6441, 77}, {0x6444, 285}, {0x6445, 291},
+    {0x6446, 6}, {0x6447, 352}, {0x6448, 17}, {0x644A, 309}, {0x6451, 100}, {0x6452, 18},
+    {0x6454, 293}, {0x6458, 374}, {0x645E, 181}, {0x645F, 176}, {0x6467, 52}, {0x6469, 198},
+    {0x646D, 381}, {0x646F, 381}, {0x6478, 198}, {0x6479, 198}, {0x647A, 378}, {0x647B, 23},
+    {0x6482, 170}, {0x6484, 356}, {0x6485, 137}, {0x6487, 238}, {0x6488, 162}, {0x6490, 36},
+    {0x6491, 36}, {0x6492, 272}, {0x6493, 206}, {0x6495, 299}, {0x6496, 108}, {0x6499, 398},
+    {0x649A, 212}, {0x649E, 388}, {0x64A2, 57}, {0x64A4, 34}, {0x64A5, 19}, {0x64A9, 170},
+    {0x64AB, 86}, {0x64AC, 248}, {0x64AD, 19}, {0x64AE, 54}, {0x64B0, 387}, {0x64B2, 243},
+    {0x64B3, 250}, {0x64B5, 212}, {0x64B7, 340}, {0x64B8, 177}, {0x64BA, 51}, {0x64BB, 307},
+    {0x64BC, 108}, {0x64BE, 333}, {0x64BF, 127}, {0x64C0, 89}, {0x64C1, 358}, {0x64C2, 164},
+    {0x64C4, 177}, {0x64C5, 282}, {0x64C7, 369}, {0x64CA, 125}, {0x64CB, 58}, {0x64CD, 25},
+    {0x64CE, 251}, {0x64D0, 120}, {0x64D2, 250}, {0x64D4, 57}, {0x64D7, 235}, {0x64D8, 6},
+    {0x64DA, 135}, {0x64DE, 301}, {0x64E0, 125}, {0x64E2, 391}, {0x64E4, 342}, {0x64E6, 21},
+    {0x64EC, 211}, {0x64ED, 333}, {0x64F0, 217}, {0x64F1, 92}, {0x64F2, 381}, {0x64F4, 157},
+    {0x64F7, 340}, {0x64FA, 6}, {0x64FB, 301}, {0x64FE, 260}, {0x6500, 229}, {0x6506, 212},
+    {0x6509, 124}, {0x650F, 175}, {0x6512, 366}, {0x6514, 160}, {0x6518, 259}, {0x6519, 31},
+    {0x651C, 340}, {0x651D, 285}, {0x6523, 178}, {0x6524, 309}, {0x6525, 396}, {0x652A, 129},
+    {0x652B, 137}, {0x652C, 160}, {0x652E, 205}, {0x652F, 381}, {0x6534, 243}, {0x6535, 243},
+    {0x6536, 290}, {0x6538, 359}, {0x6539, 88}, {0x653B, 96}, {0x653E, 81}, {0x653F, 380},
+    {0x6545, 98}, {0x6548, 339}, {0x6549, 191}, {0x654C, 62}, {0x654F, 195}, {0x6551, 134},
+    {0x6554, 360}, {0x6555, 37}, {0x6556, 4}, {0x6557, 6}, {0x6558, 345}, {0x6559, 129},
+    {0x655B, 168}, {0x655D, 13}, {0x655E, 32}, {0x6562, 89}, {0x6563, 274}, {0x6566, 73},
+    {0x656B, 129}, {0x656C, 132}, {0x6570, 291}, {0x6572, 248}, {0x6574, 380}, {0x6575, 62},
+    {0x6577, 86}, {0x6578, 291}, {0x6582, 168}, {0x6583, 13}, {0x6587, 331}, {0x658B, 374},
+    {0x658C, 17}, {0x6590, 82}, {0x6591, 7}, {0x6593, 160}, {0x6595, 160}, {0x6597, 69},
+    {0x6599, 170}, {0x659B, 117}, {0x659C, 340}, {0x659F, 379}, {0x65A1, 333}, {0x65A4, 131},
+    {0x65A5, 37}, {0x65A7, 86}, {0x65A9, 375}, {0x65AB, 391}, {0x65AC, 375}, {0x65AD, 71},
+    {0x65AF, 299}, {0x65B0, 341}, {0x65B7, 71}, {0x65B9, 81}, {0x65BC, 360}, {0x65BD, 289},
+    {0x65C1, 230}, {0x65C3, 375}, {0x65C4, 186}, {0x65C5, 177}, {0x65C6, 232}, {0x65CB, 346},
+    {0x65CC, 132}, {0x65CE, 211}, {0x65CF, 395}, {0x65D2, 174}, {0x65D6, 354}, {0x65D7, 244},
+    {0x65E0, 334}, {0x65E2, 125}, {0x65E5, 264}, {0x65E6, 57}, {0x65E7, 134}, {0x65E8, 381},
+    {0x65E9, 368}, {0x65EC, 348}, {0x65ED, 345}, {0x65EE, 87}, {0x65EF, 158}, {0x65F0, 89},
+    {0x65F1, 108}, {0x65F6, 289}, {0x65F7, 154}, {0x65FA, 329}, {0x6600, 363}, {0x6602, 3},
+    {0x6603, 369}, {0x6606, 156}, {0x6607, 288}, {0x660A, 110}, {0x660C, 32}, {0x660E, 196},
+    {0x660F, 123}, {0x6613, 354}, {0x6614, 335}, {0x6615, 341}, {0x6619, 309}, {0x661D, 366},
+    {0x661F, 342}, {0x6620, 356}, {0x6624, 173}, {0x6625, 45}, {0x6627, 188}, {0x6628, 399},
+    {0x662D, 377}, {0x662F, 289}, {0x6631, 360}, {0x6634, 186}, {0x6635, 211}, {0x6636, 32},
+    {0x663C, 383}, {0x663E, 337}, {0x6641, 33}, {0x6642, 289}, {0x6643, 121}, {0x6645, 346},
+    {0x6649, 131}, {0x664B, 131}, {0x664C, 283}, {0x664F, 350}, {0x6652, 281}, {0x6653, 339},
+    {0x6654, 353}, {0x6655, 363}, {0x6656, 122}, {0x6657, 108}, {0x665A, 328}, {0x665D, 383},
+    {0x665E, 335}, {0x665F, 36}, {0x6661, 20}, {0x6664, 334}, {0x6666, 122}, {0x6668, 35},
+    {0x666E, 243}, {0x666F, 132}, {0x6670, 335}, {0x6674, 251}, {0x6676, 132}, {0x6677, 103},
+    {0x667A, 381}, {0x667E, 169}, {0x6682, 366}, {0x6684, 346}, {0x6687, 336}, {0x6688, 363},
+    {0x6689, 122}, {0x668C, 155}, {0x668D, 353}, {0x6691, 291}, {0x6696, 222}, {0x6697, 2},
+    {0x6698, 351}, {0x669D, 196}, {0x66A2, 32}, {0x66A7, 1}, {0x66A8, 125}, {0x66AB, 366},
+    {0x66AE, 200}, {0x66B1, 211}, {0x66B4, 9}, {0x66B8, 170}, {0x66B9, 337}, {0x66BE, 324},
+    {0x66C4, 353}, {0x66C6, 166}, {0x66C7, 309}, {0x66C9, 339}, {0x66D6, 1}, {0x66D9, 291},
+    {0x66DB, 348}, {0x66DC, 352}, {0x66DD, 243}, {0x66E0, 154}, {0x66E6, 335}, {0x66E9, 205},
+    {0x66EC, 281}, {0x66F0, 362}, {0x66F2, 254}, {0x66F3, 353}, {0x66F4, 95}, {0x66F7, 111},
+    {0x66F8, 291}, {0x66F9, 25}, {0x66FC, 184}, {0x66FE, 28}, {0x66FF, 314}, {0x6700, 397},
+    {0x6703, 122}, {0x6708, 362}, {0x6709, 359}, {0x670A, 268}, {0x670B, 234}, {0x670D, 86},
+    {0x6710, 254}, {0x6714, 298}, {0x6715, 379}, {0x6717, 161}, {0x671B, 329}, {0x671D, 33},
+    {0x671F, 244}, {0x6726, 190}, {0x6727, 175}, {0x6728, 200}, {0x672A, 330}, {0x672B, 198},
+    {0x672C, 11}, {0x672D, 373}, {0x672E, 291}, {0x672F, 291}, {0x6731, 384}, {0x6734, 243},
+    {0x6735, 74}, {0x673A, 125}, {0x673D, 344}, {0x6740, 280}, {0x6742, 364}, {0x6743, 255},
+    {0x6746, 89}, {0x6748, 29}, {0x6749, 282}, {0x674C, 334}, {0x674E, 166}, {0x674F, 342},
+    {0x6750, 22}, {0x6751, 53}, {0x6753, 15}, {0x6756, 376}, {0x6757, 185}, {0x675C, 70},
+    {0x675E, 244}, {0x675F, 291}, {0x6760, 90}, {0x6761, 316}, {0x6765, 159}, {0x6768, 351},
+    {0x6769, 182}, {0x676A, 193}, {0x676D, 109}, {0x676F, 10}, {0x6770, 130}, {0x6771, 68},
+    {0x6772, 91}, {0x6773, 352}, {0x6775, 40}, {0x6777, 227}, {0x677C, 384}, {0x677E, 300},
+    {0x677F, 7}, {0x6781, 125}, {0x6784, 97}, {0x6787, 235}, {0x6789, 329}, {0x678B, 81},
+    {0x6790, 335}, {0x6793, 69}, {0x6795, 379}, {0x6797, 172}, {0x6798, 269}, {0x679A, 188},
+    {0x679C, 105}, {0x679D, 381}, {0x679E, 48}, {0x67A2, 291}, {0x67A3, 368}, {0x67A5, 166},
+    {0x67A7, 127}, {0x67A8, 36}, {0x67AA, 247}, {0x67AB, 84}, {0x67AD, 339}, {0x67AF, 150},
+    {0x67B0, 240}, {0x67B3, 381}, {0x67B4, 100}, {0x67B5, 339}, {0x67B6, 126}, {0x67B7, 126},
+    {0x67B8, 97}, {0x67C1, 74}, {0x67C3, 173}, {0x67C4, 18}, {0x67CF, 6}, {0x67D0, 199},
+    {0x67D1, 89}, {0x67D2, 244}, {0x67D3, 258}, {0x67D4, 266}, {0x67D8, 378}, {0x67D9, 336},
+    {0x67DA, 359}, {0x67DC, 103}, {0x67DD, 325}, {0x67DE, 373}, {0x67E0, 217}, {0x67E2, 62},
+    {0x67E5, 29}, {0x67E9, 134}, {0x67EC, 127}, {0x67EF, 144}, {0x67F0, 203}, {0x67F1, 384},
+    {0x67F3, 174}, {0x67F4, 30}, {0x67F5, 282}, {0x67FD, 36}, {0x67FF, 289}, {0x6800, 381},
+    {0x6805, 373}, {0x6807, 15}, {0x6808, 375}, {0x6809, 381}, {0x680A, 175}, {0x680B, 68},
+    {0x680C, 177}, {0x680E, 166}, {0x680F, 160}, {0x6811, 291}, {0x6813, 294}, {0x6816, 244},
+    {0x6817, 166}, {0x6818, 354}, {0x681D, 99}, {0x6821, 339}, {0x6829, 345}, {0x682A, 384},
+    {0x6832, 143}, {0x6833, 162}, {0x6837, 351}, {0x6838, 111}, {0x6839, 94}, {0x683C, 92},
+    {0x683D, 365}, {0x683E, 178}, {0x6840, 130}, {0x6841, 114}, {0x6842, 103}, {0x6843, 311},
+    {0x6844, 102}, {0x6845, 330}, {0x6846, 154}, {0x6848, 2}, {0x6849, 2}, {0x684A, 136},
+    {0x684C, 391}, {0x684E, 381}, {0x6850, 319}, {0x6851, 275}, {0x6853, 120}, {0x6854, 135},
+    {0x6855, 134}, {0x6860, 349}, {0x6861, 260}, {0x6862, 379}, {0x6863, 58}, {0x6864, 244},
+    {0x6865, 248}, {0x6866, 118}, {0x6867, 103}, {0x6868, 128}, {0x6869, 388}, {0x686B, 306},
+    {0x6874, 86}, {0x6876, 319}, {0x6877, 137}, {0x687F, 89}, {0x6881, 169}, {0x6882, 253},
+    {0x6883, 318}, {0x6885, 188}, {0x6886, 8}, {0x688F, 98}, {0x6893, 392}, {0x6894, 381},
+    {0x6897, 95}, {0x689D, 316}, {0x689F, 339}, {0x68A1, 123}, {0x68A2, 284}, {0x68A6, 190},
+    {0x68A7, 334}, {0x68A8, 166}, {0x68AD, 306}, {0x68AF, 314}, {0x68B0, 340}, {0x68B1, 156},
+    {0x68B3, 291}, {0x68B5, 80}, {0x68C0, 127}, {0x68C2, 173}, {0x68C4, 244}, {0x68C9, 192},
+    {0x68CB, 244}, {0x68CD, 104}, {0x68D2, 8}, {0x68D5, 393}, {0x68D7, 368}, {0x68D8, 125},
+    {0x68DA, 234}, {0x68DF, 68}, {0x68E0, 310}, {0x68E3, 62}, {0x68E7, 375}, {0x68EE, 278},
+    {0x68F0, 44}, {0x68F1, 165}, {0x68F2, 244}, {0x68F5, 144}, {0x68F9, 377}, {0x68FA, 101},
+    {0x68FB, 83}, {0x68FC, 83}, {0x6901, 105}, {0x6905, 354}, {0x690B, 169}, {0x690D, 381},
+    {0x690E, 44}, {0x6910, 135}, {0x6912, 129}, {0x691F, 70}, {0x6920, 246}, {0x6924, 181},
+    {0x692D, 325}, {0x6930, 353}, {0x6934, 71}, {0x6939, 287}, {0x693D, 42}, {0x693F, 45},
+    {0x6942, 373}, {0x694A, 351}, {0x6953, 84}, {0x6954, 340}, {0x6957, 127}, {0x695A, 40},
+    {0x695B, 117}, {0x695D, 168}, {0x695E, 165}, {0x6960, 204}, {0x6963, 188}, {0x6966, 346},
+    {0x6968, 379}, {0x696B, 125}, {0x696D, 353}, {0x696E, 40}, {0x6971, 394}, {0x6975, 125},
+    {0x6977, 140}, {0x6978, 253}, {0x6979, 356}, {0x697C, 176}, {0x6980, 239}, {0x6982, 88},
+    {0x6984, 160}, {0x6986, 360}, {0x6987, 35}, {0x6988, 177}, {0x6989, 135}, {0x698D, 340},
+    {0x6994, 161}, {0x6995, 265}, {0x6998, 135}, {0x699B, 379}, {0x699C, 8}, {0x69A3, 352},
+    {0x69A6, 89}, {0x69A7, 82}, {0x69A8, 373}, {0x69AB, 305}, {0x69AD, 340}, {0x69AE, 265},
+    {0x69B1, 52}, {0x69B4, 174}, {0x69B7, 256}, {0x69BB, 307}, {0x69C1, 91}, {0x69C3, 229},
+    {0x69CA, 298}, {0x69CB, 97}, {0x69CC, 44}, {0x69CD, 247}, {0x69CE, 29}, {0x69D0, 119},
+    {0x69D3, 90}, {0x69D4, 91}, {0x69DB, 141}, {0x69DF, 17}, {0x69E0, 384}, {0x69E8, 105},
+    {0x69ED, 244}, {0x69F2, 117}, {0x69F3, 128}, {0x69FD, 25}, {0x69FF, 131}, {0x6A01, 388},
+    {0x6A02, 163}, {0x6A05, 48}, {0x6A0A, 80}, {0x6A11, 169}, {0x6A13, 176}, {0x6A17, 40},
+    {0x6A18, 310}, {0x6A19, 15}, {0x6A1E, 291}, {0x6A1F, 376}, {0x6A21, 198}, {0x6A23, 351},
+    {0x6A28, 335}, {0x6A2A, 114}, {0x6A2F, 247}, {0x6A31, 356}, {0x6A35, 248}, {0x6A38, 243},
+    {0x6A39, 291}, {0x6A3A, 118}, {0x6A3D, 398}, {0x6A3E, 362}, {0x6A44, 89}, {0x6A47, 248},
+    {0x6A48, 260}, {0x6A4B, 248}, {0x6A50, 325}, {0x6A58, 135}, {0x6A59, 36}, {0x6A5B, 137},
+    {0x6A5F, 125}, {0x6A61, 338}, {0x6A62, 325}, {0x6A65, 384}, {0x6A6B, 114}, {0x6A71, 40},
+    {0x6A79, 177}, {0x6A7C, 361}, {0x6A7E, 291}, {0x6A80, 309}, {0x6A84, 335}, {0x6A8E, 250},
+    {0x6A90, 350}, {0x6A91, 164}, {0x6A94, 58}, {0x6A97, 19}, {0x6A9C, 103}, {0x6AA0, 251},
+    {0x6AA2, 127}, {0x6AA3, 247}, {0x6AA9, 172}, {0x6AAB, 29}, {0x6AAC, 190}, {0x6AAE, 311},
+    {0x6AAF, 308}, {0x6AB3, 17}, {0x6AB8, 217}, {0x6ABB, 141}, {0x6AC2, 377}, {0x6AC3, 103},
+    {0x6AD3, 177}, {0x6ADA, 177}, {0x6ADB, 381}, {0x6ADD, 70}, {0x6AE5, 40}, {0x6AEC, 35},
+    {0x6AFA, 173}, {0x6AFB, 356}, {0x6B04, 160}, {0x6B0A, 255}, {0x6B10, 166}, {0x6B16, 160},
+    {0x6B20, 246}, {0x6B21, 47}, {0x6B22, 120}, {0x6B23, 341}, {0x6B24, 360}, {0x6B27, 226},
+    {0x6B32, 360}, {0x6B37, 335}, {0x6B39, 354}, {0x6B3A, 244}, {0x6B3D, 250}, {0x6B3E, 153},
+    {0x6B43, 280}, {0x6B46, 341}, {0x6B47, 340}, {0x6B49, 246}, {0x6B4C, 92}, {0x6B4E, 309},
+    {0x6B50, 226}, {0x6B59, 285}, {0x6B5C, 40}, {0x6B5F, 360}, {0x6B61, 120}, {0x6B62, 381},
+    {0x6B63, 380}, {0x6B64, 47}, {0x6B65, 20}, {0x6B66, 334}, {0x6B67, 244}, {0x6B6A, 327},
+    {0x6B72, 304}, {0x6B77, 166}, {0x6B78, 103}, {0x6B79, 56}, {0x6B7B, 299}, {0x6B7C, 127},
+    {0x6B7F, 198}, {0x6B81, 198}, {0x6B82, 50}, {0x6B83, 351}, {0x6B84, 315}, {0x6B86, 56},
+    {0x6B87, 283}, {0x6B89, 348}, {0x6B8A, 291}, {0x6B8B, 23}, {0x6B8D, 237}, {0x6B92, 363},
+    {0x6B93, 168}, {0x6B96, 381}, {0x6B98, 23}, {0x6B9A, 57}, {0x6B9B, 125}, {0x6BA1, 17},
+    {0x6BA4, 283}, {0x6BAA, 354}, {0x6BAE, 168}, {0x6BAF, 17}, {0x6BB2, 127}, {0x6BB3, 291},
+    {0x6BB4, 226}, {0x6BB5, 71}, {0x6BB7, 355}, {0x6BBA, 280}, {0x6BBC, 144}, {0x6BBF, 63},
+    {0x6BC0, 122}, {0x6BC1, 122}, {0x6BC2, 98}, {0x6BC5, 354}, {0x6BC6, 226}, {0x6BCB, 334},
+    {0x6BCD, 200}, {0x6BCF, 188}, {0x6BD2, 70}, {0x6BD3, 360}, {0x6BD4, 13}, {0x6BD5, 13},
+    {0x6BD6, 13}, {0x6BD7, 235}, {0x6BD9, 13}, {0x6BDA, 31}, {0x6BDB, 186}, {0x6BE1, 375},
+    {0x6BEA, 200}, {0x6BEB, 110}, {0x6BEC, 253}, {0x6BEF, 309}, {0x6BF3, 52}, {0x6BF5, 274},
+    {0x6BF9, 291}, {0x6BFD, 127}, {0x6C05, 32}, {0x6C06, 243}, {0x6C07, 177}, {0x6C08, 375},
+    {0x6C0D, 254}, {0x6C0F, 289}, {0x6C10, 62}, {0x6C11, 195}, {0x6C13, 185}, {0x6C14, 244},
+    {0x6C15, 238}, {0x6C16, 203}, {0x6C18, 59}, {0x6C19, 337}, {0x6C1A, 42}, {0x6C1B, 83},
+    {0x6C1F, 86}, {0x6C21, 68}, {0x6C22, 251}, {0x6C23, 244}, {0x6C24, 355}, {0x6C26, 107},
+    {0x6C27, 351}, {0x6C28, 2}, {0x6C29, 349}, {0x6C2A, 144}, {0x6C2B, 251}, {0x6C2C, 349},
+    {0x6C2E, 57}, {0x6C2F, 177}, {0x6C30, 251}, {0x6C32, 363}, {0x6C33, 363}, {0x6C34, 296},
+    {0x6C35, 296}, {0x6C38, 358}, {0x6C3D, 324}, {0x6C3E, 80}, {0x6C40, 318}, {0x6C41, 381},
+    {0x6C42, 253}, {0x6C46, 51}, {0x6C47, 122}, {0x6C49, 108}, {0x6C4A, 29}, {0x6C4D, 328},
+    {0x6C4E, 80}, {0x6C50, 335}, {0x6C54, 244}, {0x6C55, 282}, {0x6C57, 108}, {0x6C59, 334},
+    {0x6C5B, 348}, {0x6C5C, 299}, {0x6C5D, 267}, {0x6C5E, 96}, {0x6C5F, 128}, {0x6C60, 37},
+    {0x6C61, 334}, {0x6C64, 310}, {0x6C68, 191}, {0x6C69, 98}, {0x6C6A, 329}, {0x6C70, 308},
+    {0x6C72, 125}, {0x6C74, 14}, {0x6C76, 331}, {0x6C79, 343}, {0x6C7A, 137}, {0x6C7D, 244},
+    {0x6C7E, 83}, {0x6C81, 250}, {0x6C82, 354}, {0x6C83, 333}, {0x6C85, 361}, {0x6C86, 109},
+    {0x6C88, 287}, {0x6C89, 35}, {0x6C8C, 73}, {0x6C8D, 117}, {0x6C8F, 244}, {0x6C90, 200},
+    {0x6C92, 188}, {0x6C93, 55}, {0x6C94, 192}, {0x6C96, 38}, {0x6C98, 13}, {0x6C99, 280},
+    {0x6C9B, 232}, {0x6C9F, 97}, {0x6CA1, 188}, {0x6CA3, 84}, {0x6CA4, 226}, {0x6CA5, 166},
+    {0x6CA6, 180}, {0x6CA7, 24}, {0x6CA9, 330}, {0x6CAA, 117}, {0x6CAB, 198}, {0x6CAC, 188},
+    {0x6CAD, 291}, {0x6CAE, 135}, {0x6CB1, 325}, {0x6CB2, 325}, {0x6CB3, 111}, {0x6CB8, 82},
+    {0x6CB9, 359}, {0x6CBB, 381}, {0x6CBC, 377}, {0x6CBD, 98}, {0x6CBE, 375}, {0x6CBF, 350},
+    {0x6CC1, 154}, {0x6CC4, 340}, {0x6CC5, 253}, {0x6CC9, 255}, {0x6CCA, 241}, {0x6CCC, 191},
+    {0x6CD0, 163}, {0x6CD3, 115}, {0x6CD4, 89}, {0x6CD5, 79}, {0x6CD6, 186}, {0x6CD7, 299},
+    {0x6CDB, 80}, {0x6CDC, 381}, {0x6CDE, 217}, {0x6CE0, 173}, {0x6CE1, 231}, {0x6CE2, 19},
+    {0x6CE3, 244}, {0x6CE5, 211}, {0x6CE8, 384}, {0x6CEA, 164}, {0x6CEB, 346}, {0x6CEE, 229},
+    {0x6CEF, 195}, {0x6CF0, 308}, {0x6CF1, 351}, {0x6CF3, 358}, {0x6CF5, 12}, {0x6CF6, 347},
+    {0x6CF7, 175}, {0x6CF8, 177}, {0x6CFA, 181}, {0x6CFB, 340}, {0x6CFC, 241}, {0x6CFD, 369},
+    {0x6CFE, 132}, {0x6D01, 130}, {0x6D04, 122}, {0x6D07, 355}, {0x6D0B, 351}, {0x6D0C, 171},
+    {0x6D0E, 125}, {0x6D12, 272}, {0x6D17, 335}, {0x6D19, 384}, {0x6D1A, 128}, {0x6D1B, 181},
+    {0x6D1E, 68}, {0x6D25, 131}, {0x6D27, 330}, {0x6D29, 340}, {0x6D2A, 115}, {0x6D2B, 345},
+    {0x6D2E, 311}, {0x6D31, 78}, {0x6D32, 383}, {0x6D33, 267}, {0x6D35, 348}, {0x6D36, 343},
+    {0x6D38, 102}, {0x6D39, 120}, {0x6D3B, 124}, {0x6D3C, 326}, {0x6D3D, 245}, {0x6D3E, 228},
+    {0x6D41, 174}, {0x6D43, 126}, {0x6D45, 246}, {0x6D46, 128}, {0x6D47, 129}, {0x6D48, 379},
+    {0x6D4A, 391}, {0x6D4B, 26}, {0x6D4D, 122}, {0x6D4E, 125}, {0x6D4F, 174}, {0x6D51, 123},
+    {0x6D52, 117}, {0x6D53, 219}, {0x6D54, 348}, {0x6D59, 378}, {0x6D5A, 138}, {0x6D5C, 8},
+    {0x6D5E, 391}, {0x6D60, 335}, {0x6D63, 120}, {0x6D65, 354}, {0x6D66, 243}, {0x6D69, 110},
+    {0x6D6A, 161}, {0x6D6C, 166}, {0x6D6E, 86}, {0x6D6F, 334}, {0x6D74, 360}, {0x6D77, 107},
+    {0x6D78, 131}, {0x6D79, 126}, {0x6D7C, 188}, {0x6D82, 321}, {0x6D85, 215}, {0x6D87, 132},
+    {0x6D88, 339}, {0x6D89, 285}, {0x6D8A, 212}, {0x6D8C, 358}, {0x6D8E, 337}, {0x6D91, 302},
+    {0x6D93, 136}, {0x6D94, 27}, {0x6D95, 314}, {0x6D9B, 311}, {0x6D9D, 162}, {0x6D9E, 159},
+    {0x6D9F, 168}, {0x6DA0, 330}, {0x6DA1, 333}, {0x6DA3, 120}, {0x6DA4, 62}, {0x6DA6, 270},
+    {0x6DA7, 127}, {0x6DA8, 376}, {0x6DA9, 277}, {0x6DAA, 86}, {0x6DAB, 101}, {0x6DAE, 294},
+    {0x6DAF, 349}, {0x6DB2, 353}, {0x6DB5, 108}, {0x6DB8, 111}, {0x6DBC, 169}, {0x6DBF, 391},
+    {0x6DC0, 63}, {0x6DC4, 392}, {0x6DC5, 335}, {0x6DC6, 339}, {0x6DC7, 244}, {0x6DCB, 172},
+    {0x6DCC, 310}, {0x6DD1, 291}, {0x6DD2, 244}, {0x6DD6, 206}, {0x6DD8, 311}, {0x6DD9, 48},
+    {0x6DDA, 164}, {0x6DDD, 82}, {0x6DDE, 300}, {0x6DE0, 235}, {0x6DE1, 57}, {0x6DE4, 360},
+    {0x6DE6, 89}, {0x6DE8, 132}, {0x6DEA, 180}, {0x6DEB, 355}, {0x6DEC, 52}, {0x6DEE, 119},
+    {0x6DF1, 287}, {0x6DF3, 45}, {0x6DF5, 361}, {0x6DF7, 123}, {0x6DF9, 350}, {0x6DFA, 246},
+    {0x6DFB, 315}, {0x6DFC, 193}, {0x6E05, 251}, {0x6E0A, 361}, {0x6E0C, 177}, {0x6E0D, 392},
+    {0x6E0E, 70}, {0x6E10, 127}, {0x6E11, 192}, {0x6E14, 360}, {0x6E16, 287}, {0x6E17, 287},
+    {0x6E19, 120}, {0x6E1A, 384}, {0x6E1B, 127}, {0x6E1D, 360}, {0x6E20, 254}, {0x6E21, 70},
+    {0x6E23, 373}, {0x6E24, 19}, {0x6E25, 333}, {0x6E26, 333}, {0x6E29, 331}, {0x6E2B, 340},
+    {0x6E2C, 26}, {0x6E2D, 330}, {0x6E2F, 90}, {0x6E32, 346}, {0x6E34, 144}, {0x6E38, 359},
+    {0x6E3A, 193}, {0x6E3E, 123}, {0x6E43, 228}, {0x6E44, 188}, {0x6E4A, 49}, {0x6E4D, 322},
+    {0x6E4E, 192}, {0x6E53, 233}, {0x6E54, 127}, {0x6E56, 117}, {0x6E58, 338}, {0x6E5B, 375},
+    {0x6E5F, 121}, {0x6E63, 195}, {0x6E67, 358}, {0x6E69, 68}, {0x6E6B, 129}, {0x6E6E, 350},
+    {0x6E6F, 310}, {0x6E72, 361}, {0x6E7E, 328}, {0x6E7F, 289}, {0x6E83, 155}, {0x6E85, 127},
+    {0x6E86, 345}, {0x6E89, 88}, {0x6E8F, 310}, {0x6E90, 361}, {0x6E96, 390}, {0x6E98, 144},
+    {0x6E9C, 174}, {0x6E9D, 97}, {0x6E9F, 196}, {0x6EA2, 354}, {0x6EA5, 243}, {0x6EA7, 166},
+    {0x6EAA, 335}, {0x6EAB, 331}, {0x6EAF, 302}, {0x6EB1, 250}, {0x6EB2, 301}, {0x6EB4, 344},
+    {0x6EB6, 265}, {0x6EB7, 123}, {0x6EBA, 211}, {0x6EBB, 307}, {0x6EBC, 289}, {0x6EBD, 267},
+    {0x6EC1, 40}, {0x6EC2, 230}, {0x6EC4, 24}, {0x6EC5, 194}, {0x6EC7, 63}, {0x6ECB, 392},
+    {0x6ECC, 62}, {0x6ECF, 86}, {0x6ED1, 118}, {0x6ED3, 392}, {0x6ED4, 311}, {0x6ED5, 313},
+    {0x6ED7, 13}, {0x6EDA, 104}, {0x6EDE, 381}, {0x6EDF, 350}, {0x6EE0, 285}, {0x6EE1, 184},
+    {0x6EE2, 356}, {0x6EE4, 177}, {0x6EE5, 160}, {0x6EE6, 178}, {0x6EE8, 17}, {0x6EE9, 309},
+    {0x6EEC, 117}, {0x6EEF, 381}, {0x6EF2, 287}, {0x6EF4, 62}, {0x6EF7, 177}, {0x6EF9, 117},
+    {0x6EFE, 104}, {0x6EFF, 184}, {0x6F01, 360}, {0x6F02, 237}, {0x6F06, 244}, {0x6F09, 177},
+    {0x6F0F, 176}, {0x6F13, 166}, {0x6F14, 350}, {0x6F15, 25}, {0x6F20, 198}, {0x6F22, 108},
+    {0x6F23, 168}, {0x6F24, 160}, {0x6F29, 346}, {0x6F2A, 354}, {0x6F2B, 184}, {0x6F2C, 392},
+    {0x6F2D, 185}, {0x6F2F, 181}, {0x6F31, 291}, {0x6F32, 376}, {0x6F33, 376}, {0x6F36, 120},
+    {0x6F38, 127}, {0x6F3E, 351}, {0x6F3F, 128}, {0x6F46, 356}, {0x6F47, 339}, {0x6F4B, 168},
+    {0x6F4D, 330}, {0x6F51, 241}, {0x6F54, 130}, {0x6F58, 229}, {0x6F5B, 246}, {0x6F5C, 246},
+    {0x6F5E, 177}, {0x6F5F, 335}, {0x6F60, 348}, {0x6F62, 121}, {0x6F64, 270}, {0x6F66, 162},
+    {0x6F6D, 309}, {0x6F6E, 33}, {0x6F6F, 348}, {0x6F70, 155}, {0x6F72, 284}, {0x6F74, 384},
+    {0x6F78, 282}, {0x6F7A, 31}, {0x6F7C, 319}, {0x6F80, 277}, {0x6F84, 36}, {0x6F86, 129},
+    {0x6F88, 34}, {0x6F89, 89}, {0x6F8C, 299}, {0x6F8D, 291}, {0x6F8E, 234}, {0x6F97, 127},
+    {0x6F9C, 160}, {0x6FA0, 192}, {0x6FA1, 368}, {0x6FA4, 369}, {0x6FA6, 360}, {0x6FA7, 166},
+    {0x6FB1, 63}, {0x6FB3, 4}, {0x6FB4, 120}, {0x6FB6, 31}, {0x6FB9, 57}, {0x6FC0, 125},
+    {0x6FC1, 391}, {0x6FC2, 168}, {0x6FC3, 219}, {0x6FC9, 304}, {0x6FD1, 159}, {0x6FD2, 17},
+    {0x6FD5, 289}, {0x6FD8, 217}, {0x6FDB, 190}, {0x6FDE, 13}, {0x6FDF, 125}, {0x6FE0, 110},
+    {0x6FE1, 267}, {0x6FE4, 311}, {0x6FE9, 124}, {0x6FEB, 160}, {0x6FEC, 138}, {0x6FEE, 243},
+    {0x6FEF, 391}, {0x6FF0, 330}, {0x6FF1, 17}, {0x6FFA, 127}, {0x6FFE, 177}, {0x7006, 70},
+    {0x7009, 340}, {0x700B, 287}, {0x700F, 174}, {0x7011, 243}, {0x7015, 17}, {0x7018, 177},
+    {0x701A, 108}, {0x701B, 356}, {0x701D, 166}, {0x701F, 339}, {0x7023, 340}, {0x7028, 159},
+    {0x7030, 191}, {0x7032, 168}, {0x7035, 83}, {0x7039, 362}, {0x703E, 160}, {0x704C, 101},
+    {0x704F, 110}, {0x7051, 272}, {0x7058, 309}, {0x705E, 5}, {0x7063, 328}, {0x7064, 178},
+    {0x706B, 124}, {0x706C, 15}, {0x706D, 194}, {0x706F, 61}, {0x7070, 122}, {0x7075, 173},
+    {0x7076, 368}, {0x7078, 134}, {0x707C, 391}, {0x707D, 365}, {0x707E, 365}, {0x707F, 23},
+    {0x7080, 351}, {0x7085, 133}, {0x7089, 177}, {0x708A, 44}, {0x708E, 350}, {0x7092, 33},
+    {0x7094, 103}, {0x7095, 142}, {0x7096, 73}, {0x7099, 381}, {0x709C, 330}, {0x709D, 247},
+    {0x70A4, 377}, {0x70AB, 346}, {0x70AC, 135}, {0x70AD, 309}, {0x70AE, 231}, {0x70AF, 133},
+    {0x70B1, 308}, {0x70B3, 18}, {0x70B7, 384}, {0x70B8, 373}, {0x70B9, 63}, {0x70BA, 330},
+    {0x70BB, 289}, {0x70BC, 168}, {0x70BD, 37}, {0x70C0, 117}, {0x70C1, 298}, {0x70C2, 160},
+    {0x70C3, 318}, {0x70C8, 171}, {0x70CA, 351}, {0x70CF, 334}, {0x70D8, 115}, {0x70D9, 162},
+    {0x70DB, 384}, {0x70DF, 350}, {0x70E4, 143}, {0x70E6, 80}, {0x70E7, 284}, {0x70E8, 353},
+    {0x70E9, 122}, {0x70EB, 310}, {0x70EC, 131}, {0x70ED, 261}, {0x70EF, 335}, {0x70F7, 328},
+    {0x70F9, 234}, {0x70FD, 84}, {0x7109, 350}, {0x710A, 108}, {0x7110, 334}, {0x7113, 108},
+    {0x7115, 120}, {0x7116, 189}, {0x7118, 59}, {0x7119, 10}, {0x711A, 83}, {0x711C, 156},
+    {0x7121, 334}, {0x7126, 129}, {0x712F, 33}, {0x7130, 350}, {0x7131, 350}, {0x7136, 258},
+    {0x7145, 71}, {0x7146, 336}, {0x7149, 168}, {0x714A, 346}, {0x714C, 121}, {0x714E, 127},
+    {0x7156, 222}, {0x7159, 350}, {0x715C, 360}, {0x715E, 280}, {0x7164, 188}, {0x7165, 120},
+    {0x7166, 345}, {0x7167, 377}, {0x7168, 330}, {0x7169, 80}, {0x716C, 351}, {0x716E, 384},
+    {0x7172, 9}, {0x7173, 117}, {0x7178, 14}, {0x717A, 323}, {0x717D, 282}, {0x7184, 335},
+    {0x718A, 343}, {0x718F, 348}, {0x7192, 356}, {0x7194, 265}, {0x7198, 174}, {0x7199, 335},
+    {0x719F, 291}, {0x71A0, 354}, {0x71A8, 363}, {0x71AC, 4}, {0x71B1, 261}, {0x71B3, 184},
+    {0x71B5, 283}, {0x71B9, 335}, {0x71BE, 37}, {0x71C3, 258}, {0x71C4, 350}, {0x71C8, 61},
+    {0x71C9, 73}, {0x71CE, 170}, {0x71D0, 172}, {0x71D2, 284}, {0x71D4, 80}, {0x71D5, 350},
+    {0x71D9, 310}, {0x71DC, 189}, {0x71DF, 356}, {0x71E0, 360}, {0x71E5, 368}, {0x71E6, 23},
+    {0x71E7, 304}, {0x71EC, 122}, {0x71ED, 384}, {0x71EE, 340}, {0x71F4, 122}, {0x71F8, 267},
+    {0x71F9, 337}, {0x71FB, 348}, {0x71FC, 131}, {0x71FE, 59}, {0x7206, 9}, {0x720D, 298},
+    {0x7210, 177}, {0x721B, 160}, {0x721D, 137}, {0x7228, 51}, {0x722A, 377}, {0x722C, 227},
+    {0x722D, 380}, {0x7230, 361}, {0x7231, 1}, {0x7235, 137}, {0x7236, 86}, {0x7237, 353},
+    {0x7238, 5}, {0x7239, 65}, {0x723A, 353}, {0x723B, 352}, {0x723D, 295}, {0x723E, 78},
+    {0x723F, 229}, {0x7246, 247}, {0x7247, 236}, {0x7248, 7}, {0x724C, 228}, {0x724D, 70},
+    {0x7252, 65}, {0x7256, 359}, {0x7258, 70}, {0x7259, 349}, {0x725B, 218}, {0x725D, 239},
+    {0x725F, 199}, {0x7260, 307}, {0x7261, 200}, {0x7262, 162}, {0x7266, 186}, {0x7267, 200},
+    {0x7269, 334}, {0x726E, 127}, {0x726F, 98}, {0x7272, 288}, {0x7274, 62}, {0x7275, 246},
+    {0x7279, 312}, {0x727A, 335}, {0x727D, 246}, {0x727E, 334}, {0x727F, 98}, {0x7280, 335},
+    {0x7281, 166}, {0x7284, 125}, {0x728A, 70}, {0x728B, 135}, {0x728D, 127}, {0x728F, 236},
+    {0x7292, 143}, {0x7296, 181}, {0x729B, 186}, {0x729F, 128}, {0x72A2, 70}, {0x72A7, 335},
+    {0x72AC, 255}, {0x72AD, 255}, {0x72AF, 80}, {0x72B0, 253}, {0x72B4, 2}, {0x72B6, 388},
+    {0x72B7, 102}, {0x72B8, 182}, {0x72B9, 359}, {0x72C0, 388}, {0x72C1, 363}, {0x72C2, 154},
+    {0x72C3, 218}, {0x72C4, 62}, {0x72C8, 10}, {0x72CD, 231}, {0x72CE, 336}, {0x72D0, 117},
+    {0x72D2, 82}, {0x72D7, 97}, {0x72D9, 135}, {0x72DE, 217}, {0x72E0, 113}, {0x72E1, 129},
+    {0x72E8, 265}, {0x72E9, 290}, {0x72EC, 70}, {0x72ED, 336}, {0x72EE, 289}, {0x72EF, 152},
+    {0x72F0, 380}, {0x72F1, 360}, {0x72F2, 305}, {0x72F3, 360}, {0x72F4, 13}, {0x72F7, 136},
+    {0x72F8, 166}, {0x72F9, 336}, {0x72FA, 355}, {0x72FB, 303}, {0x72FC, 161}, {0x72FD, 10},
+    {0x7301, 166}, {0x7303, 337}, {0x730A, 211}, {0x730E, 171}, {0x7313, 105}, {0x7315, 191},
+    {0x7316, 32}, {0x7317, 354}, {0x7319, 380}, {0x731B, 190}, {0x731C, 22}, {0x731D, 50},
+    {0x731E, 285}, {0x7321, 181}, {0x7322, 117}, {0x7325, 330}, {0x7329, 342}, {0x732A, 384},
+    {0x732B, 186}, {0x732C, 330}, {0x732E, 337}, {0x7331, 206}, {0x7334, 116}, {0x7336, 359},
+    {0x7337, 359}, {0x7338, 188}, {0x7339, 29}, {0x733E, 118}, {0x733F, 361}, {0x7344, 360},
+    {0x7345, 289}, {0x734D, 132}, {0x734E, 128}, {0x7350, 376}, {0x7352, 4}, {0x7357, 137},
+    {0x7360, 170}, {0x7368, 70}, {0x736C, 340}, {0x736D, 307}, {0x736F, 348}, {0x7370, 217},
+    {0x7372, 124}, {0x7375, 171}, {0x7377, 102}, {0x7378, 290}, {0x737A, 307}, {0x737B, 337},
+    {0x737E, 120}, {0x7380, 181}, {0x7384, 346}, {0x7386, 392}, {0x7387, 177}, {0x7389, 360},
+    {0x738B, 329}, {0x738E, 66}, {0x7391, 125}, {0x7396, 134}, {0x739B, 182}, {0x739F, 331},
+    {0x73A2, 17}, {0x73A5, 362}, {0x73A8, 137}, {0x73A9, 328}, {0x73AB, 188}, {0x73AE, 330},
+    {0x73AF, 120}, {0x73B0, 337}, {0x73B2, 173}, {0x73B3, 56}, {0x73B7, 63}, {0x73BA, 335},
+    {0x73BB, 19}, {0x73C0, 241}, {0x73C2, 144}, {0x73C8, 126}, {0x73C9, 195}, {0x73CA, 282},
+    {0x73CD, 379}, {0x73CF, 137}, {0x73D0, 79}, {0x73D1, 175}, {0x73D9, 96}, {0x73DE, 181},
+    {0x73E0, 384}, {0x73E5, 78}, {0x73E7, 352}, {0x73E9, 109}, {0x73EA, 103}, {0x73ED, 7},
+    {0x73EE, 232}, {0x73F2, 122}, {0x73FE, 337}, {0x7403, 253}, {0x7405, 161}, {0x7406, 166},
+    {0x7409, 174}, {0x740A, 349}, {0x740D, 166}, {0x740F, 168}, {0x7410, 306}, {0x741A, 135},
+    {0x741B, 35}, {0x7422, 399}, {0x7425, 117}, {0x7426, 244}, {0x7428, 156}, {0x742A, 244},
+    {0x742C, 328}, {0x742E, 48}, {0x742F, 101}, {0x7430, 350}, {0x7433, 172}, {0x7434, 250},
+    {0x7435, 235}, {0x7436, 227}, {0x743A, 79}, {0x743C, 252}, {0x743F, 123}, {0x7441, 186},
+    {0x7455, 336}, {0x7457, 361}, {0x7459, 206}, {0x745A, 117}, {0x745B, 356}, {0x745C, 360},
+    {0x745E, 269}, {0x745F, 277}, {0x7463, 306}, {0x7464, 352}, {0x7469, 356}, {0x746A, 182},
+    {0x746D, 310}, {0x746F, 161}, {0x7470, 103}, {0x7476, 352}, {0x7477, 1}, {0x747E, 131},
+    {0x7480, 52}, {0x7481, 48}, {0x7483, 166}, {0x7487, 346}, {0x748B, 376}, {0x748E, 356},
+    {0x7490, 177}, {0x7498, 172}, {0x749C, 121}, {0x749E, 243}, {0x749F, 132}, {0x74A3, 125},
+    {0x74A6, 1}, {0x74A7, 13}, {0x74A8, 23}, {0x74A9, 254}, {0x74B0, 120}, {0x74BA, 331},
+    {0x74BD, 335}, {0x74BF, 346}, {0x74CA, 252}, {0x74CF, 175}, {0x74D2, 366}, {0x74D4, 356},
+    {0x74D6, 338}, {0x74DA, 366}, {0x74DC, 99}, {0x74DE, 65}, {0x74E0, 117}, {0x74E2, 237},
+    {0x74E3, 7}, {0x74E4, 259}, {0x74E6, 326}, {0x74EE, 332}, {0x74EF, 226}, {0x74F4, 173},
+    {0x74F6, 240}, {0x74F7, 47}, {0x74FF, 20}, {0x7504, 379}, {0x750C, 226}, {0x750D, 190},
+    {0x750F, 12}, {0x7511, 372}, {0x7513, 235}, {0x7515, 332}, {0x7518, 89}, {0x7519, 56},
+    {0x751A, 287}, {0x751C, 315}, {0x751F, 288}, {0x7522, 31}, {0x7525, 288}, {0x7526, 302},
+    {0x7528, 358}, {0x7529, 293}, {0x752B, 86}, {0x752C, 358}, {0x752D, 12}, {0x752F, 217},
+    {0x7530, 315}, {0x7531, 359}, {0x7532, 126}, {0x7533, 287}, {0x7535, 63}, {0x7537, 204},
+    {0x7538, 63}, {0x753A, 318}, {0x753B, 118}, {0x753D, 379}, {0x753E, 365}, {0x7540, 13},
+    {0x7545, 32}, {0x7548, 80}, {0x754B, 315}, {0x754C, 130}, {0x754E, 255}, {0x754F, 330},
+    {0x7554, 229}, {0x7559, 174}, {0x755A, 11}, {0x755B, 379}, {0x755C, 40}, {0x755D, 200},
+    {0x7562, 13}, {0x7565, 179}, {0x7566, 244}, {0x756A, 80}, {0x756B, 118}, {0x7570, 354},
+    {0x7572, 285}, {0x7574, 39}, {0x7576, 58}, {0x7578, 125}, {0x7579, 328}, {0x757F, 125},
+    {0x7583, 322}, {0x7586, 128}, {0x7587, 39}, {0x758A, 65}, {0x758B, 235}, {0x758F, 291},
+    {0x7591, 354}, {0x7592, 207}, {0x7594, 66}, {0x7596, 130}, {0x7597, 170}, {0x7599, 92},
+    {0x759A, 134}, {0x759D, 282}, {0x759F, 223}, {0x75A0, 166}, {0x75A1, 351}, {0x75A2, 35},
+    {0x75A3, 359}, {0x75A4, 5}, {0x75A5, 130}, {0x75AB, 354}, {0x75AC, 166}, {0x75AE, 43},
+    {0x75AF, 84}, {0x75B0, 384}, {0x75B1, 231}, {0x75B2, 235}, {0x75B3, 89}, {0x75B4, 144},
+    {0x75B5, 47}, {0x75B8, 57}, {0x75B9, 379}, {0x75BC, 313}, {0x75BD, 135}, {0x75BE, 125},
+    {0x75C2, 126}, {0x75C3, 346}, {0x75C4, 373}, {0x75C5, 18}, {0x75C7, 380}, {0x75C8, 358},
+    {0x75C9, 132}, {0x75CA, 255}, {0x75CD, 354}, {0x75D2, 351}, {0x75D4, 381}, {0x75D5, 113},
+    {0x75D6, 349}, {0x75D8, 69}, {0x75D9, 132}, {0x75DB, 319}, {0x75DE, 235}, {0x75E0, 303},
+    {0x75E2, 166}, {0x75E3, 381}, {0x75E4, 54}, {0x75E6, 334}, {0x75E7, 280}, {0x75E8, 162},
+    {0x75EA, 120}, {0x75EB, 337}, {0x75F0, 309}, {0x75F1, 82}, {0x75F2, 182}, {0x75F3, 172},
+    {0x75F4, 37}, {0x75F9, 13}, {0x75FA, 13}, {0x75FC, 98}, {0x75FF, 330}, {0x7600, 360},
+    {0x7601, 52}, {0x7603, 384}, {0x7605, 57}, {0x7609, 360}, {0x760A, 116}, {0x760B, 84},
+    {0x760C, 158}, {0x760D, 351}, {0x7610, 360}, {0x7613, 120}, {0x7615, 126}, {0x7617, 354},
+    {0x7618, 176}, {0x7619, 276}, {0x761B, 37}, {0x761F, 331}, {0x7620, 125}, {0x7621, 43},
+    {0x7622, 7}, {0x7624, 174}, {0x7625, 30}, {0x7626, 290}, {0x7627, 223}, {0x7629, 55},
+    {0x762A, 16}, {0x762B, 309}, {0x762D, 15}, {0x7630, 181}, {0x7633, 39}, {0x7634, 376},
+    {0x7635, 374}, {0x7638, 256}, {0x763A, 176}, {0x763C, 198}, {0x763E, 355}, {0x763F, 356},
+    {0x7640, 121}, {0x7642, 170}, {0x7643, 175}, {0x7646, 162}, {0x764C, 1}, {0x764D, 7},
+    {0x7652, 360}, {0x7654, 354}, {0x7656, 235}, {0x7658, 166}, {0x765C, 63}, {0x765E, 159},
+    {0x765F, 16}, {0x7661, 37}, {0x7662, 351}, {0x7663, 346}, {0x7665, 380}, {0x7669, 159},
+    {0x766B, 63}, {0x766C, 346}, {0x766E, 355}, {0x766F, 254}, {0x7671, 309}, {0x7672, 63},
+    {0x7678, 103}, {0x767B, 61}, {0x767C, 79}, {0x767D, 6}, {0x767E, 6}, {0x7682, 368},
+    {0x7684, 60}, {0x7686, 130}, {0x7687, 121}, {0x7688, 103}, {0x768B, 91}, {0x768E, 129},
+    {0x7691, 1}, {0x7693, 110}, {0x7696, 328}, {0x7699, 335}, {0x769A, 1}, {0x76A4, 241},
+    {0x76AE, 235}, {0x76B0, 231}, {0x76B1, 383}, {0x76B2, 138}, {0x76B4, 53}, {0x76BA, 383},
+    {0x76BF, 195}, {0x76C2, 360}, {0x76C3, 10}, {0x76C5, 382}, {0x76C6, 233}, {0x76C8, 356},
+    {0x76CA, 354}, {0x76CD, 111}, {0x76CE, 3}, {0x76CF, 375}, {0x76D0, 350}, {0x76D1, 127},
+    {0x76D2, 111}, {0x76D4, 155}, {0x76D6, 88}, {0x76D7, 59}, {0x76D8, 229}, {0x76DB, 288},
+    {0x76DC, 59}, {0x76DE, 375}, {0x76DF, 190}, {0x76E1, 131}, {0x76E3, 127}, {0x76E4, 229},
+    {0x76E5, 101}, {0x76E7, 177}, {0x76EA, 58}, {0x76EE, 200}, {0x76EF, 66}, {0x76F1, 345},
+    {0x76F2, 185}, {0x76F4, 381}, {0x76F8, 338}, {0x76F9, 73}, {0x76FC, 229}, {0x76FE, 73},
+    {0x7701, 288}, {0x7704, 192}, {0x7707, 193}, {0x7708, 57}, {0x7709, 188}, {0x770B, 141},
+    {0x770D, 149}, {0x7719, 354}, {0x771A, 288}, {0x771F, 379}, {0x7720, 192}, {0x7722, 361},
+    {0x7726, 392}, {0x7728, 373}, {0x7729, 346}, {0x772D, 304}, {0x772F, 191}, {0x7735, 37},
+    {0x7736, 154}, {0x7737, 136}, {0x7738, 199}, {0x773A, 316}, {0x773C, 350}, {0x773E, 382},
+    {0x7740, 378}, {0x7741, 380}, {0x7743, 306}, {0x7747, 62}, {0x774F, 156}, {0x7750, 159},
+    {0x7751, 127}, {0x775A, 349}, {0x775B, 132}, {0x775C, 380}, {0x775E, 159}, {0x7761, 296},
+    {0x7762, 304}, {0x7763, 70}, {0x7765, 235}, {0x7766, 200}, {0x7768, 211}, {0x776A, 354},
+    {0x776B, 130}, {0x776C, 22}, {0x7779, 70}, {0x777D, 155}, {0x777E, 91}, {0x777F, 269},
+    {0x7780, 186}, {0x7784, 193}, {0x7785, 39}, {0x7787, 191}, {0x778B, 35}, {0x778C, 144},
+    {0x778D, 301}, {0x778E, 336}, {0x7791, 196}, {0x7792, 184}, {0x779E, 184}, {0x779F, 237},
+    {0x77A0, 36}, {0x77A2, 190}, {0x77A5, 238}, {0x77A7, 248}, {0x77A9, 384}, {0x77AA, 61},
+    {0x77AC, 297}, {0x77AD, 170}, {0x77B0, 141}, {0x77B3, 319}, {0x77B5, 172}, {0x77BB, 375},
+    {0x77BC, 127}, {0x77BD, 98}, {0x77BF, 254}, {0x77C7, 190}, {0x77CD, 137}, {0x77D3, 175},
+    {0x77D7, 40}, {0x77DA, 384}, {0x77DB, 186}, {0x77DC, 131}, {0x77E2, 289}, {0x77E3, 354},
+    {0x77E5, 381}, {0x77E7, 287}, {0x77E9, 135}, {0x77EB, 129}, {0x77EC, 54}, {0x77ED, 71},
+    {0x77EE, 1}, {0x77EF, 129}, {0x77F3, 289}, {0x77F6, 125}, {0x77F8, 89}, {0x77FD, 335},
+    {0x77FE, 80}, {0x77FF, 154}, {0x7800, 58}, {0x7801, 182}, {0x7802, 280}, {0x7809, 124},
+    {0x780C, 244}, {0x780D, 141}, {0x7811, 349}, {0x7812, 235}, {0x7814, 350}, {0x7816, 387},
+    {0x7817, 34}, {0x7818, 73}, {0x781A, 350}, {0x781C, 84}, {0x781D, 79}, {0x781F, 373},
+    {0x7820, 135}, {0x7823, 325}, {0x7825, 62}, {0x7826, 374}, {0x7827, 379}, {0x7829, 86},
+    {0x782C, 158}, {0x782D, 14}, {0x7830, 234}, {0x7832, 231}, {0x7834, 241}, {0x7837, 287},
+    {0x7838, 364}, {0x7839, 1}, {0x783A, 166}, {0x783B, 175}, {0x783C, 319}, {0x783E, 166},
+    {0x7840, 40}, {0x7843, 384}, {0x7845, 103}, {0x7847, 206}, {0x784C, 92}, {0x784E, 342},
+    {0x7850, 68}, {0x7852, 335}, {0x7855, 298}, {0x7856, 336}, {0x7857, 248}, {0x785D, 339},
+    {0x786A, 333}, {0x786B, 174}, {0x786C, 356}, {0x786D, 185}, {0x786E, 256}, {0x786F, 350},
+    {0x7877, 127}, {0x787C, 234}, {0x787F, 148}, {0x7887, 66}, {0x7889, 64}, {0x788C, 177},
+    {0x788D, 1}, {0x788E, 304}, {0x7891, 10}, {0x7893, 72}, {0x7897, 328}, {0x7898, 63},
+    {0x789A, 10}, {0x789B, 244}, {0x789C, 35}, {0x789F, 65}, {0x78A1, 70}, {0x78A3, 130},
+    {0x78A5, 14}, {0x78A7, 13}, {0x78A9, 298}, {0x78B0, 234}, {0x78B1, 127}, {0x78B2, 62},
+    {0x78B3, 309}, {0x78B4, 29}, {0x78B9, 346}, {0x78BA, 256}, {0x78BC, 182}, {0x78BE, 212},
+    {0x78C1, 47}, {0x78C5, 8}, {0x78C9, 275}, {0x78CA, 164}, {0x78CB, 54}, {0x78D0, 229},
+    {0x78D4, 378}, {0x78D5, 144}, {0x78D9, 104}, {0x78DA, 387}, {0x78E7, 244}, {0x78E8, 198},
+    {0x78EC, 251}, {0x78EF, 125}, {0x78F2, 254}, {0x78F4, 61}, {0x78F7, 172}, {0x78FA, 121},
+    {0x7901, 129}, {0x7905, 73}, {0x790E, 40}, {0x7913, 128}, {0x7919, 1}, {0x791E, 190},
+    {0x7924, 21}, {0x7926, 154}, {0x792A, 166}, {0x792B, 166}, {0x792C, 80}, {0x7934, 19},
+    {0x793A, 289}, {0x793B, 289}, {0x793C, 166}, {0x793E, 285}, {0x7940, 299}, {0x7941, 244},
+    {0x7946, 337}, {0x7947, 244}, {0x7948, 244}, {0x7949, 381}, {0x7950, 359}, {0x7953, 86},
+    {0x7955, 191}, {0x7956, 395}, {0x7957, 381}, {0x795A, 399}, {0x795B, 254}, {0x795C, 117},
+    {0x795D, 384}, {0x795E, 287}, {0x795F, 304}, {0x7960, 47}, {0x7962, 191}, {0x7965, 338},
+    {0x7967, 316}, {0x7968, 237}, {0x796D, 125}, {0x796F, 379}, {0x7977, 59}, {0x7978, 124},
+    {0x797A, 244}, {0x797F, 177}, {0x7980, 18}, {0x7981, 131}, {0x7984, 177}, {0x7985, 31},
+    {0x798A, 335}, {0x798D, 124}, {0x798E, 379}, {0x798F, 86}, {0x799A, 391}, {0x79A6, 360},
+    {0x79A7, 335}, {0x79AA, 31}, {0x79AE, 166}, {0x79B1, 59}, {0x79B3, 259}, {0x79B9, 360},
+    {0x79BA, 360}, {0x79BB, 166}, {0x79BD, 250}, {0x79BE, 111}, {0x79BF, 321}, {0x79C0, 344},
+    {0x79C1, 299}, {0x79C3, 321}, {0x79C6, 89}, {0x79C8, 337}, {0x79C9, 18}, {0x79CB, 253},
+    {0x79CD, 382}, {0x79D1, 144}, {0x79D2, 193}, {0x79D5, 13}, {0x79D8, 191}, {0x79DF, 395},
+    {0x79E3, 198}, {0x79E4, 36}, {0x79E6, 250}, {0x79E7, 351}, {0x79E9, 381}, {0x79EB, 291},
+    {0x79ED, 392}, {0x79EF, 125}, {0x79F0, 36}, {0x79F8, 130}, {0x79FB, 354}, {0x79FD, 122},
+    {0x7A00, 335}, {0x7A02, 161}, {0x7A03, 86}, {0x7A05, 296}, {0x7A06, 177}, {0x7A08, 89},
+    {0x7A0B, 36}, {0x7A0D, 284}, {0x7A0E, 296}, {0x7A14, 262}, {0x7A17, 6}, {0x7A1A, 381},
+    {0x7A1C, 165}, {0x7A1E, 144}, {0x7A1F, 18}, {0x7A20, 39}, {0x7A23, 302}, {0x7A2E, 382},
+    {0x7A31, 36}, {0x7A33, 331}, {0x7A37, 125}, {0x7A39, 379}, {0x7A3B, 59}, {0x7A3C, 126},
+    {0x7A3D, 125}, {0x7A3F, 91}, {0x7A40, 98}, {0x7A46, 200}, {0x7A4B, 177}, {0x7A4C, 302},
+    {0x7A4D, 125}, {0x7A4E, 356}, {0x7A51, 277}, {0x7A57, 304}, {0x7A60, 219}, {0x7A61, 277},
+    {0x7A62, 122}, {0x7A69, 331}, {0x7A6B, 124}, {0x7A70, 259}, {0x7A74, 347}, {0x7A76, 134},
+    {0x7A77, 252}, {0x7A78, 335}, {0x7A79, 252}, {0x7A7A, 148}, {0x7A7F, 42}, {0x7A80, 390},
+    {0x7A81, 321}, {0x7A83, 249}, {0x7A84, 374}, {0x7A86, 14}, {0x7A88, 352}, {0x7A8D, 248},
+    {0x7A91, 352}, {0x7A92, 381}, {0x7A95, 316}, {0x7A96, 129}, {0x7A97, 43}, {0x7A98, 133},
+    {0x7A9C, 51}, {0x7A9D, 333}, {0x7A9F, 150}, {0x7AA0, 144}, {0x7AA5, 155}, {0x7AA6, 69},
+    {0x7AA8, 348}, {0x7AA9, 333}, {0x7AAA, 326}, {0x7AAC, 360}, {0x7AAD, 135}, {0x7AAE, 252},
+    {0x7AAF, 352}, {0x7AB3, 360}, {0x7ABA, 155}, {0x7ABF, 175}, {0x7AC4, 51}, {0x7AC5, 248},
+    {0x7AC7, 69}, {0x7ACA, 249}, {0x7ACB, 166}, {0x7AD6, 291}, {0x7AD9, 375}, {0x7ADE, 132},
+    {0x7ADF, 132}, {0x7AE0, 376}, {0x7AE3, 138}, {0x7AE5, 319}, {0x7AE6, 300}, {0x7AED, 130},
+    {0x7AEF, 71}, {0x7AF6, 132}, {0x7AF9, 384}, {0x7AFA, 384}, {0x7AFD, 360}, {0x7AFF, 89},
+    {0x7B03, 70}, {0x7B04, 125}, {0x7B06, 5}, {0x7B08, 125}, {0x7B0A, 377}, {0x7B0B, 305},
+    {0x7B0F, 117}, {0x7B11, 339}, {0x7B14, 13}, {0x7B15, 127}, {0x7B19, 288}, {0x7B1B, 62},
+    {0x7B1E, 37}, {0x7B20, 166}, {0x7B24, 316}, {0x7B25, 299}, {0x7B26, 86}, {0x7B28, 11},
+    {0x7B2A, 55}, {0x7B2B, 392}, {0x7B2C, 62}, {0x7B2E, 369}, {0x7B31, 97}, {0x7B33, 126},
+    {0x7B38, 241}, {0x7B3A, 127}, {0x7B3C, 175}, {0x7B3E, 14}, {0x7B45, 337}, {0x7B46, 13},
+    {0x7B47, 252}, {0x7B49, 61}, {0x7B4B, 131}, {0x7B4C, 255}, {0x7B4D, 305}, {0x7B4F, 79},
+    {0x7B50, 154}, {0x7B51, 384}, {0x7B52, 319}, {0x7B54, 55}, {0x7B56, 26}, {0x7B58, 149},
+    {0x7B5A, 13}, {0x7B5B, 281}, {0x7B5D, 380}, {0x7B60, 363}, {0x7B62, 227}, {0x7B67, 127},
+    {0x7B6E, 289}, {0x7B71, 339}, {0x7B72, 284}, {0x7B75, 350}, {0x7B77, 152}, {0x7B79, 39},
+    {0x7B7B, 90}, {0x7B7E, 246}, {0x7B80, 127}, {0x7B84, 13}, {0x7B85, 13}, {0x7B87, 92},
+    {0x7B8B, 127}, {0x7B8D, 98}, {0x7B8F, 380}, {0x7B90, 251}, {0x7B94, 19}, {0x7B95, 125},
+    {0x7B97, 303}, {0x7B9C, 148}, {0x7B9D, 246}, {0x7BA0, 44}, {0x7BA1, 101}, {0x7BA2, 361},
+    {0x7BA6, 369}, {0x7BA7, 249}, {0x7BA8, 325}, {0x7BA9, 181}, {0x7BAA, 57}, {0x7BAB, 339},
+    {0x7BAC, 271}, {0x7BAD, 127}, {0x7BB1, 338}, {0x7BB4, 379}, {0x7BB8, 384}, {0x7BC0, 130},
+    {0x7BC1, 121}, {0x7BC4, 80}, {0x7BC6, 387}, {0x7BC7, 236}, {0x7BC9, 384}, {0x7BCC, 116},
+    {0x7BD1, 155}, {0x7BD3, 176}, {0x7BD9, 91}, {0x7BDA, 82}, {0x7BDB, 271}, {0x7BDD, 97},
+    {0x7BE0, 339}, {0x7BE1, 51}, {0x7BE4, 70}, {0x7BE5, 166}, {0x7BE6, 13}, {0x7BE9, 281},
+    {0x7BEA, 37}, {0x7BEE, 160}, {0x7BF1, 166}, {0x7BF7, 234}, {0x7BFC, 69}, {0x7BFE, 194},
+    {0x7C07, 50}, {0x7C0B, 103}, {0x7C0C, 302}, {0x7C0D, 176}, {0x7C0F, 177}, {0x7C11, 306},
+    {0x7C16, 71}, {0x7C1E, 57}, {0x7C1F, 63}, {0x7C21, 127}, {0x7C23, 155}, {0x7C26, 61},
+    {0x7C27, 121}, {0x7C2A, 366}, {0x7C2B, 339}, {0x7C37, 350}, {0x7C38, 19}, {0x7C3D, 246},
+    {0x7C3E, 168}, {0x7C3F, 20}, {0x7C40, 383}, {0x7C41, 159}, {0x7C43, 160}, {0x7C4C, 39},
+    {0x7C4D, 125}, {0x7C50, 313}, {0x7C5F, 159}, {0x7C60, 175}, {0x7C63, 160}, {0x7C64, 246},
+    {0x7C65, 362}, {0x7C6C, 166}, {0x7C6E, 181}, {0x7C72, 360}, {0x7C73, 191}, {0x7C74, 62},
+    {0x7C7B, 164}, {0x7C7C, 337}, {0x7C7D, 392}, {0x7C89, 83}, {0x7C91, 5}, {0x7C92, 166},
+    {0x7C95, 241}, {0x7C97, 50}, {0x7C98, 375}, {0x7C9C, 316}, {0x7C9D, 166}, {0x7C9E, 335},
+    {0x7C9F, 302}, {0x7CA2, 392}, {0x7CA4, 362}, {0x7CA5, 383}, {0x7CAA, 83}, {0x7CAE, 169},
+    {0x7CB1, 169}, {0x7CB2, 23}, {0x7CB3, 132}, {0x7CB5, 362}, {0x7CB9, 52}, {0x7CBC, 172},
+    {0x7CBD, 393}, {0x7CBE, 132}, {0x7CC1, 274}, {0x7CC5, 266}, {0x7CC7, 116}, {0x7CC8, 345},
+    {0x7CCA, 117}, {0x7CCC, 366}, {0x7CCD, 47}, {0x7CD5, 91}, {0x7CD6, 310}, {0x7CD7, 253},
+    {0x7CD9, 25}, {0x7CDC, 191}, {0x7CDD, 274}, {0x7CDE, 83}, {0x7CDF, 368}, {0x7CE0, 142},
+    {0x7CE2, 198}, {0x7CE7, 169}, {0x7CE8, 128}, {0x7CEF, 224}, {0x7CF0, 322}, {0x7CF8, 191},
+    {0x7CFB, 335}, {0x7CFE, 134}, {0x7D00, 125}, {0x7D02, 383}, {0x7D04, 362}, {0x7D05, 115},
+    {0x7D06, 360}, {0x7D07, 111}, {0x7D09, 262}, {0x7D0A, 331}, {0x7D0B, 331}, {0x7D0D, 202},
+    {0x7D10, 218}, {0x7D14, 45}, {0x7D15, 235}, {0x7D17, 280}, {0x7D19, 381}, {0x7D1A, 125},
+    {0x7D1B, 83}, {0x7D1C, 363}, {0x7D20, 302}, {0x7D21, 81}, {0x7D22, 306}, {0x7D27, 131},
+    {0x7D2B, 392}, {0x7D2E, 364}, {0x7D2F, 164}, {0x7D30, 335}, {0x7D31, 86}, {0x7D32, 340},
+    {0x7D33, 287}, {0x7D39, 284}, {0x7D3C, 86}, {0x7D40, 40}, {0x7D42, 382}, {0x7D43, 337},
+    {0x7D44, 395}, {0x7D46, 7}, {0x7D50, 130}, {0x7D55, 137}, {0x7D5B, 311}, {0x7D5E, 129},
+    {0x7D61, 181}, {0x7D62, 346}, {0x7D66, 93}, {0x7D68, 265}, {0x7D6E, 345}, {0x7D70, 65},
+    {0x7D71, 319}, {0x7D72, 299}, {0x7D73, 128}, {0x7D77, 381}, {0x7D79, 136}, {0x7D81, 8},
+    {0x7D8F, 304}, {0x7D91, 156}, {0x7D93, 132}, {0x7D9C, 393}, {0x7D9E, 74}, {0x7DA0, 177},
+    {0x7DA2, 39}, {0x7DA6, 244}, {0x7DAC, 290}, {0x7DAD, 330}, {0x7DAE, 244}, {0x7DB0, 328},
+    {0x7DB1, 90}, {0x7DB2, 329}, {0x7DB4, 389}, {0x7DB5, 22}, {0x7DB8, 180}, {0x7DBA, 244},
+    {0x7DBB, 375}, {0x7DBD, 46}, {0x7DBE, 173}, {0x7DBF, 192}, {0x7DC7, 392}, {0x7DCA, 131},
+    {0x7DD2, 345}, {0x7DD8, 127}, {0x7DD9, 144}, {0x7DDA, 337}, {0x7DDD, 125}, {0x7DDE, 71},
+    {0x7DE0, 62}, {0x7DE3, 361}, {0x7DE8, 14}, {0x7DE9, 120}, {0x7DEC, 192}, {0x7DEF, 330},
+    {0x7DF2, 193}, {0x7DF4, 168}, {0x7DF9, 314}, {0x7DFB, 381}, {0x7E08, 356}, {0x7E09, 131},
+    {0x7E0A, 354}, {0x7E10, 383}, {0x7E11, 127}, {0x7E1B, 86}, {0x7E1D, 35}, {0x7E1E, 91},
+    {0x7E23, 337}, {0x7E2B, 84}, {0x7E2E, 306}, {0x7E2F, 350}, {0x7E31, 393}, {0x7E32, 164},
+    {0x7E34, 246}, {0x7E35, 184}, {0x7E37, 177}, {0x7E39, 237}, {0x7E3B, 191}, {0x7E3D, 393},
+    {0x7E3E, 125}, {0x7E3F, 282}, {0x7E41, 80}, {0x7E43, 12}, {0x7E45, 276}, {0x7E46, 199},
+    {0x7E47, 352}, {0x7E48, 247}, {0x7E52, 372}, {0x7E54, 381}, {0x7E55, 282}, {0x7E59, 80},
+    {0x7E5A, 170}, {0x7E5E, 260}, {0x7E61, 344}, {0x7E69, 288}, {0x7E6A, 122}, {0x7E6B, 335},
+    {0x7E6D, 127}, {0x7E73, 129}, {0x7E79, 354}, {0x7E7C, 125}, {0x7E7D, 17}, {0x7E82, 396},
+    {0x7E8C, 345}, {0x7E8F, 31}, {0x7E93, 356}, {0x7E94, 22}, {0x7E96, 337}, {0x7E9B, 59},
+    {0x7E9C, 160}, {0x7E9F, 299}, {0x7EA0, 134}, {0x7EA1, 360}, {0x7EA2, 115}, {0x7EA3, 383},
+    {0x7EA4, 337}, {0x7EA5, 92}, {0x7EA6, 362}, {0x7EA7, 125}, {0x7EA8, 328}, {0x7EA9, 154},
+    {0x7EAA, 125}, {0x7EAB, 262}, {0x7EAC, 330}, {0x7EAD, 363}, {0x7EAF, 45}, {0x7EB0, 235},
+    {0x7EB1, 280}, {0x7EB2, 90}, {0x7EB3, 202}, {0x7EB5, 393}, {0x7EB6, 180}, {0x7EB7, 83},
+    {0x7EB8, 381}, {0x7EB9, 331}, {0x7EBA, 81}, {0x7EBD, 218}, {0x7EBE, 291}, {0x7EBF, 337},
+    {0x7EC0, 89}, {0x7EC1, 340}, {0x7EC2, 86}, {0x7EC3, 168}, {0x7EC4, 395}, {0x7EC5, 287},
+    {0x7EC6, 335}, {0x7EC7, 381}, {0x7EC8, 382}, {0x7EC9, 383}, {0x7ECA, 7}, {0x7ECB, 86},
+    {0x7ECC, 40}, {0x7ECD, 284}, {0x7ECE, 354}, {0x7ECF, 132}, {0x7ED0, 56}, {0x7ED1, 8},
+    {0x7ED2, 265}, {0x7ED3, 130}, {0x7ED4, 150}, {0x7ED5, 260}, {0x7ED7, 109}, {0x7ED8, 122},
+    {0x7ED9, 93}, {0x7EDA, 346}, {0x7EDB, 128}, {0x7EDC, 181}, {0x7EDD, 137}, {0x7EDE, 129},
+    {0x7EDF, 319}, {0x7EE0, 95}, {0x7EE1, 339}, {0x7EE2, 136}, {0x7EE3, 344}, {0x7EE5, 304},
+    {0x7EE6, 311}, {0x7EE7, 125}, {0x7EE8, 314}, {0x7EE9, 125}, {0x7EEA, 345}, {0x7EEB, 173},
+    {0x7EED, 345}, {0x7EEE, 244}, {0x7EEF, 82}, {0x7EF0, 46}, {0x7EF1, 283}, {0x7EF2, 104},
+    {0x7EF3, 288}, {0x7EF4, 330}, {0x7EF5, 192}, {0x7EF6, 290}, {0x7EF7, 12}, {0x7EF8, 39},
+    {0x7EFA, 174}, {0x7EFB, 255}, {0x7EFC, 393}, {0x7EFD, 375}, {0x7EFE, 328}, {0x7EFF, 177},
+    {0x7F00, 389}, {0x7F01, 392}, {0x7F02, 144}, {0x7F03, 338}, {0x7F04, 127}, {0x7F05, 192},
+    {0x7F06, 160}, {0x7F07, 314}, {0x7F08, 193}, {0x7F09, 125}, {0x7F0B, 122}, {0x7F0C, 299},
+    {0x7F0D, 74}, {0x7F0E, 71}, {0x7F0F, 14}, {0x7F11, 97}, {0x7F12, 389}, {0x7F13, 120},
+    {0x7F14, 62}, {0x7F15, 177}, {0x7F16, 14}, {0x7F17, 195}, {0x7F18, 361}, {0x7F19, 131},
+    {0x7F1A, 86}, {0x7F1B, 267}, {0x7F1C, 379}, {0x7F1D, 84}, {0x7F1F, 91}, {0x7F20, 31},
+    {0x7F21, 166}, {0x7F22, 354}, {0x7F23, 127}, {0x7F24, 17}, {0x7F25, 237}, {0x7F26, 184},
+    {0x7F27, 164}, {0x7F28, 356}, {0x7F29, 306}, {0x7F2A, 199}, {0x7F2B, 276}, {0x7F2C, 340},
+    {0x7F2D, 170}, {0x7F2E, 282}, {0x7F2F, 372}, {0x7F30, 128}, {0x7F31, 246}, {0x7F32, 248},
+    {0x7F33, 120}, {0x7F34, 129}, {0x7F35, 396}, {0x7F36, 85}, {0x7F38, 90}, {0x7F3A, 256},
+    {0x7F3D, 19}, {0x7F42, 356}, {0x7F44, 251}, {0x7F45, 336}, {0x7F48, 309}, {0x7F4C, 356},
+    {0x7F50, 101}, {0x7F51, 329}, {0x7F54, 329}, {0x7F55, 108}, {0x7F57, 181}, {0x7F58, 86},
+    {0x7F5A, 79}, {0x7F5F, 98}, {0x7F61, 90}, {0x7F62, 5}, {0x7F68, 350}, {0x7F69, 377},
+    {0x7F6A, 397}, {0x7F6E, 381}, {0x7F70, 79}, {0x7F71, 160}, {0x7F72, 291}, {0x7F74, 235},
+    {0x7F75, 182}, {0x7F77, 5}, {0x7F79, 166}, {0x7F7E, 372}, {0x7F81, 125}, {0x7F85, 181},
+    {0x7F88, 125}, {0x7F8A, 351}, {0x7F8B, 191}, {0x7F8C, 247}, {0x7F8E, 188}, {0x7F94, 91},
+    {0x7F9A, 173}, {0x7F9D, 62}, {0x7F9E, 344}, {0x7F9F, 247}, {0x7FA1, 337}, {0x7FA4, 257},
+    {0x7FA7, 306}, {0x7FA8, 337}, {0x7FA9, 354}, {0x7FAF, 130}, {0x7FB0, 310}, {0x7FB2, 335},
+    {0x7FB6, 282}, {0x7FB8, 164}, {0x7FB9, 95}, {0x7FBC, 31}, {0x7FBD, 360}, {0x7FBF, 354},
+    {0x7FC1, 332}, {0x7FC5, 37}, {0x7FCA, 354}, {0x7FCC, 354}, {0x7FCE, 173}, {0x7FD2, 335},
+    {0x7FD4, 338}, {0x7FD5, 335}, {0x7FD8, 248}, {0x7FDF, 62}, {0x7FE0, 52}, {0x7FE1, 82},
+    {0x7FE5, 384}, {0x7FE6, 127}, {0x7FE9, 236}, {0x7FEE, 111}, {0x7FF0, 108}, {0x7FF1, 4},
+    {0x7FF3, 354}, {0x7FF9, 248}, {0x7FFB, 80}, {0x7FFC, 354}, {0x8000, 352}, {0x8001, 162},
+    {0x8003, 143}, {0x8004, 186}, {0x8005, 378}, {0x8006, 244}, {0x800B, 65}, {0x800C, 78},
+    {0x800D, 292}, {0x8010, 203}, {0x8011, 71}, {0x8012, 164}, {0x8014, 392}, {0x8015, 95},
+    {0x8016, 33}, {0x8017, 110}, {0x8018, 363}, {0x8019, 5}, {0x801C, 299}, {0x8020, 124},
+    {0x8022, 162}, {0x8025, 310}, {0x8026, 226}, {0x8027, 176}, {0x8028, 220}, {0x8029, 128},
+    {0x802A, 230}, {0x8031, 198}, {0x8033, 78}, {0x8035, 66}, {0x8036, 353}, {0x8037, 55},
+    {0x8038, 300}, {0x803B, 37}, {0x803D, 57}, {0x803F, 95}, {0x8042, 215}, {0x8043, 57},
+    {0x8046, 173}, {0x804A, 170}, {0x804B, 175}, {0x804C, 381}, {0x804D, 217}, {0x8052, 99},
+    {0x8054, 168}, {0x8056, 288}, {0x8058, 239}, {0x805A, 135}, {0x805E, 331}, {0x8069, 155},
+    {0x806A, 48}, {0x806F, 168}, {0x8070, 48}, {0x8071, 4}, {0x8072, 288}, {0x8073, 300},
+    {0x8076, 215}, {0x8077, 381}, {0x807D, 318}, {0x807E, 175}, {0x807F, 360}, {0x8080, 360},
+    {0x8083, 302}, {0x8084, 354}, {0x8085, 302}, {0x8086, 299}, {0x8087, 377}, {0x8089, 266},
+    {0x808B, 163}, {0x808C, 125}, {0x8093, 121}, {0x8096, 339}, {0x8098, 383}, {0x809A, 70},
+    {0x809B, 90}, {0x809C, 265}, {0x809D, 89}, {0x809F, 333}, {0x80A0, 32}, {0x80A1, 98},
+    {0x80A2, 381}, {0x80A4, 86}, {0x80A5, 82}, {0x80A9, 127}, {0x80AA, 81}, {0x80AB, 390},
+    {0x80AD, 202}, {0x80AE, 3}, {0x80AF, 146}, {0x80B1, 96}, {0x80B2, 360}, {0x80B4, 352},
+    {0x80B7, 246}, {0x80BA, 82}, {0x80BC, 132}, {0x80BD, 308}, {0x80BE, 287}, {0x80BF, 382},
+    {0x80C0, 376}, {0x80C1, 340}, {0x80C2, 287}, {0x80C3, 330}, {0x80C4, 383}, {0x80C6, 57},
+    {0x80CC, 10}, {0x80CD, 99}, {0x80CE, 308}, {0x80D6, 230}, {0x80D7, 379}, {0x80D9, 399},
+    {0x80DA, 232}, {0x80DB, 126}, {0x80DC, 288}, {0x80DD, 381}, {0x80DE, 9}, {0x80E1, 117},
+    {0x80E4, 355}, {0x80E5, 345}, {0x80E7, 175}, {0x80E8, 68}, {0x80E9, 139}, {0x80EA, 177},
+    {0x80EB, 132}, {0x80EC, 221}, {0x80ED, 350}, {0x80EF, 151}, {0x80F0, 354}, {0x80F1, 102},
+    {0x80F2, 107}, {0x80F3, 92}, {0x80F4, 68}, {0x80F6, 129}, {0x80F8, 343}, {0x80FA, 2},
+    {0x80FC, 236}, {0x80FD, 210}, {0x8102, 381}, {0x8105, 340}, {0x8106, 52}, {0x8108, 183},
+    {0x8109, 183}, {0x810A, 125}, {0x810D, 152}, {0x810E, 272}, {0x810F, 367}, {0x8110, 244},
+    {0x8111, 206}, {0x8112, 191}, {0x8113, 219}, {0x8114, 178}, {0x8116, 19}, {0x8118, 328},
+    {0x811A, 129}, {0x811E, 54}, {0x8123, 45}, {0x8124, 287}, {0x8129, 344}, {0x812B, 325},
+    {0x812C, 231}, {0x812F, 243}, {0x8130, 69}, {0x8131, 325}, {0x8132, 214}, {0x8136, 181},
+    {0x8138, 168}, {0x8139, 376}, {0x813E, 235}, {0x8146, 315}, {0x8148, 132}, {0x814A, 158},
+    {0x814B, 353}, {0x814C, 350}, {0x814E, 287}, {0x8150, 86}, {0x8151, 86}, {0x8153, 82},
+    {0x8154, 247}, {0x8155, 328}, {0x8159, 393}, {0x815A, 66}, {0x8160, 49}, {0x8165, 342},
+    {0x8166, 206}, {0x8167, 291}, {0x8169, 204}, {0x816B, 382}, {0x816D, 75}, {0x816E, 273},
+    {0x8170, 352}, {0x8171, 127}, {0x8173, 129}, {0x8174, 360}, {0x8178, 32}, {0x8179, 86},
+    {0x817A, 337}, {0x817B, 211}, {0x817C, 192}, {0x817D, 326}, {0x817E, 313}, {0x817F, 323},
+    {0x8180, 8}, {0x8182, 177}, {0x8188, 92}, {0x818A, 19}, {0x818F, 91}, {0x8191, 17},
+    {0x8198, 15}, {0x819A, 86}, {0x819B, 310}, {0x819C, 198}, {0x819D, 335}, {0x81A0, 129},
+    {0x81A3, 381}, {0x81A6, 172}, {0x81A8, 234}, {0x81A9, 211}, {0x81AA, 41}, {0x81B3, 282},
+    {0x81BA, 356}, {0x81BB, 282}, {0x81BD, 57}, {0x81BE, 152}, {0x81BF, 219}, {0x81C0, 324},
+    {0x81C1, 168}, {0x81C2, 13}, {0x81C3, 358}, {0x81C6, 354}, {0x81C9, 168}, {0x81CA, 276},
+    {0x81CC, 98}, {0x81CD, 244}, {0x81CF, 17}, {0x81D8, 158}, {0x81DA, 177}, {0x81DF, 367},
+    {0x81E2, 364}, {0x81E3, 35}, {0x81E5, 333}, {0x81E7, 367}, {0x81E8, 172}, {0x81EA, 392},
+    {0x81EC, 215}, {0x81ED, 39}, {0x81F3, 381}, {0x81F4, 381}, {0x81FA, 308}, {0x81FB, 379},
+    {0x81FC, 134}, {0x81FE, 360}, {0x8200, 352}, {0x8201, 360}, {0x8202, 38}, {0x8204, 335},
+    {0x8205, 134}, {0x8206, 360}, {0x8207, 360}, {0x8208, 342}, {0x8209, 135}, {0x820A, 134},
+    {0x820C, 285}, {0x820D, 285}, {0x8210, 289}, {0x8212, 291}, {0x8214, 315}, {0x821B, 42},
+    {0x821C, 297}, {0x821E, 334}, {0x821F, 383}, {0x8221, 42}, {0x8222, 282}, {0x8223, 354},
+    {0x8228, 7}, {0x822A, 109}, {0x822B, 81}, {0x822C, 7}, {0x822D, 13}, {0x822F, 382},
+    {0x8230, 127}, {0x8231, 24}, {0x8233, 384}, {0x8234, 369}, {0x8235, 74}, {0x8236, 19},
+    {0x8237, 337}, {0x8238, 92}, {0x8239, 42}, {0x823B, 177}, {0x823E, 335}, {0x8244, 284},
+    {0x8247, 318}, {0x8249, 330}, {0x824B, 190}, {0x824F, 290}, {0x8258, 301}, {0x8259, 24},
+    {0x825A, 25}, {0x825F, 38}, {0x8266, 127}, {0x8268, 190}, {0x826E, 94}, {0x826F, 169},
+    {0x8270, 127}, {0x8271, 127}, {0x8272, 277}, {0x8273, 350}, {0x8274, 86}, {0x8277, 350},
+    {0x8279, 25}, {0x827A, 354}, {0x827D, 129}, {0x827E, 1}, {0x827F, 203}, {0x8282, 130},
+    {0x8284, 328}, {0x8288, 191}, {0x828A, 246}, {0x828B, 360}, {0x828D, 284}, {0x828E, 252},
+    {0x828F, 70}, {0x8291, 244}, {0x8292, 185}, {0x8297, 338}, {0x8298, 235}, {0x8299, 86},
+    {0x829C, 334}, {0x829D, 381}, {0x829F, 282}, {0x82A1, 246}, {0x82A3, 86}, {0x82A4, 149},
+    {0x82A5, 130}, {0x82A6, 177}, {0x82A8, 125}, {0x82A9, 250}, {0x82AA, 244}, {0x82AB, 350},
+    {0x82AC, 83}, {0x82AD, 5}, {0x82AE, 269}, {0x82AF, 341}, {0x82B0, 125}, {0x82B1, 118},
+    {0x82B3, 81}, {0x82B4, 334}, {0x82B7, 381}, {0x82B8, 363}, {0x82B9, 250}, {0x82BB, 40},
+    {0x82BD, 349}, {0x82BE, 82}, {0x82C1, 48}, {0x82C4, 14}, {0x82C7, 330}, {0x82C8, 166},
+    {0x82CA, 75}, {0x82CB, 337}, {0x82CC, 32}, {0x82CD, 24}, {0x82CE, 384}, {0x82CF, 302},
+    {0x82D1, 361}, {0x82D2, 258}, {0x82D3, 173}, {0x82D4, 308}, {0x82D5, 284}, {0x82D7, 193},
+    {0x82D8, 251}, {0x82DB, 144}, {0x82DC, 200}, {0x82DE, 9}, {0x82DF, 97}, {0x82E0, 195},
+    {0x82E1, 354}, {0x82E3, 135}, {0x82E4, 238}, {0x82E5, 271}, {0x82E6, 150}, {0x82E7, 217},
+    {0x82EB, 282}, {0x82EF, 11}, {0x82F1, 356}, {0x82F4, 135}, {0x82F7, 89}, {0x82F9, 240},
+    {0x82FB, 86}, {0x8301, 391}, {0x8302, 186}, {0x8303, 80}, {0x8304, 126}, {0x8305, 186},
+    {0x8306, 186}, {0x8307, 5}, {0x8308, 47}, {0x8309, 198}, {0x830C, 37}, {0x830E, 132},
+    {0x830F, 175}, {0x8311, 214}, {0x8314, 356}, {0x8315, 252}, {0x8317, 196}, {0x831A, 355},
+    {0x831B, 94}, {0x831C, 246}, {0x8327, 127}, {0x8328, 47}, {0x832B, 185}, {0x832C, 29},
+    {0x832D, 129}, {0x832F, 86}, {0x8331, 384}, {0x8332, 392}, {0x8333, 128}, {0x8334, 122},
+    {0x8335, 355}, {0x8336, 29}, {0x8338, 265}, {0x8339, 267}, {0x833A, 38}, {0x833C, 319},
+    {0x8340, 348}, {0x8343, 255}, {0x8346, 132}, {0x8347, 342}, {0x8349, 25}, {0x834A, 132},
+    {0x834F, 262}, {0x8350, 127}, {0x8351, 314}, {0x8352, 121}, {0x8354, 166}, {0x835A, 126},
+    {0x835B, 260}, {0x835C, 13}, {0x835E, 248}, {0x835F, 122}, {0x8360, 125}, {0x8361, 58},
+    {0x8363, 265}, {0x8364, 123}, {0x8365, 342}, {0x8366, 181}, {0x8367, 356}, {0x8368, 348},
+    {0x8369, 131}, {0x836A, 305}, {0x836B, 355}, {0x836C, 183}, {0x836D, 115}, {0x836E, 383},
+    {0x836F, 352}, {0x8377, 111}, {0x8378, 13}, {0x837B, 62}, {0x837C, 321}, {0x837D, 304},
+    {0x8385, 166}, {0x8386, 243}, {0x8389, 166}, {0x838A, 388}, {0x838E, 280}, {0x8392, 135},
+    {0x8393, 188}, {0x8396, 132}, {0x8398, 287}, {0x839B, 318}, {0x839C, 359}, {0x839E, 101},
+    {0x83A0, 359}, {0x83A2, 126}, {0x83A7, 337}, {0x83A8, 161}, {0x83A9, 86}, {0x83AA, 75},
+    {0x83AB, 198}, {0x83B0, 141}, {0x83B1, 159}, {0x83B2, 168}, {0x83B3, 289}, {0x83B4, 333},
+    {0x83B6, 337}, {0x83B7, 124}, {0x83B8, 359}, {0x83B9, 356}, {0x83BA, 356}, {0x83BC, 45},
+    {0x83BD, 185}, {0x83C0, 328}, {0x83C1, 132}, {0x83C5, 127}, {0x83C7, 98}, {0x83CA, 135},
+    {0x83CC, 138}, {0x83CF, 111}, {0x83D4, 86}, {0x83D6, 32}, {0x83D8, 300}, {0x83DC, 22},
+    {0x83DD, 5}, {0x83DF, 321}, {0x83E0, 19}, {0x83E1, 108}, {0x83E5, 335}, {0x83E9, 243},
+    {0x83EA, 58}, {0x83EF, 118}, {0x83F0, 98}, {0x83F1, 173}, {0x83F2, 82}, {0x83F4, 2},
+    {0x83F8, 350}, {0x83F9, 135}, {0x83FD, 291}, {0x8401, 244}, {0x8403, 52}, {0x8404, 311},
+    {0x8406, 13}, {0x8407, 32}, {0x840A, 159}, {0x840B, 244}, {0x840C, 190}, {0x840D, 240},
+    {0x840E, 330}, {0x840F, 57}, {0x8411, 120}, {0x8418, 203}, {0x841C, 317}, {0x841D, 181},
+    {0x8424, 356}, {0x8425, 356}, {0x8426, 356}, {0x8427, 339}, {0x8428, 272}, {0x842C, 328},
+    {0x8431, 346}, {0x8435, 333}, {0x8438, 360}, {0x843C, 75}, {0x843D, 181}, {0x8446, 9},
+    {0x8449, 353}, {0x8451, 84}, {0x8457, 378}, {0x8459, 338}, {0x845A, 262}, {0x845B, 92},
+    {0x845C, 245}, {0x8461, 243}, {0x8463, 68}, {0x8466, 330}, {0x8469, 227}, {0x846B, 117},
+    {0x846C, 367}, {0x846D, 126}, {0x8471, 48}, {0x8473, 330}, {0x8475, 155}, {0x8476, 318},
+    {0x8477, 123}, {0x8478, 335}, {0x847A, 244}, {0x8482, 62}, {0x8487, 31}, {0x8488, 140},
+    {0x8489, 155}, {0x848B, 128}, {0x848C, 176}, {0x848E, 228}, {0x8490, 301}, {0x8497, 161},
+    {0x8499, 190}, {0x849C, 303}, {0x849E, 166}, {0x84A1, 8}, {0x84AF, 152}, {0x84B2, 243},
+    {0x84B4, 298}, {0x84B8, 380}, {0x84B9, 127}, {0x84BA, 125}, {0x84BC, 24}, {0x84BD, 77},
+    {0x84BF, 110}, {0x84C0, 305}, {0x84C1, 379}, {0x84C4, 345}, {0x84C6, 335}, {0x84C9, 265},
+    {0x84CA, 332}, {0x84CB, 88}, {0x84CD, 289}, {0x84D0, 267}, {0x84D1, 306}, {0x84D3, 10},
+    {0x84D6, 13}, {0x84DD, 160}, {0x84DF, 125}, {0x84E0, 166}, {0x84E3, 360}, {0x84E5, 356},
+    {0x84E6, 198}, {0x84EC, 234}, {0x84EE, 168}, {0x84F0, 335}, {0x84FC, 170}, {0x84FF, 345},
+    {0x8506, 173}, {0x850C, 302}, {0x8511, 194}, {0x8513, 184}, {0x8514, 19}, {0x8517, 378},
+    {0x851A, 330}, {0x851F, 50}, {0x8521, 22}, {0x8523, 128}, {0x8525, 48}, {0x852B, 212},
+    {0x852C, 291}, {0x852D, 355}, {0x8537, 247}, {0x8538, 69}, {0x8539, 168}, {0x853A, 172},
+    {0x853B, 149}, {0x853C, 1}, {0x853D, 13}, {0x8543, 80}, {0x8548, 348}, {0x8549, 129},
+    {0x854A, 269}, {0x8556, 254}, {0x8559, 122}, {0x855E, 397}, {0x8564, 269}, {0x8568, 137},
+    {0x8569, 58}, {0x856A, 334}, {0x856D, 339}, {0x8572, 244}, {0x8574, 363}, {0x8579, 332},
+    {0x857A, 125}, {0x857B, 115}, {0x857E, 164}, {0x8584, 9}, {0x8585, 110}, {0x8587, 330},
+    {0x858A, 125}, {0x858F, 354}, {0x8591, 128}, {0x8594, 247}, {0x859B, 347}, {0x859C, 13},
+    {0x85A4, 340}, {0x85A6, 127}, {0x85A8, 115}, {0x85A9, 272}, {0x85AA, 341}, {0x85AE, 301},
+    {0x85AF, 291}, {0x85B0, 348}, {0x85B7, 267}, {0x85B9, 308}, {0x85BA, 125}, {0x85C1, 91},
+    {0x85C9, 125}, {0x85CD, 160}, {0x85CF, 24}, {0x85D0, 193}, {0x85D3, 337}, {0x85D5, 226},
+    {0x85DC, 166}, {0x85DD, 354}, {0x85E4, 313}, {0x85E5, 352}, {0x85E9, 80}, {0x85EA, 301},
+    {0x85F7, 291}, {0x85F9, 1}, {0x85FA, 172}, {0x85FB, 368}, {0x85FF, 124}, {0x8605, 114},
+    {0x8606, 177}, {0x8607, 302}, {0x860A, 363}, {0x860B, 240}, {0x8611, 198}, {0x8616, 215},
+    {0x8617, 19}, {0x861A, 337}, {0x8627, 254}, {0x8629, 80}, {0x862D, 160}, {0x8638, 375},
+    {0x863C, 191}, {0x863F, 181}, {0x864D, 117}, {0x864E, 117}, {0x864F, 177}, {0x8650, 223},
+    {0x8651, 177}, {0x8654, 246}, {0x8655, 40}, {0x865A, 345}, {0x865B, 345}, {0x865C, 177},
+    {0x865E, 360}, {0x865F, 110}, {0x8662, 105}, {0x8667, 155}, {0x866B, 38}, {0x866C, 253},
+    {0x866E, 125}, {0x8671, 289}, {0x8679, 115}, {0x867A, 122}, {0x867B, 190}, {0x867C, 92},
+    {0x867D, 304}, {0x867E, 336}, {0x867F, 30}, {0x8680, 289}, {0x8681, 354}, {0x8682, 182},
+    {0x868A, 331}, {0x868B, 269}, {0x868C, 8}, {0x868D, 235}, {0x8693, 355}, {0x8695, 23},
+    {0x869C, 349}, {0x869D, 110}, {0x86A3, 96}, {0x86A4, 368}, {0x86A7, 130}, {0x86A8, 86},
+    {0x86A9, 37}, {0x86AA, 69}, {0x86AC, 337}, {0x86AF, 253}, {0x86B0, 359}, {0x86B1, 373},
+    {0x86B4, 359}, {0x86B5, 111}, {0x86B6, 108}, {0x86BA, 258}, {0x86C0, 384}, {0x86C4, 98},
+    {0x86C6, 254}, {0x86C7, 285}, {0x86C9, 173}, {0x86CA, 98}, {0x86CB, 57}, {0x86CE, 166},
+    {0x86CF, 36}, {0x86D0, 254}, {0x86D1, 199}, {0x86D4, 122}, {0x86D8, 351}, {0x86D9, 326},
+    {0x86DB, 384}, {0x86DE, 157}, {0x86DF, 129}, {0x86E4, 106}, {0x86E9, 252}, {0x86ED, 381},
+    {0x86EE, 184}, {0x86F0, 378}, {0x86F1, 126}, {0x86F2, 206}, {0x86F3, 299}, {0x86F4, 244},
+    {0x86F8, 284}, {0x86F9, 358}, {0x86FB, 323}, {0x86FE, 75}, {0x8700, 291}, {0x8702, 84},
+    {0x8703, 287}, {0x8706, 337}, {0x8707, 378}, {0x8708, 334}, {0x8709, 86}, {0x870A, 166},
+    {0x870D, 40}, {0x8712, 350}, {0x8713, 318}, {0x8715, 323}, {0x8717, 333}, {0x8718, 381},
+    {0x871A, 82}, {0x871C, 191}, {0x871E, 244}, {0x8721, 158}, {0x8722, 190}, {0x8723, 247},
+    {0x8725, 335}, {0x8729, 316}, {0x872E, 360}, {0x8731, 235}, {0x8734, 354}, {0x8737, 255},
+    {0x873B, 251}, {0x873E, 105}, {0x873F, 328}, {0x8747, 356}, {0x8748, 105}, {0x8749, 31},
+    {0x874C, 144}, {0x874E, 340}, {0x8753, 360}, {0x8755, 289}, {0x8757, 121}, {0x8759, 14},
+    {0x8760, 86}, {0x8763, 359}, {0x8764, 253}, {0x8765, 186}, {0x8766, 336}, {0x8768, 289},
+    {0x876E, 86}, {0x8770, 155}, {0x8774, 117}, {0x8776, 65}, {0x8778, 333}, {0x877B, 204},
+    {0x877C, 176}, {0x877D, 45}, {0x877E, 265}, {0x8782, 161}, {0x8783, 230}, {0x8785, 335},
+    {0x8788, 361}, {0x878B, 301}, {0x878D, 265}, {0x8793, 250}, {0x8797, 310}, {0x879E, 182},
+    {0x879F, 196}, {0x87A2, 356}, {0x87A8, 184}, {0x87AB, 289}, {0x87AC, 25}, {0x87AD, 37},
+    {0x87AF, 4}, {0x87B3, 310}, {0x87B5, 237}, {0x87BA, 181}, {0x87BB, 176}, {0x87BD, 382},
+    {0x87C0, 293}, {0x87C6, 182}, {0x87C8, 105}, {0x87CA, 186}, {0x87CB, 335}, {0x87D1, 376},
+    {0x87D2, 185}, {0x87D3, 338}, {0x87DB, 234}, {0x87E0, 229}, {0x87E5, 121}, {0x87EA, 122},
+    {0x87EC, 31}, {0x87EE, 282}, {0x87EF, 206}, {0x87F2, 38}, {0x87F9, 340}, {0x87FB, 354},
+    {0x87FE, 31}, {0x8803, 181}, {0x8805, 356}, {0x880A, 168}, {0x880D, 340}, {0x8813, 190},
+    {0x8814, 110}, {0x8815, 267}, {0x8816, 124}, {0x881B, 194}, {0x881F, 158}, {0x8821, 166},
+    {0x8822, 45}, {0x8823, 166}, {0x8831, 98}, {0x8832, 136}, {0x8836, 23}, {0x8839, 70},
+    {0x883B, 184}, {0x883C, 254}, {0x8840, 347}, {0x8844, 221}, {0x8845, 341}, {0x884C, 342},
+    {0x884D, 350}, {0x8853, 291}, {0x8854, 337}, {0x8857, 130}, {0x8859, 349}, {0x885B, 330},
+    {0x885D, 38}, {0x8861, 114}, {0x8862, 254}, {0x8863, 354}, {0x8864, 354}, {0x8865, 20},
+    {0x8868, 15}, {0x8869, 29}, {0x886B, 282}, {0x886C, 35}, {0x886E, 104}, {0x8870, 293},
+    {0x8872, 202}, {0x8877, 382}, {0x8879, 381}, {0x887D, 262}, {0x887E, 250}, {0x887F, 131},
+    {0x8881, 361}, {0x8882, 188}, {0x8884, 4}, {0x8885, 214}, {0x8888, 126}, {0x888B, 56},
+    {0x888D, 231}, {0x8892, 309}, {0x8896, 344}, {0x889C, 326}, {0x889E, 104}, {0x88A2, 229},
+    {0x88A4, 186}, {0x88AB, 10}, {0x88AD, 335}, {0x88B1, 86}, {0x88B7, 245}, {0x88BC, 92},
+    {0x88C1, 22}, {0x88C2, 171}, {0x88C5, 388}, {0x88C6, 58}, {0x88C9, 146}, {0x88CA, 214},
+    {0x88CE, 36}, {0x88D2, 242}, {0x88D4, 354}, {0x88D5, 360}, {0x88D8, 253}, {0x88D9, 257},
+    {0x88DC, 20}, {0x88DD, 388}, {0x88DF, 280}, {0x88E1, 166}, {0x88E2, 168}, {0x88E3, 168},
+    {0x88E4, 150}, {0x88E5, 127}, {0x88E8, 13}, {0x88EF, 39}, {0x88F0, 74}, {0x88F1, 15},
+    {0x88F3, 283}, {0x88F4, 232}, {0x88F8, 181}, {0x88F9, 105}, {0x88FC, 314}, {0x88FD, 381},
+    {0x88FE, 135}, {0x8902, 99}, {0x8907, 86}, {0x890A, 14}, {0x8910, 111}, {0x8912, 9},
+    {0x8913, 9}, {0x8915, 360}, {0x8919, 10}, {0x891A, 40}, {0x891B, 177}, {0x8921, 55},
+    {0x8925, 267}, {0x892A, 323}, {0x892B, 37}, {0x8930, 246}, {0x8932, 150}, {0x8934, 160},
+    {0x8936, 378}, {0x8938, 177}, {0x893B, 340}, {0x893D, 330}, {0x8941, 247}, {0x8944, 338},
+    {0x8956, 4}, {0x895E, 13}, {0x895F, 131}, {0x8960, 58}, {0x8964, 160}, {0x8966, 267},
+    {0x896A, 326}, {0x896C, 6}, {0x896F, 35}, {0x8972, 335}, {0x897B, 229}, {0x897F, 335},
+    {0x8981, 352}, {0x8983, 309}, {0x8986, 86}, {0x898B, 127}, {0x898F, 103}, {0x8993, 191},
+    {0x8996, 289}, {0x899C, 316}, {0x89A6, 360}, {0x89AA, 250}, {0x89AC, 125}, {0x89B2, 131},
+    {0x89BA, 137}, {0x89BD, 160}, {0x89C0, 101}, {0x89C1, 127}, {0x89C2, 101}, {0x89C4, 103},
+    {0x89C5, 191}, {0x89C6, 289}, {0x89C7, 31}, {0x89C8, 160}, {0x89C9, 137}, {0x89CA, 125},
+    {0x89CB, 335}, {0x89CC, 62}, {0x89CE, 360}, {0x89CF, 97}, {0x89D0, 131}, {0x89D1, 254},
+    {0x89D2, 129}, {0x89D4, 131}, {0x89D6, 137}, {0x89DA, 98}, {0x89DC, 392}, {0x89DE, 283},
+    {0x89E3, 130}, {0x89E5, 96}, {0x89E6, 40}, {0x89EB, 302}, {0x89EF, 381}, {0x89F3, 117},
+    {0x89F4, 283}, {0x89F8, 40}, {0x89FC, 137}, {0x8A00, 350}, {0x8A02, 66}, {0x8A03, 86},
+    {0x8A07, 115}, {0x8A08, 125}, {0x8A0A, 348}, {0x8A0C, 115}, {0x8A0E, 311}, {0x8A0F, 345},
+    {0x8A10, 130}, {0x8A11, 354}, {0x8A13, 348}, {0x8A15, 282}, {0x8A16, 244}, {0x8A17, 325},
+    {0x8A18, 125}, {0x8A1B, 75}, {0x8A1D, 349}, {0x8A1F, 300}, {0x8A22, 341}, {0x8A23, 137},
+    {0x8A25, 207}, {0x8A2A, 81}, {0x8A2D, 285}, {0x8A31, 345}, {0x8A34, 302}, {0x8A36, 111},
+    {0x8A3A, 379}, {0x8A3B, 384}, {0x8A3C, 380}, {0x8A3E, 392}, {0x8A41, 98}, {0x8A46, 62},
+    {0x8A48, 166}, {0x8A50, 373}, {0x8A54, 377}, {0x8A55, 240}, {0x8A56, 13}, {0x8A5B, 395},
+    {0x8A5E, 47}, {0x8A60, 358}, {0x8A62, 348}, {0x8A63, 354}, {0x8A66, 289}, {0x8A68, 339},
+    {0x8A69, 289}, {0x8A6B, 29}, {0x8A6C, 97}, {0x8A6D, 103}, {0x8A6E, 255}, {0x8A70, 130},
+    {0x8A71, 118}, {0x8A72, 88}, {0x8A73, 338}, {0x8A79, 375}, {0x8A7B, 75}, {0x8A7C, 122},
+    {0x8A85, 384}, {0x8A87, 151}, {0x8A89, 360}, {0x8A8A, 313}, {0x8A8C, 381}, {0x8A8D, 262},
+    {0x8A91, 154}, {0x8A93, 289}, {0x8A95, 57}, {0x8A98, 359}, {0x8A9A, 248}, {0x8A9E, 360},
+    {0x8AA0, 36}, {0x8AA1, 130}, {0x8AA3, 334}, {0x8AA4, 334}, {0x8AA5, 91}, {0x8AA6, 300},
+    {0x8AA7, 20}, {0x8AA8, 122}, {0x8AAA, 298}, {0x8AB0, 296}, {0x8AB2, 144}, {0x8AB6, 304},
+    {0x8AB9, 82}, {0x8ABC, 354}, {0x8ABF, 64}, {0x8AC2, 31}, {0x8AC4, 390}, {0x8AC7, 309},
+    {0x8AC9, 330}, {0x8ACB, 251}, {0x8ACD, 380}, {0x8AD2, 169}, {0x8AD6, 180}, {0x8ADB, 360},
+    {0x8ADC, 65}, {0x8AE6, 62}, {0x8AE7, 340}, {0x8AEB, 127}, {0x8AED, 360}, {0x8AEE, 392},
+    {0x8AF1, 122}, {0x8AF3, 2}, {0x8AF6, 35}, {0x8AF7, 84}, {0x8AF8, 384}, {0x8AFA, 350},
+    {0x8AFC, 346}, {0x8AFE, 224}, {0x8B00, 199}, {0x8B01, 353}, {0x8B02, 330}, {0x8B04, 313},
+    {0x8B07, 127}, {0x8B0A, 121}, {0x8B0E, 191}, {0x8B10, 191}, {0x8B17, 8}, {0x8B19, 246},
+    {0x8B1B, 128}, {0x8B1D, 340}, {0x8B20, 352}, {0x8B26, 251}, {0x8B28, 198}, {0x8B2B, 378},
+    {0x8B2C, 197}, {0x8B39, 131}, {0x8B41, 118}, {0x8B46, 335}, {0x8B49, 380}, {0x8B4E, 137},
+    {0x8B4F, 125}, {0x8B58, 289}, {0x8B59, 248}, {0x8B5A, 309}, {0x8B5C, 243}, {0x8B5F, 368},
+    {0x8B66, 132}, {0x8B6B, 375}, {0x8B6C, 235}, {0x8B6F, 354}, {0x8B70, 354}, {0x8B74, 246},
+    {0x8B77, 117}, {0x8B7D, 360}, {0x8B80, 70}, {0x8B8A, 14}, {0x8B92, 31}, {0x8B93, 259},
+    {0x8B96, 35}, {0x8B9A, 366}, {0x8B9C, 58}, {0x8BA0, 350}, {0x8BA1, 125}, {0x8BA2, 66},
+    {0x8BA3, 86}, {0x8BA4, 262}, {0x8BA5, 125}, {0x8BA6, 130}, {0x8BA7, 115}, {0x8BA8, 311},
+    {0x8BA9, 259}, {0x8BAA, 282}, {0x8BAB, 244}, {0x8BAD, 348}, {0x8BAE, 354}, {0x8BAF, 348},
+    {0x8BB0, 125}, {0x8BB2, 128}, {0x8BB3, 122}, {0x8BB4, 226}, {0x8BB5, 135}, {0x8BB6, 349},
+    {0x8BB7, 207}, {0x8BB8, 345}, {0x8BB9, 75}, {0x8BBA, 180}, {0x8BBC, 300}, {0x8BBD, 84},
+    {0x8BBE, 285}, {0x8BBF, 81}, {0x8BC0, 137}, {0x8BC1, 380}, {0x8BC2, 98}, {0x8BC3, 111},
+    {0x8BC4, 240}, {0x8BC5, 395}, {0x8BC6, 289}, {0x8BC8, 373}, {0x8BC9, 302}, {0x8BCA, 379},
+    {0x8BCB, 62}, {0x8BCC, 383}, {0x8BCD, 47}, {0x8BCE, 254}, {0x8BCF, 377}, {0x8BD1, 354},
+    {0x8BD2, 354}, {0x8BD3, 154}, {0x8BD4, 164}, {0x8BD5, 289}, {0x8BD6, 99}, {0x8BD7, 289},
+    {0x8BD8, 125}, {0x8BD9, 122}, {0x8BDA, 36}, {0x8BDB, 384}, {0x8BDC, 287}, {0x8BDD, 118},
+    {0x8BDE, 57}, {0x8BDF, 97}, {0x8BE0, 255}, {0x8BE1, 103}, {0x8BE2, 348}, {0x8BE3, 354},
+    {0x8BE4, 380}, {0x8BE5, 88}, {0x8BE6, 338}, {0x8BE7, 29}, {0x8BE8, 123}, {0x8BE9, 345},
+    {0x8BEB, 130}, {0x8BEC, 334}, {0x8BED, 360}, {0x8BEE, 248}, {0x8BEF, 334}, {0x8BF0, 91},
+    {0x8BF1, 359}, {0x8BF2, 122}, {0x8BF3, 154}, {0x8BF4, 298}, {0x8BF5, 300}, {0x8BF6, 76},
+    {0x8BF7, 251}, {0x8BF8, 384}, {0x8BF9, 394}, {0x8BFA, 224}, {0x8BFB, 70}, {0x8BFC, 391},
+    {0x8BFD, 82}, {0x8BFE, 144}, {0x8BFF, 330}, {0x8C00, 360}, {0x8C01, 286}, {0x8C02, 287},
+    {0x8C03, 64}, {0x8C04, 31}, {0x8C05, 169}, {0x8C06, 390}, {0x8C07, 304}, {0x8C08, 309},
+    {0x8C0A, 354}, {0x8C0B, 199}, {0x8C0C, 35}, {0x8C0D, 65}, {0x8C0E, 121}, {0x8C0F, 127},
+    {0x8C10, 340}, {0x8C11, 347}, {0x8C12, 353}, {0x8C13, 330}, {0x8C14, 75}, {0x8C15, 360},
+    {0x8C16, 346}, {0x8C17, 31}, {0x8C18, 392}, {0x8C19, 2}, {0x8C1A, 350}, {0x8C1B, 62},
+    {0x8C1C, 191}, {0x8C1D, 236}, {0x8C1F, 198}, {0x8C20, 58}, {0x8C21, 302}, {0x8C22, 340},
+    {0x8C23, 352}, {0x8C24, 8}, {0x8C25, 289}, {0x8C26, 246}, {0x8C27, 191}, {0x8C28, 131},
+    {0x8C29, 184}, {0x8C2A, 378}, {0x8C2B, 127}, {0x8C2C, 197}, {0x8C2D, 309}, {0x8C2E, 371},
+    {0x8C2F, 248}, {0x8C30, 160}, {0x8C31, 243}, {0x8C32, 137}, {0x8C33, 350}, {0x8C34, 246},
+    {0x8C35, 375}, {0x8C36, 35}, {0x8C37, 98}, {0x8C3F, 335}, {0x8C41, 124}, {0x8C46, 69},
+    {0x8C47, 128}, {0x8C48, 244}, {0x8C49, 289}, {0x8C4C, 328}, {0x8C4E, 291}, {0x8C50, 84},
+    {0x8C54, 350}, {0x8C55, 289}, {0x8C5A, 324}, {0x8C61, 338}, {0x8C62, 120}, {0x8C6A, 110},
+    {0x8C6B, 360}, {0x8C6C, 384}, {0x8C6D, 126}, {0x8C73, 17}, {0x8C78, 381}, {0x8C79, 9},
+    {0x8C7A, 30}, {0x8C82, 64}, {0x8C85, 344}, {0x8C89, 110}, {0x8C8A, 198}, {0x8C8C, 186},
+    {0x8C8D, 166}, {0x8C93, 186}, {0x8C94, 235}, {0x8C98, 198}, {0x8C9D, 10}, {0x8C9E, 379},
+    {0x8CA0, 86}, {0x8CA1, 22}, {0x8CA2, 96}, {0x8CA7, 239}, {0x8CA8, 124}, {0x8CA9, 80},
+    {0x8CAA, 309}, {0x8CAB, 101}, {0x8CAC, 369}, {0x8CAF, 384}, {0x8CB2, 392}, {0x8CB3, 78},
+    {0x8CB4, 103}, {0x8CB6, 14}, {0x8CB7, 183}, {0x8CB8, 56}, {0x8CBB, 82}, {0x8CBC, 317},
+    {0x8CBD, 354}, {0x8CBF, 186}, {0x8CC0, 111}, {0x8CC1, 13}, {0x8CC2, 177}, {0x8CC3, 172},
+    {0x8CC4, 122}, {0x8CC5, 88}, {0x8CC7, 392}, {0x8CC8, 126}, {0x8CCA, 370}, {0x8CD1, 379},
+    {0x8CD2, 285}, {0x8CD3, 17}, {0x8CDC, 47}, {0x8CDE, 283}, {0x8CE0, 232}, {0x8CE1, 95},
+    {0x8CE2, 337}, {0x8CE3, 183}, {0x8CE4, 127}, {0x8CE6, 86}, {0x8CEA, 381}, {0x8CEC, 376},
+    {0x8CED, 70}, {0x8CF4, 159}, {0x8CF8, 288}, {0x8CFA, 387}, {0x8CFB, 86}, {0x8CFC, 97},
+    {0x8CFD, 273}, {0x8D05, 389}, {0x8D08, 372}, {0x8D0A, 366}, {0x8D0D, 282}, {0x8D0F, 356},
+    {0x8D13, 367}, {0x8D16, 291}, {0x8D17, 350}, {0x8D1B, 89}, {0x8D1D, 10}, {0x8D1E, 379},
+    {0x8D1F, 86}, {0x8D21, 96}, {0x8D22, 22}, {0x8D23, 369}, {0x8D24, 337}, {0x8D25, 6},
+    {0x8D26, 376}, {0x8D27, 124}, {0x8D28, 381}, {0x8D29, 80}, {0x8D2A, 309}, {0x8D2B, 239},
+    {0x8D2C, 14}, {0x8D2D, 97}, {0x8D2E, 384}, {0x8D2F, 101}, {0x8D30, 78}, {0x8D31, 127},
+    {0x8D32, 11}, {0x8D33, 289}, {0x8D34, 317}, {0x8D35, 103}, {0x8D36, 154}, {0x8D37, 56},
+    {0x8D38, 186}, {0x8D39, 82}, {0x8D3A, 111}, {0x8D3B, 354}, {0x8D3C, 370}, {0x8D3D, 381},
+    {0x8D3E, 126}, {0x8D3F, 122}, {0x8D40, 392}, {0x8D41, 172}, {0x8D42, 177}, {0x8D43, 367},
+    {0x8D44, 392}, {0x8D45, 88}, {0x8D46, 131}, {0x8D47, 253}, {0x8D48, 379}, {0x8D49, 159},
+    {0x8D4A, 285}, {0x8D4B, 86}, {0x8D4C, 70}, {0x8D4D, 125}, {0x8D4E, 291}, {0x8D4F, 283},
+    {0x8D50, 47}, {0x8D53, 95}, {0x8D54, 232}, {0x8D55, 57}, {0x8D56, 159}, {0x8D58, 389},
+    {0x8D59, 86}, {0x8D5A, 387}, {0x8D5B, 273}, {0x8D5C, 369}, {0x8D5D, 350}, {0x8D5E, 366},
+    {0x8D60, 372}, {0x8D61, 282}, {0x8D62, 356}, {0x8D63, 89}, {0x8D64, 37}, {0x8D66, 285},
+    {0x8D67, 204}, {0x8D6B, 111}, {0x8D6D, 378}, {0x8D70, 394}, {0x8D73, 134}, {0x8D74, 86},
+    {0x8D75, 377}, {0x8D76, 89}, {0x8D77, 244}, {0x8D81, 35}, {0x8D84, 135}, {0x8D85, 33},
+    {0x8D8A, 362}, {0x8D8B, 254}, {0x8D91, 392}, {0x8D94, 171}, {0x8D95, 89}, {0x8D99, 377},
+    {0x8D9F, 310}, {0x8DA3, 254}, {0x8DA8, 254}, {0x8DB1, 366}, {0x8DB3, 395}, {0x8DB4, 227},
+    {0x8DB5, 9}, {0x8DB8, 73}, {0x8DBA, 86}, {0x8DBC, 127}, {0x8DBE, 381}, {0x8DBF, 307},
+    {0x8DC3, 362}, {0x8DC4, 247}, {0x8DC6, 308}, {0x8DCB, 5}, {0x8DCC, 65}, {0x8DCE, 325},
+    {0x8DCF, 126}, {0x8DD1, 231}, {0x8DD6, 381}, {0x8DD7, 86}, {0x8DDA, 282}, {0x8DDB, 19},
+    {0x8DDD, 135}, {0x8DDE, 166}, {0x8DDF, 94}, {0x8DE1, 125}, {0x8DE3, 337}, {0x8DE4, 129},
+    {0x8DE6, 384}, {0x8DE8, 151}, {0x8DEA, 103}, {0x8DEB, 252}, {0x8DEC, 155}, {0x8DEF, 177},
+    {0x8DF3, 316}, {0x8DF5, 127}, {0x8DF7, 248}, {0x8DF8, 13}, {0x8DF9, 337}, {0x8DFA, 74},
+    {0x8DFB, 125}, {0x8DFC, 135}, {0x8DFD, 125}, {0x8E05, 347}, {0x8E09, 169}, {0x8E0A, 358},
+    {0x8E0C, 39}, {0x8E0F, 307}, {0x8E10, 127}, {0x8E14, 46}, {0x8E1D, 119}, {0x8E1E, 135},
+    {0x8E1F, 37}, {0x8E21, 255}, {0x8E22, 314}, {0x8E23, 19}, {0x8E29, 22}, {0x8E2A, 393},
+    {0x8E2B, 234}, {0x8E2C, 381}, {0x8E2E, 63}, {0x8E2F, 381}, {0x8E31, 74}, {0x8E34, 358},
+    {0x8E35, 382}, {0x8E39, 41}, {0x8E3A, 127}, {0x8E3D, 135}, {0x8E40, 65}, {0x8E41, 236},
+    {0x8E42, 266}, {0x8E44, 314}, {0x8E47, 127}, {0x8E48, 59}, {0x8E49, 54}, {0x8E4A, 244},
+    {0x8E4B, 307}, {0x8E51, 215}, {0x8E52, 184}, {0x8E55, 13}, {0x8E59, 50}, {0x8E5F, 125},
+    {0x8E63, 229}, {0x8E64, 393}, {0x8E66, 12}, {0x8E69, 16}, {0x8E6C, 61}, {0x8E6D, 28},
+    {0x8E6F, 80}, {0x8E70, 40}, {0x8E72, 73}, {0x8E74, 50}, {0x8E76, 137}, {0x8E7A, 248},
+    {0x8E7C, 243}, {0x8E7F, 51}, {0x8E81, 368}, {0x8E82, 55}, {0x8E85, 384}, {0x8E87, 40},
+    {0x8E89, 73}, {0x8E8A, 39}, {0x8E8B, 125}, {0x8E8D, 362}, {0x8E8F, 172}, {0x8E90, 171},
+    {0x8E91, 381}, {0x8E93, 381}, {0x8E94, 31}, {0x8E9C, 396}, {0x8E9E, 340}, {0x8EA1, 215},
+    {0x8EAA, 172}, {0x8EAB, 287}, {0x8EAC, 96}, {0x8EAF, 254}, {0x8EB2, 74}, {0x8EBA, 310},
+    {0x8EC0, 254}, {0x8ECA, 34}, {0x8ECB, 349}, {0x8ECC, 103}, {0x8ECD, 138}, {0x8ECE, 330},
+    {0x8ECF, 362}, {0x8ED2, 346}, {0x8ED4, 262}, {0x8EDB, 75}, {0x8EDF, 268}, {0x8EF8, 383},
+    {0x8EFB, 144}, {0x8EFC, 354}, {0x8EFE, 289}, {0x8F03, 129}, {0x8F09, 365}, {0x8F0A, 381},
+    {0x8F12, 378}, {0x8F13, 328}, {0x8F14, 86}, {0x8F15, 251}, {0x8F1B, 169}, {0x8F1C, 392},
+    {0x8F1D, 122}, {0x8F1E, 329}, {0x8F1F, 46}, {0x8F25, 104}, {0x8F26, 212}, {0x8F29, 10},
+    {0x8F2A, 180}, {0x8F2F, 125}, {0x8F33, 49}, {0x8F38, 291}, {0x8F3B, 86}, {0x8F3E, 375},
+    {0x8F3F, 360}, {0x8F42, 98}, {0x8F44, 336}, {0x8F45, 361}, {0x8F49, 387}, {0x8F4D, 378},
+    {0x8F4E, 129}, {0x8F54, 172}, {0x8F5F, 115}, {0x8F61, 232}, {0x8F66, 34}, {0x8F67, 349},
+    {0x8F68, 103}, {0x8F69, 346}, {0x8F6B, 262}, {0x8F6C, 387}, {0x8F6D, 75}, {0x8F6E, 180},
+    {0x8F6F, 268}, {0x8F70, 115}, {0x8F71, 98}, {0x8F72, 144}, {0x8F73, 177}, {0x8F74, 383},
+    {0x8F75, 381}, {0x8F76, 354}, {0x8F77, 117}, {0x8F78, 379}, {0x8F79, 166}, {0x8F7A, 352},
+    {0x8F7B, 251}, {0x8F7C, 289}, {0x8F7D, 365}, {0x8F7E, 381}, {0x8F7F, 129}, {0x8F81, 255},
+    {0x8F82, 177}, {0x8F83, 129}, {0x8F84, 378}, {0x8F85, 86}, {0x8F86, 169}, {0x8F87, 212},
+    {0x8F88, 10}, {0x8F89, 122}, {0x8F8A, 104}, {0x8F8B, 329}, {0x8F8D, 46}, {0x8F8E, 392},
+    {0x8F8F, 49}, {0x8F90, 86}, {0x8F91, 125}, {0x8F93, 291}, {0x8F94, 232}, {0x8F95, 361},
+    {0x8F96, 336}, {0x8F97, 212}, {0x8F98, 177}, {0x8F99, 378}, {0x8F9A, 172}, {0x8F9B, 341},
+    {0x8F9C, 98}, {0x8F9E, 47}, {0x8F9F, 235}, {0x8FA3, 158}, {0x8FA6, 7}, {0x8FA8, 14},
+    {0x8FA9, 14}, {0x8FAB, 14}, {0x8FAD, 47}, {0x8FAE, 14}, {0x8FAF, 14}, {0x8FB0, 35},
+    {0x8FB1, 267}, {0x8FB2, 219}, {0x8FB6, 46}, {0x8FB9, 14}, {0x8FBD, 170}, {0x8FBE, 55},
+    {0x8FC1, 246}, {0x8FC2, 360}, {0x8FC4, 244}, {0x8FC5, 348}, {0x8FC6, 354}, {0x8FC7, 105},
+    {0x8FC8, 183}, {0x8FCE, 356}, {0x8FD0, 363}, {0x8FD1, 131}, {0x8FD3, 349}, {0x8FD4, 80},
+    {0x8FD5, 334}, {0x8FD8, 107}, {0x8FD9, 378}, {0x8FDB, 131}, {0x8FDC, 361}, {0x8FDD, 330},
+    {0x8FDE, 168}, {0x8FDF, 37}, {0x8FE2, 316}, {0x8FE4, 354}, {0x8FE5, 133}, {0x8FE6, 126},
+    {0x8FE8, 56}, {0x8FE9, 78}, {0x8FEA, 62}, {0x8FEB, 241}, {0x8FED, 65}, {0x8FEE, 369},
+    {0x8FF0, 291}, {0x8FF3, 132}, {0x8FF4, 122}, {0x8FF7, 191}, {0x8FF8, 12}, {0x8FF9, 125},
+    {0x8FFA, 203}, {0x8FFD, 389}, {0x9000, 323}, {0x9001, 300}, {0x9002, 289}, {0x9003, 311},
+    {0x9004, 230}, {0x9005, 116}, {0x9006, 211}, {0x9009, 346}, {0x900A, 348}, {0x900B, 20},
+    {0x900D, 339}, {0x900F, 320}, {0x9010, 384}, {0x9011, 253}, {0x9012, 62}, {0x9014, 321},
+    {0x9015, 132}, {0x9016, 314}, {0x9017, 69}, {0x9019, 378}, {0x901A, 319}, {0x901B, 102},
+    {0x901D, 289}, {0x901E, 36}, {0x901F, 302}, {0x9020, 368}, {0x9021, 257}, {0x9022, 84},
+    {0x9023, 168}, {0x9026, 166}, {0x902D, 120}, {0x902E, 56}, {0x902F, 177}, {0x9031, 383},
+    {0x9032, 131}, {0x9035, 155}, {0x9036, 330}, {0x9038, 354}, {0x903B, 181}, {0x903C, 13},
+    {0x903E, 360}, {0x9041, 73}, {0x9042, 304}, {0x9044, 42}, {0x9047, 360}, {0x904A, 359},
+    {0x904B, 363}, {0x904D, 14}, {0x904E, 105}, {0x904F, 75}, {0x9050, 336}, {0x9051, 121},
+    {0x9052, 253}, {0x9053, 59}, {0x9054, 55}, {0x9055, 330}, {0x9057, 354}, {0x9058, 97},
+    {0x9059, 352}, {0x905B, 174}, {0x905C, 348}, {0x905D, 307}, {0x905E, 62}, {0x9060, 361},
+    {0x9062, 307}, {0x9063, 246}, {0x9065, 352}, {0x9068, 4}, {0x9069, 289}, {0x906D, 368},
+    {0x906E, 378}, {0x9072, 37}, {0x9074, 172}, {0x9075, 398}, {0x9077, 246}, {0x9078, 346},
+    {0x907A, 354}, {0x907C, 170}, {0x907D, 135}, {0x907F, 13}, {0x9080, 352}, {0x9081, 183},
+    {0x9082, 340}, {0x9083, 304}, {0x9084, 107}, {0x9087, 78}, {0x9088, 193}, {0x908A, 14},
+    {0x908B, 158}, {0x908F, 181}, {0x9090, 166}, {0x9091, 354}, {0x9093, 61}, {0x9095, 358},
+    {0x9097, 108}, {0x9099, 185}, {0x909B, 252}, {0x909D, 154}, {0x90A1, 81}, {0x90A2, 342},
+    {0x90A3, 202}, {0x90A6, 8}, {0x90AA, 340}, {0x90AC, 334}, {0x90AE, 359}, {0x90AF, 108},
+    {0x90B0, 308}, {0x90B1, 253}, {0x90B3, 235}, {0x90B4, 18}, {0x90B5, 284}, {0x90B6, 10},
+    {0x90B8, 62}, {0x90B9, 394}, {0x90BA, 353}, {0x90BB, 172}, {0x90BE, 384}, {0x90C1, 360},
+    {0x90C3, 111}, {0x90C4, 249}, {0x90C5, 381}, {0x90C7, 120}, {0x90CA, 129}, {0x90CE, 161},
+    {0x90CF, 126}, {0x90D0, 152}, {0x90D1, 380}, {0x90D3, 363}, {0x90D7, 335}, {0x90DB, 86},
+    {0x90DC, 91}, {0x90DD, 110}, {0x90E1, 138}, {0x90E2, 356}, {0x90E6, 166}, {0x90E7, 363},
+    {0x90E8, 20}, {0x90EB, 235}, {0x90ED, 105}, {0x90EF, 309}, {0x90F4, 35}, {0x90F5, 359},
+    {0x90F8, 57}, {0x90FD, 69}, {0x90FE, 350}, {0x9102, 75}, {0x9104, 136}, {0x9109, 338},
+    {0x9112, 394}, {0x9117, 110}, {0x9118, 358}, {0x9119, 13}, {0x911E, 355}, {0x9122, 350},
+    {0x9123, 376}, {0x9127, 61}, {0x912D, 380}, {0x912F, 282}, {0x9130, 172}, {0x9131, 241},
+    {0x9134, 353}, {0x9139, 394}, {0x9143, 173}, {0x9146, 84}, {0x9148, 166}, {0x9149, 359},
+    {0x914A, 66}, {0x914B, 253}, {0x914C, 391}, {0x914D, 232}, {0x914E, 383}, {0x914F, 354},
+    {0x9150, 89}, {0x9152, 134}, {0x9157, 345}, {0x915A, 83}, {0x915D, 363}, {0x915E, 308},
+    {0x9161, 325}, {0x9162, 50}, {0x9163, 108}, {0x9164, 98}, {0x9165, 302}, {0x9169, 196},
+    {0x916A, 162}, {0x916C, 39}, {0x916E, 319}, {0x916F, 381}, {0x9170, 337}, {0x9171, 128},
+    {0x9172, 36}, {0x9174, 321}, {0x9175, 129}, {0x9176, 188}, {0x9177, 150}, {0x9178, 303},
+    {0x9179, 164}, {0x917D, 350}, {0x917E, 281}, {0x917F, 213}, {0x9183, 350}, {0x9185, 232},
+    {0x9187, 45}, {0x9189, 397}, {0x918B, 50}, {0x918C, 156}, {0x918D, 314}, {0x9190, 117},
+    {0x9191, 345}, {0x9192, 342}, {0x919A, 191}, {0x919B, 255}, {0x919C, 39}, {0x919E, 363},
+    {0x91A2, 107}, {0x91A3, 310}, {0x91AA, 162}, {0x91AB, 354}, {0x91AC, 128}, {0x91AD, 20},
+    {0x91AE, 129}, {0x91AF, 335}, {0x91B1, 79}, {0x91B4, 166}, {0x91B5, 135}, {0x91BA, 348},
+    {0x91C0, 213}, {0x91C1, 341}, {0x91C5, 350}, {0x91C6, 14}, {0x91C7, 22}, {0x91C9, 359},
+    {0x91CA, 289}, {0x91CB, 289}, {0x91CC, 166}, {0x91CD, 382}, {0x91CE, 353}, {0x91CF, 169},
+    {0x91D0, 335}, {0x91D1, 131}, {0x91D7, 377}, {0x91D8, 66}, {0x91D9, 241}, {0x91DC, 86},
+    {0x91DD, 379}, {0x91E3, 64}, {0x91E6, 149}, {0x91E7, 42}, {0x91E9, 80}, {0x91ED, 90},
+    {0x91F5, 30}, {0x9207, 86}, {0x9209, 202}, {0x920D, 73}, {0x9210, 246}, {0x9211, 7},
+    {0x9214, 33}, {0x9215, 218}, {0x921E, 138}, {0x9223, 88}, {0x9234, 173}, {0x9237, 98},
+    {0x9238, 19}, {0x9239, 235}, {0x923D, 20}, {0x923E, 359}, {0x923F, 315}, {0x9240, 126},
+    {0x9245, 135}, {0x9249, 346}, {0x924B, 9}, {0x924D, 13}, {0x9251, 19}, {0x9257, 246},
+    {0x925A, 174}, {0x925B, 246}, {0x9264, 97}, {0x9274, 127}, {0x9278, 129}, {0x927B, 181},
+    {0x927C, 18}, {0x9280, 355}, {0x9285, 319}, {0x928E, 252}, {0x9291, 337}, {0x9293, 255},
+    {0x9296, 384}, {0x9298, 196}, {0x929C, 337}, {0x92A8, 2}, {0x92AC, 143}, {0x92AE, 178},
+    {0x92B2, 108}, {0x92B3, 269}, {0x92B7, 339}, {0x92BB, 314}, {0x92BC, 54}, {0x92C1, 177},
+    {0x92C5, 341}, {0x92C7, 10}, {0x92C8, 334}, {0x92D2, 84}, {0x92E4, 40}, {0x92EA, 243},
+    {0x92F0, 166}, {0x92F8, 135}, {0x92FC, 90}, {0x9304, 177}, {0x9310, 389}, {0x9315, 156},
+    {0x9318, 44}, {0x9319, 392}, {0x931A, 380}, {0x9320, 66}, {0x9321, 244}, {0x9322, 246},
+    {0x9326, 131}, {0x9328, 186}, {0x932B, 335}, {0x932E, 98}, {0x932F, 54}, {0x9333, 190},
+    {0x9336, 15}, {0x933E, 366}, {0x934A, 168}, {0x934B, 105}, {0x934D, 70}, {0x9354, 75},
+    {0x935A, 351}, {0x935B, 71}, {0x9365, 249}, {0x936A, 199}, {0x936C, 248}, {0x9370, 120},
+    {0x9375, 127}, {0x937E, 382}, {0x9382, 188}, {0x938A, 8}, {0x938F, 174}, {0x9394, 265},
+    {0x9396, 306}, {0x9397, 247}, {0x9398, 166}, {0x939A, 44}, {0x93A2, 334}, {0x93AC, 110},
+    {0x93AE, 379}, {0x93B0, 354}, {0x93B3, 215}, {0x93C3, 395}, {0x93C8, 168}, {0x93CA, 4},
+    {0x93CD, 181}, {0x93D1, 62}, {0x93D6, 4}, {0x93D7, 147}, {0x93D8, 247}, {0x93DC, 310},
+    {0x93DD, 184}, {0x93DF, 31}, {0x93E1, 132}, {0x93E2, 15}, {0x93E4, 176}, {0x93E8, 366},
+    {0x93FD, 344}, {0x9403, 206}, {0x9418, 382}, {0x942B, 136}, {0x942E, 168}, {0x9432, 391},
+    {0x9433, 164}, {0x9435, 317}, {0x9438, 74}, {0x943A, 58}, {0x943E, 10}, {0x9444, 384},
+    {0x9451, 127}, {0x9452, 127}, {0x9460, 298}, {0x9463, 15}, {0x9464, 9}, {0x946A, 177},
+    {0x946B, 341}, {0x9470, 352}, {0x9472, 338}, {0x9477, 215}, {0x947C, 181}, {0x947D, 396},
+    {0x947E, 178}, {0x947F, 368}, {0x9485, 131}, {0x9486, 87}, {0x9487, 354}, {0x9488, 379},
+    {0x9489, 66}, {0x948A, 377}, {0x948B, 241}, {0x948C, 170}, {0x948D, 321}, {0x948E, 246},
+    {0x948F, 42}, {0x9490, 282}, {0x9492, 80}, {0x9493, 64}, {0x9494, 189}, {0x9495, 221},
+    {0x9497, 30}, {0x9499, 88}, {0x949A, 20}, {0x949B, 308}, {0x949C, 135}, {0x949D, 73},
+    {0x949E, 33}, {0x949F, 382}, {0x94A0, 202}, {0x94A1, 10}, {0x94A2, 90}, {0x94A3, 7},
+    {0x94A4, 246}, {0x94A5, 352}, {0x94A6, 250}, {0x94A7, 138}, {0x94A8, 334}, {0x94A9, 97},
+    {0x94AA, 142}, {0x94AB, 81}, {0x94AC, 124}, {0x94AD, 320}, {0x94AE, 218}, {0x94AF, 5},
+    {0x94B0, 360}, {0x94B1, 246}, {0x94B2, 380}, {0x94B3, 246}, {0x94B4, 98}, {0x94B5, 19},
+    {0x94B6, 144}, {0x94B7, 241}, {0x94B8, 20}, {0x94B9, 19}, {0x94BA, 362}, {0x94BB, 396},
+    {0x94BC, 200}, {0x94BD, 309}, {0x94BE, 126}, {0x94BF, 63}, {0x94C0, 359}, {0x94C1, 317},
+    {0x94C2, 19}, {0x94C3, 173}, {0x94C4, 298}, {0x94C5, 246}, {0x94C6, 186}, {0x94C8, 289},
+    {0x94C9, 346}, {0x94CA, 307}, {0x94CB, 13}, {0x94CC, 211}, {0x94CD, 235}, {0x94CE, 74},
+    {0x94D0, 143}, {0x94D1, 162}, {0x94D2, 78}, {0x94D5, 359}, {0x94D6, 36}, {0x94D7, 126},
+    {0x94D8, 353}, {0x94D9, 206}, {0x94DB, 58}, {0x94DC, 319}, {0x94DD, 177}, {0x94DE, 64},
+    {0x94DF, 355}, {0x94E0, 140}, {0x94E1, 373}, {0x94E2, 384}, {0x94E3, 335}, {0x94E4, 66},
+    {0x94E5, 67}, {0x94E7, 118}, {0x94E8, 255}, {0x94E9, 280}, {0x94EA, 106}, {0x94EB, 64},
+    {0x94EC, 92}, {0x94ED, 196}, {0x94EE, 380}, {0x94EF, 277}, {0x94F0, 129}, {0x94F1, 354},
+    {0x94F2, 31}, {0x94F3, 38}, {0x94F4, 310}, {0x94F5, 2}, {0x94F6, 355}, {0x94F7, 267},
+    {0x94F8, 384}, {0x94F9, 162}, {0x94FA, 243}, {0x94FC, 159}, {0x94FD, 312}, {0x94FE, 168},
+    {0x94FF, 147}, {0x9500, 339}, {0x9501, 306}, {0x9502, 166}, {0x9503, 372}, {0x9504, 40},
+    {0x9505, 105}, {0x9506, 91}, {0x9507, 75}, {0x9508, 344}, {0x9509, 54}, {0x950A, 179},
+    {0x950B, 84}, {0x950C, 341}, {0x950D, 174}, {0x950E, 140}, {0x950F, 127}, {0x9510, 269},
+    {0x9511, 314}, {0x9512, 161}, {0x9513, 250}, {0x9514, 135}, {0x9515, 0}, {0x9516, 247},
+    {0x9517, 378}, {0x9518, 224}, {0x9519, 54}, {0x951A, 186}, {0x951B, 11}, {0x951D, 60},
+    {0x951E, 144}, {0x951F, 156}, {0x9521, 335}, {0x9522, 98}, {0x9523, 181}, {0x9524, 44},
+    {0x9525, 389}, {0x9526, 131}, {0x9528, 337}, {0x9529, 136}, {0x952A, 124}, {0x952B, 232},
+    {0x952C, 309}, {0x952D, 66}, {0x952E, 127}, {0x952F, 135}, {0x9530, 190}, {0x9531, 392},
+    {0x9532, 249}, {0x9534, 140}, {0x9535, 247}, {0x9536, 299}, {0x9537, 75}, {0x9538, 29},
+    {0x9539, 248}, {0x953A, 382}, {0x953B, 71}, {0x953C, 301}, {0x953E, 120}, {0x953F, 1},
+    {0x9540, 70}, {0x9541, 188}, {0x9542, 176}, {0x9544, 82}, {0x9545, 188}, {0x9546, 198},
+    {0x9547, 379}, {0x9549, 92}, {0x954A, 215}, {0x954C, 136}, {0x954D, 215}, {0x954E, 202},
+    {0x954F, 174}, {0x9550, 91}, {0x9551, 8}, {0x9552, 354}, {0x9553, 126}, {0x9554, 17},
+    {0x9556, 15}, {0x9557, 310}, {0x9558, 184}, {0x9559, 181}, {0x955B, 358}, {0x955C, 132},
+    {0x955D, 62}, {0x955E, 395}, {0x955F, 346}, {0x9561, 31}, {0x9562, 137}, {0x9563, 170},
+    {0x9564, 243}, {0x9565, 177}, {0x9566, 72}, {0x9567, 160}, {0x9568, 243}, {0x9569, 51},
+    {0x956A, 247}, {0x956B, 61}, {0x956C, 124}, {0x956D, 164}, {0x956F, 391}, {0x9570, 168},
+    {0x9571, 354}, {0x9572, 29}, {0x9573, 15}, {0x9576, 338}, {0x9577, 376}, {0x957F, 376},
+    {0x9580, 189}, {0x9582, 294}, {0x9583, 282}, {0x9589, 13}, {0x958B, 140}, {0x958E, 115},
+    {0x958F, 270}, {0x9591, 337}, {0x9592, 337}, {0x9593, 127}, {0x9594, 195}, {0x9598, 373},
+    {0x95A1, 1}, {0x95A3, 92}, {0x95A4, 92}, {0x95A5, 79}, {0x95A8, 103}, {0x95A9, 195},
+    {0x95AD, 177}, {0x95B1, 362}, {0x95BB, 350}, {0x95C6, 7}, {0x95C8, 330}, {0x95CA, 157},
+    {0x95CB, 256}, {0x95CC, 160}, {0x95D0, 315}, {0x95D4, 111}, {0x95D5, 256}, {0x95D6, 43},
+    {0x95DC, 101}, {0x95E1, 31}, {0x95E2, 235}, {0x95E8, 189}, {0x95E9, 294}, {0x95EA, 282},
+    {0x95EB, 350}, {0x95ED, 13}, {0x95EE, 331}, {0x95EF, 43}, {0x95F0, 270}, {0x95F1, 330},
+    {0x95F2, 337}, {0x95F3, 115}, {0x95F4, 127}, {0x95F5, 195}, {0x95F6, 142}, {0x95F7, 189},
+    {0x95F8, 373}, {0x95F9, 206}, {0x95FA, 103}, {0x95FB, 331}, {0x95FC, 307}, {0x95FD, 195},
+    {0x95FE, 177}, {0x9600, 79}, {0x9601, 92}, {0x9602, 111}, {0x9603, 156}, {0x9604, 134},
+    {0x9605, 362}, {0x9606, 161}, {0x9608, 360}, {0x9609, 350}, {0x960A, 32}, {0x960B, 335},
+    {0x960C, 331}, {0x960D, 123}, {0x960E, 350}, {0x960F, 75}, {0x9610, 31}, {0x9611, 160},
+    {0x9612, 254}, {0x9614, 157}, {0x9615, 256}, {0x9616, 111}, {0x9617, 315}, {0x9619, 256},
+    {0x961A, 108}, {0x961C, 86}, {0x961D, 86}, {0x961F, 72}, {0x9621, 246}, {0x9622, 334},
+    {0x962A, 7}, {0x962C, 147}, {0x962E, 268}, {0x9631, 132}, {0x9632, 81}, {0x9633, 351},
+    {0x9634, 355}, {0x9635, 379}, {0x9636, 130}, {0x963B, 395}, {0x963C, 399}, {0x963D, 63},
+    {0x963F, 0}, {0x9640, 325}, {0x9642, 10}, {0x9644, 86}, {0x9645, 125}, {0x9646, 177},
+    {0x9647, 175}, {0x9648, 35}, {0x9649, 342}, {0x964B, 176}, {0x964C, 198}, {0x964D, 128},
+    {0x9650, 337}, {0x9654, 88}, {0x9655, 282}, {0x9658, 342}, {0x965B, 13}, {0x965D, 282},
+    {0x965E, 288}, {0x965F, 381}, {0x9661, 69}, {0x9662, 361}, {0x9663, 379}, {0x9664, 40},
+    {0x9667, 215}, {0x9668, 363}, {0x9669, 337}, {0x966A, 232}, {0x966C, 394}, {0x9670, 355},
+    {0x9672, 44}, {0x9673, 35}, {0x9674, 235}, {0x9675, 173}, {0x9676, 311}, {0x9677, 337},
+    {0x9678, 177}, {0x967D, 351}, {0x9684, 62}, {0x9685, 360}, {0x9686, 175}, {0x9688, 330},
+    {0x968A, 72}, {0x968B, 304}, {0x968D, 121}, {0x968E, 130}, {0x968F, 304}, {0x9690, 355},
+    {0x9694, 92}, {0x9695, 363}, {0x9697, 155}, {0x9698, 1}, {0x9699, 335}, {0x969B, 125},
+    {0x969C, 376}, {0x96A7, 304}, {0x96A8, 304}, {0x96AA, 337}, {0x96B0, 335}, {0x96B1, 355},
+    {0x96B3, 122}, {0x96B4, 175}, {0x96B6, 166}, {0x96B8, 166}, {0x96B9, 389}, {0x96BB, 381},
+    {0x96BC, 305}, {0x96BD, 136}, {0x96BE, 204}, {0x96C0, 256}, {0x96C1, 350}, {0x96C4, 343},
+    {0x96C5, 349}, {0x96C6, 125}, {0x96C7, 98}, {0x96C9, 381}, {0x96CA, 97}, {0x96CB, 136},
+    {0x96CC, 47}, {0x96CD, 358}, {0x96CE, 135}, {0x96CF, 40}, {0x96D2, 181}, {0x96D5, 64},
+    {0x96D6, 304}, {0x96D9, 295}, {0x96DB, 40}, {0x96DC, 364}, {0x96DE, 125}, {0x96E0, 39},
+    {0x96E2, 166}, {0x96E3, 204}, {0x96E8, 360}, {0x96E9, 360}, {0x96EA, 347}, {0x96EF, 331},
+    {0x96F2, 363}, {0x96F3, 166}, {0x96F6, 173}, {0x96F7, 164}, {0x96F9, 9}, {0x96FB, 63},
+    {0x96FE, 334}, {0x9700, 345}, {0x9701, 125}, {0x9704, 339}, {0x9706, 318}, {0x9707, 379},
+    {0x9708, 232}, {0x9709, 188}, {0x970D, 124}, {0x970E, 280}, {0x970F, 82}, {0x9711, 375},
+    {0x9713, 211}, {0x9716, 172}, {0x971C, 295}, {0x971E, 336}, {0x9724, 174}, {0x9727, 334},
+    {0x972A, 355}, {0x972D, 1}, {0x9730, 337}, {0x9732, 177}, {0x9738, 5}, {0x9739, 235},
+    {0x973D, 125}, {0x973E, 183}, {0x9742, 166}, {0x9744, 1}, {0x9748, 173}, {0x9752, 251},
+    {0x9753, 132}, {0x9756, 132}, {0x9759, 132}, {0x975B, 63}, {0x975C, 132}, {0x975E, 82},
+    {0x9760, 143}, {0x9761, 191}, {0x9762, 192}, {0x9765, 353}, {0x9766, 315}, {0x9768, 353},
+    {0x9769, 92}, {0x9773, 131}, {0x9774, 347}, {0x9776, 5}, {0x977C, 55}, {0x9785, 351},
+    {0x978B, 340}, {0x978D, 2}, {0x978F, 96}, {0x9791, 55}, {0x9792, 248}, {0x9794, 184},
+    {0x9798, 248}, {0x97A0, 135}, {0x97A3, 266}, {0x97A6, 253}, {0x97AB, 135}, {0x97AD, 14},
+    {0x97AF, 127}, {0x97B2, 97}, {0x97B4, 10}, {0x97C1, 128}, {0x97C3, 55}, {0x97C6, 246},
+    {0x97C9, 127}, {0x97CB, 330}, {0x97CC, 262}, {0x97D3, 108}, {0x97DC, 311}, {0x97E6, 330},
+    {0x97E7, 262}, {0x97E9, 108}, {0x97EA, 330}, {0x97EB, 363}, {0x97EC, 311}, {0x97ED, 134},
+    {0x97F3, 355}, {0x97F5, 363}, {0x97F6, 284}, {0x97F9, 121}, {0x97FB, 363}, {0x97FF, 338},
+    {0x9801, 353}, {0x9802, 66}, {0x9803, 251}, {0x9805, 338}, {0x9806, 297}, {0x9808, 345},
+    {0x980A, 345}, {0x980C, 300}, {0x9810, 360}, {0x9811, 328}, {0x9812, 7}, {0x9813, 73},
+    {0x9817, 241}, {0x9818, 173}, {0x981C, 111}, {0x9821, 340}, {0x9824, 354}, {0x982B, 86},
+    {0x982D, 320}, {0x9830, 126}, {0x9837, 108}, {0x9838, 132}, {0x9839, 323}, {0x983B, 239},
+    {0x9846, 144}, {0x984C, 314}, {0x984D, 75}, {0x984E, 75}, {0x984F, 350}, {0x9853, 387},
+    {0x9858, 361}, {0x985B, 63}, {0x985E, 164}, {0x9865, 110}, {0x9867, 98}, {0x986B, 31},
+    {0x986F, 337}, {0x9870, 239}, {0x9871, 177}, {0x9875, 353}, {0x9876, 66}, {0x9877, 251},
+    {0x9878, 108}, {0x9879, 338}, {0x987A, 297}, {0x987B, 345}, {0x987C, 345}, {0x987D, 328},
+    {0x987E, 98}, {0x987F, 73}, {0x9880, 244}, {0x9881, 7}, {0x9882, 300}, {0x9883, 109},
+    {0x9884, 360}, {0x9885, 177}, {0x9886, 173}, {0x9887, 241}, {0x9888, 132}, {0x9889, 130},
+    {0x988A, 126}, {0x988C, 111}, {0x988D, 356}, {0x988F, 144}, {0x9890, 354}, {0x9891, 239},
+    {0x9893, 323}, {0x9894, 108}, {0x9896, 356}, {0x9897, 144}, {0x9898, 314}, {0x989A, 75},
+    {0x989B, 387}, {0x989C, 350}, {0x989D, 75}, {0x989E, 215}, {0x989F, 184}, {0x98A0, 63},
+    {0x98A1, 275}, {0x98A2, 110}, {0x98A4, 31}, {0x98A5, 267}, {0x98A6, 239}, {0x98A7, 255},
+    {0x98A8, 84}, {0x98AF, 272}, {0x98B1, 308}, {0x98B3, 99}, {0x98B6, 135}, {0x98BA, 351},
+    {0x98BC, 301}, {0x98C4, 237}, {0x98CE, 84}, {0x98D1, 15}, {0x98D2, 272}, {0x98D3, 135},
+    {0x98D5, 301}, {0x98D8, 237}, {0x98D9, 15}, {0x98DA, 15}, {0x98DB, 82}, {0x98DE, 82},
+    {0x98DF, 289}, {0x98E2, 125}, {0x98E7, 305}, {0x98E8, 338}, {0x98E9, 324}, {0x98EA, 262},
+    {0x98ED, 37}, {0x98EF, 80}, {0x98F2, 355}, {0x98F4, 354}, {0x98FC, 299}, {0x98FD, 9},
+    {0x98FE, 289}, {0x9903, 129}, {0x9905, 18}, {0x9909, 338}, {0x990A, 351}, {0x990C, 78},
+    {0x990D, 350}, {0x9910, 23}, {0x9912, 208}, {0x9913, 75}, {0x9918, 360}, {0x991A, 352},
+    {0x991B, 123}, {0x991E, 127}, {0x9921, 337}, {0x9928, 101}, {0x992E, 317}, {0x9935, 330},
+    {0x993D, 155}, {0x993E, 174}, {0x993F, 301}, {0x9945, 184}, {0x9949, 131}, {0x9951, 125},
+    {0x9952, 260}, {0x9954, 358}, {0x9955, 311}, {0x9957, 338}, {0x995C, 350}, {0x995E, 31},
+    {0x9963, 289}, {0x9965, 125}, {0x9967, 310}, {0x9968, 324}, {0x9969, 335}, {0x996A, 262},
+    {0x996B, 360}, {0x996C, 37}, {0x996D, 80}, {0x996E, 355}, {0x996F, 127}, {0x9970, 289},
+    {0x9971, 9}, {0x9972, 299}, {0x9974, 354}, {0x9975, 78}, {0x9976, 260}, {0x9977, 338},
+    {0x997A, 129}, {0x997C, 18}, {0x997D, 19}, {0x997F, 75}, {0x9980, 360}, {0x9981, 208},
+    {0x9984, 123}, {0x9985, 337}, {0x9986, 101}, {0x9987, 29}, {0x9988, 155}, {0x998A, 301},
+    {0x998B, 31}, {0x998D, 198}, {0x998F, 174}, {0x9990, 344}, {0x9991, 131}, {0x9992, 184},
+    {0x9993, 274}, {0x9994, 387}, {0x9995, 205}, {0x9996, 290}, {0x9997, 155}, {0x9998, 105},
+    {0x9999, 338}, {0x99A5, 86}, {0x99A8, 341}, {0x99AC, 182}, {0x99AD, 360}, {0x99AE, 84},
+    {0x99B1, 325}, {0x99B3, 37}, {0x99B4, 348}, {0x99C1, 19}, {0x99D0, 384}, {0x99D1, 221},
+    {0x99D2, 135}, {0x99D5, 126}, {0x99D9, 86}, {0x99DB, 289}, {0x99DD, 325}, {0x99DF, 299},
+    {0x99E2, 236}, {0x99ED, 107}, {0x99F1, 181}, {0x99FF, 138}, {0x9A01, 36}, {0x9A0E, 244},
+    {0x9A16, 334}, {0x9A19, 236}, {0x9A2B, 246}, {0x9A30, 313}, {0x9A35, 361}, {0x9A37, 276},
+    {0x9A3E, 181}, {0x9A40, 198}, {0x9A43, 15}, {0x9A45, 254}, {0x9A4D, 339}, {0x9A55, 129},
+    {0x9A57, 350}, {0x9A5A, 132}, {0x9A5B, 354}, {0x9A5F, 383}, {0x9A62, 177}, {0x9A65, 125},
+    {0x9A6A, 166}, {0x9A6C, 182}, {0x9A6D, 360}, {0x9A6E, 325}, {0x9A6F, 348}, {0x9A70, 37},
+    {0x9A71, 254}, {0x9A73, 19}, {0x9A74, 177}, {0x9A75, 367}, {0x9A76, 289}, {0x9A77, 299},
+    {0x9A78, 86}, {0x9A79, 135}, {0x9A7A, 394}, {0x9A7B, 384}, {0x9A7C, 325}, {0x9A7D, 221},
+    {0x9A7E, 126}, {0x9A7F, 354}, {0x9A80, 56}, {0x9A81, 339}, {0x9A82, 182}, {0x9A84, 129},
+    {0x9A85, 118}, {0x9A86, 181}, {0x9A87, 107}, {0x9A88, 236}, {0x9A8A, 166}, {0x9A8B, 36},
+    {0x9A8C, 350}, {0x9A8F, 138}, {0x9A90, 244}, {0x9A91, 244}, {0x9A92, 144}, {0x9A93, 389},
+    {0x9A96, 23}, {0x9A97, 236}, {0x9A98, 381}, {0x9A9A, 276}, {0x9A9B, 334}, {0x9A9C, 4},
+    {0x9A9D, 174}, {0x9A9E, 246}, {0x9A9F, 282}, {0x9AA0, 15}, {0x9AA1, 181}, {0x9AA2, 48},
+    {0x9AA3, 31}, {0x9AA4, 383}, {0x9AA5, 125}, {0x9AA7, 338}, {0x9AA8, 98}, {0x9AAF, 3},
+    {0x9AB0, 320}, {0x9AB1, 130}, {0x9AB6, 62}, {0x9AB7, 150}, {0x9AB8, 107}, {0x9ABA, 116},
+    {0x9ABC, 92}, {0x9AC0, 13}, {0x9AC1, 144}, {0x9AC2, 245}, {0x9AC5, 176}, {0x9ACB, 153},
+    {0x9ACC, 17}, {0x9ACF, 176}, {0x9AD1, 70}, {0x9AD2, 367}, {0x9AD3, 304}, {0x9AD4, 314},
+    {0x9AD6, 153}, {0x9AD8, 91}, {0x9ADF, 15}, {0x9AE1, 156}, {0x9AE6, 186}, {0x9AEB, 316},
+    {0x9AED, 392}, {0x9AEE, 79}, {0x9AEF, 258}, {0x9AF9, 344}, {0x9AFB, 125}, {0x9B03, 393},
+    {0x9B06, 300}, {0x9B08, 255}, {0x9B0D, 117}, {0x9B0F, 134}, {0x9B13, 17}, {0x9B1A, 345},
+    {0x9B1F, 120}, {0x9B22, 17}, {0x9B23, 171}, {0x9B25, 69}, {0x9B27, 206}, {0x9B28, 115},
+    {0x9B2F, 32}, {0x9B31, 360}, {0x9B32, 92}, {0x9B3B, 360}, {0x9B3C, 103}, {0x9B41, 155},
+    {0x9B42, 123}, {0x9B43, 5}, {0x9B44, 241}, {0x9B45, 188}, {0x9B47, 350}, {0x9B48, 339},
+    {0x9B49, 169}, {0x9B4D, 329}, {0x9B4E, 169}, {0x9B4F, 330}, {0x9B51, 37}, {0x9B54, 198},
+    {0x9B58, 350}, {0x9B5A, 360}, {0x9B6F, 177}, {0x9B77, 359}, {0x9B91, 9}, {0x9BAA, 330},
+    {0x9BAB, 129}, {0x9BAD, 103}, {0x9BAE, 337}, {0x9BC0, 104}, {0x9BC8, 316}, {0x9BC9, 166},
+    {0x9BCA, 280}, {0x9BD6, 380}, {0x9BDB, 64}, {0x9BE7, 32}, {0x9BE8, 132}, {0x9BFD, 370},
+    {0x9C0D, 253}, {0x9C13, 273}, {0x9C25, 101}, {0x9C2D, 244}, {0x9C31, 168}, {0x9C3B, 184},
+    {0x9C3E, 15}, {0x9C49, 16}, {0x9C54, 282}, {0x9C56, 103}, {0x9C57, 172}, {0x9C5F, 116},
+    {0x9C77, 75}, {0x9C78, 177}, {0x9C7C, 360}, {0x9C7F, 359}, {0x9C81, 177}, {0x9C82, 81},
+    {0x9C85, 5}, {0x9C86, 240}, {0x9C87, 212}, {0x9C88, 177}, {0x9C8B, 86}, {0x9C8D, 9},
+    {0x9C8E, 116}, {0x9C90, 308}, {0x9C91, 103}, {0x9C92, 130}, {0x9C94, 330}, {0x9C95, 78},
+    {0x9C9A, 125}, {0x9C9B, 129}, {0x9C9C, 337}, {0x9C9E, 338}, {0x9C9F, 348}, {0x9CA0, 95},
+    {0x9CA1, 166}, {0x9CA2, 168}, {0x9CA3, 127}, {0x9CA4, 166}, {0x9CA5, 289}, {0x9CA6, 316},
+    {0x9CA7, 104}, {0x9CA8, 280}, {0x9CA9, 120}, {0x9CAB, 125}, {0x9CAD, 251}, {0x9CAE, 173},
+    {0x9CB0, 394}, {0x9CB1, 82}, {0x9CB2, 156}, {0x9CB3, 32}, {0x9CB4, 98}, {0x9CB5, 211},
+    {0x9CB6, 212}, {0x9CB7, 64}, {0x9CB8, 132}, {0x9CBA, 289}, {0x9CBB, 392}, {0x9CBC, 83},
+    {0x9CBD, 65}, {0x9CC3, 273}, {0x9CC4, 75}, {0x9CC5, 253}, {0x9CC6, 86}, {0x9CC7, 121},
+    {0x9CCA, 14}, {0x9CCB, 276}, {0x9CCC, 4}, {0x9CCD, 244}, {0x9CCE, 307}, {0x9CCF, 101},
+    {0x9CD0, 352}, {0x9CD3, 163}, {0x9CD4, 15}, {0x9CD5, 347}, {0x9CD6, 16}, {0x9CD7, 184},
+    {0x9CD8, 195}, {0x9CD9, 358}, {0x9CDC, 103}, {0x9CDD, 282}, {0x9CDE, 172}, {0x9CDF, 398},
+    {0x9CE2, 166}, {0x9CE5, 214}, {0x9CE9, 134}, {0x9CF3, 84}, {0x9CF4, 196}, {0x9CF6, 361},
+    {0x9D03, 137}, {0x9D06, 379}, {0x9D09, 349}, {0x9D12, 173}, {0x9D15, 325}, {0x9D1B, 361},
+    {0x9D23, 98}, {0x9D26, 351}, {0x9D28, 349}, {0x9D3B, 115}, {0x9D3F, 92}, {0x9D51, 136},
+    {0x9D5D, 75}, {0x9D60, 117}, {0x9D61, 334}, {0x9D6A, 2}, {0x9D6C, 234}, {0x9D72, 256},
+    {0x9D89, 45}, {0x9DAF, 356}, {0x9DB4, 111}, {0x9DB8, 271}, {0x9DC2, 352}, {0x9DD3, 378},
+    {0x9DD7, 226}, {0x9DE5, 299}, {0x9DF9, 356}, {0x9DFA, 177}, {0x9E1A, 356}, {0x9E1B, 101},
+    {0x9E1E, 178}, {0x9E1F, 214}, {0x9E20, 134}, {0x9E21, 125}, {0x9E22, 361}, {0x9E23, 196},
+    {0x9E25, 226}, {0x9E26, 349}, {0x9E28, 9}, {0x9E29, 379}, {0x9E2A, 98}, {0x9E2B, 68},
+    {0x9E2C, 177}, {0x9E2D, 349}, {0x9E2F, 351}, {0x9E31, 37}, {0x9E32, 254}, {0x9E33, 361},
+    {0x9E35, 325}, {0x9E36, 299}, {0x9E37, 381}, {0x9E38, 78}, {0x9E39, 99}, {0x9E3A, 344},
+    {0x9E3D, 92}, {0x9E3E, 178}, {0x9E3F, 115}, {0x9E41, 19}, {0x9E42, 166}, {0x9E43, 136},
+    {0x9E44, 98}, {0x9E45, 75}, {0x9E46, 360}, {0x9E47, 337}, {0x9E48, 314}, {0x9E49, 334},
+    {0x9E4A, 256}, {0x9E4B, 193}, {0x9E4C, 2}, {0x9E4E, 10}, {0x9E4F, 234}, {0x9E51, 45},
+    {0x9E55, 117}, {0x9E57, 75}, {0x9E58, 98}, {0x9E5A, 47}, {0x9E5B, 188}, {0x9E5C, 334},
+    {0x9E5E, 352}, {0x9E63, 127}, {0x9E64, 111}, {0x9E66, 356}, {0x9E67, 378}, {0x9E68, 174},
+    {0x9E69, 170}, {0x9E6A, 129}, {0x9E6B, 134}, {0x9E6C, 360}, {0x9E6D, 177}, {0x9E70, 356},
+    {0x9E71, 117}, {0x9E73, 101}, {0x9E75, 177}, {0x9E79, 337}, {0x9E7C, 127}, {0x9E7D, 350},
+    {0x9E7E, 54}, {0x9E7F, 177}, {0x9E82, 125}, {0x9E87, 138}, {0x9E88, 384}, {0x9E8B, 191},
+    {0x9E92, 244}, {0x9E93, 177}, {0x9E97, 166}, {0x9E9D, 285}, {0x9E9F, 172}, {0x9EA5, 183},
+    {0x9EA6, 183}, {0x9EA9, 86}, {0x9EB4, 254}, {0x9EB5, 192}, {0x9EB8, 86}, {0x9EBB, 182},
+    {0x9EBC, 187}, {0x9EBD, 198}, {0x9EBE, 122}, {0x9EC3, 121}, {0x9EC4, 121}, {0x9EC9, 115},
+    {0x9ECC, 115}, {0x9ECD, 291}, {0x9ECE, 166}, {0x9ECF, 212}, {0x9ED1, 112}, {0x9ED4, 246},
+    {0x9ED8, 198}, {0x9EDB, 56}, {0x9EDC, 40}, {0x9EDD, 359}, {0x9EDE, 63}, {0x9EDF, 354},
+    {0x9EE0, 336}, {0x9EE2, 254}, {0x9EE5, 251}, {0x9EE7, 166}, {0x9EE8, 58}, {0x9EE9, 70},
+    {0x9EEA, 23}, {0x9EEF, 2}, {0x9EF4, 188}, {0x9EF7, 70}, {0x9EF9, 381}, {0x9EFB, 86},
+    {0x9EFC, 86}, {0x9EFE, 192}, {0x9F07, 4}, {0x9F0B, 361}, {0x9F0D, 325}, {0x9F0E, 66},
+    {0x9F10, 203}, {0x9F13, 98}, {0x9F15, 68}, {0x9F17, 311}, {0x9F19, 235}, {0x9F20, 291},
+    {0x9F22, 83}, {0x9F2C, 359}, {0x9F2F, 334}, {0x9F34, 350}, {0x9F37, 335}, {0x9F39, 350},
+    {0x9F3B, 13}, {0x9F3D, 253}, {0x9F3E, 108}, {0x9F44, 373}, {0x9F4A, 244}, {0x9F4B, 374},
+    {0x9F50, 244}, {0x9F51, 125}, {0x9F52, 37}, {0x9F5C, 30}, {0x9F5F, 135}, {0x9F61, 173},
+    {0x9F63, 40}, {0x9F66, 146}, {0x9F67, 215}, {0x9F6A, 46}, {0x9F6C, 360}, {0x9F72, 254},
+    {0x9F77, 333}, {0x9F7F, 37}, {0x9F80, 35}, {0x9F83, 135}, {0x9F84, 173}, {0x9F85, 9},
+    {0x9F86, 316}, {0x9F87, 392}, {0x9F88, 146}, {0x9F89, 360}, {0x9F8A, 46}, {0x9F8B, 254},
+    {0x9F8C, 333}, {0x9F8D, 175}, {0x9F90, 230}, {0x9F94, 96}, {0x9F99, 175}, {0x9F9A, 96},
+    {0x9F9B, 141}, {0x9F9C, 103}, {0x9F9F, 103}, {0x9FA0, 362},
+};
+
+} // namespace
+
+// =============================================================================
+// Lookup
+// =============================================================================
+
+std::string_view Pinyin::syllable(uint32_t codepoint) {
+    if (codepoint < READINGS[0].codepoint || codepoint > 0xFFFF) return {};
+    
+    auto it = std::lower_bound(std::begin(READINGS), std::end(READINGS), codepoint,
+        [](const Reading& reading, uint32_t cp) { return reading.codepoint < cp; });
+    if (it == std::end(READINGS) || it->codepoint != codepoint) return {};
+    return SYLLABLES[it->syllable];
+}
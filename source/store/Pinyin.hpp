@@ -0,0 +1,20 @@
+// =============================================================================
+// Switch App Store - Pinyin
+// =============================================================================
+// Character to pinyin lookup, so Chinese titles can be searched from the
+// Latin keyboard: 马里奥 is also found by "maliao" and by its initials
+// "mla". Polyphonic characters only carry their most common reading.
+// =============================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace Pinyin {
+
+// Toneless, lowercase pinyin of a Han character ("ma" for 马), or an empty
+// view if the character is not in the table
+std::string_view syllable(uint32_t codepoint);
+
+} // namespace Pinyin
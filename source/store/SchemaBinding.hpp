@@ -0,0 +1,179 @@
+// =============================================================================
+// Switch App Store - Schema Binding
+// =============================================================================
+// Declarative, compile-time tables that bind JSON object keys to members of
+// a plain struct. Keys are resolved through a perfect hash computed by the
+// compiler, so a lookup is one hash, one table load and one compare.
+// =============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace schema {
+
+// =============================================================================
+// Field kinds
+// =============================================================================
+enum class FieldKind : uint8_t {
+    String,         // std::string
+    Url,            // std::string, relative URLs resolved against the source
+    StringList,     // std::vector<std::string>
+    UrlList,        // std::vector<std::string>, each resolved as a URL
+    Size,           // size_t
+    Int,            // int
+    Float           // float
+};
+
+// =============================================================================
+// FieldBinding - One JSON key and the member it writes to
+// =============================================================================
+template <typename T>
+struct FieldBinding {
+    std::string_view key;
+    FieldKind kind;
+    std::string T::* text = nullptr;
+    std::vector<std::string> T::* list = nullptr;
+    size_t T::* size = nullptr;
+    int T::* integer = nullptr;
+    float T::* real = nullptr;
+
+    bool isList() const { return kind == FieldKind::StringList || kind == FieldKind::UrlList; }
+    bool isUrl() const { return kind == FieldKind::Url || kind == FieldKind::UrlList; }
+};
+
+// -----------------------------------------------------------------------------
+// Constructors, picked by member type
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr FieldBinding<T> field(std::string_view key, std::string T::* member) {
+    FieldBinding<T> f{key, FieldKind::String};
+    f.text = member;
+    return f;
+}
+
+template <typename T>
+constexpr FieldBinding<T> field(std::string_view key, std::vector<std::string> T::* member) {
+    FieldBinding<T> f{key, FieldKind::StringList};
+    f.list = member;
+    return f;
+}
+
+template <typename T>
+constexpr FieldBinding<T> field(std::string_view key, size_t T::* member) {
+    FieldBinding<T> f{key, FieldKind::Size};
+    f.size = member;
+    return f;
+}
+
+template <typename T>
+constexpr FieldBinding<T> field(std::string_view key, int T::* member) {
+    FieldBinding<T> f{key, FieldKind::Int};
+    f.integer = member;
+    return f;
+}
+
+template <typename T>
+constexpr FieldBinding<T> field(std::string_view key, float T::* member) {
+    FieldBinding<T> f{key, FieldKind::Float};
+    f.real = member;
+    return f;
+}
+
+template <typename T>
+constexpr FieldBinding<T> urlField(std::string_view key, std::string T::* member) {
+    FieldBinding<T> f{key, FieldKind::Url};
+    f.text = member;
+    return f;
+}
+
+template <typename T>
+constexpr FieldBinding<T> urlField(std::string_view key, std::vector<std::string> T::* member) {
+    FieldBinding<T> f{key, FieldKind::UrlList};
+    f.list = member;
+    return f;
+}
+
+// =============================================================================
+// Perfect hash
+// =============================================================================
+
+// Seeded FNV-1a
+constexpr uint32_t hashKey(std::string_view key, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (char c : key) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 16777619u;
+    }
+    return h ^ (h >> 15);
+}
+
+// Smallest power of two with at least twice as many slots as keys
+constexpr size_t tableSizeFor(size_t count) {
+    size_t size = 1;
+    while (size < count * 2) size <<= 1;
+    return size;
+}
+
+// =============================================================================
+// Schema - Field table plus its collision-free slot table
+// =============================================================================
+template <typename T, size_t N>
+class Schema {
+public:
+    static constexpr size_t TABLE_SIZE = tableSizeFor(N);
+    static constexpr uint8_t EMPTY = 0xFF;
+    static_assert(N < EMPTY, "too many fields for an 8-bit slot table");
+
+    constexpr explicit Schema(const FieldBinding<T> (&fields)[N]) : m_fields{} {
+        for (size_t i = 0; i < N; i++) m_fields[i] = fields[i];
+
+        // Try seeds until every key lands in its own slot
+        for (uint32_t seed = 0; seed < 100000; seed++) {
+            if (tryBuild(seed)) {
+                m_seed = seed;
+                m_valid = true;
+                return;
+            }
+        }
+    }
+
+    // True if a collision-free seed was found (checked with static_assert)
+    constexpr bool isValid() const { return m_valid; }
+
+    // -------------------------------------------------------------------------
+    // Binding for key, or nullptr for fields we do not map
+    // -------------------------------------------------------------------------
+    const FieldBinding<T>* find(std::string_view key) const {
+        uint8_t index = m_slots[hashKey(key, m_seed) & (TABLE_SIZE - 1)];
+        if (index == EMPTY || m_fields[index].key != key) return nullptr;
+        return &m_fields[index];
+    }
+
+private:
+    constexpr bool tryBuild(uint32_t seed) {
+        for (size_t i = 0; i < TABLE_SIZE; i++) m_slots[i] = EMPTY;
+        for (size_t i = 0; i < N; i++) {
+            size_t slot = hashKey(m_fields[i].key, seed) & (TABLE_SIZE - 1);
+            if (m_slots[slot] != EMPTY) return false;
+            m_slots[slot] = static_cast<uint8_t>(i);
+        }
+        return true;
+    }
+
+    FieldBinding<T> m_fields[N];
+    uint8_t m_slots[TABLE_SIZE] = {};
+    uint32_t m_seed = 0;
+    bool m_valid = false;
+};
+
+template <typename T, size_t N>
+constexpr Schema<T, N> makeSchema(const FieldBinding<T> (&fields)[N]) {
+    return Schema<T, N>(fields);
+}
+
+} // namespace schema
@@ -0,0 +1,552 @@
+// =============================================================================
+// Switch App Store - Search Index Implementation
+// =============================================================================
+
+#include "SearchIndex.hpp"
+#include "EntryIndex.hpp"
+#include "Pinyin.hpp"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+
+namespace {
+
+// BM25 parameters (the usual defaults)
+constexpr float BM25_K1 = 1.2f;
+constexpr float BM25_B = 0.75f;
+
+// How much the popularity prior can add on top of the text score; a strong
+// text match (score ~5-15) still outranks a popular weak one
+constexpr float PRIOR_WEIGHT = 2.0f;
+
+// Longest query handled; the rest is ignored
+constexpr size_t MAX_QUERY_TERMS = 16;
+
+void writeVarint(std::vector<uint8_t>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+// Syllables joined into one pinyin term at most; longer runs are covered
+// by the terms starting further in
+constexpr size_t MAX_PINYIN_SYLLABLES = 8;
+
+inline uint32_t readVarint(const uint8_t*& p) {
+    uint32_t value = *p & 0x7F;
+    int shift = 7;
+    while (*p++ & 0x80) {
+        value |= uint32_t(*p & 0x7F) << shift;
+        shift += 7;
+    }
+    return value;
+}
+
+// -----------------------------------------------------------------------------
+// Pinyin terms of the Han runs in text. From every character of a run, the
+// joined pinyin of the rest of the run ("maliao", "liao", "ao") and its
+// initials ("mla", "la"), so any tail of a Chinese title can be typed on a
+// Latin keyboard. emit(term, wholeRun) flags the full pinyin of a whole
+// run, the one spelling worth matching with typos.
+// -----------------------------------------------------------------------------
+template <typename Emit>
+void pinyinTerms(std::string_view text, Emit&& emit) {
+    std::vector<std::string_view> run;
+    std::string full;
+    std::string initials;
+    
+    auto endRun = [&]() {
+        for (size_t start = 0; start < run.size(); start++) {
+            full.clear();
+            initials.clear();
+            size_t end = std::min(run.size(), start + MAX_PINYIN_SYLLABLES);
+            for (size_t k = start; k < end; k++) {
+                full += run[k];
+                initials += run[k][0];
+            }
+            emit(std::string_view(full), start == 0);
+            if (initials.size() >= 2 && initials != full) {
+                emit(std::string_view(initials), false);
+            }
+        }
+        run.clear();
+    };
+    
+    size_t i = 0;
+    while (i < text.size()) {
+        std::string_view syllable = Pinyin::syllable(search_detail::decodeUtf8(text, i));
+        if (!syllable.empty()) {
+            run.push_back(syllable);
+        } else if (!run.empty()) {
+            endRun();
+        }
+    }
+    if (!run.empty()) endRun();
+}
+
+} // namespace
+
+// =============================================================================
+// Build
+// =============================================================================
+
+void SearchIndex::build(const EntryStore& entries) {
+    // -------------------------------------------------------------------------
+    // Collect (term, doc, tf) occurrences in one flat array rather than a
+    // list per term: most terms (CJK bigrams, pinyin) occur in one or two
+    // documents, and a heap block each would dominate the build. A repeat
+    // in the same document only bumps the frequency of its occurrence.
+    // -------------------------------------------------------------------------
+    struct Occurrence {
+        uint32_t slot;
+        uint32_t doc;
+        uint32_t tf;
+    };
+    std::deque<std::string> termStrings;           // Stable storage for termTexts
+    std::vector<std::string_view> termTexts;       // Per slot
+    std::vector<uint32_t> termHashes;              // Per slot, to grow the table
+    std::vector<Occurrence> occurrences;
+    std::vector<uint32_t> lastOccurrence;          // Per slot, into occurrences
+    std::vector<uint32_t> docCounts;               // Per slot
+    std::vector<uint8_t> fuzzy;                    // Word seen in a name or developer
+    
+    // Term -> slot, open addressing like EntryIndex: (hash << 32) | (slot
+    // + 1) per entry, kept at most half full. A node-based map spends most
+    // of the build chasing pointers once there are a few 100k terms.
+    std::vector<uint64_t> table(1024, 0);
+    uint32_t mask = static_cast<uint32_t>(table.size() - 1);
+    
+    auto slotOf = [&](std::string_view term) {
+        uint32_t h = EntryIndex::hash(term);
+        uint32_t i = h & mask;
+        while (table[i] != 0) {
+            uint32_t slot = uint32_t(table[i]) - 1;
+            if (uint32_t(table[i] >> 32) == h && termTexts[slot] == term) return slot;
+            i = (i + 1) & mask;
+        }
+        
+        uint32_t slot = static_cast<uint32_t>(termTexts.size());
+        termStrings.emplace_back(term);
+        termTexts.push_back(termStrings.back());
+        termHashes.push_back(h);
+        lastOccurrence.push_back(UINT32_MAX);
+        docCounts.push_back(0);
+        fuzzy.push_back(0);
+        table[i] = (uint64_t(h) << 32) | uint64_t(slot + 1);
+        
+        if (termTexts.size() * 2 > table.size()) {
+            table.assign(table.size() * 2, 0);
+            mask = static_cast<uint32_t>(table.size() - 1);
+            for (uint32_t s = 0; s < termHashes.size(); s++) {
+                uint32_t k = termHashes[s] & mask;
+                while (table[k] != 0) k = (k + 1) & mask;
+                table[k] = (uint64_t(termHashes[s]) << 32) | uint64_t(s + 1);
+            }
+        }
+        return slot;
+    };
+    
+    std::vector<uint32_t> docLength(entries.size(), 0);
+    uint64_t totalLength = 0;
+    
+    for (uint32_t doc = 0; doc < entries.size(); doc++) {
+        EntryView entry = entries[doc];
+        uint32_t length = 0;
+        
+        auto addTerm = [&](std::string_view term, uint32_t weight, bool typoTolerant) {
+            uint32_t slot = slotOf(term);
+            if (typoTolerant) fuzzy[slot] = 1;
+            
+            uint32_t last = lastOccurrence[slot];
+            if (last != UINT32_MAX && occurrences[last].doc == doc) {
+                occurrences[last].tf += weight;
+            } else {
+                lastOccurrence[slot] = static_cast<uint32_t>(occurrences.size());
+                occurrences.push_back({slot, doc, weight});
+                docCounts[slot]++;
+            }
+        };
+        auto addField = [&](std::string_view text, uint32_t weight, bool typoTolerant) {
+            tokenize(text, false, [&](std::string_view term, bool isWord) {
+                addTerm(term, weight, isWord && typoTolerant);
+                length += weight;
+            });
+        };
+        addField(entry.name(), NAME_WEIGHT, true);
+        addField(entry.developer(), DEVELOPER_WEIGHT, true);
+        addField(entry.description(), DESCRIPTION_WEIGHT, false);
+        
+        // Pinyin spellings of the name are alternatives to its Han
+        // characters, not more text, so they leave the length alone
+        pinyinTerms(entry.name(), [&](std::string_view term, bool wholeRun) {
+            addTerm(term, NAME_WEIGHT, wholeRun);
+        });
+        
+        docLength[doc] = std::max<uint32_t>(length, 1);
+        totalLength += docLength[doc];
+    }
+    
+    // The BM25 length normalization only depends on the document, so it
+    // is folded into one number per document here instead of per posting
+    float avgDocLength = entries.empty() ? 1.0f : float(totalLength) / float(entries.size());
+    m_docNorm.resize(entries.size());
+    for (size_t doc = 0; doc < entries.size(); doc++) {
+        m_docNorm[doc] = BM25_K1 * (1.0f - BM25_B + BM25_B * float(docLength[doc]) / avgDocLength);
+    }
+    
+    // -------------------------------------------------------------------------
+    // Group the occurrences by term with a counting sort; documents were
+    // visited in order, so each term's postings come out sorted
+    // -------------------------------------------------------------------------
+    std::vector<uint32_t> listStart(termTexts.size() + 1, 0);
+    for (size_t slot = 0; slot < termTexts.size(); slot++) {
+        listStart[slot + 1] = listStart[slot] + docCounts[slot];
+    }
+    std::vector<uint32_t> fill(listStart.begin(), listStart.end() - 1);
+    std::vector<std::pair<uint32_t, uint32_t>> postings(occurrences.size());   // (doc, tf)
+    for (const Occurrence& occurrence : occurrences) {
+        postings[fill[occurrence.slot]++] = {occurrence.doc, occurrence.tf};
+    }
+    occurrences = std::vector<Occurrence>();
+    
+    // -------------------------------------------------------------------------
+    // Sorted dictionary and compressed postings
+    // -------------------------------------------------------------------------
+    std::vector<uint32_t> order(termTexts.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = static_cast<uint32_t>(i);
+    std::sort(order.begin(), order.end(), [&termTexts](uint32_t a, uint32_t b) {
+        return termTexts[a] < termTexts[b];
+    });
+    
+    m_terms.clear();
+    m_terms.reserve(order.size());
+    m_termText.clear();
+    m_postings.clear();
+    m_skips.clear();
+    std::vector<TrigramIndex::Word> fuzzyWords;
+    
+    for (uint32_t slot : order) {
+        Term term;
+        term.textOffset = static_cast<uint32_t>(m_termText.size());
+        term.textLength = static_cast<uint32_t>(termTexts[slot].size());
+        term.postingsOffset = static_cast<uint32_t>(m_postings.size());
+        term.skipOffset = static_cast<uint32_t>(m_skips.size());
+        term.docCount = docCounts[slot];
+        m_termText += termTexts[slot];
+        
+        uint32_t previous = 0;
+        for (uint32_t i = listStart[slot]; i < listStart[slot + 1]; i++) {
+            if (i > listStart[slot] && (i - listStart[slot]) % SKIP_INTERVAL == 0) {
+                m_skips.push_back({previous, static_cast<uint32_t>(m_postings.size())});
+            }
+            writeVarint(m_postings, postings[i].first - previous);
+            writeVarint(m_postings, postings[i].second);
+            previous = postings[i].first;
+        }
+        if (fuzzy[slot]) {
+            fuzzyWords.push_back({static_cast<uint32_t>(m_terms.size()), termTexts[slot]});
+        }
+        m_terms.push_back(term);
+    }
+    m_postings.shrink_to_fit();
+    m_skips.shrink_to_fit();
+    
+    // Description words are left out: they are mostly common English words
+    // that would turn a typo into noise instead of the title that was meant
+    m_fuzzy.build(fuzzyWords);
+    
+    // -------------------------------------------------------------------------
+    // Popularity prior: half rating, half log-scaled downloads
+    // -------------------------------------------------------------------------
+    int maxDownloads = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        maxDownloads = std::max(maxDownloads, entries.downloadCount(i));
+    }
+    float downloadScale = maxDownloads > 0 ? 1.0f / std::log1p(float(maxDownloads)) : 0.0f;
+    
+    m_prior.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        float rating = std::min(std::max(entries.rating(i) / 5.0f, 0.0f), 1.0f);
+        float downloads = std::log1p(float(std::max(entries.downloadCount(i), 0))) * downloadScale;
+        m_prior[i] = 0.5f * rating + 0.5f * downloads;
+    }
+}
+
+// =============================================================================
+// Query
+// =============================================================================
+
+std::vector<SearchIndex::Hit> SearchIndex::search(std::string_view query, size_t limit,
+                                                  Narrowing* narrowing) const {
+    std::vector<Hit> hits;
+    if (narrowing) {
+        narrowing->matches.clear();
+        narrowing->exhaustive = true;
+    }
+    if (m_docNorm.empty() || limit == 0) return hits;
+    
+    // -------------------------------------------------------------------------
+    // Parse the query. The last word is a prefix unless the user already
+    // typed past it.
+    // -------------------------------------------------------------------------
+    struct Token {
+        std::string text;
+        bool isWord;
+    };
+    std::vector<Token> tokens;
+    tokenize(query, true, [&](std::string_view term, bool isWord) {
+        for (const auto& token : tokens) {
+            if (token.text == term) return;
+        }
+        if (tokens.size() < MAX_QUERY_TERMS) {
+            tokens.push_back({std::string(term), isWord});
+        }
+    });
+    if (tokens.empty()) return hits;
+    
+    size_t lastWord = tokens.size();
+    if (tokens.back().isWord && !query.empty()) {
+        size_t i = query.size() - 1;
+        while (i > 0 && (static_cast<uint8_t>(query[i]) & 0xC0) == 0x80) i--;  // Back to a lead byte
+        size_t end = i;
+        if (search_detail::isWordChar(search_detail::decodeUtf8(query, end))) {
+            lastWord = tokens.size() - 1;
+        }
+    }
+    
+    // -------------------------------------------------------------------------
+    // Each token becomes a group of dictionary terms (one, the most frequent
+    // completions of a prefix, or the closest words to a misspelling).
+    // Every group must match.
+    // -------------------------------------------------------------------------
+    struct GroupTerm {
+        uint32_t term;
+        float weight;               // 1, less for a fuzzy match
+    };
+    struct Group {
+        std::vector<GroupTerm> terms;
+        uint64_t cost = 0;          // Postings to decode
+    };
+    std::vector<Group> groups(tokens.size());
+    bool capped = false;            // Some group is not every match of its token
+    bool fuzzy = false;
+    
+    for (size_t k = 0; k < tokens.size(); k++) {
+        Group& group = groups[k];
+        auto range = findTerms(tokens[k].text, k == lastWord);
+        for (size_t t = range.first; t < range.second; t++) {
+            group.terms.push_back({static_cast<uint32_t>(t), 1.0f});
+        }
+        
+        if (group.terms.empty() && tokens[k].isWord && tokens[k].text.size() >= FUZZY_MIN_LENGTH) {
+            fuzzy = true;
+            uint32_t maxDistance = tokens[k].text.size() < FUZZY_TWO_EDITS_LENGTH ? 1 : 2;
+            for (const auto& match : m_fuzzy.find(tokens[k].text, maxDistance)) {
+                group.terms.push_back({match.id, 1.0f / float(1 + match.distance)});
+            }
+        }
+        if (group.terms.empty()) {
+            if (narrowing) narrowing->exhaustive = !fuzzy;
+            return hits;
+        }
+        
+        if (group.terms.size() > MAX_PREFIX_TERMS) {
+            capped = true;
+            std::partial_sort(group.terms.begin(), group.terms.begin() + MAX_PREFIX_TERMS, group.terms.end(),
+                [this](const GroupTerm& a, const GroupTerm& b) {
+                    if (a.weight != b.weight) return a.weight > b.weight;
+                    return m_terms[a.term].docCount > m_terms[b.term].docCount;
+                });
+            group.terms.resize(MAX_PREFIX_TERMS);
+        }
+        for (const GroupTerm& t : group.terms) {
+            group.cost += m_terms[t.term].docCount;
+        }
+    }
+    
+    // Rarest group first: documents that miss it are skipped by the rest
+    std::sort(groups.begin(), groups.end(),
+              [](const Group& a, const Group& b) { return a.cost < b.cost; });
+    
+    // -------------------------------------------------------------------------
+    // Score. matched[doc] counts the groups a document has hit so far;
+    // anything behind the current group can no longer match all of them.
+    // An earlier query's matches act as one more group that every
+    // document in it has already passed. The typo fallback is not
+    // monotonic in the query, so it always searches everything.
+    // -------------------------------------------------------------------------
+    const size_t docCount = m_docNorm.size();
+    std::vector<float> scores(docCount, 0.0f);
+    std::vector<uint8_t> matched(docCount, 0);
+    std::vector<uint32_t> candidates;           // Sorted once past the first group
+    
+    uint8_t passed = 0;                         // Groups behind us
+    if (narrowing && narrowing->within && !fuzzy) {
+        for (uint32_t doc : *narrowing->within) {
+            if (doc >= docCount) continue;
+            matched[doc] = 1;
+            candidates.push_back(doc);
+        }
+        passed = 1;
+    }
+    
+    for (const Group& group : groups) {
+        for (const GroupTerm& t : group.terms) {
+            const Term& term = m_terms[t.term];
+            float idf = t.weight * std::log(1.0f + (float(docCount) - float(term.docCount) + 0.5f) /
+                                                   (float(term.docCount) + 0.5f));
+            
+            auto add = [&](uint32_t doc, float tf) {
+                scores[doc] += idf * tf * (BM25_K1 + 1.0f) / (tf + m_docNorm[doc]);
+                if (matched[doc] == passed) {
+                    matched[doc] = static_cast<uint8_t>(passed + 1);
+                    if (passed == 0) candidates.push_back(doc);
+                }
+            };
+            
+            // Few candidates left against a long list: look each one up
+            // through the skip table instead of decoding every posting
+            if (passed > 0 && candidates.size() * (SKIP_INTERVAL / 2) < term.docCount) {
+                PostingCursor cursor(*this, term);
+                for (uint32_t doc : candidates) {
+                    uint32_t tf;
+                    if (matched[doc] >= passed && cursor.seek(doc, tf)) add(doc, float(tf));
+                }
+                continue;
+            }
+            
+            const uint8_t* p = m_postings.data() + term.postingsOffset;
+            uint32_t doc = 0;
+            for (uint32_t n = 0; n < term.docCount; n++) {
+                doc += readVarint(p);
+                uint32_t tf = readVarint(p);
+                if (matched[doc] >= passed) add(doc, float(tf));
+            }
+        }
+        
+        passed++;
+        if (passed == 1) {
+            // Several terms leave the first group's documents out of
+            // order. Only later groups and a reusable match list need
+            // them sorted; a dense set is cheaper to collect again from
+            // matched.
+            bool needSorted = groups.size() > 1 || (narrowing && !capped && !fuzzy);
+            if (!needSorted || std::is_sorted(candidates.begin(), candidates.end())) {
+                // Nothing to do
+            } else if (candidates.size() * 8 > docCount) {
+                size_t count = 0;
+                candidates.resize(docCount);
+                for (uint32_t doc = 0; doc < docCount; doc++) {
+                    candidates[count] = doc;
+                    count += matched[doc] != 0;     // Branch-free: the set is dense
+                }
+                candidates.resize(count);
+            } else {
+                std::sort(candidates.begin(), candidates.end());
+            }
+        } else {
+            candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                            [&](uint32_t doc) { return matched[doc] < passed; }),
+                             candidates.end());
+        }
+    }
+    
+    if (narrowing && !capped && !fuzzy) {
+        narrowing->matches = candidates;
+    } else if (narrowing) {
+        narrowing->exhaustive = false;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Keep the best limit matches in a min-heap: a common term matches most
+    // of the catalog, and most candidates then cost one comparison with the
+    // heap's worst element instead of a slot in a full sort
+    // -------------------------------------------------------------------------
+    auto better = [](const Hit& a, const Hit& b) {
+        return a.score != b.score ? a.score > b.score : a.position < b.position;
+    };
+    
+    hits.reserve(std::min(limit, candidates.size()));
+    for (uint32_t doc : candidates) {
+        Hit hit{doc, scores[doc] + PRIOR_WEIGHT * m_prior[doc]};
+        if (hits.size() < limit) {
+            hits.push_back(hit);
+            std::push_heap(hits.begin(), hits.end(), better);
+        } else if (better(hit, hits.front())) {
+            std::pop_heap(hits.begin(), hits.end(), better);
+            hits.back() = hit;
+            std::push_heap(hits.begin(), hits.end(), better);
+        }
+    }
+    std::sort_heap(hits.begin(), hits.end(), better);
+    return hits;
+}
+
+// -----------------------------------------------------------------------------
+// Posting cursor: forward-only lookups of ascending documents in one list
+// -----------------------------------------------------------------------------
+
+SearchIndex::PostingCursor::PostingCursor(const SearchIndex& index, const Term& term)
+    : m_postings(index.m_postings.data()),
+      m_skips(index.m_skips.data() + term.skipOffset),
+      m_skipCount(term.docCount > 0 ? (term.docCount - 1) / SKIP_INTERVAL : 0),
+      m_docCount(term.docCount),
+      m_p(index.m_postings.data() + term.postingsOffset) {
+}
+
+bool SearchIndex::PostingCursor::seek(uint32_t doc, uint32_t& tf) {
+    if (m_current && m_doc >= doc) {
+        tf = m_tf;
+        return m_doc == doc;
+    }
+    
+    // Jump to the last skip entry still before doc, if it is ahead of us
+    uint32_t first = m_read / SKIP_INTERVAL;
+    if (first < m_skipCount && m_skips[first].doc < doc) {
+        const Skip* end = std::partition_point(m_skips + first, m_skips + m_skipCount,
+                                               [doc](const Skip& skip) { return skip.doc < doc; });
+        uint32_t index = static_cast<uint32_t>(end - m_skips);
+        m_read = index * SKIP_INTERVAL;
+        m_doc = end[-1].doc;
+        m_p = m_postings + end[-1].offset;
+        m_current = false;
+    }
+    
+    while (m_read < m_docCount) {
+        m_doc += readVarint(m_p);
+        m_tf = readVarint(m_p);
+        m_read++;
+        if (m_doc >= doc) {
+            m_current = true;
+            tf = m_tf;
+            return m_doc == doc;
+        }
+    }
+    m_current = false;
+    return false;
+}
+
+std::pair<size_t, size_t> SearchIndex::findTerms(std::string_view text, bool prefix) const {
+    auto first = std::lower_bound(m_terms.begin(), m_terms.end(), text,
+        [this](const Term& term, std::string_view t) { return termText(term) < t; });
+    
+    if (!prefix) {
+        bool found = first != m_terms.end() && termText(*first) == text;
+        size_t at = first - m_terms.begin();
+        return {at, found ? at + 1 : at};
+    }
+    
+    // Terms sharing the prefix are contiguous right after first
+    auto last = std::partition_point(first, m_terms.end(),
+        [this, text](const Term& term) { return termText(term).compare(0, text.size(), text) == 0; });
+    return {size_t(first - m_terms.begin()), size_t(last - m_terms.begin())};
+}
+
+size_t SearchIndex::memoryUsage() const {
+    return m_terms.capacity() * sizeof(Term) + m_termText.capacity() + m_postings.capacity() +
+           m_skips.capacity() * sizeof(Skip) +
+           m_docNorm.capacity() * sizeof(float) + m_prior.capacity() * sizeof(float) +
+           m_fuzzy.memoryUsage();
+}
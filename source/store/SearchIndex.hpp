@@ -0,0 +1,233 @@
+// =============================================================================
+// Switch App Store - Search Index
+// =============================================================================
+// Inverted index over entry name, developer and description, built once per
+// catalog version so a query costs a few postings decodes instead of a scan
+// of the whole catalog.
+//
+//   Tokens     Latin/digit runs are lowercased words; CJK runs (Han, kana,
+//              Hangul) become overlapping bigrams plus single characters,
+//              so both "马里奥" and "马" find 马里奥 without a dictionary.
+//   Pinyin     Han runs in names are also indexed by their pinyin and
+//              its initials, from every character on, so "maliao", "liao"
+//              and "mla" find 马里奥 too (see Pinyin.hpp).
+//   Postings   Per term: doc ids delta + varint coded, each followed by the
+//              field-weighted term frequency.
+//   Ranking    BM25 over the field-weighted frequencies, plus a popularity
+//              prior from rating and downloadCount.
+//
+// All query terms must match. The last query word is also matched as a
+// prefix while it is being typed ("zel" finds "zelda"). A query word that
+// matches no term at all falls back to the words of names and developers
+// within a small edit distance (TrigramIndex), scored below exact hits.
+// =============================================================================
+
+#pragma once
+
+#include "EntryStore.hpp"
+#include "TrigramIndex.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// =============================================================================
+// SearchIndex - Immutable full-text index over a vector of entries
+// =============================================================================
+class SearchIndex {
+public:
+    // One match: position in the entries the index was built from
+    struct Hit {
+        uint32_t position;
+        float score;
+    };
+    
+    // Index entries (positions refer to this store)
+    void build(const EntryStore& entries);
+    
+    // Incremental querying (see SearchSession). A query that extends an
+    // earlier one ("mar" after "ma") matches a subset of it, so when the
+    // earlier match set was exhaustive it can stand in for the catalog.
+    struct Narrowing {
+        const std::vector<uint32_t>* within = nullptr;  // In: sorted positions to search, or all
+        std::vector<uint32_t> matches;                  // Out: every match, sorted
+        bool exhaustive = false;                        // Out: no prefix cap or typo fallback applied
+    };
+    
+    // Best-scoring matches first, at most limit of them
+    std::vector<Hit> search(std::string_view query, size_t limit, Narrowing* narrowing = nullptr) const;
+    
+    size_t memoryUsage() const;
+    
+    // Split text into terms; emit(term, isWord) receives lowercased words
+    // (isWord = true) and CJK bigrams/unigrams. For queries, unigrams are
+    // only emitted for single-character CJK runs, since the bigrams of a
+    // longer run already imply them.
+    template <typename Emit>
+    static void tokenize(std::string_view text, bool forQuery, Emit&& emit);
+
+private:
+    // -------------------------------------------------------------------------
+    // Dictionary: sorted so exact terms and prefixes are binary searches
+    // -------------------------------------------------------------------------
+    struct Term {
+        uint32_t textOffset;        // Into m_termText
+        uint32_t textLength;
+        uint32_t postingsOffset;    // Into m_postings
+        uint32_t skipOffset;        // Into m_skips, (docCount - 1) / SKIP_INTERVAL entries
+        uint32_t docCount;          // Document frequency
+    };
+    
+    // Every SKIP_INTERVAL postings of a term: the document before and the
+    // byte offset to resume decoding from
+    struct Skip {
+        uint32_t doc;
+        uint32_t offset;            // Into m_postings
+    };
+    static constexpr uint32_t SKIP_INTERVAL = 32;
+    
+    // Reads one term's postings for ascending documents, jumping through
+    // the skip table over the ones in between
+    class PostingCursor {
+    public:
+        PostingCursor(const SearchIndex& index, const Term& term);
+        
+        // Whether the term occurs in doc (then tf is its frequency); doc
+        // must not be below the previous call's
+        bool seek(uint32_t doc, uint32_t& tf);
+    
+    private:
+        const uint8_t* m_postings;
+        const Skip* m_skips;
+        uint32_t m_skipCount;
+        uint32_t m_docCount;
+        const uint8_t* m_p;
+        uint32_t m_read = 0;        // Postings decoded
+        uint32_t m_doc = 0;         // Last decoded document
+        uint32_t m_tf = 0;
+        bool m_current = false;     // m_doc is an unconsumed match candidate
+    };
+    
+    std::string_view termText(const Term& term) const {
+        return std::string_view(m_termText.data() + term.textOffset, term.textLength);
+    }
+    
+    // Range of m_terms equal to / starting with text
+    std::pair<size_t, size_t> findTerms(std::string_view text, bool prefix) const;
+    
+    // Field weights folded into term frequencies
+    static constexpr uint32_t NAME_WEIGHT = 3;
+    static constexpr uint32_t DEVELOPER_WEIGHT = 2;
+    static constexpr uint32_t DESCRIPTION_WEIGHT = 1;
+    
+    // A typed prefix expands to at most this many terms (most frequent first)
+    static constexpr size_t MAX_PREFIX_TERMS = 32;
+    
+    // Edits tolerated in a query word with no exact match: none below
+    // FUZZY_MIN_LENGTH bytes (too many short words are one edit apart),
+    // one below FUZZY_TWO_EDITS_LENGTH, two from there on
+    static constexpr size_t FUZZY_MIN_LENGTH = 4;
+    static constexpr size_t FUZZY_TWO_EDITS_LENGTH = 5;
+    
+    std::vector<Term> m_terms;
+    std::string m_termText;
+    std::vector<uint8_t> m_postings;
+    std::vector<Skip> m_skips;
+    std::vector<float> m_docNorm;          // BM25 length normalization per document
+    std::vector<float> m_prior;            // Popularity in [0, 1]
+    TrigramIndex m_fuzzy;                  // Name and developer words, by term id
+};
+
+// =============================================================================
+// Tokenizer
+// =============================================================================
+
+namespace search_detail {
+
+// Decode one UTF-8 code point starting at text[i]; advances i. Malformed
+// bytes decode as themselves so they never stall the tokenizer.
+inline uint32_t decodeUtf8(std::string_view text, size_t& i) {
+    uint8_t c = static_cast<uint8_t>(text[i]);
+    size_t length = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : (c >> 3) == 0x1E ? 4 : 1;
+    if (i + length > text.size()) length = 1;
+    
+    uint32_t cp = length == 1 ? c : length == 2 ? (c & 0x1F) : length == 3 ? (c & 0x0F) : (c & 0x07);
+    for (size_t k = 1; k < length; k++) {
+        cp = (cp << 6) | (static_cast<uint8_t>(text[i + k]) & 0x3F);
+    }
+    i += length;
+    return cp;
+}
+
+inline bool isCjk(uint32_t cp) {
+    return (cp >= 0x4E00 && cp <= 0x9FFF) ||    // CJK unified ideographs
+           (cp >= 0x3400 && cp <= 0x4DBF) ||    // Extension A
+           (cp >= 0x3040 && cp <= 0x30FF) ||    // Hiragana, Katakana
+           (cp >= 0xAC00 && cp <= 0xD7AF) ||    // Hangul syllables
+           (cp >= 0xF900 && cp <= 0xFAFF);      // Compatibility ideographs
+}
+
+inline bool isWordChar(uint32_t cp) {
+    if (cp < 0x80) {
+        return (cp >= 'a' && cp <= 'z') || (cp >= 'A' && cp <= 'Z') || (cp >= '0' && cp <= '9');
+    }
+    return cp >= 0xC0 && cp <= 0x24F && cp != 0xD7 && cp != 0xF7;  // Latin letters with accents
+}
+
+} // namespace search_detail
+
+template <typename Emit>
+void SearchIndex::tokenize(std::string_view text, bool forQuery, Emit&& emit) {
+    using namespace search_detail;
+    
+    std::string word;
+    size_t cjkStart = 0;            // Byte offset of the previous CJK char
+    size_t cjkEnd = 0;
+    size_t cjkRun = 0;              // CJK chars in the current run
+    
+    auto endCjkRun = [&]() {
+        if (forQuery && cjkRun == 1) {
+            emit(text.substr(cjkStart, cjkEnd - cjkStart), false);
+        }
+        cjkRun = 0;
+    };
+    
+    size_t i = 0;
+    while (i < text.size()) {
+        size_t start = i;
+        uint32_t cp = decodeUtf8(text, i);
+        
+        if (isCjk(cp)) {
+            if (!word.empty()) {
+                emit(std::string_view(word), true);
+                word.clear();
+            }
+            if (!forQuery) {
+                emit(text.substr(start, i - start), false);
+            }
+            if (cjkRun > 0) {
+                emit(text.substr(cjkStart, i - cjkStart), false);
+            }
+            cjkStart = start;
+            cjkEnd = i;
+            cjkRun++;
+            continue;
+        }
+        if (cjkRun > 0) endCjkRun();
+        
+        if (isWordChar(cp)) {
+            if (cp < 0x80) {
+                word += static_cast<char>(cp >= 'A' && cp <= 'Z' ? cp + ('a' - 'A') : cp);
+            } else {
+                word.append(text.data() + start, i - start);
+            }
+        } else if (!word.empty()) {
+            emit(std::string_view(word), true);
+            word.clear();
+        }
+    }
+    if (cjkRun > 0) endCjkRun();
+    if (!word.empty()) {
+        emit(std::string_view(word), true);
+    }
+}
@@ -0,0 +1,104 @@
+// =============================================================================
+// Switch App Store - Search Session Implementation
+// =============================================================================
+
+#include "SearchSession.hpp"
+#include <utility>
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+void SearchSession::setQuery(const std::string& query) {
+    m_pendingQuery = query;
+    m_pending = true;
+}
+
+bool SearchSession::update() {
+    // A refresh invalidates every cached position. Copies that only
+    // update counters share the index, and with it the positions.
+    CatalogHandle catalog = StoreManager::getInstance().getCatalog();
+    bool catalogChanged = catalog != m_catalog;
+    if (catalogChanged) {
+        if (!catalog || !m_catalog || catalog->searchIndex != m_catalog->searchIndex) {
+            m_cache.clear();
+        }
+        m_catalog = std::move(catalog);
+    }
+    
+    if (m_pending) {
+        m_pending = false;
+        if (m_pendingQuery == m_query && !catalogChanged) return false;
+        m_query = std::move(m_pendingQuery);
+        m_pendingQuery.clear();
+    } else if (!catalogChanged || m_query.empty()) {
+        return false;
+    }
+    
+    run(m_query);
+    return true;
+}
+
+void SearchSession::clear() {
+    m_cache.clear();
+    m_query.clear();
+    m_pendingQuery.clear();
+    m_pending = false;
+    m_results.clear();
+}
+
+// =============================================================================
+// Search
+// =============================================================================
+
+void SearchSession::run(const std::string& query) {
+    m_results.clear();
+    if (query.empty() || !m_catalog || !m_catalog->searchIndex) return;
+    
+    auto publish = [this](const std::vector<SearchIndex::Hit>& hits) {
+        for (const auto& hit : hits) {
+            m_results.push_back(m_catalog->entries[hit.position]);
+        }
+    };
+    
+    // -------------------------------------------------------------------------
+    // Seen recently: move it to the back of the LRU
+    // -------------------------------------------------------------------------
+    for (size_t i = 0; i < m_cache.size(); i++) {
+        if (m_cache[i].query != query) continue;
+        
+        CachedQuery cached = std::move(m_cache[i]);
+        m_cache.erase(m_cache.begin() + i);
+        publish(cached.hits);
+        m_cache.push_back(std::move(cached));
+        return;
+    }
+    
+    // -------------------------------------------------------------------------
+    // Otherwise narrow to the longest cached query this one extends. Typing
+    // only adds constraints, so its matches are a superset of ours.
+    // -------------------------------------------------------------------------
+    SearchIndex::Narrowing narrowing;
+    size_t longest = 0;
+    for (const auto& cached : m_cache) {
+        if (cached.narrowable && cached.query.size() > longest && cached.query.size() < query.size() &&
+            query.compare(0, cached.query.size(), cached.query) == 0) {
+            narrowing.within = &cached.matches;
+            longest = cached.query.size();
+        }
+    }
+    
+    CachedQuery result;
+    result.query = query;
+    result.hits = m_catalog->searchIndex->search(query, RESULT_LIMIT, &narrowing);
+    if (narrowing.exhaustive && narrowing.matches.size() <= MAX_CACHED_MATCHES) {
+        result.matches = std::move(narrowing.matches);
+        result.narrowable = true;
+    }
+    publish(result.hits);
+    
+    if (m_cache.size() >= CACHE_SIZE) {
+        m_cache.erase(m_cache.begin());
+    }
+    m_cache.push_back(std::move(result));
+}
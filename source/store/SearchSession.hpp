@@ -0,0 +1,71 @@
+// =============================================================================
+// Switch App Store - Search Session
+// =============================================================================
+// Search-as-you-type on top of the pinned catalog's SearchIndex. Each
+// keystroke only records the query; update() runs the newest one once per
+// frame, so keystrokes that arrive in the same frame never cost a search.
+//
+//   Reuse       Recent results are kept in a small LRU, so deleting a
+//               character or retyping a query is a lookup.
+//   Narrowing   A query that extends a cached one ("mari" after "mar")
+//               only searches that query's matches instead of the catalog.
+//
+// Main thread only.
+// =============================================================================
+
+#pragma once
+
+#include "Catalog.hpp"
+#include <string>
+#include <vector>
+
+// =============================================================================
+// SearchSession - Incremental queries against the store catalog
+// =============================================================================
+class SearchSession {
+public:
+    // Results per query, best first
+    static constexpr size_t RESULT_LIMIT = 100;
+    
+    // Queries kept for reuse
+    static constexpr size_t CACHE_SIZE = 16;
+    
+    // Match sets above this size are not kept for narrowing (4 bytes each);
+    // narrowing to a large share of the catalog barely pays off anyway
+    static constexpr size_t MAX_CACHED_MATCHES = 8192;
+    
+    // Search for query at the next update(), replacing any query that has
+    // not run yet
+    void setQuery(const std::string& query);
+    
+    // Run the pending query, and the current one again if a new catalog
+    // was published. Returns true if results() changed.
+    bool update();
+    
+    // Results of query(); valid until the next update() or clear()
+    const std::vector<EntryView>& results() const { return m_results; }
+    
+    // The query results() belong to
+    const std::string& query() const { return m_query; }
+    
+    // Forget the query, its results and the cache
+    void clear();
+
+private:
+    struct CachedQuery {
+        std::string query;
+        std::vector<SearchIndex::Hit> hits;
+        std::vector<uint32_t> matches;      // Every match, if narrowable
+        bool narrowable = false;
+    };
+    
+    // Run query against m_catalog (cached or narrowed if possible)
+    void run(const std::string& query);
+    
+    CatalogHandle m_catalog;                // Version the cache belongs to
+    std::vector<CachedQuery> m_cache;       // Least recently used first
+    std::string m_query;
+    std::string m_pendingQuery;
+    bool m_pending = false;
+    std::vector<EntryView> m_results;
+};
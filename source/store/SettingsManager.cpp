@@ -3,6 +3,7 @@
 // =============================================================================
 
 #include "SettingsManager.hpp"
+#include "utils/FileUtils.hpp"
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -41,18 +42,43 @@ void SettingsManager::setDefaults() {
 // =============================================================================
 
 void SettingsManager::load() {
-    FILE* file = fopen(m_settingsPath.c_str(), "r");
-    if (!file) return;
+    std::string content;
+    if (!FileUtils::readFile(m_settingsPath, content)) return;
     
-    char line[512];
-    while (fgets(line, sizeof(line), file)) {
+    // Older builds wrote "key=value" lines
+    size_t first = content.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos || content[first] != '{') {
+        loadLegacy(content);
+        m_dirty = true;     // Rewrite as JSON on the next save
+        return;
+    }
+    
+    json::Document doc = json::parseDocument(std::move(content));
+    const json::Node& root = doc.root();
+    if (!root.isObject()) return;
+    
+    for (const json::Member& member : root) {
+        if (member.value.isString()) {
+            m_settings[member.key.asString()] = member.value.asString();
+        }
+    }
+    m_dirty = false;
+}
+
+void SettingsManager::loadLegacy(const std::string& content) {
+    size_t pos = 0;
+    while (pos < content.size()) {
+        size_t end = content.find('\n', pos);
+        if (end == std::string::npos) end = content.size();
+        std::string line = content.substr(pos, end - pos);
+        pos = end + 1;
+        
         // Parse "key=value" format
-        char* eq = strchr(line, '=');
-        if (!eq) continue;
+        size_t eq = line.find('=');
+        if (eq == std::string::npos) continue;
         
-        *eq = '\0';
-        std::string key = line;
-        std::string value = eq + 1;
+        std::string key = line.substr(0, eq);
+        std::string value = line.substr(eq + 1);
         
         // Remove newline
         while (!value.empty() && (value.back() == '\n' || value.back() == '\r')) {
@@ -66,19 +92,36 @@ void SettingsManager::load() {
         
         m_settings[key] = value;
     }
-    
-    fclose(file);
 }
 
 void SettingsManager::save() {
-    FILE* file = fopen(m_settingsPath.c_str(), "w");
-    if (!file) return;
+    if (!m_dirty) return;
     
+    m_writer.clear();
+    m_writer.beginObject();
     for (const auto& pair : m_settings) {
-        fprintf(file, "%s=%s\n", pair.first.c_str(), pair.second.c_str());
+        m_writer.key(pair.first).value(pair.second);
     }
+    m_writer.endObject();
     
-    fclose(file);
+    if (FileUtils::writeFileAtomic(m_settingsPath, m_writer.str())) {
+        m_dirty = false;
+    }
+}
+
+void SettingsManager::assign(const std::string& key, const std::string& value) {
+    auto it = m_settings.find(key);
+    if (it == m_settings.end()) {
+        m_settings.emplace(key, value);
+        m_dirty = true;
+    } else if (it->second != value) {
+        it->second = value;
+        m_dirty = true;
+    }
+    
+    if (m_onChange) {
+        m_onChange(key);
+    }
 }
 
 // =============================================================================
@@ -93,11 +136,7 @@ bool SettingsManager::getBool(const std::string& key, bool defaultValue) const {
 }
 
 void SettingsManager::setBool(const std::string& key, bool value) {
-    m_settings[key] = value ? "true" : "false";
-    
-    if (m_onChange) {
-        m_onChange(key);
-    }
+    assign(key, value ? "true" : "false");
 }
 
 // =============================================================================
@@ -114,11 +153,7 @@ int SettingsManager::getInt(const std::string& key, int defaultValue) const {
 void SettingsManager::setInt(const std::string& key, int value) {
     char buf[32];
     snprintf(buf, sizeof(buf), "%d", value);
-    m_settings[key] = buf;
-    
-    if (m_onChange) {
-        m_onChange(key);
-    }
+    assign(key, buf);
 }
 
 // =============================================================================
@@ -135,11 +170,7 @@ float SettingsManager::getFloat(const std::string& key, float defaultValue) cons
 void SettingsManager::setFloat(const std::string& key, float value) {
     char buf[32];
     snprintf(buf, sizeof(buf), "%.4f", value);
-    m_settings[key] = buf;
-    
-    if (m_onChange) {
-        m_onChange(key);
-    }
+    assign(key, buf);
 }
 
 // =============================================================================
@@ -155,9 +186,5 @@ std::string SettingsManager::getString(const std::string& key,
 }
 
 void SettingsManager::setString(const std::string& key, const std::string& value) {
-    m_settings[key] = value;
-    
-    if (m_onChange) {
-        m_onChange(key);
-    }
+    assign(key, value);
 }
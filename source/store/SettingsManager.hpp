@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "json.hpp"
 #include <string>
 #include <map>
 #include <functional>
@@ -34,6 +35,8 @@ public:
     // Initialization
     // -------------------------------------------------------------------------
     void init(const std::string& settingsPath);
+    
+    // Write settings to disk if anything changed since the last load/save
     void save();
     
     // -------------------------------------------------------------------------
@@ -112,9 +115,15 @@ private:
     SettingsManager& operator=(const SettingsManager&) = delete;
     
     void load();
+    void loadLegacy(const std::string& content);
     void setDefaults();
     
+    // Store a value, mark the file dirty if it changed and notify
+    void assign(const std::string& key, const std::string& value);
+    
     std::string m_settingsPath;
     std::map<std::string, std::string> m_settings;
+    json::Writer m_writer{2};           // Reused across saves
+    bool m_dirty = false;               // Unsaved changes since load/save
     SettingChangeCallback m_onChange;
 };
@@ -3,6 +3,12 @@
 // =============================================================================
 
 #include "StoreManager.hpp"
+#include "Catalog.hpp"
+#include "CatalogParser.hpp"
+#include "CatalogSnapshot.hpp"
+#include "EntryStore.hpp"
+#include "network/HttpCache.hpp"
+#include "utils/FileUtils.hpp"
 #include "json.hpp"
 #include <cstdio>
 #include <ctime>
@@ -12,20 +18,42 @@
 // StoreEntry helpers
 // =============================================================================
 
-std::string StoreEntry::getFormattedSize() const {
+std::string StoreEntry::formatSize(size_t bytes) {
     char buf[32];
-    if (fileSize >= 1024ULL * 1024 * 1024) {
-        snprintf(buf, sizeof(buf), "%.1f GB", fileSize / (1024.0 * 1024.0 * 1024.0));
-    } else if (fileSize >= 1024 * 1024) {
-        snprintf(buf, sizeof(buf), "%.1f MB", fileSize / (1024.0 * 1024.0));
-    } else if (fileSize >= 1024) {
-        snprintf(buf, sizeof(buf), "%.1f KB", fileSize / 1024.0);
+    if (bytes >= 1024ULL * 1024 * 1024) {
+        snprintf(buf, sizeof(buf), "%.1f GB", bytes / (1024.0 * 1024.0 * 1024.0));
+    } else if (bytes >= 1024 * 1024) {
+        snprintf(buf, sizeof(buf), "%.1f MB", bytes / (1024.0 * 1024.0));
+    } else if (bytes >= 1024) {
+        snprintf(buf, sizeof(buf), "%.1f KB", bytes / 1024.0);
     } else {
-        snprintf(buf, sizeof(buf), "%zu B", fileSize);
+        snprintf(buf, sizeof(buf), "%zu B", bytes);
     }
     return std::string(buf);
 }
 
+int32_t StoreEntry::parseReleaseDate(const std::string& date) {
+    // Up to three dash-separated numbers: year, month, day
+    int32_t parts[3] = {0, 0, 0};
+    size_t part = 0;
+    size_t digits = 0;
+    for (char c : date) {
+        if (c >= '0' && c <= '9') {
+            if (++digits > 4) return 0;
+            parts[part] = parts[part] * 10 + (c - '0');
+        } else if (c == '-' && digits > 0 && part < 2) {
+            part++;
+            digits = 0;
+        } else if (c == 'T' || c == ' ') {
+            break;          // Time of day
+        } else {
+            return 0;
+        }
+    }
+    if (parts[0] < 1000 || parts[1] > 12 || parts[2] > 31) return 0;
+    return parts[0] * 10000 + parts[1] * 100 + parts[2];
+}
+
 // =============================================================================
 // Singleton
 // =============================================================================
@@ -41,16 +69,21 @@ StoreManager& StoreManager::getInstance() {
 
 void StoreManager::init(const std::string& configPath) {
     m_configPath = configPath;
-    m_httpClient = std::make_unique<HttpClient>();
+    m_snapshotPath = configPath.substr(0, configPath.find_last_of('/') + 1) + "catalog.bin";
+    m_refreshClient = std::make_unique<HttpClient>();
+    m_detailClient = std::make_unique<HttpClient>();
     
-    // Initialize default categories
-    m_categories = {
+    // Start from an empty catalog with the default categories
+    auto initial = std::make_shared<Catalog>();
+    initial->categories = {
         {"games", "游戏", "game"},
         {"homebrew", "自制软件", "app"},
         {"emulators", "模拟器", "gamepad"},
         {"tools", "工具", "tool"},
         {"themes", "主题", "palette"},
     };
+    publish(std::move(initial));
+    m_pinned = std::atomic_load(&m_catalog);
     
     loadConfig();
     
@@ -58,15 +91,80 @@ void StoreManager::init(const std::string& configPath) {
     if (m_sources.empty()) {
         addDefaultSource();
     }
+    
+    // Serve the last good catalog right away; the network refresh is
+    // started from update() once the UI is up
+    loadSnapshot();
+}
+
+void StoreManager::update() {
+    // Pin the newest published catalog for this frame. Catalogs published
+    // mid-frame are picked up on the next one, so nothing the UI got from
+    // the accessors changes while it is being used.
+    m_pinned = std::atomic_load(&m_catalog);
+    
+    if (m_isRefreshing && m_refreshFinished.load(std::memory_order_acquire)) {
+        finishRefresh();
+    }
+    
+    finishEntryDetails();
+    
+    if (!m_isRefreshing && needsRefresh()) {
+        refresh();
+    }
 }
 
 void StoreManager::shutdown() {
+    // Never initialized, or shut down already: saving now would write an
+    // empty source list over the config
+    if (!m_refreshClient) return;
+    
+    // Abort the transfer in flight instead of waiting for it
+    m_cancelRefresh = true;
+    if (m_refreshThread.joinable()) {
+        m_refreshThread.join();
+    }
+    m_isRefreshing = false;
+    
+    {
+        std::lock_guard<std::mutex> lock(m_detailMutex);
+        m_stopDetails = true;
+        m_detailQueue.clear();
+    }
+    m_detailWake.notify_all();
+    if (m_detailThread.joinable()) {
+        m_detailThread.join();
+    }
+    m_detailResults.clear();
+    m_detailCache.clear();
+    m_detailPending.clear();
+    
     saveConfig();
-    m_httpClient.reset();
-    m_entries.clear();
+    m_refreshClient.reset();
+    m_detailClient.reset();
+    m_pinned.reset();
+    std::atomic_store(&m_catalog, std::shared_ptr<const Catalog>());
     m_sources.clear();
 }
 
+StoreManager::~StoreManager() {
+    // A thread that is still joinable at destruction calls std::terminate,
+    // so both workers are stopped even if shutdown() never ran
+    m_cancelRefresh = true;
+    if (m_refreshThread.joinable()) {
+        m_refreshThread.join();
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_detailMutex);
+        m_stopDetails = true;
+    }
+    m_detailWake.notify_all();
+    if (m_detailThread.joinable()) {
+        m_detailThread.join();
+    }
+}
+
 // =============================================================================
 // Source Management
 // =============================================================================
@@ -107,66 +205,230 @@ void StoreManager::setSourceEnabled(const std::string& id, bool enabled) {
 // Catalog Access
 // =============================================================================
 
-std::vector<const StoreEntry*> StoreManager::getEntriesByCategory(
-    const std::string& category) const {
-    std::vector<const StoreEntry*> result;
-    for (const auto& entry : m_entries) {
-        if (entry.category == category) {
-            result.push_back(&entry);
-        }
+EntrySpan StoreManager::getAllEntries() const {
+    return m_pinned->sorted(EntrySort::Catalog, 0, SIZE_MAX);
+}
+
+const std::vector<StoreCategory>& StoreManager::getCategories() const {
+    return m_pinned->categories;
+}
+
+uint32_t StoreManager::getCatalogVersion() const {
+    return m_pinned ? m_pinned->version : 0;
+}
+
+EntrySpan StoreManager::getEntriesByCategory(const std::string& category) const {
+    return m_pinned->byCategory(category);
+}
+
+std::vector<EntryView> StoreManager::getFeaturedEntries(int count) const {
+    // Highest rating + download count (simple popularity score)
+    std::vector<EntryView> result;
+    for (EntryView entry : m_pinned->sorted(EntrySort::Popularity, 0, std::max(count, 0))) {
+        result.push_back(entry);
     }
     return result;
 }
 
-std::vector<const StoreEntry*> StoreManager::getFeaturedEntries(int count) const {
-    std::vector<const StoreEntry*> result;
-    
-    // Sort by rating + download count (simple popularity score)
-    std::vector<std::pair<float, const StoreEntry*>> scored;
-    for (const auto& entry : m_entries) {
-        float score = entry.rating * 10 + entry.downloadCount / 1000.0f;
-        scored.push_back({score, &entry});
+EntrySpan StoreManager::getSortedEntries(EntrySort sort, size_t first, size_t count) const {
+    return m_pinned->sorted(sort, first, count);
+}
+
+std::vector<EntryView> StoreManager::filterEntries(const EntryFilter& filter, EntrySort sort,
+                                                  size_t limit) const {
+    std::vector<EntryView> result;
+    for (uint32_t position : m_pinned->filter(filter, sort, limit)) {
+        result.push_back(m_pinned->entries[position]);
     }
+    return result;
+}
+
+FacetCounts StoreManager::getFacetCounts(const EntryFilter& filter) const {
+    return m_pinned->facets ? m_pinned->facets->counts(filter) : FacetCounts();
+}
+
+std::vector<EntryView> StoreManager::search(const std::string& query, size_t limit) const {
+    return m_pinned->search(query, limit);
+}
+
+EntryView StoreManager::getEntry(const std::string& id) const {
+    return m_pinned->find(id);
+}
+
+EntryView StoreManager::getEntryByTitleId(const std::string& titleId) const {
+    return m_pinned->findByTitleId(titleId);
+}
+
+// =============================================================================
+// Entry Details
+// =============================================================================
+
+bool StoreManager::getEntryDetail(const std::string& id, EntryDetail& out) {
+    EntryView entry = m_pinned->find(id);
+    if (!entry) return false;
     
-    std::sort(scored.begin(), scored.end(),
-              [](const auto& a, const auto& b) { return a.first > b.first; });
-    
-    for (int i = 0; i < count && i < (int)scored.size(); i++) {
-        result.push_back(scored[i].second);
+    // Sources that do not support the lite view send everything inline
+    if (!entry.description().empty() || !entry.screenshotUrls().empty()) {
+        out.description = std::string(entry.description());
+        out.screenshotUrls = entry.screenshotUrls();
+        return true;
     }
     
-    return result;
+    // A detail fetched for another version of the entry is stale
+    for (size_t i = 0; i < m_detailCache.size(); i++) {
+        if (m_detailCache[i].id == id && m_detailCache[i].version == entry.version()) {
+            CachedDetail hit = std::move(m_detailCache[i]);
+            m_detailCache.erase(m_detailCache.begin() + i);
+            m_detailCache.push_back(std::move(hit));
+            out = m_detailCache.back().detail;
+            return true;
+        }
+    }
+    return false;
+}
+
+void StoreManager::requestEntryDetail(const std::string& id) {
+    queueEntryDetail(id, false);
+}
+
+void StoreManager::prefetchEntryDetail(const std::string& id) {
+    queueEntryDetail(id, true);
 }
 
-std::vector<const StoreEntry*> StoreManager::search(const std::string& query) const {
-    std::vector<const StoreEntry*> result;
+bool StoreManager::isFetchingEntryDetail(const std::string& id) const {
+    return std::find(m_detailPending.begin(), m_detailPending.end(), id) != m_detailPending.end();
+}
+
+void StoreManager::queueEntryDetail(const std::string& id, bool prefetch) {
+    EntryView entry = m_pinned->find(id);
+    if (!entry) return;
+    
+    if (isFetchingEntryDetail(id)) {
+        // A detail page waiting on a queued prefetch moves it to the front
+        if (!prefetch) {
+            std::lock_guard<std::mutex> lock(m_detailMutex);
+            for (size_t i = 0; i < m_detailQueue.size(); i++) {
+                if (m_detailQueue[i].id == id) {
+                    DetailRequest request = std::move(m_detailQueue[i]);
+                    request.prefetch = false;
+                    m_detailQueue.erase(m_detailQueue.begin() + i);
+                    m_detailQueue.push_front(std::move(request));
+                    break;
+                }
+            }
+        }
+        return;
+    }
     
-    std::string lowerQuery = query;
-    std::transform(lowerQuery.begin(), lowerQuery.end(), lowerQuery.begin(), ::tolower);
+    EntryDetail cached;
+    if (getEntryDetail(id, cached)) return;
     
-    for (const auto& entry : m_entries) {
-        std::string lowerName = entry.name;
-        std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
-        
-        std::string lowerDev = entry.developer;
-        std::transform(lowerDev.begin(), lowerDev.end(), lowerDev.begin(), ::tolower);
-        
-        if (lowerName.find(lowerQuery) != std::string::npos ||
-            lowerDev.find(lowerQuery) != std::string::npos) {
-            result.push_back(&entry);
+    const StoreSource* source = nullptr;
+    for (const auto& s : m_sources) {
+        if (s.id == entry.sourceId()) source = &s;
+    }
+    if (!source) return;
+    
+    DetailRequest request;
+    request.id = id;
+    request.version = std::string(entry.version());
+    request.url = source->url + "/api/catalog/game/" + HttpClient::urlEncode(id);
+    request.baseUrl = source->url;
+    request.prefetch = prefetch;
+    
+    std::vector<std::string> dropped;
+    {
+        std::lock_guard<std::mutex> lock(m_detailMutex);
+        if (prefetch) {
+            for (auto it = m_detailQueue.begin(); it != m_detailQueue.end();) {
+                if (it->prefetch) {
+                    dropped.push_back(std::move(it->id));
+                    it = m_detailQueue.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            m_detailQueue.push_back(std::move(request));
+        } else {
+            m_detailQueue.push_front(std::move(request));
         }
     }
+    m_detailWake.notify_one();
     
-    return result;
+    for (const auto& droppedId : dropped) {
+        auto pending = std::find(m_detailPending.begin(), m_detailPending.end(), droppedId);
+        if (pending != m_detailPending.end()) m_detailPending.erase(pending);
+    }
+    m_detailPending.push_back(id);
+    
+    if (!m_detailThread.joinable()) {
+        m_detailThread = std::thread(&StoreManager::runDetailWorker, this);
+    }
 }
 
-const StoreEntry* StoreManager::getEntry(const std::string& id) const {
-    for (const auto& entry : m_entries) {
-        if (entry.id == id) {
-            return &entry;
+void StoreManager::runDetailWorker() {
+    // -------------------------------------------------------------------------
+    // Runs on the detail worker thread, one request at a time
+    // -------------------------------------------------------------------------
+    for (;;) {
+        DetailResult result;
+        {
+            std::unique_lock<std::mutex> lock(m_detailMutex);
+            m_detailWake.wait(lock, [this]() { return m_stopDetails || !m_detailQueue.empty(); });
+            if (m_stopDetails) return;
+            result.request = std::move(m_detailQueue.front());
+            m_detailQueue.pop_front();
+        }
+        
+        // Expected format: { success: true, data: { description, screenshotUrls, ... } }
+        // Through the HttpCache, so an entry opened before is answered (or
+        // revalidated) from disk. A transfer still running when shutdown()
+        // sets m_stopDetails is aborted within 100 ms.
+        HttpResponse response = m_detailClient->get(result.request.url, HttpOptions(),
+                                                     [this]() { return m_stopDetails.load(); });
+        if (response.isSuccess()) {
+            json::Document root = json::parseDocument(std::move(response.body));
+            const json::Node& data = root["data"];
+            if (root["success"].asBool(false) && data.isObject()) {
+                result.detail.description = data["description"].asString();
+                const json::Node& screenshots = data["screenshotUrls"];
+                for (size_t i = 0; i < screenshots.size(); i++) {
+                    result.detail.screenshotUrls.push_back(
+                        CatalogParser::resolveUrl(result.request.baseUrl, screenshots[i].asString()));
+                }
+                result.success = true;
+            }
+        }
+        
+        std::lock_guard<std::mutex> lock(m_detailMutex);
+        m_detailResults.push_back(std::move(result));
+    }
+}
+
+void StoreManager::finishEntryDetails() {
+    std::vector<DetailResult> results;
+    {
+        std::lock_guard<std::mutex> lock(m_detailMutex);
+        if (m_detailResults.empty()) return;
+        results.swap(m_detailResults);
+    }
+    
+    for (auto& result : results) {
+        const std::string& id = result.request.id;
+        auto pending = std::find(m_detailPending.begin(), m_detailPending.end(), id);
+        if (pending != m_detailPending.end()) m_detailPending.erase(pending);
+        if (!result.success) continue;
+        
+        // Replaces an earlier fetch of the entry; the least recently used
+        // detail goes once the cache is full
+        m_detailCache.erase(std::remove_if(m_detailCache.begin(), m_detailCache.end(),
+            [&id](const CachedDetail& cached) { return cached.id == id; }),
+            m_detailCache.end());
+        m_detailCache.push_back({id, std::move(result.request.version), std::move(result.detail)});
+        if (m_detailCache.size() > DETAIL_CACHE_SIZE) {
+            m_detailCache.erase(m_detailCache.begin());
         }
     }
-    return nullptr;
 }
 
 // =============================================================================
@@ -182,166 +444,292 @@ void StoreManager::refresh() {
     if (m_isRefreshing) return;
     
     m_isRefreshing = true;
-    m_entries.clear();
+    m_refreshFinished = false;
+    m_cancelRefresh = false;
+    
+    // The worker gets its own copy of the sources and builds on the latest
+    // published catalog; the main thread keeps rendering the pinned one
+    m_refreshThread = std::thread(&StoreManager::runRefresh, this,
+                                  std::atomic_load(&m_catalog), m_sources);
+}
+
+void StoreManager::runRefresh(std::shared_ptr<const Catalog> base,
+                              std::vector<StoreSource> sources) {
+    // -------------------------------------------------------------------------
+    // Runs on the worker thread. Published catalogs are never modified, so
+    // the new version starts as a private copy of base.
+    // -------------------------------------------------------------------------
+    auto next = std::make_shared<Catalog>(*base);
+    base.reset();
     
     bool anySuccess = false;
+    bool changed = false;
     std::string lastError;
     
-    for (const auto& source : m_sources) {
+    // -------------------------------------------------------------------------
+    // Request every enabled source at once. Each response is parsed as it
+    // streams in, so by the time the slowest source finishes the others
+    // are already parsed.
+    // -------------------------------------------------------------------------
+    std::vector<size_t> fetched;                    // Index into sources
+    std::vector<std::unique_ptr<CatalogParser>> parsers;
+    std::vector<HttpStreamRequest> requests;
+    
+    for (size_t i = 0; i < sources.size(); i++) {
+        const StoreSource& source = sources[i];
         if (!source.enabled) continue;
         
-        // -------------------------------------------------------------------------
-        // Construct the API URL. The server uses /api/catalog, not /api/catalog.json
-        // -------------------------------------------------------------------------
-        std::string apiUrl = source.url + "/api/catalog";
-        HttpResponse response = m_httpClient->get(apiUrl);
+        // The server uses /api/catalog, not /api/catalog.json. The lite
+        // view leaves out descriptions and screenshots, which are fetched
+        // per entry when a detail page needs them. With a cursor from the
+        // last sync only the changes are sent back.
+        HttpStreamRequest request;
+        request.url = source.url + "/api/catalog?view=lite";
+        if (!source.cursor.empty()) {
+            request.url += "&since=" + HttpClient::urlEncode(source.cursor);
+        }
+        if (!source.etag.empty()) {
+            request.options.headers["If-None-Match"] = source.etag;
+        }
+        
+        // Returning false on shutdown makes curl abort the transfer. The
+        // status is known before the first body byte: an error page is
+        // drained unparsed, so lastError reports "HTTP <code>" rather than
+        // the write error a failed parse would cause.
+        parsers.push_back(std::make_unique<CatalogParser>(source.url));
+        CatalogParser* parser = parsers.back().get();
+        size_t index = requests.size();
+        request.onData = [this, parser, &requests, index](const char* data, size_t size) {
+            if (m_cancelRefresh.load(std::memory_order_relaxed)) return false;
+            return !requests[index].response.isSuccess() || parser->feed(data, size);
+        };
         
-        if (response.isSuccess()) {
-            parseCatalog(response.body, source.id, source.url);
+        fetched.push_back(i);
+        requests.push_back(std::move(request));
+    }
+    
+    m_refreshClient->getStreamedAll(requests, [this]() {
+        return m_cancelRefresh.load(std::memory_order_relaxed);
+    });
+    
+    // -------------------------------------------------------------------------
+    // Merge in a fixed order regardless of which response arrived first:
+    // lowest priority first, so the categories of the highest-priority
+    // source are applied last. Which duplicate stays visible is decided by
+    // resolve() below.
+    // -------------------------------------------------------------------------
+    std::vector<size_t> mergeOrder(fetched.size());
+    for (size_t k = 0; k < mergeOrder.size(); k++) mergeOrder[k] = k;
+    std::stable_sort(mergeOrder.begin(), mergeOrder.end(), [&](size_t a, size_t b) {
+        return sources[fetched[a]].priority < sources[fetched[b]].priority;
+    });
+    
+    for (size_t k : mergeOrder) {
+        StoreSource& source = sources[fetched[k]];
+        HttpResponse& response = requests[k].response;
+        CatalogParser& parser = *parsers[k];
+        
+        if (response.isNotModified()) {
+            anySuccess = true;
+            continue;
+        }
+        
+        if (response.isSuccess() && parser.finish() && parser.isSuccess()) {
+            next->merge(source.id, parser);
+            source.etag = response.getHeader("etag");
+            source.cursor = parser.getCursor();
             anySuccess = true;
+            changed = true;
         } else {
             lastError = response.error;
             if (lastError.empty()) {
-                lastError = "HTTP " + std::to_string(response.statusCode);
+                lastError = response.isSuccess() ? "Invalid catalog response"
+                                                 : "HTTP " + std::to_string(response.statusCode);
+            }
+        }
+    }
+    
+    // Entries of sources that were removed or disabled since the last sync
+    if (next->retainSources(sources)) {
+        changed = true;
+    }
+    
+    if (!m_cancelRefresh) {
+        if (changed) {
+            next->resolve(sources);
+            publish(next);
+        }
+        if (anySuccess) {
+            // Also records the refresh time when everything was a 304
+            saveSnapshot(*next, sources, static_cast<uint64_t>(time(nullptr)));
+        }
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_refreshMutex);
+        m_refreshResult.success = anySuccess;
+        m_refreshResult.error = anySuccess ? "" : lastError;
+        m_refreshResult.sources = std::move(sources);
+    }
+    m_refreshFinished.store(true, std::memory_order_release);
+}
+
+void StoreManager::finishRefresh() {
+    m_refreshThread.join();
+    
+    RefreshResult result;
+    {
+        std::lock_guard<std::mutex> lock(m_refreshMutex);
+        result = std::move(m_refreshResult);
+        m_refreshResult = RefreshResult();
+    }
+    
+    // Sources may have been added or removed meanwhile, so the sync state
+    // is copied back by id
+    for (const auto& state : result.sources) {
+        for (auto& source : m_sources) {
+            if (source.id == state.id) {
+                source.etag = state.etag;
+                source.cursor = state.cursor;
             }
         }
     }
     
     m_lastRefreshTime = static_cast<uint64_t>(time(nullptr));
     m_isRefreshing = false;
+    m_refreshFinished = false;
+    
+    // The worker may have published after this frame was pinned
+    m_pinned = std::atomic_load(&m_catalog);
     
     if (m_onRefreshComplete) {
-        m_onRefreshComplete(anySuccess, anySuccess ? "" : lastError);
+        m_onRefreshComplete(result.success, result.error);
+    }
+}
+
+void StoreManager::publish(std::shared_ptr<Catalog> catalog) {
+    std::lock_guard<std::mutex> lock(m_publishMutex);
+    applyReportedCounts(*catalog);
+    catalog->version = ++m_versionCounter;
+    std::atomic_store(&m_catalog, std::shared_ptr<const Catalog>(std::move(catalog)));
+}
+
+void StoreManager::applyReportedCounts(Catalog& catalog) const {
+    // Counts only grow, so a lower one in catalog is older than the report
+    for (const auto& reported : m_reportedCounts) {
+        EntryView entry = catalog.find(reported.first);
+        if (entry && entry.downloadCount() < reported.second) {
+            catalog.setDownloadCount(entry.position(), reported.second);
+        }
     }
 }
 
 // =============================================================================
-// JSON Parsing (Simplified)
+// Catalog Parsing
 // =============================================================================
 
 void StoreManager::parseCatalog(const std::string& jsonStr, const std::string& sourceId, const std::string& baseUrl) {
     // -------------------------------------------------------------------------
-    // Parse the JSON response from /api/catalog
+    // Parse a /api/catalog response that is already in memory
     // Expected format: { success: true, data: { games: [...], categories: [...] } }
     // -------------------------------------------------------------------------
-    
-    json::Value root = json::parse(jsonStr);
-    
-    // Check for success
-    if (!root["success"].asBool(false)) {
-        return;
+    CatalogParser parser(baseUrl);
+    if (parser.feed(jsonStr.data(), jsonStr.size()) && parser.finish() && parser.isSuccess()) {
+        auto next = std::make_shared<Catalog>(*std::atomic_load(&m_catalog));
+        next->merge(sourceId, parser);
+        next->resolve(m_sources);
+        publish(std::move(next));
+        m_pinned = std::atomic_load(&m_catalog);
     }
-    
-    // Get the data object
-    const json::Value& data = root["data"];
-    if (data.isNull()) {
+}
+
+// =============================================================================
+// Snapshot
+// =============================================================================
+
+void StoreManager::loadSnapshot() {
+    auto loaded = std::make_shared<Catalog>();
+    std::vector<StoreEntry> entries;
+    std::vector<StoreSource> syncStates;
+    uint64_t savedAt = 0;
+    if (!CatalogSnapshot::load(m_snapshotPath, entries, loaded->categories,
+                               syncStates, savedAt)) {
         return;
     }
-    
-    // Parse games array
-    const json::Value& games = data["games"];
-    if (games.isArray()) {
-        for (size_t i = 0; i < games.size(); ++i) {
-            const json::Value& game = games[i];
-            
-            StoreEntry entry;
-            entry.id = game["id"].asString();
-            entry.name = game["name"].asString();
-            entry.developer = game["developer"].asString();
-            entry.description = game["description"].asString();
-            entry.category = game["category"].asString();
-            entry.version = game["version"].asString();
-            entry.titleId = game["titleId"].asString();
-            // Helper to resolve relative URLs
-            auto resolveUrl = [&](std::string url) {
-                if (url.empty()) return url;
-                if (url.front() == '/') {
-                    return baseUrl + url;
-                }
-                return url;
-            };
-
-            entry.iconUrl = resolveUrl(game["iconUrl"].asString());
-            entry.downloadUrl = resolveUrl(game["downloadUrl"].asString());
-            entry.fileSize = static_cast<size_t>(game["fileSize"].asNumber(0));
-            entry.rating = static_cast<float>(game["rating"].asNumber(0.0));
-            entry.downloadCount = game["downloadCount"].asInt(0);
-            entry.releaseDate = game["releaseDate"].asString();
-            
-            // Parse screenshot URLs array
-            const json::Value& screenshots = game["screenshotUrls"];
-            if (screenshots.isArray()) {
-                for (size_t j = 0; j < screenshots.size(); ++j) {
-                    entry.screenshotUrls.push_back(resolveUrl(screenshots[j].asString()));
-                }
-            }
-            
-            // Parse languages array
-            const json::Value& languages = game["languages"];
-            if (languages.isArray()) {
-                for (size_t j = 0; j < languages.size(); ++j) {
-                    entry.languages.push_back(languages[j].asString());
-                }
+    loaded->assign(std::move(entries));
+    
+    // ETags and cursors describe the snapshot's entries, so they are only
+    // trusted when those entries were loaded too
+    for (const auto& state : syncStates) {
+        for (auto& source : m_sources) {
+            if (source.id == state.id) {
+                source.etag = state.etag;
+                source.cursor = state.cursor;
             }
-            
-            m_entries.push_back(entry);
         }
     }
     
-    // Parse categories array
-    const json::Value& categories = data["categories"];
-    if (categories.isArray()) {
-        m_categories.clear();
-        for (size_t i = 0; i < categories.size(); ++i) {
-            const json::Value& cat = categories[i];
-            
-            StoreCategory category;
-            category.id = cat["id"].asString();
-            category.name = cat["name"].asString();
-            category.iconName = cat["icon"].asString();
-            
-            m_categories.push_back(category);
-        }
-    }
+    // A recent snapshot counts as a refresh, so startup skips the network
+    m_lastRefreshTime = savedAt;
+    loaded->resolve(m_sources);
+    publish(std::move(loaded));
+    m_pinned = std::atomic_load(&m_catalog);
 }
 
+void StoreManager::saveSnapshot(const Catalog& catalog, const std::vector<StoreSource>& sources,
+                                uint64_t savedAt) {
+    // The snapshot keeps its own string table, so it is written from
+    // plain records rather than the packed entries
+    CatalogSnapshot::save(m_snapshotPath, catalog.entries.unpack(), catalog.shadowed, catalog.categories,
+                          sources, savedAt);
+}
 
 // =============================================================================
 // Configuration
 // =============================================================================
 
 void StoreManager::loadConfig() {
-    FILE* file = fopen(m_configPath.c_str(), "r");
-    if (!file) return;
-    
-    // Read file content
-    fseek(file, 0, SEEK_END);
-    long size = ftell(file);
-    fseek(file, 0, SEEK_SET);
+    std::string content;
+    if (!FileUtils::readFile(m_configPath, content)) return;
     
-    std::string content(size, '\0');
-    fread(&content[0], 1, size, file);
-    fclose(file);
+    json::Document doc = json::parseDocument(std::move(content));
+    const json::Node& sources = doc["sources"];
+    if (!sources.isArray()) return;
     
-    // Parse sources from config (simplified)
-    // Real implementation would parse proper JSON/config format
+    m_sources.clear();
+    for (size_t i = 0; i < sources.size(); i++) {
+        const json::Node& item = sources[i];
+        
+        StoreSource source;
+        source.id = item["id"].asString();
+        source.name = item["name"].asString();
+        source.url = item["url"].asString();
+        source.iconUrl = item["iconUrl"].asString();
+        source.enabled = item["enabled"].asBool(true);
+        source.priority = item["priority"].asInt(0);
+        
+        if (!source.id.empty() && !source.url.empty()) {
+            m_sources.push_back(std::move(source));
+        }
+    }
 }
 
 void StoreManager::saveConfig() {
-    FILE* file = fopen(m_configPath.c_str(), "w");
-    if (!file) return;
-    
-    // Write sources as simple format
-    fprintf(file, "{\n  \"sources\": [\n");
-    for (size_t i = 0; i < m_sources.size(); i++) {
-        const auto& s = m_sources[i];
-        fprintf(file, "    {\"id\":\"%s\",\"name\":\"%s\",\"url\":\"%s\",\"enabled\":%s}%s\n",
-                s.id.c_str(), s.name.c_str(), s.url.c_str(),
-                s.enabled ? "true" : "false",
-                i < m_sources.size() - 1 ? "," : "");
+    m_configWriter.clear();
+    m_configWriter.beginObject().key("sources").beginArray();
+    for (const auto& s : m_sources) {
+        m_configWriter.beginObject()
+            .key("id").value(s.id)
+            .key("name").value(s.name)
+            .key("url").value(s.url)
+            .key("iconUrl").value(s.iconUrl)
+            .key("enabled").value(s.enabled)
+            .key("priority").value(s.priority)
+            .endObject();
     }
-    fprintf(file, "  ]\n}\n");
-    fclose(file);
+    m_configWriter.endArray().endObject();
+    
+    FileUtils::writeFileAtomic(m_configPath, m_configWriter.str());
 }
 
 void StoreManager::addDefaultSource() {
@@ -363,18 +751,13 @@ void StoreManager::addDefaultSource() {
 // Download Statistics
 // =============================================================================
 
-void StoreManager::reportDownload(const std::string& gameId, 
-                                   DownloadReportCallback callback) {
+HttpHandle StoreManager::reportDownload(const std::string& gameId,
+                                         DownloadReportCallback callback) {
     // -------------------------------------------------------------------------
     // Send POST request to /api/catalog/download/:gameId to increment
     // the server-side download counter. Upon success, update local entry.
     // -------------------------------------------------------------------------
     
-    if (!m_httpClient) {
-        if (callback) callback(false, 0);
-        return;
-    }
-    
     // Find the first enabled source to get the base URL
     std::string baseUrl;
     for (const auto& source : m_sources) {
@@ -386,36 +769,47 @@ void StoreManager::reportDownload(const std::string& gameId,
     
     if (baseUrl.empty()) {
         if (callback) callback(false, 0);
-        return;
+        return 0;
     }
     
-    // Construct the API endpoint URL
-    std::string apiUrl = baseUrl + "/api/catalog/download/" + gameId;
-    
-    // Send POST request (empty body for this endpoint)
-    HttpResponse response = m_httpClient->post(apiUrl, "{}");
-    
-    if (response.isSuccess()) {
-        // -------------------------------------------------------------------------
-        // Parse the response JSON to extract the new download count
-        // Expected format: { success: true, data: { newDownloadCount: N } }
-        // -------------------------------------------------------------------------
-        json::Value root = json::parse(response.body);
-        
-        if (root["success"].asBool(false)) {
-            const json::Value& data = root["data"];
-            int newCount = data["newDownloadCount"].asInt(0);
+    // POST to the API endpoint (empty body for this endpoint)
+    HttpRequest request;
+    request.url = baseUrl + "/api/catalog/download/" + HttpClient::urlEncode(gameId);
+    request.method = HttpMethod::Post;
+    request.body = "{}";
+    std::string detailUrl = baseUrl + "/api/catalog/game/" + HttpClient::urlEncode(gameId);
+    request.onComplete = [this, gameId, detailUrl, callback](const HttpResponse& response) {
+        if (response.isSuccess()) {
+            // The cached detail still has the old count
+            HttpCache::getInstance().invalidate(detailUrl);
             
-            // Update local entry with new count
-            updateLocalDownloadCount(gameId, newCount);
+            // -----------------------------------------------------------------
+            // Parse the response JSON to extract the new download count
+            // Expected format: { success: true, data: { newDownloadCount: N } }
+            // -----------------------------------------------------------------
+            json::Document root = json::parseDocument(response.body);
             
-            if (callback) callback(true, newCount);
-            return;
+            if (root["success"].asBool(false)) {
+                const json::Node& data = root["data"];
+                int newCount = data["newDownloadCount"].asInt(0);
+                
+                // Update local entry with new count
+                updateLocalDownloadCount(gameId, newCount);
+                
+                if (callback) callback(true, newCount);
+                return;
+            }
         }
-    }
+        
+        // Failed - call callback with failure
+        if (callback) callback(false, 0);
+    };
     
-    // Failed - call callback with failure
-    if (callback) callback(false, 0);
+    HttpHandle handle = HttpEngine::getInstance().submit(std::move(request));
+    if (handle == 0 && callback) {
+        callback(false, 0);
+    }
+    return handle;
 }
 
 void StoreManager::updateLocalDownloadCount(const std::string& gameId, int newCount) {
@@ -423,11 +817,24 @@ void StoreManager::updateLocalDownloadCount(const std::string& gameId, int newCo
     // Find and update the local entry's download count
     // This keeps the local cache in sync with server data
     // -------------------------------------------------------------------------
-    for (auto& entry : m_entries) {
-        if (entry.id == gameId) {
-            entry.downloadCount = newCount;
-            break;
-        }
+    // Published catalogs are immutable, so the change goes into a copy.
+    // The count is also remembered, and publish() applies it to whatever a
+    // refresh worker publishes later from an older base.
+    {
+        std::lock_guard<std::mutex> lock(m_publishMutex);
+        std::shared_ptr<const Catalog> current = std::atomic_load(&m_catalog);
+        EntryView entry = current->find(gameId);
+        if (!entry) return;
+        
+        int& reported = m_reportedCounts[gameId];
+        reported = std::max(reported, newCount);
+        
+        // Positions and indexes carry over to the copy unchanged
+        auto next = std::make_shared<Catalog>(*current);
+        applyReportedCounts(*next);
+        next->version = ++m_versionCounter;
+        std::atomic_store(&m_catalog, std::shared_ptr<const Catalog>(std::move(next)));
     }
+    m_pinned = std::atomic_load(&m_catalog);
 }
 
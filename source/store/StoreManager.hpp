@@ -8,14 +8,29 @@
 #pragma once
 
 #include "network/HttpClient.hpp"
+#include "network/HttpEngine.hpp"
+#include "json.hpp"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <functional>
 #include <map>
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Forward declarations
+class CatalogParser;
+class EntryStore;
+struct Catalog;
 
 // =============================================================================
-// App/Game entry from store catalog
+// App/Game entry from store catalog, as parsed and merged. Published
+// catalogs pack their entries into an EntryStore and hand out EntryViews.
 // =============================================================================
 struct StoreEntry {
     std::string id;
@@ -32,10 +47,158 @@ struct StoreEntry {
     float rating = 0.0f;
     int downloadCount = 0;
     std::string releaseDate;
+    int32_t releaseDay = 0;     // releaseDate as YYYYMMDD, 0 if unknown (set at ingest)
     std::vector<std::string> languages;
+    std::string sourceId;       // StoreSource this entry came from
     
     // Format file size as string
-    std::string getFormattedSize() const;
+    std::string getFormattedSize() const { return formatSize(fileSize); }
+    static std::string formatSize(size_t bytes);
+    
+    // Rating and downloads combined, for featured lists and sorting
+    float getPopularity() const { return popularity(rating, downloadCount); }
+    static float popularity(float rating, int downloadCount) { return rating * 10 + downloadCount / 1000.0f; }
+    
+    // "2023-10-05" (or "2023-10", "2023") as 20231005, 0 if not a date
+    static int32_t parseReleaseDate(const std::string& date);
+};
+
+// =============================================================================
+// EntryView - One entry of a published catalog (see EntryStore). Cheap to
+// copy; valid as long as the catalog version it came from is pinned. A
+// default-constructed view is "not found".
+// =============================================================================
+class EntryView {
+public:
+    EntryView() = default;
+    EntryView(const EntryStore* store, uint32_t position) : m_store(store), m_position(position) {}
+    
+    explicit operator bool() const { return m_store != nullptr; }
+    bool operator==(const EntryView& other) const {
+        return m_store == other.m_store && m_position == other.m_position;
+    }
+    bool operator!=(const EntryView& other) const { return !(*this == other); }
+    
+    // Position in the catalog's entries
+    uint32_t position() const { return m_position; }
+    
+    std::string_view id() const;
+    std::string_view name() const;
+    std::string_view developer() const;
+    std::string_view description() const;
+    std::string_view category() const;
+    std::string_view version() const;
+    std::string_view titleId() const;
+    std::string_view releaseDate() const;
+    std::string_view sourceId() const;
+    std::string iconUrl() const;
+    std::string downloadUrl() const;
+    std::vector<std::string> screenshotUrls() const;
+    std::vector<std::string_view> languages() const;   // In the order the catalog first lists them
+    size_t fileSize() const;
+    float rating() const;
+    int downloadCount() const;
+    int32_t releaseDay() const;
+    
+    std::string getFormattedSize() const { return StoreEntry::formatSize(fileSize()); }
+    float getPopularity() const { return StoreEntry::popularity(rating(), downloadCount()); }
+    
+    // Mutable copy of the entry
+    StoreEntry toEntry() const;
+
+private:
+    const EntryStore* m_store = nullptr;
+    uint32_t m_position = 0;
+};
+
+// =============================================================================
+// EntrySpan - Read-only view of entries selected by a precomputed position
+// list (e.g. a category's posting list). Iterates as EntryView.
+// =============================================================================
+class EntrySpan {
+public:
+    class Iterator {
+    public:
+        Iterator(const EntryStore* store, const uint32_t* position)
+            : m_store(store), m_position(position) {}
+        
+        EntryView operator*() const { return EntryView(m_store, *m_position); }
+        Iterator& operator++() { ++m_position; return *this; }
+        bool operator==(const Iterator& other) const { return m_position == other.m_position; }
+        bool operator!=(const Iterator& other) const { return m_position != other.m_position; }
+    
+    private:
+        const EntryStore* m_store;
+        const uint32_t* m_position;
+    };
+    
+    EntrySpan() = default;
+    EntrySpan(const EntryStore* store, const uint32_t* positions, size_t count)
+        : m_store(store), m_positions(positions), m_count(count) {}
+    
+    Iterator begin() const { return Iterator(m_store, m_positions); }
+    Iterator end() const { return Iterator(m_store, m_positions + m_count); }
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+    EntryView operator[](size_t i) const { return EntryView(m_store, m_positions[i]); }
+
+private:
+    const EntryStore* m_store = nullptr;
+    const uint32_t* m_positions = nullptr;
+    size_t m_count = 0;
+};
+
+// =============================================================================
+// Entry filtering (store filter chips)
+// =============================================================================
+
+// Size chips: fileSize at most 100 MB, 500 MB, 1 GB or 4 GB
+enum class SizeLimit : uint8_t {
+    Any,
+    Under100MB,
+    Under500MB,
+    Under1GB,
+    Under4GB
+};
+
+enum class EntrySort : uint8_t {
+    Catalog,        // Source priority, then the order the source sent
+    Popularity,     // Same score as getFeaturedEntries
+    Rating,
+    Downloads,
+    Newest,         // By releaseDay
+    Size            // Smallest first
+};
+constexpr size_t ENTRY_SORT_COUNT = 6;
+
+// Facets are ANDed; the values listed within one facet are ORed
+struct EntryFilter {
+    std::vector<std::string> categories;    // Any of these; empty = all
+    std::vector<std::string> languages;     // Supports any of these; empty = all
+    SizeLimit size = SizeLimit::Any;
+    int minStars = 0;                       // rating >= minStars (0-5)
+};
+
+// How many entries each chip would match, with the other facets' current
+// selection applied (so counts never hide the user's other choices)
+struct FacetCounts {
+    static constexpr size_t SIZE_LIMITS = 5;        // Indexed by SizeLimit
+    static constexpr size_t STAR_LEVELS = 6;        // Indexed by minStars
+    
+    uint32_t matches = 0;                           // Entries the filter itself matches
+    std::vector<std::pair<std::string, uint32_t>> categories;   // Sorted by name
+    std::vector<std::pair<std::string, uint32_t>> languages;    // Sorted by name
+    uint32_t sizes[SIZE_LIMITS] = {};
+    uint32_t stars[STAR_LEVELS] = {};
+};
+
+// =============================================================================
+// Entry detail: the fields only the detail page shows. Refreshes fetch the
+// lite catalog listing without them (see StoreManager::requestEntryDetail).
+// =============================================================================
+struct EntryDetail {
+    std::string description;
+    std::vector<std::string> screenshotUrls;
 };
 
 // =============================================================================
@@ -51,6 +214,11 @@ struct StoreSource {
     
     // Last update time
     uint64_t lastUpdated = 0;
+    
+    // Sync state, valid only together with the entries it produced, so it
+    // is persisted in the catalog snapshot rather than the config
+    std::string etag;          // Sent as If-None-Match
+    std::string cursor;        // Sent as ?since= for delta updates
 };
 
 // =============================================================================
@@ -78,6 +246,9 @@ public:
     void init(const std::string& configPath);
     void shutdown();
     
+    // Per-frame tick: starts a refresh once the catalog is stale
+    void update();
+    
     // -------------------------------------------------------------------------
     // Source management
     // -------------------------------------------------------------------------
@@ -98,32 +269,79 @@ public:
     // Catalog access
     // -------------------------------------------------------------------------
     
+    // The catalog version the current frame works with. Holding the handle
+    // keeps that version alive even after a refresh publishes a newer one.
+    std::shared_ptr<const Catalog> getCatalog() const { return m_pinned; }
+    
+    // The accessors below read the pinned catalog; returned pointers and
+    // references stay valid until the next update()
+    
     // Get all entries (combined from all sources)
-    const std::vector<StoreEntry>& getAllEntries() const { return m_entries; }
+    EntrySpan getAllEntries() const;
     
-    // Get entries by category
-    std::vector<const StoreEntry*> getEntriesByCategory(const std::string& category) const;
+    // Get entries by category (precomputed when the catalog is built)
+    EntrySpan getEntriesByCategory(const std::string& category) const;
     
     // Get featured entries
-    std::vector<const StoreEntry*> getFeaturedEntries(int count = 5) const;
+    std::vector<EntryView> getFeaturedEntries(int count = 5) const;
+    
+    // Entries in the given order, from first on; a slice of a precomputed
+    // permutation, so top-K lists and sort toggles cost only what they show
+    EntrySpan getSortedEntries(EntrySort sort, size_t first = 0, size_t count = SIZE_MAX) const;
+    
+    // Entries matching filter in the given order, at most limit of them
+    std::vector<EntryView> filterEntries(const EntryFilter& filter, EntrySort sort = EntrySort::Catalog,
+                                         size_t limit = SIZE_MAX) const;
     
-    // Search entries
-    std::vector<const StoreEntry*> search(const std::string& query) const;
+    // Chip counts for filter
+    FacetCounts getFacetCounts(const EntryFilter& filter) const;
+    
+    // Search name, developer and description (where the listing carries
+    // one); best matches first. Typing queries one keystroke at a time
+    // should go through a SearchSession.
+    std::vector<EntryView> search(const std::string& query, size_t limit = 100) const;
     
     // Get entry by ID
-    const StoreEntry* getEntry(const std::string& id) const;
+    EntryView getEntry(const std::string& id) const;
+    
+    // Get entry by Switch title ID (entries without one are not indexed)
+    EntryView getEntryByTitleId(const std::string& titleId) const;
+    
+    // -------------------------------------------------------------------------
+    // Entry details, fetched from /api/catalog/game/:id on a worker thread
+    // and kept in a small LRU. Results are picked up in update().
+    // -------------------------------------------------------------------------
+    
+    // Details kept for reuse
+    static constexpr size_t DETAIL_CACHE_SIZE = 32;
+    
+    // Detail of entry id, from the cache or from the listing itself (older
+    // servers send full entries). False if it has not been fetched yet.
+    bool getEntryDetail(const std::string& id, EntryDetail& out);
+    
+    // Fetch entry id's detail unless it is cached or already on its way.
+    // A detail page request goes ahead of prefetches.
+    void requestEntryDetail(const std::string& id);
+    
+    // Like requestEntryDetail, for the tile that has focus. Replaces any
+    // prefetch still queued, since focus has moved on from it.
+    void prefetchEntryDetail(const std::string& id);
+    
+    // True while entry id's detail is queued or being fetched
+    bool isFetchingEntryDetail(const std::string& id) const;
     
     // -------------------------------------------------------------------------
     // Categories
     // -------------------------------------------------------------------------
     
-    const std::vector<StoreCategory>& getCategories() const { return m_categories; }
+    const std::vector<StoreCategory>& getCategories() const;
     
     // -------------------------------------------------------------------------
     // Refresh
     // -------------------------------------------------------------------------
     
-    // Refresh catalog from all sources (async-like, call in update loop)
+    // Start refreshing the catalog from all sources on a worker thread.
+    // The new catalog is picked up and the callback fired from update().
     void refresh();
     
     // Check if refresh is needed
@@ -132,11 +350,16 @@ public:
     // Check if currently refreshing
     bool isRefreshing() const { return m_isRefreshing; }
     
+    // Changes whenever a new catalog is pinned; screens compare it against
+    // the value they last built from and reload on change
+    uint32_t getCatalogVersion() const;
+    
     // -------------------------------------------------------------------------
     // Callbacks
     // -------------------------------------------------------------------------
     
     using RefreshCallback = std::function<void(bool success, const std::string& error)>;
+    // Always invoked on the main thread, from update()
     void setOnRefreshComplete(RefreshCallback callback) { m_onRefreshComplete = callback; }
     
     // -------------------------------------------------------------------------
@@ -148,16 +371,19 @@ public:
     
     // Report a download to the server - this increments the download counter
     // on the server and updates the local entry's downloadCount
-    // The callback is optional but useful for UI updates
-    void reportDownload(const std::string& gameId, 
-                        DownloadReportCallback callback = nullptr);
+    // The request runs on the HttpEngine; the callback (optional, but useful
+    // for UI updates) runs on the main thread once it finishes. Returns the
+    // handle to cancel it with, or 0 if nothing was sent (the callback has
+    // then already been called with false).
+    HttpHandle reportDownload(const std::string& gameId,
+                              DownloadReportCallback callback = nullptr);
     
     // Update local entry's download count (called internally after successful report)
     void updateLocalDownloadCount(const std::string& gameId, int newCount);
-    
+
 private:
     StoreManager() = default;
-    ~StoreManager() = default;
+    ~StoreManager();
     
     StoreManager(const StoreManager&) = delete;
     StoreManager& operator=(const StoreManager&) = delete;
@@ -166,26 +392,117 @@ private:
     void loadConfig();
     void saveConfig();
     
-    // Parse catalog JSON
+    // Parse catalog JSON held in memory
     void parseCatalog(const std::string& json, const std::string& sourceId, const std::string& baseUrl);
     
+    // Worker thread body: fetch every source into a copy of base and
+    // publish it, then hand the sync state back through m_refreshResult
+    void runRefresh(std::shared_ptr<const Catalog> base, std::vector<StoreSource> sources);
+    
+    // Main thread: join a finished worker and apply its result
+    void finishRefresh();
+    
+    // Make catalog the current version (any thread)
+    void publish(std::shared_ptr<Catalog> catalog);
+    
+    // Raise entries in catalog to the counts in m_reportedCounts
+    // (m_publishMutex held)
+    void applyReportedCounts(Catalog& catalog) const;
+    
+    // Binary snapshot of the last good catalog (see CatalogSnapshot)
+    void loadSnapshot();
+    void saveSnapshot(const Catalog& catalog, const std::vector<StoreSource>& sources,
+                      uint64_t savedAt);
+    
     // Add default source
     void addDefaultSource();
     
+    // Entry details (see requestEntryDetail)
+    void queueEntryDetail(const std::string& id, bool prefetch);
+    void runDetailWorker();
+    void finishEntryDetails();
+    
     // -------------------------------------------------------------------------
     // Members
     // -------------------------------------------------------------------------
     
     std::string m_configPath;
+    std::string m_snapshotPath;
+    json::Writer m_configWriter{2};     // Reused across saves
     std::vector<StoreSource> m_sources;
-    std::vector<StoreEntry> m_entries;
-    std::vector<StoreCategory> m_categories;
     
-    std::unique_ptr<HttpClient> m_httpClient;
+    // -------------------------------------------------------------------------
+    // Catalog versions. m_catalog is the latest published version and is
+    // only touched through std::atomic_load/atomic_store; m_pinned is the
+    // main thread's copy, re-read once per update(). A replaced version is
+    // freed when its last handle goes away.
+    // -------------------------------------------------------------------------
+    std::shared_ptr<const Catalog> m_catalog;
+    std::shared_ptr<const Catalog> m_pinned;
+    std::atomic<uint32_t> m_versionCounter{0};
+    
+    // Serializes publishers. Download counts the server reported are kept
+    // here and re-applied to every version published, so a refresh built
+    // from an older version can't drop them.
+    std::mutex m_publishMutex;
+    std::map<std::string, int> m_reportedCounts;
+    
+    std::unique_ptr<HttpClient> m_refreshClient;    // Refresh worker only
+    
+    // -------------------------------------------------------------------------
+    // Refresh worker
+    // -------------------------------------------------------------------------
+    struct RefreshResult {
+        bool success = false;
+        std::string error;
+        std::vector<StoreSource> sources;           // With updated etag/cursor
+    };
+    
+    std::thread m_refreshThread;
+    std::mutex m_refreshMutex;                      // Guards m_refreshResult
+    RefreshResult m_refreshResult;
+    std::atomic<bool> m_refreshFinished{false};
+    std::atomic<bool> m_cancelRefresh{false};
     
     bool m_isRefreshing = false;
     uint64_t m_lastRefreshTime = 0;
     static constexpr uint64_t REFRESH_INTERVAL = 3600;  // 1 hour
     
     RefreshCallback m_onRefreshComplete;
+    
+    // -------------------------------------------------------------------------
+    // Entry detail worker. The queue and results are shared with the
+    // worker under m_detailMutex; the cache and m_detailPending are main
+    // thread only.
+    // -------------------------------------------------------------------------
+    struct DetailRequest {
+        std::string id;
+        std::string version;                        // Entry version it belongs to
+        std::string url;
+        std::string baseUrl;                        // For relative screenshot URLs
+        bool prefetch = false;
+    };
+    
+    struct DetailResult {
+        DetailRequest request;
+        EntryDetail detail;
+        bool success = false;
+    };
+    
+    struct CachedDetail {
+        std::string id;
+        std::string version;
+        EntryDetail detail;
+    };
+    
+    std::thread m_detailThread;
+    std::mutex m_detailMutex;
+    std::condition_variable m_detailWake;
+    std::deque<DetailRequest> m_detailQueue;
+    std::vector<DetailResult> m_detailResults;
+    std::atomic<bool> m_stopDetails{false};      // Also aborts the transfer in flight
+    
+    std::unique_ptr<HttpClient> m_detailClient;     // Detail worker only
+    std::vector<CachedDetail> m_detailCache;        // Least recently used first
+    std::vector<std::string> m_detailPending;       // Queued or in flight
 };
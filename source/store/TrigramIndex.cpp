@@ -0,0 +1,250 @@
+// =============================================================================
+// Switch App Store - Trigram Index Implementation
+// =============================================================================
+
+#include "TrigramIndex.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+// Marks the start and end of a word; never part of an indexed word
+constexpr uint8_t PAD = '$';
+
+// -----------------------------------------------------------------------------
+// Myers' bit-parallel edit distance in Hyyro's formulation, with his
+// transposition term so a swapped pair ("zelad") costs one edit instead of
+// two. Bit i of vp / vn says the DP cell in pattern row i is one more / one
+// less than the cell above it; d0 marks cells equal to their upper-left
+// neighbour. A whole column advances in a handful of word operations and
+// score tracks the last row, i.e. distance(pattern, text[0..j]).
+// -----------------------------------------------------------------------------
+uint32_t myersDistance(const uint64_t* peq, size_t patternLength, std::string_view text,
+                       uint32_t maxDistance) {
+    if (patternLength == 0) {
+        return static_cast<uint32_t>(std::min<size_t>(text.size(), maxDistance + 1));
+    }
+    
+    const uint64_t last = 1ULL << (patternLength - 1);
+    uint64_t vp = ~0ULL;
+    uint64_t vn = 0;
+    uint64_t d0 = 0;
+    uint64_t previousEq = 0;
+    size_t score = patternLength;
+    
+    for (size_t j = 0; j < text.size(); j++) {
+        uint64_t eq = peq[static_cast<uint8_t>(text[j])];
+        uint64_t transposed = ((~d0 & eq) << 1) & previousEq;
+        d0 = (((eq & vp) + vp) ^ vp) | eq | vn | transposed;
+        uint64_t hp = vn | ~(d0 | vp);
+        uint64_t hn = vp & d0;
+        
+        // Branch-free: which way the last row moves is data dependent and
+        // would mispredict about half the time
+        score += (hp & last) != 0;
+        score -= (hn & last) != 0;
+        
+        // Shifting in a 1 makes row 0 count up (distance to an empty
+        // pattern prefix), which gives the global rather than the
+        // substring distance
+        uint64_t x = (hp << 1) | 1;
+        vn = x & d0;
+        vp = (hn << 1) | ~(x | d0);
+        previousEq = eq;
+        
+        // Each remaining text byte can lower the score by at most one
+        if (score > maxDistance + (text.size() - j - 1)) return maxDistance + 1;
+    }
+    return static_cast<uint32_t>(std::min<size_t>(score, maxDistance + 1));
+}
+
+// Which byte values occur in text, folded into 32 buckets (exact for a-z)
+uint32_t byteMask(std::string_view text) {
+    uint32_t mask = 0;
+    for (char c : text) {
+        mask |= 1u << (static_cast<uint8_t>(c) & 31);
+    }
+    return mask;
+}
+
+// Match bit masks of pattern: bit i of peq[c] is set if pattern[i] == c
+void buildPeq(std::string_view pattern, uint64_t* peq) {
+    std::fill(peq, peq + 256, 0);
+    for (size_t i = 0; i < pattern.size(); i++) {
+        peq[static_cast<uint8_t>(pattern[i])] |= 1ULL << i;
+    }
+}
+
+} // namespace
+
+// =============================================================================
+// Build
+// =============================================================================
+
+void TrigramIndex::build(const std::vector<Word>& words) {
+    m_words.clear();
+    m_text.clear();
+    
+    // Words are stored shortest first, so every trigram's word list is
+    // also ordered by length and a lookup can cut it to the lengths that
+    // are within reach with two binary searches
+    std::vector<const Word*> sorted;
+    sorted.reserve(words.size());
+    for (const Word& word : words) {
+        if (word.text.empty() || word.text.size() > MAX_WORD_LENGTH) continue;
+        sorted.push_back(&word);
+    }
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Word* a, const Word* b) {
+        return a->text.size() < b->text.size();
+    });
+    
+    m_lengthStart.assign(MAX_WORD_LENGTH + 2, 0);
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;   // (trigram, word index)
+    std::vector<uint32_t> grams;
+    
+    for (const Word* word : sorted) {
+        uint32_t index = static_cast<uint32_t>(m_words.size());
+        m_words.push_back({word->id, static_cast<uint32_t>(m_text.size()),
+                           static_cast<uint32_t>(word->text.size()), byteMask(word->text)});
+        m_text += word->text;
+        m_lengthStart[word->text.size() + 1] = index + 1;
+        
+        trigrams(word->text, grams);
+        for (uint32_t gram : grams) {
+            pairs.emplace_back(gram, index);
+        }
+    }
+    
+    // Lengths nobody has start where the previous length ended
+    for (size_t length = 1; length < m_lengthStart.size(); length++) {
+        m_lengthStart[length] = std::max(m_lengthStart[length], m_lengthStart[length - 1]);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    
+    // -------------------------------------------------------------------------
+    // Group into one word list per distinct trigram
+    // -------------------------------------------------------------------------
+    m_keys.clear();
+    m_listOffsets.clear();
+    m_lists.clear();
+    m_lists.reserve(pairs.size());
+    
+    for (const auto& pair : pairs) {
+        if (m_keys.empty() || m_keys.back() != pair.first) {
+            m_keys.push_back(pair.first);
+            m_listOffsets.push_back(static_cast<uint32_t>(m_lists.size()));
+        }
+        m_lists.push_back(pair.second);
+    }
+    m_listOffsets.push_back(static_cast<uint32_t>(m_lists.size()));
+}
+
+void TrigramIndex::trigrams(std::string_view word, std::vector<uint32_t>& out) {
+    out.clear();
+    
+    // "$word$": one trigram per byte of word
+    uint32_t gram = PAD;
+    for (size_t i = 0; i <= word.size(); i++) {
+        uint8_t c = i < word.size() ? static_cast<uint8_t>(word[i]) : PAD;
+        gram = ((gram << 8) | c) & 0xFFFFFF;
+        if (i >= 1) out.push_back(gram);
+    }
+    
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+// =============================================================================
+// Lookup
+// =============================================================================
+
+std::vector<TrigramIndex::Match> TrigramIndex::find(std::string_view word, uint32_t maxDistance) const {
+    std::vector<Match> matches;
+    if (m_words.empty() || word.empty() || word.size() > MAX_WORD_LENGTH) return matches;
+    
+    // -------------------------------------------------------------------------
+    // Count shared trigrams per word. A distinct query trigram only goes
+    // missing if every occurrence of it is hit by an edit, and an edit hits
+    // at most three trigrams (four for a swap), so a word within maxDistance
+    // keeps at least (count - 4 * maxDistance) of them. When that bound is
+    // zero (short words, large maxDistance) a match may share none, so
+    // every word of a reachable length is a candidate instead.
+    // -------------------------------------------------------------------------
+    std::vector<uint32_t> grams;
+    trigrams(word, grams);
+    
+    size_t lost = size_t(4) * maxDistance;
+    size_t needed = grams.size() > lost ? grams.size() - lost : 0;
+    
+    // Only words whose length is within maxDistance of word can match
+    size_t minLength = word.size() > maxDistance ? word.size() - maxDistance : 1;
+    size_t maxLength = std::min(word.size() + maxDistance, MAX_WORD_LENGTH);
+    uint32_t firstWord = m_lengthStart[minLength];
+    uint32_t endWord = m_lengthStart[maxLength + 1];
+    
+    std::vector<uint8_t> shared;
+    std::vector<uint32_t> candidates;
+    
+    if (needed == 0) {
+        for (uint32_t w = firstWord; w < endWord; w++) {
+            candidates.push_back(w);
+        }
+    } else {
+        shared.assign(m_words.size(), 0);
+        for (uint32_t gram : grams) {
+            auto it = std::lower_bound(m_keys.begin(), m_keys.end(), gram);
+            if (it == m_keys.end() || *it != gram) continue;
+            
+            size_t key = it - m_keys.begin();
+            auto listBegin = m_lists.begin() + m_listOffsets[key];
+            auto listEnd = m_lists.begin() + m_listOffsets[key + 1];
+            auto first = std::lower_bound(listBegin, listEnd, firstWord);
+            auto last = std::lower_bound(first, listEnd, endWord);
+            for (auto n = first; n != last; ++n) {
+                if (shared[*n]++ == 0) candidates.push_back(*n);
+            }
+        }
+    }
+    
+    // -------------------------------------------------------------------------
+    // Verify the survivors of the count filter. First a cheaper bound: an
+    // edit removes at most one distinct byte value from either side, so
+    // neither word can have more than maxDistance values the other lacks.
+    // -------------------------------------------------------------------------
+    uint64_t peq[256];
+    buildPeq(word, peq);
+    uint32_t wordMask = byteMask(word);
+    
+    for (uint32_t w : candidates) {
+        if (needed > 0 && shared[w] < needed) continue;
+        
+        const Entry& entry = m_words[w];
+        if (uint32_t(__builtin_popcount(wordMask & ~entry.mask)) > maxDistance ||
+            uint32_t(__builtin_popcount(entry.mask & ~wordMask)) > maxDistance) {
+            continue;
+        }
+        std::string_view text(m_text.data() + entry.textOffset, entry.textLength);
+        uint32_t distance = myersDistance(peq, word.size(), text, maxDistance);
+        if (distance <= maxDistance) {
+            matches.push_back({entry.id, distance});
+        }
+    }
+    
+    std::sort(matches.begin(), matches.end(), [](const Match& a, const Match& b) {
+        return a.distance != b.distance ? a.distance < b.distance : a.id < b.id;
+    });
+    return matches;
+}
+
+uint32_t TrigramIndex::boundedDistance(std::string_view a, std::string_view b, uint32_t maxDistance) {
+    if (a.size() > MAX_WORD_LENGTH) return maxDistance + 1;
+    
+    uint64_t peq[256];
+    buildPeq(a, peq);
+    return myersDistance(peq, a.size(), b, maxDistance);
+}
+
+size_t TrigramIndex::memoryUsage() const {
+    size_t lists = m_lengthStart.capacity() + m_keys.capacity() + m_listOffsets.capacity() + m_lists.capacity();
+    return m_words.capacity() * sizeof(Entry) + m_text.capacity() + lists * sizeof(uint32_t);
+}
@@ -0,0 +1,78 @@
+// =============================================================================
+// Switch App Store - Trigram Index
+// =============================================================================
+// Approximate word lookup for typo-tolerant search ("zelad" -> "zelda",
+// "retroarh" -> "retroarch").
+//
+//   Candidates     Every word is padded ("$zelda$") and split into byte
+//                  trigrams; a word within k edits of the query shares at
+//                  least (query trigrams - 4k) of them, since one edit
+//                  touches at most four. Only words that pass this count
+//                  and the length filter are compared; when the count
+//                  rules nothing out (query trigrams <= 4k) every word of
+//                  a length within k is, so no match is ever missed.
+//   Verification   Myers' bit-parallel edit distance (one 64-bit word per
+//                  column of the DP matrix), abandoned as soon as the
+//                  distance can no longer end up within k. Swapping two
+//                  adjacent bytes counts as one edit.
+//
+// Distances are counted in bytes, so an accented letter counts as two.
+// =============================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// =============================================================================
+// TrigramIndex - words -> ids of words within a small edit distance
+// =============================================================================
+class TrigramIndex {
+public:
+    // Longest word (in bytes) that is indexed or looked up
+    static constexpr size_t MAX_WORD_LENGTH = 64;
+    
+    struct Word {
+        uint32_t id;                // Caller's id, returned in matches
+        std::string_view text;
+    };
+    
+    struct Match {
+        uint32_t id;
+        uint32_t distance;
+    };
+    
+    // Index words; the texts are copied
+    void build(const std::vector<Word>& words);
+    
+    // Words within maxDistance edits of word, closest first
+    std::vector<Match> find(std::string_view word, uint32_t maxDistance) const;
+    
+    size_t memoryUsage() const;
+    
+    // Edit distance between a and b (insertions, deletions, substitutions
+    // and adjacent transpositions) if it is at most maxDistance,
+    // otherwise some value above maxDistance. a must be at most
+    // MAX_WORD_LENGTH bytes.
+    static uint32_t boundedDistance(std::string_view a, std::string_view b, uint32_t maxDistance);
+
+private:
+    // Distinct padded trigrams of word, each packed into 24 bits
+    static void trigrams(std::string_view word, std::vector<uint32_t>& out);
+    
+    struct Entry {
+        uint32_t id;
+        uint32_t textOffset;        // Into m_text
+        uint32_t textLength;
+        uint32_t mask;              // Byte values present (see byteMask)
+    };
+    
+    std::vector<Entry> m_words;             // Shortest first
+    std::vector<uint32_t> m_lengthStart;    // First word of each length
+    std::string m_text;
+    std::vector<uint32_t> m_keys;           // Sorted distinct trigrams
+    std::vector<uint32_t> m_listOffsets;    // m_keys.size() + 1 offsets into m_lists
+    std::vector<uint32_t> m_lists;          // Word indexes per trigram, ascending
+};
@@ -6,7 +6,7 @@
 #include "app.hpp"
 #include "core/Input.hpp"
 #include "ui/Theme.hpp"
-#include "store/StoreManager.hpp"  // For download statistics
+#include "store/StoreManager.hpp"  // For entry details and download statistics
 #include <algorithm>
 #include <cmath>
 
@@ -20,7 +20,10 @@ DetailScreen::DetailScreen(App* app, const GameItem& game)
     loadGameDetail(game);
 }
 
-DetailScreen::~DetailScreen() = default;
+DetailScreen::~DetailScreen() {
+    // The report callback captures this; drop it if it hasn't run yet
+    HttpEngine::getInstance().cancel(m_downloadReport);
+}
 
 // =============================================================================
 // Lifecycle
@@ -103,6 +106,19 @@ void DetailScreen::update(float deltaTime) {
     // Clamp scroll
     m_scrollY = std::max(0.0f, m_scrollY);
     
+    // Description and screenshots arrive after the page opens
+    if (m_detailLoading) {
+        StoreManager& store = StoreManager::getInstance();
+        EntryDetail detail;
+        if (store.getEntryDetail(m_detail.basic.id, detail)) {
+            m_detail.description = std::move(detail.description);
+            m_detail.screenshots = std::move(detail.screenshotUrls);
+            m_detailLoading = false;
+        } else if (!store.isFetchingEntryDetail(m_detail.basic.id)) {
+            m_detailLoading = false;    // Failed; the page shows what the listing had
+        }
+    }
+    
     // Animate screenshot scroll
     float targetScrollX = m_selectedScreenshot * (SCREENSHOT_WIDTH + 16);
     m_screenshotScrollX += (targetScrollX - m_screenshotScrollX) * deltaTime * 8.0f;
@@ -239,7 +255,7 @@ void DetailScreen::renderDescription(Renderer& renderer, float& yOffset) {
     yOffset += 32;
     
     // Description text (truncated unless expanded)
-    std::string displayText = m_detail.description;
+    std::string displayText = m_detailLoading ? "加载中..." : m_detail.description;
     if (!m_showFullDescription && displayText.length() > 200) {
         displayText = displayText.substr(0, 200) + "...";
     }
@@ -362,9 +378,10 @@ void DetailScreen::startDownload() {
     // Report this download to the server to increment the download counter
     // This helps track popularity and provides analytics data
     // -------------------------------------------------------------------------
-    StoreManager::getInstance().reportDownload(
+    m_downloadReport = StoreManager::getInstance().reportDownload(
         m_detail.basic.id,
         [this](bool success, int newCount) {
+            m_downloadReport = 0;
             if (success) {
                 // Update the local display with the new download count
                 // This keeps the UI in sync with server data
@@ -379,19 +396,31 @@ void DetailScreen::startDownload() {
 
 void DetailScreen::loadGameDetail(const GameItem& game) {
     m_detail.basic = game;
-    m_detail.description = "踏上一场冒险之旅，探索广阔的开放世界。在这款游戏中，你将"
-                           "体验前所未有的自由与乐趣。穿越山川河流，发现隐藏的宝藏，"
-                           "与各种敌人战斗，解开神秘的谜题。无论是新手玩家还是资深玩家，"
-                           "都能在这个世界中找到属于自己的乐趣。准备好开始你的冒险了吗？";
-    
-    // Demo screenshots (placeholders)
-    m_detail.screenshots = {"shot1.jpg", "shot2.jpg", "shot3.jpg", "shot4.jpg"};
-    
-    m_detail.version = "1.6.0";
-    m_detail.releaseDate = "2017-03-03";
-    m_detail.titleId = "0100" + game.id + "00000" + game.id + "000";
-    m_detail.languages = {"中文", "英语", "日语"};
+    
+    // -------------------------------------------------------------------------
+    // Listing fields come from the catalog; description and screenshots are
+    // not in the lite listing and are fetched (or found already prefetched)
+    // -------------------------------------------------------------------------
+    StoreManager& store = StoreManager::getInstance();
+    if (EntryView entry = store.getEntry(game.id)) {
+        m_detail.version = entry.version();
+        m_detail.releaseDate = entry.releaseDate();
+        m_detail.titleId = entry.titleId();
+        m_detail.languages.clear();
+        for (std::string_view language : entry.languages()) {
+            m_detail.languages.emplace_back(language);
+        }
+    }
     m_detail.players = "1人";
+    
+    EntryDetail detail;
+    if (store.getEntryDetail(game.id, detail)) {
+        m_detail.description = std::move(detail.description);
+        m_detail.screenshots = std::move(detail.screenshotUrls);
+    } else {
+        store.requestEntryDetail(game.id);
+        m_detailLoading = store.isFetchingEntryDetail(game.id);
+    }
     m_detail.isInstalled = false;
     m_detail.isDownloading = false;
     m_detail.downloadProgress = 0.0f;
@@ -10,6 +10,7 @@
 #include "Screen.hpp"
 #include "GamesScreen.hpp"  // For GameItem
 #include "core/Renderer.hpp"
+#include "network/HttpEngine.hpp"
 #include <vector>
 #include <string>
 #include <functional>
@@ -98,8 +99,12 @@ private:
     
     // UI state
     bool m_showFullDescription = false;
+    bool m_detailLoading = false;       // Waiting for the entry detail fetch
     bool m_installButtonFocused = false;
     
+    // Download report in flight; its callback points at this screen
+    HttpHandle m_downloadReport = 0;
+    
     // Callback for navigation
     std::function<void()> m_onBack;
 };
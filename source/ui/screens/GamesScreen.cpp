@@ -12,6 +12,7 @@
 #include "store/StoreManager.hpp"
 #include <algorithm>
 #include <cmath>
+#include <map>
 #include <switch.h>
 
 // =============================================================================
@@ -253,6 +254,31 @@ void GamesScreen::handleInput(const Input& input) {
 // =============================================================================
 
 void GamesScreen::update(float deltaTime) {
+    // Rebuild rows when the store catalog was replaced
+    if (StoreManager::getInstance().getCatalogVersion() != m_catalogVersion) {
+        loadDemoContent();
+    }
+    
+    // Prefetch the detail of a tile once focus has rested on it, so its
+    // detail page opens complete; tiles passed over while scrolling are
+    // never fetched
+    std::string focusedId;
+    if (!m_showingInstalled && m_selectedCategory < static_cast<int>(m_categories.size()) &&
+        m_selectedGame < static_cast<int>(m_categories[m_selectedCategory].games.size())) {
+        focusedId = m_categories[m_selectedCategory].games[m_selectedGame].id;
+    }
+    if (focusedId != m_focusedId) {
+        m_focusedId = focusedId;
+        m_focusTime = 0.0f;
+        m_focusPrefetched = false;
+    } else if (!m_focusPrefetched && !m_focusedId.empty()) {
+        m_focusTime += deltaTime;
+        if (m_focusTime >= PREFETCH_DELAY) {
+            StoreManager::getInstance().prefetchEntryDetail(m_focusedId);
+            m_focusPrefetched = true;
+        }
+    }
+    
     // Apply scroll velocity
     if (m_scrollVelocity != 0.0f) {
         m_scrollY += m_scrollVelocity * deltaTime;
@@ -530,6 +556,28 @@ void GamesScreen::loadDemoContent() {
     StoreManager& store = StoreManager::getInstance();
     const auto& categories = store.getCategories();
     
+    m_catalogVersion = store.getCatalogVersion();
+    
+    // A new catalog version (a refresh, a download count) must not move
+    // the rows under the user: remember where each row was scrolled to and
+    // which tile was selected, and put them back on the rebuilt rows
+    std::map<std::string, float> scrollByTitle;
+    for (size_t i = 0; i < m_categories.size() && i < m_categoryScrollX.size(); i++) {
+        scrollByTitle[m_categories[i].title] = m_categoryScrollX[i];
+    }
+    std::string selectedTitle;
+    std::string selectedId;
+    if (m_selectedCategory < static_cast<int>(m_categories.size())) {
+        const GameCategory& row = m_categories[m_selectedCategory];
+        selectedTitle = row.title;
+        if (m_selectedGame < static_cast<int>(row.games.size())) {
+            selectedId = row.games[m_selectedGame].id;
+        }
+    }
+    
+    m_categories.clear();
+    m_categoryScrollX.clear();
+    
     for (const auto& storeCategory : categories) {
         // ---------------------------------------------------------------------
         // Filter: Only show "games" category on this screen
@@ -548,21 +596,42 @@ void GamesScreen::loadDemoContent() {
         GameCategory category;
         category.title = storeCategory.name;
         
-        for (const StoreEntry* entry : entries) {
+        for (EntryView entry : entries) {
             GameItem item;
-            item.id = entry->id;
-            item.name = entry->name;
-            item.developer = entry->developer;
+            item.id = entry.id();
+            item.name = entry.name();
+            item.developer = entry.developer();
             item.category = storeCategory.name;
-            item.iconUrl = entry->iconUrl;
-            item.rating = entry->rating;
-            item.size = entry->getFormattedSize();
+            item.iconUrl = entry.iconUrl();
+            item.rating = entry.rating();
+            item.size = entry.getFormattedSize();
             
             category.games.push_back(item);
         }
         
-        m_categories.push_back(category);
-        m_categoryScrollX.push_back(0.0f);
+        auto scroll = scrollByTitle.find(category.title);
+        m_categoryScrollX.push_back(scroll != scrollByTitle.end() ? scroll->second : 0.0f);
+        
+        if (category.title == selectedTitle) {
+            m_selectedCategory = static_cast<int>(m_categories.size());
+            for (size_t i = 0; i < category.games.size(); i++) {
+                if (category.games[i].id == selectedId) {
+                    m_selectedGame = static_cast<int>(i);
+                    break;
+                }
+            }
+        }
+        
+        m_categories.push_back(std::move(category));
+    }
+    
+    // Keep the controller selection inside the new rows
+    if (m_selectedCategory >= static_cast<int>(m_categories.size())) {
+        m_selectedCategory = 0;
+        m_selectedGame = 0;
+    } else if (!m_categories.empty() &&
+               m_selectedGame >= static_cast<int>(m_categories[m_selectedCategory].games.size())) {
+        m_selectedGame = 0;
     }
 }
 
@@ -85,6 +85,7 @@ private:
     static constexpr float GAME_CARD_SIZE = 180.0f;
     static constexpr float CARD_SPACING = 16.0f;
     static constexpr float ICON_RADIUS = 22.0f;
+    static constexpr float PREFETCH_DELAY = 0.3f;   // Seconds of focus before a detail prefetch
     
     // -------------------------------------------------------------------------
     // Private methods
@@ -108,6 +109,7 @@ private:
     
     // Content
     std::vector<GameCategory> m_categories;
+    uint32_t m_catalogVersion = 0;      // StoreManager catalog version loaded
     
     // Scroll state
     float m_scrollY = 0.0f;
@@ -117,6 +119,11 @@ private:
     int m_selectedCategory = 0;
     int m_selectedGame = 0;
     
+    // Detail prefetch for the focused tile
+    std::string m_focusedId;
+    float m_focusTime = 0.0f;
+    bool m_focusPrefetched = false;
+    
     // Horizontal scroll per category
     std::vector<float> m_categoryScrollX;
     
@@ -8,7 +8,6 @@
 #include "ui/Theme.hpp"
 #include "store/StoreManager.hpp"
 #include <algorithm>
-#include <switch.h>  // For swkbd (software keyboard)
 
 // =============================================================================
 // Constructor & Destructor
@@ -20,7 +19,9 @@ SearchScreen::SearchScreen(App* app)
     loadDemoContent();
 }
 
-SearchScreen::~SearchScreen() = default;
+SearchScreen::~SearchScreen() {
+    closeKeyboard();
+}
 
 // =============================================================================
 // Lifecycle
@@ -32,10 +33,12 @@ void SearchScreen::onEnter() {
     m_isSearching = false;
     m_selectedTagIndex = -1;
     m_selectedResultIndex = 0;
+    m_session.clear();
 }
 
 void SearchScreen::onExit() {
-    // Clear search state
+    // Release the keyboard applet while other screens are shown
+    closeKeyboard();
 }
 
 void SearchScreen::onResolutionChanged(int width, int height, float scale) {
@@ -47,11 +50,14 @@ void SearchScreen::onResolutionChanged(int width, int height, float scale) {
 // =============================================================================
 
 void SearchScreen::handleInput(const Input& input) {
+    // The inline keyboard reads the controller itself while it is shown
+    if (m_keyboardVisible) return;
+    
     // =========================================================================
     // SEARCH & DISCOVERY TOUCH EXPERIENCE
     // Precise hit testing for tags, results, and instant search bar access.
     // =========================================================================
-
+    
     // D-pad navigation for tags
     if (!m_isSearching) {
         if (input.isPressed(Input::Button::DPadLeft)) {
@@ -88,6 +94,7 @@ void SearchScreen::handleInput(const Input& input) {
             m_isSearching = false;
             m_searchQuery.clear();
             m_searchResults.clear();
+            m_session.setQuery(m_searchQuery);
         }
         
         // A to select result
@@ -133,10 +140,10 @@ void SearchScreen::handleInput(const Input& input) {
                 showKeyboard();
                 return; 
             }
-             
+            
             // 2. Content Handling
             // float effectiveScroll = m_scrollY; // Unused
-
+            
             // Note: In SearchScreen render logic, some parts might be static? 
             // Looking at render(), header is static.
             // renderHotTags starts at SEARCH_BAR_HEIGHT + MARGIN*2.
@@ -199,7 +206,7 @@ void SearchScreen::handleInput(const Input& input) {
                      }
                      itemY += 76;
                 }
-
+            
             } else {
                 // Tags
                 float tagstartY = SEARCH_BAR_HEIGHT + SEARCH_BAR_MARGIN * 2;
@@ -229,7 +236,7 @@ void SearchScreen::handleInput(const Input& input) {
                 // To be safe, we might need to assume a fixed start or recount.
                 // Simply checking Y range might be enough if we assume standard layout.
             }
-            
+        
         } else {
             // Momentum
             m_scrollVelocity = -touch.velocityY * 35.0f;
@@ -242,6 +249,21 @@ void SearchScreen::handleInput(const Input& input) {
 // =============================================================================
 
 void SearchScreen::update(float deltaTime) {
+    // Rebuild recommendations when the store catalog was replaced
+    if (StoreManager::getInstance().getCatalogVersion() != m_catalogVersion) {
+        loadDemoContent();
+    }
+    
+    // Keyboard callbacks fire from here; however many edits arrived this
+    // frame, only the last one is searched
+    if (m_keyboardLaunched) {
+        SwkbdState state;
+        swkbdInlineUpdate(&m_keyboard, &state);
+    }
+    if (m_session.update()) {
+        applySearchResults();
+    }
+    
     // Apply scroll velocity (momentum)
     if (m_scrollVelocity != 0.0f) {
         m_scrollY += m_scrollVelocity * deltaTime;
@@ -494,26 +516,30 @@ void SearchScreen::renderSearchResults(Renderer& renderer, float yOffset) {
 
 void SearchScreen::performSearch(const std::string& query) {
     m_isSearching = true;
-    m_searchResults.clear();
-    m_selectedResultIndex = 0;
     
     // -------------------------------------------------------------------------
-    // Search using StoreManager (backend data only)
+    // Search the StoreManager catalog (backend data only)
     // No fallback local search - requires backend connection
     // -------------------------------------------------------------------------
-    StoreManager& store = StoreManager::getInstance();
-    auto results = store.search(query);
+    m_session.setQuery(query);
+    m_session.update();
+    applySearchResults();
+}
+
+void SearchScreen::applySearchResults() {
+    m_searchResults.clear();
+    m_selectedResultIndex = 0;
     
-    // Convert StoreEntry results to GameItem items
-    for (const StoreEntry* entry : results) {
+    // Convert entry views to GameItem items
+    for (EntryView entry : m_session.results()) {
         GameItem result;
-        result.id = entry->id;
-        result.name = entry->name;
-        result.developer = entry->developer;
-        result.category = entry->category;
-        result.iconUrl = entry->iconUrl;
-        result.rating = entry->rating;
-        result.size = entry->getFormattedSize();
+        result.id = entry.id();
+        result.name = entry.name();
+        result.developer = entry.developer();
+        result.category = entry.category();
+        result.iconUrl = entry.iconUrl();
+        result.rating = entry.rating();
+        result.size = entry.getFormattedSize();
         
         m_searchResults.push_back(result);
     }
@@ -539,15 +565,18 @@ void SearchScreen::loadDemoContent() {
     StoreManager& store = StoreManager::getInstance();
     auto featured = store.getFeaturedEntries(7);
     
-    for (const StoreEntry* entry : featured) {
+    m_catalogVersion = store.getCatalogVersion();
+    m_recommendations.clear();
+    
+    for (EntryView entry : featured) {
         GameItem rec;
-        rec.id = entry->id;
-        rec.name = entry->name;
-        rec.developer = entry->developer;
-        rec.category = entry->category;
-        rec.iconUrl = entry->iconUrl;
-        rec.rating = entry->rating;
-        rec.size = entry->getFormattedSize();
+        rec.id = entry.id();
+        rec.name = entry.name();
+        rec.developer = entry.developer();
+        rec.category = entry.category();
+        rec.iconUrl = entry.iconUrl();
+        rec.rating = entry.rating();
+        rec.size = entry.getFormattedSize();
         
         m_recommendations.push_back(rec);
     }
@@ -558,7 +587,86 @@ void SearchScreen::loadDemoContent() {
 // Software Keyboard
 // =============================================================================
 
+SearchScreen* SearchScreen::s_keyboardOwner = nullptr;
+
 void SearchScreen::showKeyboard() {
+    if (m_keyboardVisible) return;
+    
+    // Launch the inline keyboard applet once, then only show and hide it
+    if (!m_keyboardLaunched) {
+        if (R_FAILED(swkbdInlineCreate(&m_keyboard))) {
+            showModalKeyboard();
+            return;
+        }
+        if (R_FAILED(swkbdInlineLaunchForLibraryApplet(&m_keyboard, SwkbdInlineMode_AppletDisplay, 0))) {
+            swkbdInlineClose(&m_keyboard);
+            showModalKeyboard();
+            return;
+        }
+        swkbdInlineSetChangedStringCallback(&m_keyboard, onKeyboardChanged);
+        swkbdInlineSetDecidedEnterCallback(&m_keyboard, onKeyboardEntered);
+        swkbdInlineSetDecidedCancelCallback(&m_keyboard, onKeyboardCancelled);
+        swkbdInlineSetUtf8Mode(&m_keyboard, true);
+        m_keyboardLaunched = true;
+    }
+    s_keyboardOwner = this;
+    
+    // Continue editing the current query, cursor at the end (in characters)
+    s32 cursor = 0;
+    for (char c : m_searchQuery) {
+        cursor += (static_cast<uint8_t>(c) & 0xC0) != 0x80;
+    }
+    swkbdInlineSetInputText(&m_keyboard, m_searchQuery.c_str());
+    swkbdInlineSetCursorPos(&m_keyboard, cursor);
+    
+    SwkbdAppearArg appear;
+    swkbdInlineMakeAppearArg(&appear, SwkbdType_Normal);
+    swkbdInlineAppearArgSetOkButtonText(&appear, "搜索");
+    swkbdInlineAppear(&m_keyboard, &appear);
+    
+    m_keyboardVisible = true;
+    m_searchBarFocused = true;
+}
+
+void SearchScreen::closeKeyboard() {
+    if (!m_keyboardLaunched) return;
+    
+    swkbdInlineClose(&m_keyboard);
+    m_keyboardLaunched = false;
+    m_keyboardVisible = false;
+    m_searchBarFocused = false;
+    if (s_keyboardOwner == this) s_keyboardOwner = nullptr;
+}
+
+void SearchScreen::onKeyboardChanged(const char* text, SwkbdChangedStringArg* arg) {
+    (void)arg;
+    SearchScreen* screen = s_keyboardOwner;
+    if (!screen) return;
+    
+    screen->m_searchQuery = text;
+    screen->m_isSearching = !screen->m_searchQuery.empty();
+    screen->m_session.setQuery(screen->m_searchQuery);
+}
+
+void SearchScreen::onKeyboardEntered(const char* text, SwkbdDecidedEnterArg* arg) {
+    onKeyboardChanged(text, nullptr);
+    (void)arg;
+    
+    SearchScreen* screen = s_keyboardOwner;
+    if (!screen) return;
+    screen->m_keyboardVisible = false;
+    screen->m_searchBarFocused = false;
+}
+
+void SearchScreen::onKeyboardCancelled() {
+    // Keep whatever was typed so far, as the live results already show it
+    SearchScreen* screen = s_keyboardOwner;
+    if (!screen) return;
+    screen->m_keyboardVisible = false;
+    screen->m_searchBarFocused = false;
+}
+
+void SearchScreen::showModalKeyboard() {
     // Initialize swkbd config
     SwkbdConfig kbd;
     Result rc = swkbdCreate(&kbd, 0);
@@ -566,7 +674,7 @@ void SearchScreen::showKeyboard() {
     if (R_SUCCEEDED(rc)) {
         // Configure keyboard
         swkbdConfigMakePresetDefault(&kbd);
-        swkbdConfigSetGuideText(&kbd, "输入搜索关键词");
+        swkbdConfigSetGuideText(&kbd, "输入名称、拼音或首字母");
         swkbdConfigSetInitialText(&kbd, m_searchQuery.c_str());
         swkbdConfigSetStringLenMax(&kbd, 64);
         swkbdConfigSetStringLenMin(&kbd, 0);
@@ -586,6 +694,7 @@ void SearchScreen::showKeyboard() {
                 // Empty query - clear search
                 m_isSearching = false;
                 m_searchResults.clear();
+                m_session.setQuery(m_searchQuery);
             }
         }
         
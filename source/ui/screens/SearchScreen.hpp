@@ -10,8 +10,10 @@
 #include "Screen.hpp"
 #include "core/Renderer.hpp"
 #include "GamesScreen.hpp"  // For GameItem
+#include "store/SearchSession.hpp"
 #include <vector>
 #include <string>
+#include <switch.h>  // For swkbd (software keyboard)
 
 // Forward declarations
 class App;
@@ -37,7 +39,7 @@ public:
     void handleInput(const Input& input) override;
     void update(float deltaTime) override;
     void render(Renderer& renderer) override;
-    
+
 private:
     // -------------------------------------------------------------------------
     // Layout constants (720p base)
@@ -58,8 +60,23 @@ private:
     void renderRecommendations(Renderer& renderer, float yOffset);
     void renderSearchResults(Renderer& renderer, float yOffset);
     void performSearch(const std::string& query);
+    void applySearchResults();  // Copy m_session's results into m_searchResults
     void loadDemoContent();
-    void showKeyboard();  // Show Switch software keyboard
+    
+    // -------------------------------------------------------------------------
+    // Software keyboard. The inline keyboard reports every edit, so results
+    // follow the query as it is typed; if it cannot be launched the modal
+    // keyboard searches once the query is confirmed.
+    // -------------------------------------------------------------------------
+    void showKeyboard();
+    void showModalKeyboard();
+    void closeKeyboard();
+    
+    // swkbd callbacks carry no user data; they go to s_keyboardOwner
+    static void onKeyboardChanged(const char* text, SwkbdChangedStringArg* arg);
+    static void onKeyboardEntered(const char* text, SwkbdDecidedEnterArg* arg);
+    static void onKeyboardCancelled();
+    static SearchScreen* s_keyboardOwner;
     
     // -------------------------------------------------------------------------
     // Private members
@@ -69,6 +86,12 @@ private:
     std::string m_searchQuery;
     bool m_isSearching = false;
     bool m_searchBarFocused = false;
+    SearchSession m_session;
+    
+    // Inline keyboard
+    SwkbdInline m_keyboard;
+    bool m_keyboardLaunched = false;        // Applet running, updated every frame
+    bool m_keyboardVisible = false;         // Shown and taking controller input
     
     // Hot keywords
     std::vector<std::string> m_hotKeywords;
@@ -78,6 +101,7 @@ private:
     
     // Recommendations (shown when no search)
     std::vector<GameItem> m_recommendations;
+    uint32_t m_catalogVersion = 0;          // StoreManager catalog version loaded
     
     // Selection
     int m_selectedTagIndex = -1;
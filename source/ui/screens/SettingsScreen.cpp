@@ -7,6 +7,11 @@
 #include "core/Input.hpp"
 #include "ui/Theme.hpp"
 #include "store/SettingsManager.hpp"
+#include "store/StoreManager.hpp"
+#include "network/HttpCache.hpp"
+#include "network/HttpClient.hpp"
+#include "network/HttpEngine.hpp"
+#include "network/ImageCache.hpp"
 #include <algorithm>
 #include <cmath>
 
@@ -144,10 +149,29 @@ void SettingsScreen::setupSettings() {
     clearCache.subtitle = "释放存储空间";
     clearCache.type = SettingItemType::Action;
     clearCache.onAction = []() {
-        // TODO: Clear cache
+        HttpCache::getInstance().clear();
+        ImageCache::getInstance().clearDiskCache();
     };
     cache.items.push_back(clearCache);
     
+    SettingItem traffic;
+    traffic.id = "network_traffic";
+    traffic.title = "网络流量";
+    traffic.type = SettingItemType::Info;
+    cache.items.push_back(traffic);
+    
+    SettingItem connections;
+    connections.id = "network_connections";
+    connections.title = "连接复用";
+    connections.type = SettingItemType::Info;
+    cache.items.push_back(connections);
+    
+    SettingItem httpCache;
+    httpCache.id = "http_cache";
+    httpCache.title = "接口缓存";
+    httpCache.type = SettingItemType::Info;
+    cache.items.push_back(httpCache);
+    
     m_sections.push_back(cache);
     
     // -------------------------------------------------------------------------
@@ -202,6 +226,31 @@ void SettingsScreen::loadCurrentValues() {
                 item.subtitle = settings.getDownloadDir();
             } else if (item.id == "install_dir") {
                 item.subtitle = settings.getInstallDir();
+            } else if (item.id == "network_traffic") {
+                // Received vs decoded body bytes since startup
+                NetworkStats stats = HttpClient::getStats();
+                item.subtitle = "已接收 " + StoreEntry::formatSize(stats.wireBytes) +
+                                " / 解压后 " + StoreEntry::formatSize(stats.bodyBytes) +
+                                " (" + std::to_string(stats.decodeMicros / 1000) + " ms)";
+            } else if (item.id == "network_connections") {
+                // Requests that skipped the TCP/TLS setup, what a new
+                // connection costs on average, and requests that needed
+                // no transfer of their own
+                NetworkStats stats = HttpClient::getStats();
+                uint64_t setupMs = stats.connectionsOpened > 0
+                    ? stats.connectMicros / stats.connectionsOpened / 1000 : 0;
+                item.subtitle = "复用 " + std::to_string(stats.connectionsReused) +
+                                " / 新建 " + std::to_string(stats.connectionsOpened) +
+                                " (建立平均 " + std::to_string(setupMs) + " ms)" +
+                                " · 合并 " + std::to_string(HttpEngine::getInstance().getCoalescedCount());
+            } else if (item.id == "http_cache") {
+                // API requests answered from the SD card (stale ones and
+                // 304s included), the body bytes that saved, and the size
+                HttpCacheStats stats = HttpCache::getInstance().getStats();
+                item.subtitle = "命中 " + std::to_string(stats.hits + stats.staleHits + stats.revalidated) +
+                                " / 未命中 " + std::to_string(stats.misses - stats.revalidated) +
+                                " · 节省 " + StoreEntry::formatSize(stats.bytesSaved) +
+                                " · 占用 " + StoreEntry::formatSize(stats.bytes);
             }
         }
     }
@@ -175,6 +175,11 @@ void ToolsScreen::handleInput(const Input& input) {
 // =============================================================================
 
 void ToolsScreen::update(float deltaTime) {
+    // Rebuild the list when the store catalog was replaced
+    if (StoreManager::getInstance().getCatalogVersion() != m_catalogVersion) {
+        loadStoreTools();
+    }
+    
     auto& tools = m_showingInstalled ? m_installedTools : m_storeTools;
     
     // Apply scroll velocity
@@ -299,13 +304,17 @@ void ToolsScreen::renderToolItem(Renderer& renderer, const ToolItem& tool,
     renderer.drawText(tool.name, textX, y + 18, 17,
                      theme->textPrimaryColor(), FontWeight::Semibold);
     
-    // Developer/description
-    renderer.drawText(tool.developer.empty() ? tool.description : tool.developer, 
-                     textX, y + 42, 13, theme->textSecondaryColor());
-    
-    // Version and size
+    // Developer/description, then version and size. The lite listing
+    // carries no description, so without a developer the version and
+    // size move up instead of leaving the line blank.
+    const std::string& subtitle = tool.developer.empty() ? tool.description : tool.developer;
     std::string info = tool.version.empty() ? tool.size : ("v" + tool.version + " · " + tool.size);
-    renderer.drawText(info, textX, y + 62, 12, theme->textTertiaryColor());
+    if (subtitle.empty()) {
+        renderer.drawText(info, textX, y + 42, 13, theme->textSecondaryColor());
+    } else {
+        renderer.drawText(subtitle, textX, y + 42, 13, theme->textSecondaryColor());
+        renderer.drawText(info, textX, y + 62, 12, theme->textTertiaryColor());
+    }
     
     // Action button
     float btnX = 1280 - SIDE_PADDING - 70;
@@ -348,20 +357,25 @@ void ToolsScreen::loadStoreTools() {
     // Get tools category entries
     auto entries = store.getEntriesByCategory("tools");
     
+    m_catalogVersion = store.getCatalogVersion();
     m_storeTools.clear();
-    for (const StoreEntry* entry : entries) {
+    for (EntryView entry : entries) {
         ToolItem item;
-        item.id = entry->id;
-        item.name = entry->name;
-        item.developer = entry->developer;
-        item.description = entry->description;
-        item.downloadUrl = entry->downloadUrl;
-        item.version = entry->version;
-        item.size = entry->getFormattedSize();
+        item.id = entry.id();
+        item.name = entry.name();
+        item.developer = entry.developer();
+        item.description = entry.description();     // Empty with the lite listing
+        item.downloadUrl = entry.downloadUrl();
+        item.version = entry.version();
+        item.size = entry.getFormattedSize();
         item.isInstalled = false;  // TODO: Check if installed
         
         m_storeTools.push_back(item);
     }
+    
+    if (!m_showingInstalled && m_selectedIndex >= static_cast<int>(m_storeTools.size())) {
+        m_selectedIndex = 0;
+    }
 }
 
 void ToolsScreen::loadNroTools(Renderer& renderer) {
@@ -65,6 +65,7 @@ private:
     
     // Data
     std::vector<ToolItem> m_storeTools;     // Tools from store
+    uint32_t m_catalogVersion = 0;          // StoreManager catalog version loaded
     std::vector<ToolItem> m_installedTools; // Local NROs
     
     // State
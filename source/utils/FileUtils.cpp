@@ -0,0 +1,89 @@
+// =============================================================================
+// Switch App Store - File Utilities Implementation
+// =============================================================================
+
+#include "FileUtils.hpp"
+#include <cstdio>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace FileUtils {
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+static bool fileExists(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0;
+}
+
+// =============================================================================
+// Read
+// =============================================================================
+
+bool readFile(const std::string& path, std::string& out) {
+    // -------------------------------------------------------------------------
+    // An interrupted save can leave only the temp file behind (the target is
+    // removed before the rename on FAT). It was fully flushed before that
+    // step, so it is safe to promote.
+    // -------------------------------------------------------------------------
+    std::string tempPath = path + ".tmp";
+    if (!fileExists(path) && fileExists(tempPath)) {
+        rename(tempPath.c_str(), path.c_str());
+    }
+    
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+    
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    
+    if (size < 0) {
+        fclose(file);
+        return false;
+    }
+    
+    out.resize(static_cast<size_t>(size));
+    size_t read = size > 0 ? fread(&out[0], 1, out.size(), file) : 0;
+    fclose(file);
+    
+    out.resize(read);
+    return read == static_cast<size_t>(size);
+}
+
+// =============================================================================
+// Write
+// =============================================================================
+
+bool writeFileAtomic(const std::string& path, const std::string& data) {
+    std::string tempPath = path + ".tmp";
+    
+    FILE* file = fopen(tempPath.c_str(), "wb");
+    if (!file) return false;
+    
+    // One large write instead of many small formatted ones
+    setvbuf(file, nullptr, _IONBF, 0);
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = fflush(file) == 0 && ok;
+    ok = fsync(fileno(file)) == 0 && ok;
+    ok = fclose(file) == 0 && ok;
+    
+    if (!ok) {
+        remove(tempPath.c_str());
+        return false;
+    }
+    
+    // -------------------------------------------------------------------------
+    // POSIX rename replaces the target atomically, but the Switch's FAT
+    // driver refuses to rename over an existing file. In that case drop the
+    // old copy first; readFile() recovers from a crash in between.
+    // -------------------------------------------------------------------------
+    if (rename(tempPath.c_str(), path.c_str()) == 0) return true;
+    
+    remove(path.c_str());
+    return rename(tempPath.c_str(), path.c_str()) == 0;
+}
+
+} // namespace FileUtils
@@ -0,0 +1,23 @@
+// =============================================================================
+// Switch App Store - File Utilities
+// =============================================================================
+// Whole-file reads and crash-safe whole-file writes for small state files
+// (config, installed database, settings) on the SD card.
+// =============================================================================
+
+#pragma once
+
+#include <string>
+
+namespace FileUtils {
+
+// Read an entire file into out. If the file is missing but a completed
+// "<path>.tmp" from an interrupted save exists, that copy is restored first.
+bool readFile(const std::string& path, std::string& out);
+
+// Write data to "<path>.tmp" in one sequential write, flush it to the
+// card, then move it over path. A crash at any point leaves either the
+// old or the new contents readable via readFile(), never a torn file.
+bool writeFileAtomic(const std::string& path, const std::string& data);
+
+} // namespace FileUtils
@@ -0,0 +1,119 @@
+// =============================================================================
+// Switch App Store - Host Test Helpers
+// =============================================================================
+// Checks and stand-in server access shared by the tests in tests/. Each test
+// takes the stand-in's base URL (server/tools/standin.js) as its first
+// argument; `make -C tests check` starts one and passes it.
+// =============================================================================
+
+#pragma once
+
+#include "json.hpp"
+#include "network/HttpClient.hpp"
+#include "network/HttpEngine.hpp"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+
+namespace test {
+
+// -----------------------------------------------------------------------------
+// Checks: a failure is printed and counted, the test carries on
+// -----------------------------------------------------------------------------
+inline int& failures() {
+    static int count = 0;
+    return count;
+}
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            test::failures()++; \
+        } \
+    } while (0)
+
+// Print the outcome; the process exit code
+inline int finish(const char* name) {
+    if (failures() == 0) {
+        printf("%s: all checks passed\n", name);
+        return 0;
+    }
+    printf("%s: %d checks failed\n", name, failures());
+    return 1;
+}
+
+// -----------------------------------------------------------------------------
+// Time
+// -----------------------------------------------------------------------------
+using Clock = std::chrono::steady_clock;
+
+inline double millisSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+inline void sleepMs(int millis) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+}
+
+// Pump the engine like the main loop would until done() or the timeout
+inline bool pumpUntil(const std::function<bool()>& done, int timeoutMs = 5000) {
+    HttpEngine& engine = HttpEngine::getInstance();
+    Clock::time_point start = Clock::now();
+    while (!done()) {
+        if (millisSince(start) > timeoutMs) return false;
+        engine.pump();
+        sleepMs(2);
+    }
+    return true;
+}
+
+// Keep pumping for a while (transfers make progress meanwhile)
+inline void pumpFor(int millis) {
+    pumpUntil([]() { return false; }, millis);
+}
+
+// -----------------------------------------------------------------------------
+// The stand-in server
+// -----------------------------------------------------------------------------
+class StandIn {
+public:
+    explicit StandIn(const std::string& baseUrl) : m_baseUrl(baseUrl) {
+        m_options.useCache = false;
+    }
+    
+    std::string url(const std::string& path) const { return m_baseUrl + path; }
+    
+    // Wait for the server to answer (it may still be starting)
+    bool waitUntilUp(int timeoutMs = 5000) {
+        Clock::time_point start = Clock::now();
+        while (!m_client.get(url("/stats"), m_options).isSuccess()) {
+            if (millisSince(start) > timeoutMs) return false;
+            sleepMs(50);
+        }
+        return true;
+    }
+    
+    // Counters from /stats; the request reading them counts itself
+    json::Document stats() {
+        return json::parseDocument(m_client.get(url("/stats"), m_options).body);
+    }
+    
+    int stat(const char* name) { return stats()[name].asInt(0); }
+    
+    void resetStats() { m_client.post(url("/stats/reset"), ""); }
+    
+    // New version of a /cache document; with fail its GETs answer 503
+    void changeDocument(const std::string& name, bool fail = false) {
+        m_client.post(url("/cache/" + name + (fail ? "?fail=1" : "")), "{}");
+    }
+
+private:
+    std::string m_baseUrl;
+    HttpClient m_client;
+    HttpOptions m_options;
+};
+
+} // namespace test
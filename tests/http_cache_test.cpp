@@ -0,0 +1,491 @@
+// =============================================================================
+// Switch App Store - HttpCache Test
+// =============================================================================
+// Drives HttpCache through HttpClient::get and HttpEngine against the
+// stand-in server's /cache documents, and checks what reached the server:
+// fresh hits, 304 revalidation merged into the cached response, the
+// Cache-Control directives, stale-while-revalidate / stale-if-error,
+// invalidation by POST, persistence across init(), the LRU byte budget and
+// damaged files.
+//
+//   usage: http_cache_test <stand-in base URL> <scratch directory>
+// =============================================================================
+
+#include "TestCommon.hpp"
+#include "network/HttpCache.hpp"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+std::string s_directory;
+std::string s_tag;
+
+// Body version of a /cache document
+int version(const HttpResponse& response) {
+    return json::parseDocument(response.body)["version"].asInt(-1);
+}
+
+// A /cache URL unique to this run
+std::string document(test::StandIn& server, const std::string& name, const std::string& query = "") {
+    return server.url("/cache/" + name + s_tag + query);
+}
+
+HttpResponse engineGet(const std::string& url, bool useCache = true) {
+    HttpRequest request;
+    request.url = url;
+    request.options.useCache = useCache;
+    return HttpEngine::getInstance().perform(std::move(request));
+}
+
+// Apply edit to every cached response file
+template <typename Edit>
+void forEachResponseFile(Edit&& edit) {
+    DIR* dir = opendir(s_directory.c_str());
+    if (!dir) return;
+    while (struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".res") == 0) {
+            edit(s_directory + "/" + name);
+        }
+    }
+    closedir(dir);
+}
+
+// -----------------------------------------------------------------------------
+// Fresh responses are answered from disk
+// -----------------------------------------------------------------------------
+void testFreshness(test::StandIn& server, HttpClient& client) {
+    HttpCache& cache = HttpCache::getInstance();
+    std::string url = document(server, "fresh", "?max-age=60&size=2000");
+    int full = server.stat("cacheFull");
+    
+    HttpResponse first = client.get(url);
+    CHECK(first.statusCode == 200 && first.body.size() == 2000);
+    HttpResponse second = client.get(url);
+    CHECK(second.statusCode == 200 && second.body == first.body);
+    CHECK(second.getHeader("etag") == first.getHeader("etag"));
+    CHECK(!second.getHeader("age").empty());
+    CHECK(server.stat("cacheFull") == full + 1);
+    
+    HttpCacheStats stats = cache.getStats();
+    CHECK(stats.hits == 1 && stats.misses == 1 && stats.bytesSaved == 2000);
+    
+    // useCache = false goes to the network
+    HttpOptions options;
+    options.useCache = false;
+    client.get(url, options);
+    CHECK(server.stat("cacheFull") == full + 2);
+    
+    // Freshness guessed from Last-Modified alone (an hour old: 6 minutes)
+    url = document(server, "heuristic", "?etag=0&lm=1");
+    client.get(url);
+    full = server.stat("cacheFull");
+    int notModified = server.stat("cacheNotModified");
+    client.get(url);
+    CHECK(server.stat("cacheFull") == full && server.stat("cacheNotModified") == notModified);
+    
+    // Age already spent counts against max-age
+    url = document(server, "aged", "?max-age=10&age=20");
+    client.get(url);
+    notModified = server.stat("cacheNotModified");
+    client.get(url);
+    CHECK(server.stat("cacheNotModified") == notModified + 1);
+}
+
+// -----------------------------------------------------------------------------
+// Expired responses are revalidated; a 304 is merged into the cached one
+// -----------------------------------------------------------------------------
+void testRevalidation(test::StandIn& server, HttpClient& client) {
+    HttpCache& cache = HttpCache::getInstance();
+    std::string url = document(server, "revalidate", "?max-age=1&size=500");
+    client.get(url);
+    int full = server.stat("cacheFull");
+    int notModified = server.stat("cacheNotModified");
+    uint64_t revalidated = cache.getStats().revalidated;
+    test::sleepMs(2100);
+    
+    HttpResponse response = client.get(url);
+    CHECK(response.statusCode == 200 && response.body.size() == 500 && version(response) == 1);
+    CHECK(server.stat("cacheNotModified") == notModified + 1 && server.stat("cacheFull") == full);
+    CHECK(cache.getStats().revalidated == revalidated + 1);
+    
+    // Fresh again after the 304
+    client.get(url);
+    CHECK(server.stat("cacheNotModified") == notModified + 1 && server.stat("cacheFull") == full);
+    
+    // Changed on the server: the new body
+    server.changeDocument("revalidate" + s_tag);
+    test::sleepMs(1100);
+    response = client.get(url);
+    CHECK(version(response) == 2 && server.stat("cacheFull") == full + 1);
+    
+    // Last-Modified as the only validator
+    url = document(server, "modified", "?max-age=0&etag=0&lm=1");
+    client.get(url);
+    notModified = server.stat("cacheNotModified");
+    response = client.get(url);
+    CHECK(response.statusCode == 200 && version(response) == 1);
+    CHECK(server.stat("cacheNotModified") == notModified + 1);
+}
+
+// -----------------------------------------------------------------------------
+// A cancelled get gives up quickly and leaves the cached copy alone
+// -----------------------------------------------------------------------------
+void testCancel(test::StandIn& server, HttpClient& client) {
+    HttpCache& cache = HttpCache::getInstance();
+    std::string url = document(server, "cancel", "?max-age=0&delay=1000");
+    client.get(url);
+    
+    test::Clock::time_point start = test::Clock::now();
+    HttpResponse response = client.get(url, HttpOptions(), [&]() { return test::millisSince(start) > 200; });
+    double elapsed = test::millisSince(start);
+    CHECK(response.error == "Cancelled" && response.statusCode != 200);
+    CHECK(elapsed < 500);
+    
+    // Still cached: revalidated, not fetched again (counted once the
+    // server has answered the abandoned request too)
+    test::sleepMs(1000);
+    int full = server.stat("cacheFull");
+    int notModified = server.stat("cacheNotModified");
+    response = client.get(url);
+    CHECK(response.statusCode == 200 && version(response) == 1);
+    CHECK(server.stat("cacheNotModified") == notModified + 1 && server.stat("cacheFull") == full);
+    
+    // Not cached before: nothing stored, the next get goes to the network
+    url = document(server, "cancelmiss", "?max-age=60&delay=300");
+    response = client.get(url, HttpOptions(), []() { return true; });
+    CHECK(response.error == "Cancelled" && response.body.empty());
+    uint64_t hits = cache.getStats().hits;
+    response = client.get(url, HttpOptions(), []() { return false; });
+    CHECK(response.statusCode == 200 && version(response) == 1 && cache.getStats().hits == hits);
+    
+    // A check that never fired: stored as usual
+    client.get(url);
+    CHECK(cache.getStats().hits == hits + 1);
+}
+
+// -----------------------------------------------------------------------------
+// no-store, no-cache and Vary
+// -----------------------------------------------------------------------------
+void testDirectives(test::StandIn& server, HttpClient& client) {
+    std::string url = document(server, "nostore", "?max-age=60&nostore=1");
+    client.get(url);
+    int full = server.stat("cacheFull");
+    client.get(url);
+    CHECK(server.stat("cacheFull") == full + 1);
+    
+    // Varies on a header the client may change: not kept
+    url = document(server, "vary", "?max-age=60&vary=User-Agent");
+    client.get(url);
+    full = server.stat("cacheFull");
+    client.get(url);
+    CHECK(server.stat("cacheFull") == full + 1);
+    
+    // Varies on Accept-Encoding only: the client always sends the same one
+    url = document(server, "encoding", "?max-age=60&vary=Accept-Encoding");
+    client.get(url);
+    full = server.stat("cacheFull");
+    client.get(url);
+    CHECK(server.stat("cacheFull") == full);
+    
+    url = document(server, "nocache", "?max-age=60&nocache=1");
+    client.get(url);
+    full = server.stat("cacheFull");
+    int notModified = server.stat("cacheNotModified");
+    HttpResponse response = client.get(url);
+    CHECK(response.statusCode == 200 && version(response) == 1);
+    CHECK(server.stat("cacheNotModified") == notModified + 1 && server.stat("cacheFull") == full);
+}
+
+// -----------------------------------------------------------------------------
+// stale-while-revalidate and stale-if-error
+// -----------------------------------------------------------------------------
+void testStale(test::StandIn& server, HttpClient& client) {
+    HttpCache& cache = HttpCache::getInstance();
+    
+    // The stale copy at once, the new one fetched behind it
+    std::string url = document(server, "swr", "?max-age=1&swr=60&size=300");
+    client.get(url);
+    server.changeDocument("swr" + s_tag);
+    test::sleepMs(2100);
+    int full = server.stat("cacheFull");
+    uint64_t staleHits = cache.getStats().staleHits;
+    HttpResponse response = client.get(url);
+    CHECK(version(response) == 1);
+    CHECK(cache.getStats().staleHits == staleHits + 1);
+    CHECK(test::pumpUntil([&]() { return server.stat("cacheFull") == full + 1; }, 2000));
+    test::sleepMs(50);
+    response = client.get(url);
+    CHECK(version(response) == 2 && server.stat("cacheFull") == full + 1);
+    
+    // ...and when the refresh comes back 304, fresh again without a request
+    // (max-age 2 so the refreshed copy outlasts a slow machine's checks)
+    url = document(server, "swr304", "?max-age=2&swr=60");
+    client.get(url);
+    test::sleepMs(3100);
+    int notModified = server.stat("cacheNotModified");
+    response = client.get(url);
+    CHECK(version(response) == 1);
+    CHECK(test::pumpUntil([&]() { return server.stat("cacheNotModified") == notModified + 1; }, 2000));
+    test::sleepMs(200);
+    full = server.stat("cacheFull");
+    notModified = server.stat("cacheNotModified");
+    response = client.get(url);
+    CHECK(version(response) == 1);
+    CHECK(server.stat("cacheFull") == full && server.stat("cacheNotModified") == notModified);
+    
+    // The server fails: the stale copy, unless must-revalidate forbids it
+    url = document(server, "sie", "?max-age=1&sie=60");
+    client.get(url);
+    server.changeDocument("sie" + s_tag, true);
+    std::string strict = document(server, "must", "?max-age=1&sie=60&must=1");
+    client.get(strict);
+    server.changeDocument("must" + s_tag, true);
+    test::sleepMs(2100);
+    response = client.get(url);
+    CHECK(response.statusCode == 200 && version(response) == 1);
+    response = client.get(strict);
+    CHECK(response.statusCode == 503);
+}
+
+// -----------------------------------------------------------------------------
+// A POST to a URL forgets it
+// -----------------------------------------------------------------------------
+void testInvalidation(test::StandIn& server, HttpClient& client) {
+    std::string url = document(server, "post");
+    client.get(url);
+    int full = server.stat("cacheFull");
+    client.post(url, "{}");
+    HttpResponse response = client.get(url);
+    CHECK(server.stat("cacheFull") == full + 1 && version(response) == 2);
+}
+
+// -----------------------------------------------------------------------------
+// The index survives init(); files it doesn't know are swept
+// -----------------------------------------------------------------------------
+void testPersistence(test::StandIn& server, HttpClient& client) {
+    HttpCache& cache = HttpCache::getInstance();
+    std::string url = document(server, "persist", "?max-age=60&size=1000");
+    client.get(url);
+    cache.flush();
+    HttpCacheStats before = cache.getStats();
+    
+    std::string stray = s_directory + "/ffffffff.res";
+    FILE* file = fopen(stray.c_str(), "w");
+    if (file) {
+        fputs("junk", file);
+        fclose(file);
+    }
+    
+    CHECK(cache.init(s_directory));
+    HttpCacheStats after = cache.getStats();
+    CHECK(after.entries == before.entries && after.bytes == before.bytes);
+    CHECK(access(stray.c_str(), F_OK) != 0);
+    
+    int full = server.stat("cacheFull");
+    int notModified = server.stat("cacheNotModified");
+    HttpResponse response = client.get(url);
+    CHECK(response.body.size() == 1000);
+    CHECK(server.stat("cacheFull") == full && server.stat("cacheNotModified") == notModified);
+    
+    // A damaged file is a miss, not a crash
+    forEachResponseFile([](const std::string& path) {
+        FILE* damaged = fopen(path.c_str(), "a");
+        if (damaged) {
+            fputc('x', damaged);
+            fclose(damaged);
+        }
+    });
+    full = server.stat("cacheFull");
+    response = client.get(url);
+    CHECK(response.statusCode == 200 && response.body.size() == 1000);
+    CHECK(server.stat("cacheFull") == full + 1);
+}
+
+// -----------------------------------------------------------------------------
+// Least recently used entries make way under the byte budget
+// -----------------------------------------------------------------------------
+void testBudget(test::StandIn& server, HttpClient& client) {
+    HttpCache& cache = HttpCache::getInstance();
+    const size_t BUDGET = 64 * 1024;
+    CHECK(cache.init(s_directory, BUDGET));
+    cache.clear();
+    
+    auto entry = [&](int i) { return document(server, "lru" + std::to_string(i) + "-", "?max-age=60&size=7000"); };
+    for (int i = 0; i < 20; i++) {
+        client.get(entry(i));
+        if (i > 0) client.get(entry(0));    // Keep 0 in use
+    }
+    HttpCacheStats stats = cache.getStats();
+    CHECK(stats.bytes <= BUDGET && stats.evictions > 0);
+    
+    int full = server.stat("cacheFull");
+    client.get(entry(0));
+    CHECK(server.stat("cacheFull") == full);
+    client.get(entry(1));
+    CHECK(server.stat("cacheFull") == full + 1);
+    
+    // Larger than budget / MAX_ENTRY_FRACTION: not stored
+    std::string big = document(server, "big", "?max-age=60&size=20000");
+    client.get(big);
+    full = server.stat("cacheFull");
+    client.get(big);
+    CHECK(server.stat("cacheFull") == full + 1);
+    
+    CHECK(cache.init(s_directory));
+}
+
+// -----------------------------------------------------------------------------
+// Several threads reading and storing at once
+// -----------------------------------------------------------------------------
+void testThreads(test::StandIn& server) {
+    HttpCache::getInstance().clear();
+    int failed = 0;
+    std::mutex failedMutex;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&]() {
+            HttpClient client;
+            for (int i = 0; i < 200; i++) {
+                std::string url = document(server, "thread" + std::to_string(i % 10) + "-",
+                                           "?max-age=60&swr=5&size=1000");
+                HttpResponse response = client.get(url);
+                if (response.statusCode != 200 || response.body.size() != 1000) {
+                    std::lock_guard<std::mutex> lock(failedMutex);
+                    failed++;
+                    break;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+    CHECK(failed == 0);
+}
+
+// -----------------------------------------------------------------------------
+// HttpEngine's buffered GETs use the same cache
+// -----------------------------------------------------------------------------
+void testEngine(test::StandIn& server, HttpClient& client) {
+    HttpEngine& engine = HttpEngine::getInstance();
+    HttpCache& cache = HttpCache::getInstance();
+    
+    // Fresh hits through perform() and submit(), shared with HttpClient
+    std::string url = document(server, "engine", "?max-age=60&size=1000");
+    int full = server.stat("cacheFull");
+    HttpResponse response = engineGet(url);
+    CHECK(response.statusCode == 200 && response.body.size() == 1000);
+    response = engineGet(url);
+    CHECK(response.statusCode == 200 && response.body.size() == 1000);
+    CHECK(server.stat("cacheFull") == full + 1);
+    
+    bool done = false;
+    HttpRequest submitted;
+    submitted.url = url;
+    submitted.onComplete = [&](const HttpResponse& answer) {
+        CHECK(answer.statusCode == 200 && answer.body.size() == 1000);
+        done = true;
+    };
+    engine.submit(std::move(submitted));
+    CHECK(test::pumpUntil([&]() { return done; }));
+    response = client.get(url);
+    CHECK(response.body.size() == 1000);
+    CHECK(server.stat("cacheFull") == full + 1);
+    
+    engineGet(url, false);
+    CHECK(server.stat("cacheFull") == full + 2);
+    
+    // 304
+    url = document(server, "engine304", "?max-age=0");
+    engineGet(url);
+    full = server.stat("cacheFull");
+    int notModified = server.stat("cacheNotModified");
+    response = engineGet(url);
+    CHECK(response.statusCode == 200 && version(response) == 1);
+    CHECK(server.stat("cacheNotModified") == notModified + 1 && server.stat("cacheFull") == full);
+    
+    // An engine POST invalidates its URL
+    url = document(server, "enginepost");
+    engineGet(url);
+    full = server.stat("cacheFull");
+    HttpRequest post;
+    post.url = url;
+    post.method = HttpMethod::Post;
+    post.body = "{}";
+    CHECK(engine.perform(std::move(post)).isSuccess());
+    response = engineGet(url);
+    CHECK(server.stat("cacheFull") == full + 1 && version(response) == 2);
+    
+    // Evicted while its 304 is on the way: asked again in full
+    url = document(server, "engineevict", "?max-age=0&delay=300");
+    engineGet(url);
+    full = server.stat("cacheFull");
+    notModified = server.stat("cacheNotModified");
+    done = false;
+    HttpRequest evicted;
+    evicted.url = url;
+    evicted.onComplete = [&](const HttpResponse& answer) {
+        CHECK(answer.statusCode == 200 && version(answer) == 1);
+        done = true;
+    };
+    engine.submit(std::move(evicted));
+    test::sleepMs(100);
+    cache.clear();
+    CHECK(test::pumpUntil([&]() { return done; }));
+    CHECK(server.stat("cacheNotModified") == notModified + 1 && server.stat("cacheFull") == full + 1);
+    
+    // Coalesced misses are stored once
+    url = document(server, "enginecoalesce", "?max-age=60&delay=100");
+    full = server.stat("cacheFull");
+    int answered = 0;
+    for (int i = 0; i < 5; i++) {
+        HttpRequest request;
+        request.url = url;
+        request.onComplete = [&](const HttpResponse& answer) { answered += answer.statusCode == 200; };
+        engine.submit(std::move(request));
+    }
+    CHECK(test::pumpUntil([&]() { return answered == 5; }));
+    CHECK(server.stat("cacheFull") == full + 1);
+    engineGet(url);
+    CHECK(server.stat("cacheFull") == full + 1);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        printf("usage: http_cache_test <stand-in base URL> <scratch directory>\n");
+        return 1;
+    }
+    s_directory = std::string(argv[2]) + "/http-cache";
+    s_tag = std::to_string(time(nullptr));
+    
+    HttpClient::init();
+    HttpEngine::getInstance().start();
+    HttpCache& cache = HttpCache::getInstance();
+    CHECK(cache.init(s_directory));
+    cache.clear();
+    {
+        test::StandIn server(argv[1]);
+        if (!server.waitUntilUp()) {
+            printf("no stand-in server at %s\n", argv[1]);
+            return 1;
+        }
+        HttpClient client;
+        testFreshness(server, client);
+        testRevalidation(server, client);
+        testDirectives(server, client);
+        testStale(server, client);
+        testInvalidation(server, client);
+        testCancel(server, client);
+        testPersistence(server, client);
+        testBudget(server, client);
+        testThreads(server);
+        testEngine(server, client);
+    }
+    HttpEngine::getInstance().stop();
+    cache.flush();
+    HttpClient::cleanup();
+    return test::finish("http_cache_test");
+}
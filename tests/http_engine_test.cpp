@@ -0,0 +1,379 @@
+// =============================================================================
+// Switch App Store - HttpEngine Test
+// =============================================================================
+// Drives HttpEngine against the stand-in server: concurrent transfers,
+// completion delivery through pump(), cancellation (before, during and from
+// inside another completion), perform(), file downloads, coalescing of
+// identical GETs and stop() with transfers in flight.
+//
+//   usage: http_engine_test <stand-in base URL> <scratch directory>
+// =============================================================================
+
+#include "TestCommon.hpp"
+#include <sys/stat.h>
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// Transfers run side by side and complete on the pumping thread
+// -----------------------------------------------------------------------------
+void testConcurrentTransfers(test::StandIn& server) {
+    HttpEngine& engine = HttpEngine::getInstance();
+    const int COUNT = 32;
+    const size_t SIZE = 1 << 20;
+    std::thread::id mainThread = std::this_thread::get_id();
+    int done = 0;
+    size_t received = 0;
+    for (int i = 0; i < COUNT; i++) {
+        HttpRequest request;
+        request.url = server.url("/bytes/" + std::to_string(SIZE));
+        request.onComplete = [&](const HttpResponse& response) {
+            CHECK(response.isSuccess());
+            CHECK(std::this_thread::get_id() == mainThread);
+            received += response.body.size();
+            done++;
+        };
+        CHECK(engine.submit(std::move(request)) != 0);
+    }
+    CHECK(test::pumpUntil([&]() { return done == COUNT; }, 20000));
+    CHECK(received == COUNT * SIZE);
+    CHECK(engine.getActiveCount() == 0);
+    
+    // 32 x 50 ms of server latency overlap instead of adding up
+    done = 0;
+    test::Clock::time_point start = test::Clock::now();
+    for (int i = 0; i < COUNT; i++) {
+        HttpRequest request;
+        request.url = server.url("/delay/50?n=" + std::to_string(i));
+        request.onComplete = [&](const HttpResponse& response) {
+            CHECK(response.isSuccess());
+            done++;
+        };
+        engine.submit(std::move(request));
+    }
+    CHECK(test::pumpUntil([&]() { return done == COUNT; }));
+    CHECK(test::millisSince(start) < COUNT * 50 / 2);
+}
+
+// -----------------------------------------------------------------------------
+// Cancellation
+// -----------------------------------------------------------------------------
+void testCancel(test::StandIn& server) {
+    HttpEngine& engine = HttpEngine::getInstance();
+    
+    // Mid-body: progress stops, the server sees the abort, no completion
+    server.resetStats();
+    {
+        bool completed = false;
+        int progressCalls = 0;
+        size_t lastProgress = 0;
+        HttpRequest request;
+        request.url = server.url("/bytes/10000000?rate=1000000");
+        request.onProgress = [&](size_t downloaded, size_t /* total */) {
+            progressCalls++;
+            lastProgress = downloaded;
+        };
+        request.onComplete = [&](const HttpResponse&) { completed = true; };
+        HttpHandle handle = engine.submit(std::move(request));
+        test::pumpFor(500);
+        engine.cancel(handle);
+        
+        CHECK(test::pumpUntil([&]() { return server.stat("aborted") == 1; }, 2000));
+        test::pumpFor(100);
+        CHECK(!completed);
+        CHECK(progressCalls > 5);
+        CHECK(lastProgress > 200000 && lastProgress < 1000000);
+        CHECK(engine.getActiveCount() == 0);
+    }
+    
+    // Finished but not yet delivered: never delivered
+    {
+        bool completed = false;
+        HttpRequest request;
+        request.url = server.url("/bytes/10");
+        request.onComplete = [&](const HttpResponse&) { completed = true; };
+        HttpHandle handle = engine.submit(std::move(request));
+        test::sleepMs(100);
+        engine.cancel(handle);
+        engine.pump();
+        CHECK(!completed);
+        CHECK(engine.getActiveCount() == 0);
+    }
+    
+    // From inside another completion delivered by the same pump()
+    {
+        bool secondCompleted = false;
+        HttpHandle second = 0;
+        HttpRequest first;
+        first.url = server.url("/bytes/10");
+        first.onComplete = [&](const HttpResponse&) { engine.cancel(second); };
+        HttpRequest other;
+        other.url = server.url("/bytes/11");
+        other.onComplete = [&](const HttpResponse&) { secondCompleted = true; };
+        engine.submit(std::move(first));
+        second = engine.submit(std::move(other));
+        test::sleepMs(100);
+        engine.pump();
+        CHECK(!secondCompleted);
+        CHECK(engine.getActiveCount() == 0);
+    }
+    
+    // Unknown handles are ignored
+    engine.cancel(0);
+    engine.cancel(999999);
+}
+
+// -----------------------------------------------------------------------------
+// perform(), file downloads and errors
+// -----------------------------------------------------------------------------
+void testPerform(test::StandIn& server, const std::string& scratch) {
+    HttpEngine& engine = HttpEngine::getInstance();
+    
+    HttpRequest post;
+    post.url = server.url("/echo");
+    post.method = HttpMethod::Post;
+    post.body = "{\"a\":1}";
+    HttpResponse response = engine.perform(std::move(post));
+    json::Document echo = json::parseDocument(response.body);
+    CHECK(response.isSuccess());
+    CHECK(echo["method"].asString() == "POST");
+    CHECK(echo["body"].asString() == "{\"a\":1}");
+    CHECK(echo["headers"]["content-type"].asString() == "application/json");
+    CHECK(echo["headers"]["accept-encoding"].asString() == "gzip, deflate");
+    
+    // To a file, which a failed download removes again
+    std::string path = scratch + "/download.bin";
+    struct stat info;
+    HttpRequest download;
+    download.url = server.url("/bytes/300000");
+    download.outputPath = path;
+    response = engine.perform(std::move(download));
+    CHECK(response.isSuccess());
+    CHECK(stat(path.c_str(), &info) == 0 && info.st_size == 300000);
+    
+    HttpRequest missing;
+    missing.url = server.url("/status/404");
+    missing.outputPath = path;
+    response = engine.perform(std::move(missing));
+    CHECK(response.statusCode == 404);
+    CHECK(stat(path.c_str(), &info) != 0);
+    
+    HttpRequest unwritable;
+    unwritable.url = server.url("/bytes/1");
+    unwritable.outputPath = scratch + "/no-such-directory/file.bin";
+    response = engine.perform(std::move(unwritable));
+    CHECK(!response.error.empty());
+    
+    HttpRequest refused;
+    refused.url = "http://127.0.0.1:1/";
+    response = engine.perform(std::move(refused));
+    CHECK(!response.error.empty());
+    CHECK(!response.isSuccess());
+}
+
+// -----------------------------------------------------------------------------
+// Identical GETs share one transfer
+// -----------------------------------------------------------------------------
+void testCoalescing(test::StandIn& server) {
+    HttpEngine& engine = HttpEngine::getInstance();
+    
+    server.resetStats();
+    {
+        uint64_t coalesced = engine.getCoalescedCount();
+        int done = 0;
+        int progressCalls = 0;
+        bool same = true;
+        std::string first;
+        for (int i = 0; i < 20; i++) {
+            HttpRequest request;
+            request.url = server.url("/bytes/300000?rate=3000000");
+            request.onProgress = [&](size_t, size_t) { progressCalls++; };
+            request.onComplete = [&](const HttpResponse& response) {
+                CHECK(response.isSuccess());
+                if (first.empty()) first = response.body;
+                else same = same && response.body == first;
+                done++;
+            };
+            engine.submit(std::move(request));
+        }
+        CHECK(test::pumpUntil([&]() { return done == 20; }));
+        CHECK(same && first.size() == 300000);
+        CHECK(progressCalls >= 20);
+        CHECK(engine.getCoalescedCount() == coalesced + 19);
+        CHECK(server.stat("requests") == 2);
+    }
+    
+    // Other headers, no compression, POST or streaming: each its own
+    server.resetStats();
+    {
+        uint64_t coalesced = engine.getCoalescedCount();
+        int done = 0;
+        HttpRequest plain;
+        plain.url = server.url("/delay/50");
+        plain.onComplete = [&](const HttpResponse&) { done++; };
+        HttpRequest headers = plain;
+        headers.options.headers["X-Test"] = "1";
+        HttpRequest uncompressed = plain;
+        uncompressed.options.acceptCompressed = false;
+        HttpRequest post = plain;
+        post.method = HttpMethod::Post;
+        HttpRequest streamed = plain;
+        streamed.onData = [](const char*, size_t) { return true; };
+        for (HttpRequest* request : {&plain, &headers, &uncompressed, &post, &streamed}) {
+            engine.submit(*request);
+        }
+        CHECK(test::pumpUntil([&]() { return done == 5; }));
+        CHECK(engine.getCoalescedCount() == coalesced);
+        CHECK(server.stat("requests") == 6);
+    }
+    
+    // Cancelling the first requester leaves the transfer to the others
+    server.resetStats();
+    {
+        int done = 0;
+        bool leaderCompleted = false;
+        HttpRequest leader;
+        leader.url = server.url("/delay/150");
+        leader.onComplete = [&](const HttpResponse&) { leaderCompleted = true; };
+        HttpHandle handle = engine.submit(leader);
+        HttpRequest follower;
+        follower.url = leader.url;
+        follower.onComplete = [&](const HttpResponse& response) {
+            CHECK(response.isSuccess() && response.body.find("150") != std::string::npos);
+            done++;
+        };
+        engine.submit(follower);
+        engine.submit(follower);
+        test::sleepMs(30);
+        engine.cancel(handle);
+        CHECK(test::pumpUntil([&]() { return done == 2; }));
+        CHECK(!leaderCompleted);
+        json::Document stats = server.stats();
+        CHECK(stats["requests"].asInt() == 2);
+        CHECK(stats["aborted"].asInt() == 0);
+    }
+    
+    // Cancelling every requester aborts it; the next one starts afresh
+    server.resetStats();
+    {
+        bool completed = false;
+        HttpRequest request;
+        request.url = server.url("/bytes/5000000?rate=500000");
+        request.onComplete = [&](const HttpResponse&) { completed = true; };
+        HttpHandle first = engine.submit(request);
+        HttpHandle second = engine.submit(request);
+        HttpHandle third = engine.submit(request);
+        test::sleepMs(200);
+        engine.cancel(second);
+        engine.cancel(first);
+        test::sleepMs(150);
+        CHECK(server.stat("aborted") == 0);
+        engine.cancel(third);
+        CHECK(test::pumpUntil([&]() { return server.stat("aborted") == 1; }, 2000));
+        CHECK(!completed);
+        CHECK(engine.getActiveCount() == 0);
+        
+        int done = 0;
+        HttpRequest next;
+        next.url = server.url("/bytes/100");
+        next.onComplete = [&](const HttpResponse& response) {
+            CHECK(response.body.size() == 100);
+            done++;
+        };
+        engine.submit(std::move(next));
+        CHECK(test::pumpUntil([&]() { return done == 1; }));
+    }
+    
+    // perform() joins a submitted transfer
+    server.resetStats();
+    {
+        int done = 0;
+        HttpRequest submitted;
+        submitted.url = server.url("/delay/120");
+        submitted.onComplete = [&](const HttpResponse&) { done++; };
+        engine.submit(std::move(submitted));
+        HttpResponse response;
+        std::thread waiter([&]() {
+            HttpRequest performed;
+            performed.url = server.url("/delay/120");
+            response = engine.perform(std::move(performed));
+        });
+        waiter.join();
+        CHECK(test::pumpUntil([&]() { return done == 1; }));
+        CHECK(response.isSuccess() && response.body.find("120") != std::string::npos);
+        CHECK(server.stat("requests") == 2);
+    }
+    
+    // A follower cancelled from the leader's completion isn't delivered
+    {
+        bool followerCompleted = false;
+        HttpHandle follower = 0;
+        HttpRequest leader;
+        leader.url = server.url("/delay/40");
+        leader.onComplete = [&](const HttpResponse&) { engine.cancel(follower); };
+        HttpRequest other;
+        other.url = leader.url;
+        other.onComplete = [&](const HttpResponse&) { followerCompleted = true; };
+        engine.submit(std::move(leader));
+        follower = engine.submit(std::move(other));
+        test::sleepMs(150);
+        engine.pump();
+        CHECK(!followerCompleted);
+        CHECK(engine.getActiveCount() == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// stop() with work in flight: prompt, and no callbacks afterwards
+// -----------------------------------------------------------------------------
+void testStop(test::StandIn& server) {
+    HttpEngine& engine = HttpEngine::getInstance();
+    
+    bool completed = false;
+    HttpRequest slow;
+    slow.url = server.url("/bytes/10000000?rate=100000");
+    slow.onComplete = [&](const HttpResponse&) { completed = true; };
+    engine.submit(std::move(slow));
+    
+    HttpRequest joined;
+    joined.url = server.url("/delay/2000");
+    engine.submit(joined);
+    HttpResponse response;
+    std::thread waiter([&]() { response = engine.perform(joined); });
+    test::sleepMs(100);
+    
+    test::Clock::time_point start = test::Clock::now();
+    engine.stop();
+    waiter.join();
+    CHECK(test::millisSince(start) < 1000);
+    CHECK(response.error == "Cancelled");
+    engine.pump();
+    CHECK(!completed);
+    CHECK(engine.submit(HttpRequest()) == 0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        printf("usage: http_engine_test <stand-in base URL> <scratch directory>\n");
+        return 1;
+    }
+    HttpClient::init();
+    HttpEngine& engine = HttpEngine::getInstance();
+    CHECK(engine.start());
+    {
+        test::StandIn server(argv[1]);
+        if (!server.waitUntilUp()) {
+            printf("no stand-in server at %s\n", argv[1]);
+            return 1;
+        }
+        testConcurrentTransfers(server);
+        testCancel(server);
+        testPerform(server, argv[2]);
+        testCoalescing(server);
+        testStop(server);
+    }
+    HttpClient::cleanup();
+    return test::finish("http_engine_test");
+}
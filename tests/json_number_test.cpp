@@ -0,0 +1,147 @@
+// =============================================================================
+// Switch App Store - JSON Number Test
+// =============================================================================
+// json::detail::parseNumber against the RFC 8259 grammar and strtod: exact
+// 64-bit integers, signed zero, overflow to infinity and underflow to zero,
+// and random doubles that must convert bit for bit like strtod. Needs no
+// server; the arguments `make check` passes are ignored.
+//
+//   usage: json_number_test
+// =============================================================================
+
+#include "TestCommon.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+namespace {
+
+bool parses(const char* text, json::Number& number) {
+    const char* end = text + strlen(text);
+    return json::detail::parseNumber(text, end, number) == end;
+}
+
+bool parses(const char* text) {
+    json::Number number;
+    return parses(text, number);
+}
+
+// Parses to exactly this double, sign of zero included
+bool parsesTo(const char* text, double expected) {
+    json::Number number;
+    if (!parses(text, number)) return false;
+    double value = number.toDouble();
+    return std::memcmp(&value, &expected, sizeof(double)) == 0;
+}
+
+// -----------------------------------------------------------------------------
+// Grammar
+// -----------------------------------------------------------------------------
+void testGrammar() {
+    for (const char* text : {"0", "-0", "1", "-1", "0.5", "1e5", "1E+5", "1e-5", "-0.0e0",
+                             "123456789012345678901234567890", "1.7976931348623157e308", "5e-324",
+                             "1e400", "1e-400"}) {
+        if (!parses(text)) printf("rejected %s\n", text);
+        CHECK(parses(text));
+    }
+    for (const char* text : {"", "-", "01", "1.", "1.e5", ".5", "+1", "1e", "1e+", "--1", "0x10",
+                             "1.5.3", "00"}) {
+        if (parses(text)) printf("accepted %s\n", text);
+        CHECK(!parses(text));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Integers that fit 64 bits stay exact
+// -----------------------------------------------------------------------------
+void testIntegers() {
+    json::Number number;
+    CHECK(parses("9007199254740993", number) && number.kind == json::Number::Kind::Int64 &&
+          number.int64 == 9007199254740993LL);
+    CHECK(parses("9223372036854775807", number) && number.int64 == INT64_MAX);
+    CHECK(parses("-9223372036854775808", number) && number.int64 == INT64_MIN);
+    CHECK(parses("18446744073709551615", number) && number.kind == json::Number::Kind::UInt64 &&
+          number.uint64 == UINT64_MAX);
+    CHECK(parses("18446744073709551616", number) && number.kind == json::Number::Kind::Double &&
+          number.real == 18446744073709551616.0);
+}
+
+// -----------------------------------------------------------------------------
+// Out of range: too large is infinite, too small is a zero of the same sign
+// -----------------------------------------------------------------------------
+void testRange() {
+    CHECK(parsesTo("-0", -0.0));
+    CHECK(parsesTo("-0.0e0", -0.0));
+    CHECK(parsesTo("5e-324", 5e-324));
+    CHECK(parsesTo("1.7976931348623157e308", 1.7976931348623157e308));
+    
+    CHECK(parsesTo("1e400", HUGE_VAL));
+    CHECK(parsesTo("-1e400", -HUGE_VAL));
+    CHECK(parsesTo("1.8e308", HUGE_VAL));
+    CHECK(parsesTo("123456789e301", HUGE_VAL));
+    CHECK(parsesTo("1e99999999999999999999", HUGE_VAL));
+    
+    CHECK(parsesTo("1e-400", 0.0));
+    CHECK(parsesTo("-1e-400", -0.0));
+    CHECK(parsesTo("2e-324", 0.0));
+    CHECK(parsesTo("0.00001e-320", 0.0));
+    CHECK(parsesTo("-1234.5e-330", -0.0));
+    CHECK(parsesTo("1e-99999999999999999999", 0.0));
+    
+    // Whole documents, the way the parsers see them
+    json::Document document = json::parseDocument(std::string("[1e-400, -1e-400, 1e400, -1e400]"));
+    CHECK(document[0].asNumber(1.0) == 0.0 && !std::signbit(document[0].asNumber(1.0)));
+    CHECK(document[1].asNumber(1.0) == 0.0 && std::signbit(document[1].asNumber(1.0)));
+    CHECK(document[2].asNumber() == HUGE_VAL);
+    CHECK(document[3].asNumber() == -HUGE_VAL);
+    json::Value value = json::parse(std::string("[1e-400, -1e-400]"));
+    CHECK(value[0].asNumber(1.0) == 0.0 && std::signbit(value[1].asNumber(1.0)));
+}
+
+// -----------------------------------------------------------------------------
+// Random doubles convert exactly like strtod
+// -----------------------------------------------------------------------------
+void testRoundTrip() {
+    std::mt19937_64 random(1);
+    char buffer[64];
+    int mismatches = 0;
+    for (int i = 0; i < 500000; i++) {
+        double value;
+        switch (random() % 4) {
+            case 0: value = static_cast<double>(random() % 100000) / 100; break;
+            case 1: value = std::ldexp(static_cast<double>(random() >> 11), static_cast<int>(random() % 200) - 100); break;
+            case 2: {
+                uint64_t bits = random();
+                std::memcpy(&value, &bits, sizeof(value));
+                if (!std::isfinite(value)) continue;
+                break;
+            }
+            default: value = static_cast<double>(random() % 1000000000) * 1e-3; break;
+        }
+        int precision = static_cast<int>(random() % 18) + 1;
+        snprintf(buffer, sizeof(buffer), random() % 2 ? "%.*g" : "%.*e", precision, value);
+        
+        json::Number number;
+        if (!parses(buffer, number)) {
+            if (mismatches++ < 5) printf("rejected %s\n", buffer);
+            continue;
+        }
+        double expected = strtod(buffer, nullptr);
+        double parsed = number.toDouble();
+        if (number.isInteger() ? parsed != expected : std::memcmp(&parsed, &expected, sizeof(double)) != 0) {
+            if (mismatches++ < 5) printf("%s: %.17g, strtod %.17g\n", buffer, parsed, expected);
+        }
+    }
+    CHECK(mismatches == 0);
+}
+
+} // namespace
+
+int main() {
+    testGrammar();
+    testIntegers();
+    testRange();
+    testRoundTrip();
+    return test::finish("json_number_test");
+}